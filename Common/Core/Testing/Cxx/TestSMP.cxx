@@ -7,6 +7,7 @@
 #include "vtkSMPThreadLocal.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include <atomic>
 #include <cstdlib>
 #include <deque>
 #include <functional>
@@ -480,6 +481,63 @@ int doTestSMP()
       return EXIT_FAILURE;
     }
   }
+
+  // Test cancellation: the first grain sets the flag, the remaining ones
+  // (and the loops nested in the running ones) must be skipped.
+  std::atomic<vtkTypeBool> cancel(0);
+  std::atomic<int> executedGrains(0);
+  std::atomic<int> nestedGrains(0);
+  std::atomic<bool> notCancelled(false);
+  {
+    vtkSMPTools::CancellationScope cancellation(cancel);
+    vtkSMPTools::For(0, Target, 1, [&](vtkIdType, vtkIdType) {
+      ++executedGrains;
+      cancel = 1;
+      if (!vtkSMPTools::IsCancelled())
+      {
+        notCancelled = true;
+      }
+      vtkSMPTools::For(0, 10, 1, [&](vtkIdType, vtkIdType) { ++nestedGrains; });
+    });
+  }
+  if (notCancelled)
+  {
+    cerr << "Error: vtkSMPTools::IsCancelled() should be true in a cancelled loop!" << endl;
+    return EXIT_FAILURE;
+  }
+  if (executedGrains < 1 || executedGrains >= Target || nestedGrains != 0)
+  {
+    cerr << "Error: Invalid number of executed grains for a cancelled vtkSMPTools::For: "
+         << executedGrains << " grains, " << nestedGrains << " nested grains!" << endl;
+    return EXIT_FAILURE;
+  }
+  if (vtkSMPTools::IsCancelled())
+  {
+    cerr << "Error: vtkSMPTools::IsCancelled() should be false out of a CancellationScope!"
+         << endl;
+    return EXIT_FAILURE;
+  }
+  executedGrains = 0;
+  vtkSMPTools::For(0, Target, 1, [&](vtkIdType, vtkIdType) { ++executedGrains; });
+  if (executedGrains != Target)
+  {
+    cerr << "Error: vtkSMPTools::For should not be cancelled out of a CancellationScope!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // A null flag makes the loops of a cancelled scope uncancellable.
+  executedGrains = 0;
+  {
+    vtkSMPTools::CancellationScope cancellation(cancel);
+    vtkSMPTools::CancellationScope uncancellable(nullptr);
+    vtkSMPTools::For(0, Target, 1, [&](vtkIdType, vtkIdType) { ++executedGrains; });
+  }
+  if (executedGrains != Target)
+  {
+    cerr << "Error: vtkSMPTools::For should not be cancelled in a null CancellationScope!"
+         << endl;
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
 
@@ -341,6 +341,8 @@ struct ComputeScalarRange
     unsigned char ghostsToSkip)
   {
     AllValuesMinAndMax<NumComps, ArrayT> minmax(array, ghosts, ghostsToSkip);
+    // The arrays cache their ranges, so these loops are not cancelled.
+    vtkSMPTools::CancellationScope uncancellable(nullptr);
     vtkSMPTools::For(0, array->GetNumberOfTuples(), minmax);
     minmax.CopyRanges(ranges);
     return true;
@@ -350,6 +352,7 @@ struct ComputeScalarRange
     unsigned char ghostsToSkip)
   {
     FiniteMinAndMax<NumComps, ArrayT> minmax(array, ghosts, ghostsToSkip);
+    vtkSMPTools::CancellationScope uncancellable(nullptr);
     vtkSMPTools::For(0, array->GetNumberOfTuples(), minmax);
     minmax.CopyRanges(ranges);
     return true;
@@ -494,6 +497,7 @@ bool GenericComputeScalarRange(ArrayT* array, RangeValueType* ranges, AllValues,
   const unsigned char* ghosts, unsigned char ghostsToSkip)
 {
   AllValuesGenericMinAndMax<ArrayT> minmax(array, ghosts, ghostsToSkip);
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(0, array->GetNumberOfTuples(), minmax);
   minmax.CopyRanges(ranges);
   return true;
@@ -504,6 +508,7 @@ bool GenericComputeScalarRange(ArrayT* array, RangeValueType* ranges, FiniteValu
   const unsigned char* ghosts, unsigned char ghostsToSkip)
 {
   FiniteGenericMinAndMax<ArrayT> minmax(array, ghosts, ghostsToSkip);
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(0, array->GetNumberOfTuples(), minmax);
   minmax.CopyRanges(ranges);
   return true;
@@ -593,6 +598,7 @@ bool DoComputeVectorRange(ArrayT* array, RangeValueType range[2], AllValues,
   // give precision errors on large 64-bit ints, but magnitudes aren't usually
   // computed for those.
   MagnitudeAllValuesMinAndMax<ArrayT, double> MinAndMax(array, ghosts, ghostsToSkip);
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(0, numTuples, MinAndMax);
   MinAndMax.CopyRanges(range);
   return true;
@@ -618,6 +624,7 @@ bool DoComputeVectorRange(ArrayT* array, RangeValueType range[2], FiniteValues,
   // give precision errors on large 64-bit ints, but magnitudes aren't usually
   // computed for those.
   MagnitudeFiniteMinAndMax<ArrayT, double> MinAndMax(array, ghosts, ghostsToSkip);
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(0, numTuples, MinAndMax);
   MinAndMax.CopyRanges(range);
   return true;
@@ -48,6 +48,8 @@ struct DeepCopyWorker
       worker.nComp = src->GetNumberOfComponents();
       // High granularity is likely to hurt performance too, so limit calls. 16 is about maximal.
       int numThreads = std::min(vtkSMPTools::GetEstimatedNumberOfThreads(), 16);
+      // A copy must be complete even if the calling filter is aborted.
+      vtkSMPTools::CancellationScope uncancellable(nullptr);
       vtkSMPTools::For(0, len, len / numThreads, worker);
     }
   }
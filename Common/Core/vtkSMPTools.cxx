@@ -5,8 +5,55 @@
 
 #include "vtkSMP.h"
 
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+#if defined(_WIN32)
 //------------------------------------------------------------------------------
+const std::atomic<vtkTypeBool>*& vtkSMPTools_CancellationFlag()
+{
+  static VTK_THREAD_LOCAL const std::atomic<vtkTypeBool>* flag = nullptr;
+  return flag;
+}
+#endif
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
+
 VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+vtkSMPTools::CancellationScope::CancellationScope(const std::atomic<vtkTypeBool>& flag)
+  : Previous(vtk::detail::smp::vtkSMPTools_CancellationFlag())
+{
+  vtk::detail::smp::vtkSMPTools_CancellationFlag() = &flag;
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTools::CancellationScope::CancellationScope(const std::atomic<vtkTypeBool>* flag)
+  : Previous(vtk::detail::smp::vtkSMPTools_CancellationFlag())
+{
+  vtk::detail::smp::vtkSMPTools_CancellationFlag() = flag;
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTools::CancellationScope::~CancellationScope()
+{
+  vtk::detail::smp::vtkSMPTools_CancellationFlag() = this->Previous;
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPTools::IsCancelled()
+{
+  const std::atomic<vtkTypeBool>* flag = vtk::detail::smp::vtkSMPTools_CancellationFlag();
+  return flag && *flag;
+}
+
+//------------------------------------------------------------------------------
 const char* vtkSMPTools::GetBackend()
 {
   auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
@@ -24,6 +24,7 @@
 #include "SMP/Common/vtkSMPToolsAPI.h"
 #include "vtkSMPThreadLocal.h" // For Initialized
 
+#include <atomic>      // For std::atomic
 #include <functional>  // For std::function
 #include <type_traits> // For std:::enable_if
 
@@ -35,6 +36,57 @@ namespace detail
 namespace smp
 {
 VTK_ABI_NAMESPACE_BEGIN
+/**
+ * Flag of the innermost vtkSMPTools::CancellationScope of the calling thread,
+ * or nullptr. Thread local variables cannot be exported from DLLs, so the
+ * accessor is only inlined where the dynamic linker merges the variable of
+ * all the libraries into a single instance.
+ */
+#if defined(_WIN32)
+VTKCOMMONCORE_EXPORT const std::atomic<vtkTypeBool>*& vtkSMPTools_CancellationFlag();
+#else
+VTKCOMMONCORE_EXPORT inline const std::atomic<vtkTypeBool>*& vtkSMPTools_CancellationFlag()
+{
+  static VTK_THREAD_LOCAL const std::atomic<vtkTypeBool>* flag = nullptr;
+  return flag;
+}
+#endif
+
+/**
+ * Cancellation flag of a parallel for, captured on the calling thread, and
+ * made current on the threads executing its grains so that nested loops are
+ * cancelled too.
+ */
+class vtkSMPTools_Cancellation
+{
+public:
+  vtkSMPTools_Cancellation()
+    : Flag(vtkSMPTools_CancellationFlag())
+  {
+  }
+  bool IsCancellable() const { return this->Flag != nullptr; }
+  bool IsCancelled() const { return this->Flag && *this->Flag; }
+
+  class Scope
+  {
+  public:
+    Scope(const vtkSMPTools_Cancellation& cancellation)
+      : Previous(vtkSMPTools_CancellationFlag())
+    {
+      vtkSMPTools_CancellationFlag() = cancellation.Flag;
+    }
+    ~Scope() { vtkSMPTools_CancellationFlag() = this->Previous; }
+
+  private:
+    Scope(const Scope&) = delete;
+    void operator=(const Scope&) = delete;
+    const std::atomic<vtkTypeBool>* Previous;
+  };
+
+private:
+  const std::atomic<vtkTypeBool>* Flag;
+};
+
 template <typename T>
 class vtkSMPTools_Has_Initialize
 {
@@ -78,11 +130,26 @@ template <typename Functor>
 struct vtkSMPTools_FunctorInternal<Functor, false>
 {
   Functor& F;
+  vtkSMPTools_Cancellation Cancellation;
   vtkSMPTools_FunctorInternal(Functor& f)
     : F(f)
   {
   }
-  void Execute(vtkIdType first, vtkIdType last) { this->F(first, last); }
+  void Execute(vtkIdType first, vtkIdType last)
+  {
+    // Loops out of any CancellationScope pay nothing for cancellation.
+    if (!this->Cancellation.IsCancellable())
+    {
+      this->F(first, last);
+      return;
+    }
+    if (this->Cancellation.IsCancelled())
+    {
+      return;
+    }
+    vtkSMPTools_Cancellation::Scope scope(this->Cancellation);
+    this->F(first, last);
+  }
   void For(vtkIdType first, vtkIdType last, vtkIdType grain)
   {
     auto& SMPToolsAPI = vtkSMPToolsAPI::GetInstance();
@@ -98,12 +165,27 @@ struct vtkSMPTools_FunctorInternal<Functor, true>
 {
   Functor& F;
   vtkSMPThreadLocal<unsigned char> Initialized;
+  vtkSMPTools_Cancellation Cancellation;
   vtkSMPTools_FunctorInternal(Functor& f)
     : F(f)
     , Initialized(0)
   {
   }
   void Execute(vtkIdType first, vtkIdType last)
+  {
+    if (!this->Cancellation.IsCancellable())
+    {
+      this->ExecuteGrain(first, last);
+      return;
+    }
+    if (this->Cancellation.IsCancelled())
+    {
+      return;
+    }
+    vtkSMPTools_Cancellation::Scope scope(this->Cancellation);
+    this->ExecuteGrain(first, last);
+  }
+  void ExecuteGrain(vtkIdType first, vtkIdType last)
   {
     unsigned char& inited = this->Initialized.Local();
     if (!inited)
@@ -367,6 +449,51 @@ public:
   }
   ///@}
 
+#if !defined(__WRAP__)
+  /**
+   * Cooperative cancellation of the parallel loops. While a CancellationScope
+   * is alive, the For() loops invoked from the thread that created it, and
+   * the loops nested in them, stop executing their grains as soon as the
+   * flag is set: the grains being executed complete, the remaining ones are
+   * skipped. The caller is then responsible for discarding the partial
+   * results. The executive creates a scope on the AbortExecute flag of the
+   * algorithms enabling vtkAlgorithm::CancellableExecution, which call
+   * CheckAbort() after each loop:
+   *
+   * \code
+   * vtkSMPTools::For(0, n, worker);
+   * if (this->CheckAbort())
+   * {
+   *   return 1;
+   * }
+   * \endcode
+   *
+   * Scopes can be nested; the innermost one applies. A scope created with a
+   * null flag makes the loops not cancellable: library code opens one around
+   * the loops whose results are cached, such as data array ranges or locator
+   * builds, so that aborting a filter never leaves them incomplete. Loops
+   * executed out of any scope, or in a null one, pay nothing for cancellation.
+   */
+  class VTKCOMMONCORE_EXPORT CancellationScope
+  {
+  public:
+    CancellationScope(const std::atomic<vtkTypeBool>& flag);
+    CancellationScope(const std::atomic<vtkTypeBool>* flag);
+    ~CancellationScope();
+
+  private:
+    CancellationScope(const CancellationScope&) = delete;
+    void operator=(const CancellationScope&) = delete;
+    const std::atomic<vtkTypeBool>* Previous;
+  };
+#endif
+
+  /**
+   * Return true if the flag of the innermost CancellationScope of the calling
+   * thread is set, i.e., if the enclosing loops are being cancelled.
+   */
+  static bool IsCancelled();
+
   /**
    * Get the backend in use.
    */
@@ -15,14 +15,17 @@
  * thread with the status of its associated task.
  *
  * All public methods of this class are thread safe.
+ *
+ * @note This class was part of VTK::ParallelCore until VTK 9.3, which depends on
+ * VTK::CommonCore, so code using it through that module is not affected.
  */
 
 #ifndef vtkThreadedCallbackQueue_h
 #define vtkThreadedCallbackQueue_h
 
+#include "vtkCommonCoreModule.h" // For export macro
 #include "vtkObject.h"
-#include "vtkParallelCoreModule.h" // For export macro
-#include "vtkSmartPointer.h"       // For vtkSmartPointer
+#include "vtkSmartPointer.h"     // For vtkSmartPointer
 
 #include <atomic>             // For atomic_bool
 #include <condition_variable> // For condition variable
@@ -39,7 +42,7 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 
-class VTKPARALLELCORE_EXPORT vtkThreadedCallbackQueue : public vtkObject
+class VTKCOMMONCORE_EXPORT vtkThreadedCallbackQueue : public vtkObject
 {
 private:
   /**
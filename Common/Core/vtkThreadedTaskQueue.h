@@ -34,6 +34,8 @@
  * progress. Also, if `strict_ordering` is true, this is ignored; the
  * buffer_size will be set to unlimited.
  *
+ * @note This class was part of VTK::ParallelCore until VTK 9.3, which depends on
+ * VTK::CommonCore, so code using it through that module is not affected.
  */
 
 #ifndef vtkThreadedTaskQueue_h
@@ -0,0 +1,231 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Move the points of a mesh and check that the cell locators are refit
+// instead of rebuilt since the cells did not change, and that they answer
+// queries like locators built from scratch. Then modify the cells and check
+// that the locators are rebuilt, and move the cells out of the bounds of the
+// locators, which only vtkStaticCellLocator rebuilds.
+
+#include "vtkCellArray.h"
+#include "vtkCellTreeLocator.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkStaticCellLocator.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+const int Resolution = 50;
+
+// Locator counting its full builds, to tell a refit from a rebuild.
+template <typename LocatorT>
+class CountingLocator : public LocatorT
+{
+public:
+  static CountingLocator* New() { VTK_STANDARD_NEW_BODY(CountingLocator); }
+
+  int NumberOfBuilds = 0;
+
+protected:
+  void BuildLocatorInternal() override
+  {
+    ++this->NumberOfBuilds;
+    this->LocatorT::BuildLocatorInternal();
+  }
+};
+
+// Triangulated grid of the unit square in the z = 0 plane. The diagonal of
+// the quads goes one way or the other depending on flip.
+void MakeCells(vtkPolyData* grid, bool flip)
+{
+  vtkNew<vtkCellArray> polys;
+  const int res = ::Resolution;
+  for (int j = 0; j < res; ++j)
+  {
+    for (int i = 0; i < res; ++i)
+    {
+      vtkIdType p0 = j * (res + 1) + i;
+      vtkIdType p1 = p0 + 1, p2 = p0 + res + 2, p3 = p0 + res + 1;
+      vtkIdType tri0[3] = { p0, p1, flip ? p3 : p2 };
+      vtkIdType tri1[3] = { flip ? p1 : p0, p2, p3 };
+      polys->InsertNextCell(3, tri0);
+      polys->InsertNextCell(3, tri1);
+    }
+  }
+  grid->SetPolys(polys);
+}
+
+// Move the points of the grid in place with a smooth displacement, which
+// keeps the boundary of the grid, and a translation along x.
+void MovePoints(vtkPoints* points, double amplitude, double shift = 0.0)
+{
+  const int res = ::Resolution;
+  for (int j = 0; j <= res; ++j)
+  {
+    for (int i = 0; i <= res; ++i)
+    {
+      const double x = static_cast<double>(i) / res;
+      const double y = static_cast<double>(j) / res;
+      const double dx = amplitude * std::sin(vtkMath::Pi() * y) * std::sin(vtkMath::Pi() * x);
+      const double dy = amplitude * std::sin(2.0 * vtkMath::Pi() * x) * y * (1.0 - y);
+      points->SetPoint(j * (res + 1) + i, x + dx + shift, y + dy, 0.0);
+    }
+  }
+  points->Modified();
+}
+
+void RandomPoints(vtkDoubleArray* points, vtkIdType numPts, double z0, double z1, int seed)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(seed);
+  points->SetNumberOfComponents(3);
+  points->SetNumberOfTuples(numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    double x[3];
+    x[0] = random->GetNextRangeValue(-0.1, 1.1);
+    x[1] = random->GetNextRangeValue(-0.1, 1.1);
+    x[2] = random->GetNextRangeValue(z0, z1);
+    points->SetTypedTuple(ptId, x);
+  }
+}
+
+// Compare the locator with a locator of the same type built from scratch.
+bool CompareWithNewLocator(vtkAbstractCellLocator* locator, vtkPolyData* grid, const char* step)
+{
+  const char* name = locator->GetClassName();
+  vtkSmartPointer<vtkAbstractCellLocator> reference =
+    vtkSmartPointer<vtkAbstractCellLocator>::Take(locator->NewInstance());
+  reference->SetDataSet(grid);
+  reference->BuildLocator();
+
+  const vtkIdType numQueries = 2000;
+  vtkNew<vtkDoubleArray> points;
+  ::RandomPoints(points, numQueries, 0.0, 0.0, 4217);
+  vtkNew<vtkDoubleArray> above;
+  ::RandomPoints(above, numQueries, 0.5, 1.0, 8311);
+  vtkNew<vtkDoubleArray> below;
+  ::RandomPoints(below, numQueries, -1.0, -0.5, 1629);
+
+  // The locator is updated by the query.
+  vtkNew<vtkIdTypeArray> cellIds[2];
+  locator->FindCells(points, 0.0, cellIds[0], nullptr);
+  reference->FindCells(points, 0.0, cellIds[1], nullptr);
+  vtkIdType numFound = 0;
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    if (cellIds[0]->GetValue(i) != cellIds[1]->GetValue(i))
+    {
+      std::cerr << name << " (" << step << "): FindCells query " << i << " found cell "
+                << cellIds[0]->GetValue(i) << " instead of " << cellIds[1]->GetValue(i) << "."
+                << std::endl;
+      return false;
+    }
+    numFound += (cellIds[0]->GetValue(i) >= 0);
+  }
+  if (numFound == 0)
+  {
+    std::cerr << name << " (" << step << "): no cell found." << std::endl;
+    return false;
+  }
+
+  vtkNew<vtkDoubleArray> t[2];
+  locator->IntersectWithLines(above, below, 0.0, t[0], nullptr, cellIds[0]);
+  reference->IntersectWithLines(above, below, 0.0, t[1], nullptr, cellIds[1]);
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    if (cellIds[0]->GetValue(i) != cellIds[1]->GetValue(i) ||
+      std::abs(t[0]->GetValue(i) - t[1]->GetValue(i)) > 1e-12)
+    {
+      std::cerr << name << " (" << step << "): IntersectWithLines query " << i << " differs."
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Check the number of full builds of the locator since it was created.
+template <typename LocatorT>
+bool CheckBuilds(CountingLocator<LocatorT>* locator, int numBuilds, const char* step)
+{
+  if (locator->NumberOfBuilds != numBuilds)
+  {
+    std::cerr << locator->GetClassName() << " (" << step << "): built "
+              << locator->NumberOfBuilds << " times instead of " << numBuilds << "." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// vtkStaticCellLocator is only refit if the cells stay in the bounds of its
+// bins, so refitOutOfBounds tells whether moving the cells out of the initial
+// bounds must be refit.
+template <typename LocatorT>
+bool TestRefit(CountingLocator<LocatorT>* locator, bool refitOutOfBounds)
+{
+  vtkNew<vtkPolyData> grid;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints((::Resolution + 1) * (::Resolution + 1));
+  ::MovePoints(points, 0.0);
+  grid->SetPoints(points);
+  ::MakeCells(grid, false);
+
+  locator->SetDataSet(grid);
+  locator->BuildLocator();
+  bool success = ::CompareWithNewLocator(locator, grid, "initial");
+  success &= ::CheckBuilds(locator, 1, "initial");
+
+  // The larger displacements move cells of vtkStaticCellLocator to other
+  // bins.
+  const double amplitudes[] = { 0.0, 0.002, 0.005, 0.15, 0.1 };
+  for (double amplitude : amplitudes)
+  {
+    ::MovePoints(points, amplitude);
+    success &= ::CompareWithNewLocator(locator, grid, "moved points");
+    success &= ::CheckBuilds(locator, 1, "moved points");
+  }
+
+  // Modifying the cells must rebuild the locator.
+  int numBuilds = locator->NumberOfBuilds;
+  ::MakeCells(grid, true);
+  success &= ::CompareWithNewLocator(locator, grid, "new cells");
+  success &= ::CheckBuilds(locator, ++numBuilds, "new cells");
+
+  ::MovePoints(points, 0.05);
+  success &= ::CompareWithNewLocator(locator, grid, "moved points with new cells");
+  success &= ::CheckBuilds(locator, numBuilds, "moved points with new cells");
+
+  ::MovePoints(points, 0.05, 0.5);
+  success &= ::CompareWithNewLocator(locator, grid, "points out of bounds");
+  success &= ::CheckBuilds(
+    locator, refitOutOfBounds ? numBuilds : numBuilds + 1, "points out of bounds");
+  return success;
+}
+}
+
+int TestCellLocatorRefit(int, char*[])
+{
+  bool success = true;
+
+  vtkNew<::CountingLocator<vtkCellTreeLocator>> cellTreeLocator;
+  success &= ::TestRefit(cellTreeLocator.GetPointer(), true);
+  vtkNew<::CountingLocator<vtkCellTreeLocator>> cellTreeLocatorNoCache;
+  cellTreeLocatorNoCache->CacheCellBoundsOff();
+  success &= ::TestRefit(cellTreeLocatorNoCache.GetPointer(), true);
+  vtkNew<::CountingLocator<vtkStaticCellLocator>> staticCellLocator;
+  success &= ::TestRefit(staticCellLocator.GetPointer(), false);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,368 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the batched queries of the cell and point locators give the same
+// results as the corresponding single point queries, and that the ray queries
+// of the locators walking their bins give the same results whether they are
+// batched, called serially or called concurrently.
+
+#include "vtkCellArray.h"
+#include "vtkCellLocator.h"
+#include "vtkCellTreeLocator.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointLocator.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticCellLocator.h"
+#include "vtkStaticPointLocator.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+// Triangulated grid of the unit square in the z = 0 plane.
+void MakeGrid(vtkPolyData* grid, int res)
+{
+  vtkNew<vtkPoints> points;
+  for (int j = 0; j <= res; ++j)
+  {
+    for (int i = 0; i <= res; ++i)
+    {
+      points->InsertNextPoint(static_cast<double>(i) / res, static_cast<double>(j) / res, 0.0);
+    }
+  }
+  vtkNew<vtkCellArray> polys;
+  for (int j = 0; j < res; ++j)
+  {
+    for (int i = 0; i < res; ++i)
+    {
+      vtkIdType p0 = j * (res + 1) + i;
+      vtkIdType tri0[3] = { p0, p0 + 1, p0 + res + 2 };
+      vtkIdType tri1[3] = { p0, p0 + res + 2, p0 + res + 1 };
+      polys->InsertNextCell(3, tri0);
+      polys->InsertNextCell(3, tri1);
+    }
+  }
+  grid->SetPoints(points);
+  grid->SetPolys(polys);
+}
+
+void RandomPoints(vtkDoubleArray* points, vtkIdType numPts, double z0, double z1)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(4217);
+  points->SetNumberOfComponents(3);
+  points->SetNumberOfTuples(numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    double x[3];
+    x[0] = random->GetNextRangeValue(-0.1, 1.1);
+    x[1] = random->GetNextRangeValue(-0.1, 1.1);
+    x[2] = random->GetNextRangeValue(z0, z1);
+    points->SetTypedTuple(ptId, x);
+  }
+}
+
+bool TestCellLocator(vtkAbstractCellLocator* locator, vtkPolyData* grid)
+{
+  const char* name = locator->GetClassName();
+  locator->SetDataSet(grid);
+  locator->BuildLocator();
+
+  const vtkIdType numQueries = 2000;
+  vtkNew<vtkDoubleArray> points;
+  ::RandomPoints(points, numQueries, 0.0, 0.0);
+  vtkNew<vtkDoubleArray> above;
+  ::RandomPoints(above, numQueries, 0.5, 1.0);
+  vtkNew<vtkDoubleArray> below;
+  ::RandomPoints(below, numQueries, -1.0, -0.5);
+
+  vtkNew<vtkGenericCell> cell;
+  std::vector<double> weights(grid->GetMaxCellSize());
+  double x[3], pcoords[3], closest[3], dist2, t;
+  int subId;
+  vtkIdType cellId;
+
+  // FindCells
+  vtkNew<vtkIdTypeArray> cellIds;
+  vtkNew<vtkDoubleArray> pcoordsArray;
+  locator->FindCells(points, 0.0, cellIds, pcoordsArray);
+  if (cellIds->GetNumberOfTuples() != numQueries || pcoordsArray->GetNumberOfTuples() != numQueries)
+  {
+    std::cerr << name << "::FindCells: wrong number of results." << std::endl;
+    return false;
+  }
+  vtkIdType numFound = 0;
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    points->GetTypedTuple(i, x);
+    cellId = locator->FindCell(x, 0.0, cell, subId, pcoords, weights.data());
+    if (cellId != cellIds->GetValue(i))
+    {
+      std::cerr << name << "::FindCells: query " << i << " found cell " << cellIds->GetValue(i)
+                << " instead of " << cellId << "." << std::endl;
+      return false;
+    }
+    numFound += (cellId >= 0);
+  }
+  if (numFound == 0)
+  {
+    std::cerr << name << "::FindCells: no cell found." << std::endl;
+    return false;
+  }
+
+  // FindClosestPoints
+  if (locator->IsA("vtkCellTreeLocator"))
+  {
+    // vtkCellTreeLocator does not support closest point queries.
+  }
+  else
+  {
+    vtkNew<vtkDoubleArray> closestPoints;
+    vtkNew<vtkDoubleArray> dist2Array;
+    locator->FindClosestPoints(above, closestPoints, cellIds, dist2Array);
+    for (vtkIdType i = 0; i < numQueries; ++i)
+    {
+      above->GetTypedTuple(i, x);
+      locator->FindClosestPoint(x, closest, cell, cellId, subId, dist2);
+      if (dist2 != dist2Array->GetValue(i))
+      {
+        std::cerr << name << "::FindClosestPoints: query " << i << " differs." << std::endl;
+        return false;
+      }
+    }
+  }
+
+  // IntersectWithLines
+  vtkNew<vtkDoubleArray> tArray;
+  vtkNew<vtkDoubleArray> xArray;
+  locator->IntersectWithLines(above, below, 0.0, tArray, xArray, cellIds);
+  numFound = 0;
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    double p1[3], p2[3];
+    above->GetTypedTuple(i, p1);
+    below->GetTypedTuple(i, p2);
+    cellId = -1;
+    int hit = locator->IntersectWithLine(p1, p2, 0.0, t, x, pcoords, subId, cellId, cell);
+    if ((hit ? cellId : -1) != cellIds->GetValue(i) || (hit && t != tArray->GetValue(i)))
+    {
+      std::cerr << name << "::IntersectWithLines: query " << i << " differs." << std::endl;
+      return false;
+    }
+    numFound += hit;
+  }
+  if (numFound == 0)
+  {
+    std::cerr << name << "::IntersectWithLines: no intersection found." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Stack of tilted triangulated layers, so that oblique rays cross many bins
+// and cells before hitting a cell.
+void MakeLayers(vtkPolyData* layers, int res, int numLayers)
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkCellArray> polys;
+  for (int layer = 0; layer < numLayers; ++layer)
+  {
+    const vtkIdType offset = points->GetNumberOfPoints();
+    for (int j = 0; j <= res; ++j)
+    {
+      for (int i = 0; i <= res; ++i)
+      {
+        const double x = static_cast<double>(i) / res;
+        const double y = static_cast<double>(j) / res;
+        points->InsertNextPoint(x, y, 0.2 * layer + 0.1 * x - 0.05 * y);
+      }
+    }
+    for (int j = 0; j < res; ++j)
+    {
+      for (int i = 0; i < res; ++i)
+      {
+        vtkIdType p0 = offset + j * (res + 1) + i;
+        vtkIdType tri0[3] = { p0, p0 + 1, p0 + res + 2 };
+        vtkIdType tri1[3] = { p0, p0 + res + 2, p0 + res + 1 };
+        polys->InsertNextCell(3, tri0);
+        polys->InsertNextCell(3, tri1);
+      }
+    }
+  }
+  layers->SetPoints(points);
+  layers->SetPolys(polys);
+}
+
+struct RayHit
+{
+  int Hit;
+  vtkIdType CellId;
+  double T;
+  double X[3];
+};
+
+bool TestRayQueries(vtkAbstractCellLocator* locator, vtkPolyData* layers)
+{
+  const char* name = locator->GetClassName();
+  locator->SetDataSet(layers);
+  locator->BuildLocator();
+
+  const vtkIdType numQueries = 5000;
+  vtkNew<vtkDoubleArray> p1;
+  ::RandomPoints(p1, numQueries, 1.2, 1.5);
+  vtkNew<vtkDoubleArray> p2;
+  ::RandomPoints(p2, numQueries, -0.5, -0.2);
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    // Make the rays oblique.
+    p2->SetTypedComponent(i, 0, 1.0 - p2->GetTypedComponent(i, 0));
+  }
+
+  vtkNew<vtkDoubleArray> tArray;
+  vtkNew<vtkDoubleArray> xArray;
+  vtkNew<vtkIdTypeArray> cellIds;
+  locator->IntersectWithLines(p1, p2, 0.0, tArray, xArray, cellIds);
+
+  // Single ray queries, serially then concurrently.
+  std::vector<RayHit> serial(numQueries);
+  std::vector<RayHit> concurrent(numQueries);
+  for (auto* hits : { &serial, &concurrent })
+  {
+    auto query = [&](vtkIdType begin, vtkIdType end) {
+      vtkNew<vtkGenericCell> cell;
+      double a0[3], a1[3], pcoords[3];
+      int subId;
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        RayHit& hit = (*hits)[i];
+        p1->GetTypedTuple(i, a0);
+        p2->GetTypedTuple(i, a1);
+        hit.CellId = -1;
+        hit.Hit =
+          locator->IntersectWithLine(a0, a1, 0.0, hit.T, hit.X, pcoords, subId, hit.CellId, cell);
+      }
+    };
+    if (hits == &serial)
+    {
+      query(0, numQueries);
+    }
+    else
+    {
+      vtkSMPTools::For(0, numQueries, 100, query);
+    }
+  }
+
+  vtkIdType numHits = 0;
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    const RayHit& hit = serial[i];
+    const RayHit& other = concurrent[i];
+    double x[3];
+    xArray->GetTypedTuple(i, x);
+    if ((hit.Hit ? hit.CellId : -1) != cellIds->GetValue(i) ||
+      (hit.Hit && (hit.T != tArray->GetValue(i) || x[0] != hit.X[0] || x[1] != hit.X[1] ||
+                    x[2] != hit.X[2])))
+    {
+      std::cerr << name << ": batched ray " << i << " differs from the single ray query."
+                << std::endl;
+      return false;
+    }
+    if (hit.Hit != other.Hit || (hit.Hit && (hit.CellId != other.CellId || hit.T != other.T)))
+    {
+      std::cerr << name << ": concurrent ray " << i << " differs from the serial query."
+                << std::endl;
+      return false;
+    }
+    numHits += (hit.Hit != 0);
+  }
+  if (numHits == 0 || numHits == numQueries)
+  {
+    std::cerr << name << ": unexpected number of hits " << numHits << "." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestPointLocator(vtkAbstractPointLocator* locator, vtkPolyData* grid)
+{
+  const char* name = locator->GetClassName();
+  locator->SetDataSet(grid);
+  locator->BuildLocator();
+
+  const vtkIdType numQueries = 2000;
+  const int N = 5;
+  vtkNew<vtkDoubleArray> points;
+  ::RandomPoints(points, numQueries, -0.1, 0.1);
+
+  vtkNew<vtkIdTypeArray> closestIds;
+  locator->FindClosestPoints(points, closestIds);
+  vtkNew<vtkIdTypeArray> closestNIds;
+  locator->FindClosestPoints(N, points, closestNIds);
+  if (closestIds->GetNumberOfTuples() != numQueries ||
+    closestNIds->GetNumberOfTuples() != numQueries || closestNIds->GetNumberOfComponents() != N)
+  {
+    std::cerr << name << "::FindClosestPoints: wrong number of results." << std::endl;
+    return false;
+  }
+
+  vtkNew<vtkIdList> result;
+  double x[3];
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    points->GetTypedTuple(i, x);
+    if (locator->FindClosestPoint(x) != closestIds->GetValue(i))
+    {
+      std::cerr << name << "::FindClosestPoints: query " << i << " differs." << std::endl;
+      return false;
+    }
+    locator->FindClosestNPoints(N, x, result);
+    for (int k = 0; k < N; ++k)
+    {
+      if (result->GetId(k) != closestNIds->GetTypedComponent(i, k))
+      {
+        std::cerr << name << "::FindClosestPoints(N): query " << i << " differs." << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestLocatorBatchQueries(int, char*[])
+{
+  vtkNew<vtkPolyData> grid;
+  ::MakeGrid(grid, 60);
+
+  bool success = true;
+
+  vtkNew<vtkStaticCellLocator> staticCellLocator;
+  success &= ::TestCellLocator(staticCellLocator, grid);
+  vtkNew<vtkCellTreeLocator> cellTreeLocator;
+  success &= ::TestCellLocator(cellTreeLocator, grid);
+  vtkNew<vtkCellLocator> cellLocator;
+  success &= ::TestCellLocator(cellLocator, grid);
+
+  vtkNew<vtkPolyData> layers;
+  ::MakeLayers(layers, 40, 5);
+  vtkNew<vtkStaticCellLocator> staticCellRayLocator;
+  success &= ::TestRayQueries(staticCellRayLocator, layers);
+  vtkNew<vtkCellLocator> cellRayLocator;
+  success &= ::TestRayQueries(cellRayLocator, layers);
+
+  vtkNew<vtkStaticPointLocator> staticPointLocator;
+  success &= ::TestPointLocator(staticPointLocator, grid);
+  vtkNew<vtkPointLocator> pointLocator;
+  success &= ::TestPointLocator(pointLocator, grid);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -4,6 +4,7 @@
 #include "vtkAbstractCellLocator.h"
 
 #include "vtkCellArray.h"
+#include "vtkCellLocatorBatchQueries.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkGenericCell.h"
@@ -14,8 +15,11 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkSMPTools.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkAbstractCellLocator::vtkAbstractCellLocator()
@@ -27,6 +31,7 @@ vtkAbstractCellLocator::vtkAbstractCellLocator()
   this->RetainCellLists = 1;
   this->NumberOfCellsPerNode = 32;
   this->UseExistingSearchStructure = 0;
+  this->RefitSearchStructure = 1;
 }
 
 //------------------------------------------------------------------------------
@@ -52,6 +57,8 @@ bool vtkAbstractCellLocator::StoreCellBounds()
   // side effects from GetCellBounds().
   this->DataSet->GetCellBounds(0, &this->CellBounds[0]);
 
+  // Cached cell bounds must be complete, so this loop is not cancelled.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(1, numCells, [&](vtkIdType begin, vtkIdType end) {
     for (vtkIdType cellId = begin; cellId < end; cellId++)
     {
@@ -90,6 +97,54 @@ void vtkAbstractCellLocator::UpdateInternalWeights()
   this->WeightsTime.Modified();
 }
 
+//------------------------------------------------------------------------------
+bool vtkAbstractCellLocator::CanRefitSearchStructure()
+{
+  return this->RefitSearchStructure && this->DataSet && this->BuildTime > this->MTime &&
+    this->BuildTime > this->GetDataSetCellsMTime();
+}
+
+//------------------------------------------------------------------------------
+namespace
+{
+vtkMTimeType GetCellArrayMTime(vtkCellArray* cells)
+{
+  if (!cells)
+  {
+    return 0;
+  }
+  // Cells may be modified through the offsets and connectivity arrays
+  // without modifying the cell array itself.
+  vtkMTimeType mtime = cells->GetMTime();
+  mtime = std::max(mtime, cells->GetOffsetsArray()->GetMTime());
+  return std::max(mtime, cells->GetConnectivityArray()->GetMTime());
+}
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkAbstractCellLocator::GetDataSetCellsMTime()
+{
+  if (auto polyData = vtkPolyData::SafeDownCast(this->DataSet))
+  {
+    vtkMTimeType mtime = ::GetCellArrayMTime(polyData->GetVerts());
+    mtime = std::max(mtime, ::GetCellArrayMTime(polyData->GetLines()));
+    mtime = std::max(mtime, ::GetCellArrayMTime(polyData->GetPolys()));
+    return std::max(mtime, ::GetCellArrayMTime(polyData->GetStrips()));
+  }
+  if (auto unstructuredGrid = vtkUnstructuredGrid::SafeDownCast(this->DataSet))
+  {
+    vtkMTimeType mtime = ::GetCellArrayMTime(unstructuredGrid->GetCells());
+    mtime = std::max(mtime, ::GetCellArrayMTime(unstructuredGrid->GetPolyhedronFaces()));
+    mtime = std::max(mtime, ::GetCellArrayMTime(unstructuredGrid->GetPolyhedronFaceLocations()));
+    if (auto types = unstructuredGrid->GetCellTypesArray())
+    {
+      mtime = std::max(mtime, types->GetMTime());
+    }
+    return mtime;
+  }
+  return this->DataSet ? this->DataSet->GetMTime() : 0;
+}
+
 //------------------------------------------------------------------------------
 bool vtkAbstractCellLocator::IsInBounds(const double bounds[6], const double x[3], double tol)
 {
@@ -258,6 +313,51 @@ vtkIdType vtkAbstractCellLocator::FindCell(
   return returnVal;
 }
 
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::FindCells(
+  vtkDataArray* points, double tol2, vtkIdTypeArray* cellIds, vtkDoubleArray* pcoords)
+{
+  this->BuildLocator();
+  if (!vtkCellLocatorBatchQueries::FindCells(this->DataSet, points, cellIds, pcoords,
+        [this, tol2](double x[3], vtkGenericCell* cell, int& subId, double pc[3],
+          double* weights) { return this->FindCell(x, tol2, cell, subId, pc, weights); }))
+  {
+    vtkErrorMacro(<< "FindCells requires query points with 3 components and a cellIds array.");
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::FindClosestPoints(vtkDataArray* points,
+  vtkDoubleArray* closestPoints, vtkIdTypeArray* cellIds, vtkDoubleArray* dist2)
+{
+  this->BuildLocator();
+  if (!vtkCellLocatorBatchQueries::FindClosestPoints(points, closestPoints, cellIds, dist2,
+        [this](const double x[3], double closestPoint[3], vtkGenericCell* cell,
+          vtkIdType& cellId, int& subId, double& d2) {
+          this->FindClosestPoint(x, closestPoint, cell, cellId, subId, d2);
+        }))
+  {
+    vtkErrorMacro(<< "FindClosestPoints requires query points with 3 components, "
+                  << "a closestPoints and a cellIds array.");
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::IntersectWithLines(vtkDataArray* p1, vtkDataArray* p2, double tol,
+  vtkDoubleArray* t, vtkDoubleArray* x, vtkIdTypeArray* cellIds)
+{
+  this->BuildLocator();
+  if (!vtkCellLocatorBatchQueries::IntersectWithLines(p1, p2, t, x, cellIds,
+        [this, tol](const double a0[3], const double a1[3], double& tHit, double xHit[3],
+          double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) {
+          return this->IntersectWithLine(a0, a1, tol, tHit, xHit, pcoords, subId, cellId, cell);
+        }))
+  {
+    vtkErrorMacro(<< "IntersectWithLines requires end points with 3 components and the same "
+                  << "number of tuples, a t and a cellIds array.");
+  }
+}
+
 //------------------------------------------------------------------------------
 bool vtkAbstractCellLocator::InsideCellBounds(double x[3], vtkIdType cell_ID)
 {
@@ -293,5 +393,6 @@ void vtkAbstractCellLocator::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Cache Cell Bounds: " << this->CacheCellBounds << "\n";
   os << indent << "Retain Cell Lists: " << (this->RetainCellLists ? "On\n" : "Off\n");
   os << indent << "Number of Cells Per Bucket: " << this->NumberOfCellsPerNode << "\n";
+  os << indent << "Refit Search Structure: " << (this->RefitSearchStructure ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -34,8 +34,11 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
+class vtkDataArray;
+class vtkDoubleArray;
 class vtkGenericCell;
 class vtkIdList;
+class vtkIdTypeArray;
 class vtkPoints;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkAbstractCellLocator : public vtkLocator
@@ -85,6 +88,26 @@ public:
   vtkBooleanMacro(RetainCellLists, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Boolean controls whether the search structure is refit instead of being
+   * rebuilt when only the point coordinates of the dataset changed, e.g. for a
+   * time-varying displacement or the output of vtkWarpVector. The topology of
+   * the search structure is kept and only its bounds are updated, which is much
+   * faster than a full build, but queries may become slower if the points moved
+   * a lot. The cells are considered unchanged if neither the locator nor the
+   * cell arrays of the dataset have been modified since the last build. This is
+   * only detected for vtkPolyData and vtkUnstructuredGrid, other datasets are
+   * always rebuilt. Use ForceBuildLocator() to rebuild the locator from scratch.
+   *
+   * Not applicable to all implementations, currently used by vtkCellTreeLocator
+   * and vtkStaticCellLocator. Default is on.
+   */
+  vtkSetMacro(RefitSearchStructure, vtkTypeBool);
+  vtkGetMacro(RefitSearchStructure, vtkTypeBool);
+  vtkBooleanMacro(RefitSearchStructure, vtkTypeBool);
+  ///@}
+
   /**
    * Return intersection point (if any) of finite line with cells contained
    * in cell locator. See vtkCell.h parameters documentation.
@@ -287,6 +310,35 @@ public:
     double pcoords[3], double* weights);
   ///@}
 
+  ///@{
+  /**
+   * Batched versions of the thread safe queries above. The query points, or
+   * the end points of the query segments, are given as arrays with 3
+   * components. The output arrays are resized to hold one result per query.
+   * The locator is built if needed, then the queries are performed in
+   * parallel using vtkSMPTools. Subclasses may reimplement these methods to
+   * query their search structure directly.
+   *
+   * FindCells() stores the id of the cell containing each point (or -1) in
+   * cellIds, and the parametric coordinates of the point in this cell if
+   * pcoords is not nullptr.
+   *
+   * FindClosestPoints() stores the closest point on the cells, the id of the
+   * closest cell, and the squared distance if dist2 is not nullptr.
+   *
+   * IntersectWithLines() intersects each segment (p1, p2) with the cells and
+   * stores the parametric coordinate t of the intersection along the segment
+   * (or -1), the intersected cell (or -1), and the intersection point if x is
+   * not nullptr.
+   */
+  virtual void FindCells(
+    vtkDataArray* points, double tol2, vtkIdTypeArray* cellIds, vtkDoubleArray* pcoords);
+  virtual void FindClosestPoints(vtkDataArray* points, vtkDoubleArray* closestPoints,
+    vtkIdTypeArray* cellIds, vtkDoubleArray* dist2);
+  virtual void IntersectWithLines(vtkDataArray* p1, vtkDataArray* p2, double tol,
+    vtkDoubleArray* t, vtkDoubleArray* x, vtkIdTypeArray* cellIds);
+  ///@}
+
   /**
    * Quickly test if a point is inside the bounds of a particular cell.
    * Some locators cache cell bounds and this function can make use
@@ -323,9 +375,26 @@ protected:
    */
   void UpdateInternalWeights();
 
+  /**
+   * Return true if the search structure may be refit instead of rebuilt, i.e.
+   * RefitSearchStructure is on, and neither the locator nor the cells of the
+   * dataset have been modified since the locator was last built. Subclasses
+   * call it in BuildLocator() once they know the dataset has been modified.
+   */
+  bool CanRefitSearchStructure();
+
+  /**
+   * Return the modification time of the cells of the dataset, ignoring the
+   * point coordinates and the point/cell data. For datasets other than
+   * vtkPolyData and vtkUnstructuredGrid, the modification time of the dataset
+   * is returned.
+   */
+  vtkMTimeType GetDataSetCellsMTime();
+
   int NumberOfCellsPerNode;
   vtkTypeBool RetainCellLists;
   vtkTypeBool CacheCellBounds;
+  vtkTypeBool RefitSearchStructure;
   vtkNew<vtkGenericCell> GenericCell;
   std::shared_ptr<std::vector<double>> CellBoundsSharedPtr;
   double* CellBounds; // The is just used for simplicity in the internal code
@@ -2,8 +2,14 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkAbstractPointLocator.h"
 
+#include "vtkDataArray.h"
 #include "vtkDataSet.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -53,6 +59,62 @@ void vtkAbstractPointLocator::FindPointsWithinRadius(
   this->FindPointsWithinRadius(R, p, result);
 }
 
+//------------------------------------------------------------------------------
+void vtkAbstractPointLocator::FindClosestPoints(vtkDataArray* points, vtkIdTypeArray* closestIds)
+{
+  if (!points || !closestIds || points->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro(<< "FindClosestPoints requires query points with 3 components "
+                  << "and a closestIds array.");
+    return;
+  }
+  vtkIdType numQueries = points->GetNumberOfTuples();
+  closestIds->SetNumberOfComponents(1);
+  closestIds->SetNumberOfTuples(numQueries);
+
+  this->BuildLocator();
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType queryId, vtkIdType endQueryId) {
+    double x[3];
+    for (; queryId < endQueryId; ++queryId)
+    {
+      points->GetTuple(queryId, x);
+      closestIds->SetValue(queryId, this->FindClosestPoint(x));
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractPointLocator::FindClosestPoints(
+  int N, vtkDataArray* points, vtkIdTypeArray* closestIds)
+{
+  if (N < 1 || !points || !closestIds || points->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro(<< "FindClosestPoints requires N > 0, query points with 3 components "
+                  << "and a closestIds array.");
+    return;
+  }
+  vtkIdType numQueries = points->GetNumberOfTuples();
+  closestIds->SetNumberOfComponents(N);
+  closestIds->SetNumberOfTuples(numQueries);
+
+  this->BuildLocator();
+  vtkSMPThreadLocalObject<vtkIdList> tlResult;
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType queryId, vtkIdType endQueryId) {
+    vtkIdList* result = tlResult.Local();
+    double x[3];
+    for (; queryId < endQueryId; ++queryId)
+    {
+      points->GetTuple(queryId, x);
+      result->Reset();
+      this->FindClosestNPoints(N, x, result);
+      vtkIdType* ids = closestIds->GetPointer(queryId * N);
+      vtkIdType numFound = std::min<vtkIdType>(result->GetNumberOfIds(), N);
+      std::copy_n(result->GetPointer(0), numFound, ids);
+      std::fill(ids + numFound, ids + N, -1);
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 void vtkAbstractPointLocator::GetBounds(double* bnds)
 {
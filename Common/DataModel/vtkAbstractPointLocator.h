@@ -22,7 +22,9 @@
 #include "vtkLocator.h"
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
 class vtkIdList;
+class vtkIdTypeArray;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkAbstractPointLocator : public vtkLocator
 {
@@ -78,6 +80,22 @@ public:
   void FindPointsWithinRadius(double R, double x, double y, double z, vtkIdList* result);
   ///@}
 
+  ///@{
+  /**
+   * Batched versions of FindClosestPoint() and FindClosestNPoints(). The
+   * query points are given as an array with 3 components. FindClosestPoints()
+   * stores the id of the closest point to each query point (or -1) in
+   * closestIds. With N specified, closestIds gets N components and each tuple
+   * holds the ids of the N closest points, sorted from closest to farthest
+   * and padded with -1 if fewer points are found. The locator is built if
+   * needed, then the queries are performed in parallel using vtkSMPTools.
+   * Subclasses may reimplement these methods to query their search structure
+   * directly.
+   */
+  virtual void FindClosestPoints(vtkDataArray* points, vtkIdTypeArray* closestIds);
+  virtual void FindClosestPoints(int N, vtkDataArray* points, vtkIdTypeArray* closestIds);
+  ///@}
+
   ///@{
   /**
    * Provide an accessor to the bounds. Valid after the locator is built.
@@ -1136,6 +1136,9 @@ struct BoundsWorker
     else
     {
       ThreadedBoundsFunctor<TPointsArray> threadedBds(pts, bds);
+      // The bounds are cached by vtkPoints, so they are computed even in an
+      // aborted filter.
+      vtkSMPTools::CancellationScope uncancellable(nullptr);
       vtkSMPTools::For(0, numPts, threadedBds);
     }
   }
@@ -1159,6 +1162,7 @@ struct BoundsPointUsesWorker
     else
     {
       ThreadedBoundsPointUsesFunctor<TPointsArray, TUsed> threadedBds(pts, ptUses, bds);
+      vtkSMPTools::CancellationScope uncancellable(nullptr);
       vtkSMPTools::For(0, numPts, threadedBds);
     }
   }
@@ -1181,6 +1185,7 @@ struct BoundsPointIdsWorker
     else
     {
       ThreadedBoundsPointIdsFunctor<TPointsArray, TId> threadedBds(pts, ptIds, bds);
+      vtkSMPTools::CancellationScope uncancellable(nullptr);
       vtkSMPTools::For(0, numberOfPointsIds, threadedBds);
     }
   }
@@ -1110,6 +1110,8 @@ int vtkCellArray::GetMaxCellSize()
   // to execute the functor serially. This is faster.
   // and also potentially avoids nested multithreading which creates race conditions.
   FindMaxCell finder{ this };
+  // Callers size their buffers from the result, so it must be exact.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(0, numCells, vtkSMPTools::THRESHOLD, finder);
 
   return static_cast<int>(finder.Result);
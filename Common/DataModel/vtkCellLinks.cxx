@@ -71,6 +71,9 @@ void vtkCellLinks::Allocate(vtkIdType sz, vtkIdType ext)
 // Allocate memory for the list of lists of cell ids.
 void vtkCellLinks::AllocateLinks(vtkIdType n)
 {
+  // The links are kept by the dataset, so they are built even if the caller
+  // is aborted.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(0, n, [&](vtkIdType beginPtId, vtkIdType endPtId) {
     for (vtkIdType ptId = beginPtId; ptId < endPtId; ++ptId)
     {
@@ -248,6 +251,7 @@ void vtkCellLinks::DeepCopy(vtkAbstractCellLinks* src)
   }
   this->SetSequentialProcessing(src->GetSequentialProcessing());
   this->Allocate(cellLinks->Size, cellLinks->Extend);
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(0, cellLinks->MaxId + 1, [&](vtkIdType ptId, vtkIdType endPtId) {
     for (; ptId < endPtId; ++ptId)
     {
@@ -5,10 +5,12 @@
 
 #include "vtkBox.h"
 #include "vtkCellArray.h"
+#include "vtkCellLocatorBatchQueries.h"
 #include "vtkGenericCell.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
 
 #include <array>
 #include <cmath>
@@ -51,6 +53,20 @@ int vtkCellLocator::vtkNeighborCells::InsertNextPoint(int* x)
   return id / 3;
 }
 
+//------------------------------------------------------------------------------
+struct vtkCellLocator::vtkInternals
+{
+  // Bookkeeping of the visited cells reused by the single ray queries.
+  vtkCellLocatorBatchQueries::VisitedCellsPool VisitedCellsPool;
+
+  // Walk the octants along the line and return the first intersected cell,
+  // assuming the locator is built. The visited cells are tracked in visited,
+  // which is reset first.
+  static int IntersectWithLine(vtkCellLocator* self, const double p1[3], const double p2[3],
+    double tol, double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId,
+    vtkGenericCell* cell, vtkCellLocatorBatchQueries::VisitedCells& visited);
+};
+
 //------------------------------------------------------------------------------
 // Construct with automatic computation of divisions, averaging
 // 25 cells per bucket.
@@ -67,6 +83,8 @@ vtkCellLocator::vtkCellLocator()
   this->Bounds[0] = this->Bounds[2] = this->Bounds[4] = VTK_DOUBLE_MAX;
   this->Bounds[1] = this->Bounds[3] = this->Bounds[5] = VTK_DOUBLE_MIN;
   this->Tree = nullptr;
+
+  this->Internals.reset(new vtkInternals);
 }
 
 //------------------------------------------------------------------------------
@@ -84,6 +102,7 @@ void vtkCellLocator::FreeSearchStructure()
     this->TreeSharedPtr.reset();
     this->Tree = nullptr;
   }
+  this->Internals->VisitedCellsPool.Clear();
 }
 
 //------------------------------------------------------------------------------
@@ -139,20 +158,50 @@ int vtkCellLocator::IntersectWithLine(const double p1[3], const double p2[3], do
   {
     return 0;
   }
-  double* bounds = this->Bounds;
-  double* h = this->H;
+  vtkCellLocatorBatchQueries::VisitedCellsPool::Lease visited(this->Internals->VisitedCellsPool);
+  return vtkInternals::IntersectWithLine(
+    this, p1, p2, tol, t, x, pcoords, subId, cellId, cell, visited.Get());
+}
+
+//------------------------------------------------------------------------------
+void vtkCellLocator::IntersectWithLines(vtkDataArray* p1, vtkDataArray* p2, double tol,
+  vtkDoubleArray* t, vtkDoubleArray* x, vtkIdTypeArray* cellIds)
+{
+  this->BuildLocator();
+  const bool built = this->Tree != nullptr;
+  vtkSMPThreadLocal<vtkCellLocatorBatchQueries::VisitedCells> tlVisited;
+  if (!vtkCellLocatorBatchQueries::IntersectWithLines(p1, p2, t, x, cellIds,
+        [this, built, tol, &tlVisited](const double a0[3], const double a1[3], double& tHit,
+          double xHit[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) {
+          return built ? vtkInternals::IntersectWithLine(this, a0, a1, tol, tHit, xHit, pcoords,
+                           subId, cellId, cell, tlVisited.Local())
+                       : 0;
+        }))
+  {
+    vtkErrorMacro(<< "IntersectWithLines requires end points with 3 components and the same "
+                  << "number of tuples, a t and a cellIds array.");
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkCellLocator::vtkInternals::IntersectWithLine(vtkCellLocator* self, const double p1[3],
+  const double p2[3], double tol, double& t, double x[3], double pcoords[3], int& subId,
+  vtkIdType& cellId, vtkGenericCell* cell, vtkCellLocatorBatchQueries::VisitedCells& visited)
+{
+  double* bounds = self->Bounds;
+  double* h = self->H;
   double t0, t1, x0[3], x1[3], tHitCell;
   double hitCellBoundsPosition[3], cellBounds[6], *cellBoundsPtr;
   double octantBounds[6];
-  int prod = this->NumberOfDivisions * this->NumberOfDivisions;
+  int prod = self->NumberOfDivisions * self->NumberOfDivisions;
   vtkIdType cellIdBest = -1, cId, i, idx, numberOfCellsInBucket;
   int ijk[3], ijkEnd[3];
   int plane0, plane1, subIdBest = -1, hitCellBounds;
   double tBest = VTK_FLOAT_MAX, xBest[3], pCoordsBest[3], step[3], next[3], tMax[3], tDelta[3];
   double rayDir[3];
   vtkMath::Subtract(p2, p1, rayDir);
-  int leafStart = this->NumberOfOctants -
-    this->NumberOfDivisions * this->NumberOfDivisions * this->NumberOfDivisions;
+  int leafStart = self->NumberOfOctants -
+    self->NumberOfDivisions * self->NumberOfDivisions * self->NumberOfDivisions;
 
   // Make sure the bounding box of the locator is hit. Also, determine the
   // entry and exit points into and out of the locator. This is used to
@@ -164,15 +213,15 @@ int vtkCellLocator::IntersectWithLine(const double p1[3], const double p2[3], do
     return 0; // No intersections possible, line is outside the locator
   }
 
-  // Initialize intersection query array if necessary. This is done
-  // locally to ensure thread safety.
-  std::vector<bool> cellHasBeenVisited(this->DataSet->GetNumberOfCells(), false);
+  // Clear the cells visited by the previous ray. Each thread uses its own
+  // bookkeeping to ensure thread safety.
+  visited.Reset(self->DataSet->GetNumberOfCells());
 
   // Get the i-j-k point of intersection and bin index. This is
   // clamped to the boundary of the locator.
-  this->GetBucketIndices(x0, ijk);
-  this->GetBucketIndices(x1, ijkEnd);
-  idx = leafStart + ijk[0] + ijk[1] * this->NumberOfDivisions + ijk[2] * prod;
+  self->GetBucketIndices(x0, ijk);
+  self->GetBucketIndices(x1, ijkEnd);
+  idx = leafStart + ijk[0] + ijk[1] * self->NumberOfDivisions + ijk[2] * prod;
 
   // Set up some traversal parameters for traversing through bins
   step[0] = (rayDir[0] >= 0.0) ? 1.0 : -1.0;
@@ -195,20 +244,20 @@ int vtkCellLocator::IntersectWithLine(const double p1[3], const double p2[3], do
 
   for (cellIdBest = (-1); cellIdBest < 0;)
   {
-    if (this->Tree[idx] &&
-      (numberOfCellsInBucket = this->Tree[idx]->GetNumberOfIds()) > 0) // there are some cell here
+    if (self->Tree[idx] &&
+      (numberOfCellsInBucket = self->Tree[idx]->GetNumberOfIds()) > 0) // there are some cell here
     {
-      this->ComputeOctantBounds(octantBounds, ijk[0], ijk[1], ijk[2]);
+      self->ComputeOctantBounds(octantBounds, ijk[0], ijk[1], ijk[2]);
       for (i = 0; i < numberOfCellsInBucket; ++i)
       {
-        cId = this->Tree[idx]->GetId(i);
-        if (!cellHasBeenVisited[cId])
+        cId = self->Tree[idx]->GetId(i);
+        if (!visited.IsVisited(cId))
         {
-          cellHasBeenVisited[cId] = true;
+          visited.SetVisited(cId, true);
 
           // check whether we intersect the cell bounds
           cellBoundsPtr = cellBounds;
-          this->GetCellBounds(cId, cellBoundsPtr);
+          self->GetCellBounds(cId, cellBoundsPtr);
           hitCellBounds =
             vtkBox::IntersectBox(cellBoundsPtr, p1, rayDir, hitCellBoundsPosition, tHitCell, tol);
 
@@ -216,14 +265,14 @@ int vtkCellLocator::IntersectWithLine(const double p1[3], const double p2[3], do
           {
             // now, do the expensive GetCell call and the expensive
             // intersect with line call
-            this->DataSet->GetCell(cId, cell);
+            self->DataSet->GetCell(cId, cell);
             if (cell->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId) && t < tBest)
             {
               // Make sure that intersection occurs within this octant or else spurious cell
               // intersections can occur behind this bin which are not the correct answer.
               if (!vtkAbstractCellLocator::IsInBounds(octantBounds, x, tol))
               {
-                cellHasBeenVisited[cId] = false; // mark the cell non-visited
+                visited.SetVisited(cId, false); // mark the cell non-visited
               }
               else
               {
@@ -239,7 +288,7 @@ int vtkCellLocator::IntersectWithLine(const double p1[3], const double p2[3], do
               } // intersection point is in current octant
             }   // if intersection
           }     // if (hitCellBounds)
-        }       // if (!CellHasBeenVisited[cId])
+        }       // if (!visited.IsVisited(cId))
       }
     }
 
@@ -284,21 +333,21 @@ int vtkCellLocator::IntersectWithLine(const double p1[3], const double p2[3], do
       }
     }
 
-    if (ijk[0] < 0 || ijk[0] >= this->NumberOfDivisions || ijk[1] < 0 ||
-      ijk[1] >= this->NumberOfDivisions || ijk[2] < 0 || ijk[2] >= this->NumberOfDivisions)
+    if (ijk[0] < 0 || ijk[0] >= self->NumberOfDivisions || ijk[1] < 0 ||
+      ijk[1] >= self->NumberOfDivisions || ijk[2] < 0 || ijk[2] >= self->NumberOfDivisions)
     {
       break;
     }
     else
     {
-      idx = leafStart + ijk[0] + ijk[1] * this->NumberOfDivisions + ijk[2] * prod;
+      idx = leafStart + ijk[0] + ijk[1] * self->NumberOfDivisions + ijk[2] * prod;
     }
   }
 
   // If a cell has been intersected, recover the information and return.
   if (cellIdBest >= 0)
   {
-    this->DataSet->GetCell(cellIdBest, cell);
+    self->DataSet->GetCell(cellIdBest, cell);
     t = tBest;
     x[0] = xBest[0];
     x[1] = xBest[1];
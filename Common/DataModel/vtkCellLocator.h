@@ -37,6 +37,8 @@
 #include "vtkCommonDataModelModule.h" // For export macro
 #include "vtkNew.h"                   // For vtkNew
 
+#include <memory> // For std::unique_ptr
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkIntArray;
 
@@ -136,6 +138,14 @@ public:
    */
   void FindCellsWithinBounds(double* bbox, vtkIdList* cells) override;
 
+  /**
+   * Batched version of IntersectWithLine(), see vtkAbstractCellLocator.
+   * Reimplemented to walk the octants directly from several threads, reusing
+   * the bookkeeping of the visited cells from one line to the next.
+   */
+  void IntersectWithLines(vtkDataArray* p1, vtkDataArray* p2, double tol, vtkDoubleArray* t,
+    vtkDoubleArray* x, vtkIdTypeArray* cellIds) override;
+
   /**
    * Take the passed line segment and intersect it with the data set.
    * For each intersection with the bounds of a cell, the cellIds
@@ -224,6 +234,9 @@ protected:
   void ComputeOctantBounds(double octantBounds[6], int i, int j, int k);
 
 private:
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+
   vtkCellLocator(const vtkCellLocator&) = delete;
   void operator=(const vtkCellLocator&) = delete;
 };
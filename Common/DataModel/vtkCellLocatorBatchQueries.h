@@ -0,0 +1,294 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkCellLocatorBatchQueries
+ * @brief   parallel loops for the batched queries of cell locators
+ *
+ * vtkCellLocatorBatchQueries provides the vtkSMPTools loops used by the
+ * batched queries of vtkAbstractCellLocator (FindCells(), FindClosestPoints()
+ * and IntersectWithLines()). The loops allocate the output arrays, manage the
+ * per-thread vtkGenericCell and weights, and call a functor performing a
+ * single query. vtkAbstractCellLocator passes functors calling its thread safe
+ * virtual methods, while subclasses pass functors calling their search
+ * structure directly. The locators walking a ray through bins keep a
+ * VisitedCells per thread in the batched queries, and a VisitedCellsPool for
+ * the single ray queries, so that the cost of a ray does not depend on the
+ * number of cells of the dataset.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkAbstractCellLocator vtkStaticCellLocator vtkCellTreeLocator
+ */
+
+#ifndef vtkCellLocatorBatchQueries_h
+#define vtkCellLocatorBatchQueries_h
+
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdTypeArray.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace vtkCellLocatorBatchQueries
+{
+
+/**
+ * Keeps track of the cells already tested by a ray traversing the bins of a
+ * locator. Reset() only clears the cells visited by the previous ray, so that
+ * the batched queries can reuse one instance per thread instead of allocating
+ * and clearing one flag per cell of the dataset for every ray.
+ */
+class VisitedCells
+{
+public:
+  // Prepare for a new ray traversing a dataset with numberOfCells cells.
+  void Reset(vtkIdType numberOfCells)
+  {
+    if (static_cast<vtkIdType>(this->Flags.size()) != numberOfCells)
+    {
+      this->Flags.assign(numberOfCells, false);
+    }
+    else
+    {
+      for (vtkIdType cellId : this->CellIds)
+      {
+        this->Flags[cellId] = false;
+      }
+    }
+    this->CellIds.clear();
+  }
+
+  bool IsVisited(vtkIdType cellId) const { return this->Flags[cellId]; }
+
+  void SetVisited(vtkIdType cellId, bool visited)
+  {
+    this->Flags[cellId] = visited;
+    if (visited)
+    {
+      this->CellIds.push_back(cellId);
+    }
+  }
+
+private:
+  std::vector<bool> Flags;
+  std::vector<vtkIdType> CellIds;
+};
+
+/**
+ * Thread safe pool of VisitedCells. The single ray queries of a locator may be
+ * called concurrently from any thread, so they borrow a VisitedCells from the
+ * pool of the locator for the duration of the query, rather than allocating
+ * one flag per cell of the dataset for every ray.
+ */
+class VisitedCellsPool
+{
+public:
+  class Lease
+  {
+  public:
+    Lease(VisitedCellsPool& pool)
+      : Pool(pool)
+      , Visited(pool.Acquire())
+    {
+    }
+    ~Lease() { this->Pool.Release(std::move(this->Visited)); }
+    VisitedCells& Get() { return *this->Visited; }
+
+  private:
+    Lease(const Lease&) = delete;
+    void operator=(const Lease&) = delete;
+
+    VisitedCellsPool& Pool;
+    std::unique_ptr<VisitedCells> Visited;
+  };
+
+  // Release the memory of the VisitedCells not in use.
+  void Clear()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Available.clear();
+  }
+
+private:
+  std::unique_ptr<VisitedCells> Acquire()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    if (this->Available.empty())
+    {
+      return std::unique_ptr<VisitedCells>(new VisitedCells);
+    }
+    std::unique_ptr<VisitedCells> visited = std::move(this->Available.back());
+    this->Available.pop_back();
+    return visited;
+  }
+
+  void Release(std::unique_ptr<VisitedCells> visited)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Available.emplace_back(std::move(visited));
+  }
+
+  std::mutex Mutex;
+  std::vector<std::unique_ptr<VisitedCells>> Available;
+};
+
+// Allocate an output array with one tuple per query.
+template <typename ArrayT>
+void Allocate(ArrayT* array, int numComps, vtkIdType numQueries)
+{
+  if (array)
+  {
+    array->SetNumberOfComponents(numComps);
+    array->SetNumberOfTuples(numQueries);
+  }
+}
+
+/**
+ * For each point, call findCell(x, cell, subId, pcoords, weights) and store
+ * the returned cell id, and the parametric coordinates if pcoords is not
+ * null. Returns false if the query points do not have 3 components.
+ */
+template <typename FindCellFunctor>
+bool FindCells(vtkDataSet* dataSet, vtkDataArray* points, vtkIdTypeArray* cellIds,
+  vtkDoubleArray* pcoords, FindCellFunctor&& findCell)
+{
+  if (!points || !cellIds || points->GetNumberOfComponents() != 3)
+  {
+    return false;
+  }
+  const vtkIdType numQueries = points->GetNumberOfTuples();
+  Allocate(cellIds, 1, numQueries);
+  Allocate(pcoords, 3, numQueries);
+  const int maxCellSize = std::max(dataSet ? dataSet->GetMaxCellSize() : 0, 1);
+
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocal<std::vector<double>> tlWeights;
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType queryId, vtkIdType endQueryId) {
+    vtkGenericCell* cell = tlCell.Local();
+    std::vector<double>& weights = tlWeights.Local();
+    weights.resize(maxCellSize);
+    double x[3], pc[3];
+    int subId;
+    for (; queryId < endQueryId; ++queryId)
+    {
+      points->GetTuple(queryId, x);
+      cellIds->SetValue(queryId, findCell(x, cell, subId, pc, weights.data()));
+      if (pcoords)
+      {
+        pcoords->SetTypedTuple(queryId, pc);
+      }
+    }
+  });
+  return true;
+}
+
+/**
+ * For each point, call findClosestPoint(x, closestPoint, cell, cellId, subId,
+ * dist2) and store the closest point, the cell id, and the squared distance
+ * if dist2 is not null. Returns false if the query points do not have 3
+ * components.
+ */
+template <typename FindClosestPointFunctor>
+bool FindClosestPoints(vtkDataArray* points, vtkDoubleArray* closestPoints,
+  vtkIdTypeArray* cellIds, vtkDoubleArray* dist2, FindClosestPointFunctor&& findClosestPoint)
+{
+  if (!points || !closestPoints || !cellIds || points->GetNumberOfComponents() != 3)
+  {
+    return false;
+  }
+  const vtkIdType numQueries = points->GetNumberOfTuples();
+  Allocate(closestPoints, 3, numQueries);
+  Allocate(cellIds, 1, numQueries);
+  Allocate(dist2, 1, numQueries);
+
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType queryId, vtkIdType endQueryId) {
+    vtkGenericCell* cell = tlCell.Local();
+    double x[3], closestPoint[3], d2;
+    vtkIdType cellId;
+    int subId;
+    for (; queryId < endQueryId; ++queryId)
+    {
+      points->GetTuple(queryId, x);
+      cellId = -1;
+      d2 = VTK_DOUBLE_MAX;
+      findClosestPoint(x, closestPoint, cell, cellId, subId, d2);
+      closestPoints->SetTypedTuple(queryId, closestPoint);
+      cellIds->SetValue(queryId, cellId);
+      if (dist2)
+      {
+        dist2->SetValue(queryId, d2);
+      }
+    }
+  });
+  return true;
+}
+
+/**
+ * For each segment (p1, p2), call intersectWithLine(p1, p2, t, x, pcoords,
+ * subId, cellId, cell) and store the parametric coordinate along the segment,
+ * the intersected cell and, if x is not null, the intersection point. t and
+ * the cell id are -1 when there is no intersection. Returns false if the end
+ * points do not have 3 components or do not have the same number of tuples.
+ */
+template <typename IntersectWithLineFunctor>
+bool IntersectWithLines(vtkDataArray* p1, vtkDataArray* p2, vtkDoubleArray* t,
+  vtkDoubleArray* x, vtkIdTypeArray* cellIds, IntersectWithLineFunctor&& intersectWithLine)
+{
+  if (!p1 || !p2 || !t || !cellIds || p1->GetNumberOfComponents() != 3 ||
+    p2->GetNumberOfComponents() != 3 || p1->GetNumberOfTuples() != p2->GetNumberOfTuples())
+  {
+    return false;
+  }
+  const vtkIdType numQueries = p1->GetNumberOfTuples();
+  Allocate(t, 1, numQueries);
+  Allocate(x, 3, numQueries);
+  Allocate(cellIds, 1, numQueries);
+
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType queryId, vtkIdType endQueryId) {
+    vtkGenericCell* cell = tlCell.Local();
+    double a0[3], a1[3], tHit, xHit[3], pcoords[3];
+    vtkIdType cellId;
+    int subId;
+    for (; queryId < endQueryId; ++queryId)
+    {
+      p1->GetTuple(queryId, a0);
+      p2->GetTuple(queryId, a1);
+      cellId = -1;
+      if (!intersectWithLine(a0, a1, tHit, xHit, pcoords, subId, cellId, cell))
+      {
+        tHit = -1.0;
+        cellId = -1;
+        xHit[0] = xHit[1] = xHit[2] = 0.0;
+      }
+      t->SetValue(queryId, tHit);
+      cellIds->SetValue(queryId, cellId);
+      if (x)
+      {
+        x->SetTypedTuple(queryId, xHit);
+      }
+    }
+  });
+  return true;
+}
+
+} // namespace vtkCellLocatorBatchQueries
+VTK_ABI_NAMESPACE_END
+
+#endif
+// VTK-HeaderTest-Exclude: vtkCellLocatorBatchQueries.h
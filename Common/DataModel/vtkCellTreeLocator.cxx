@@ -6,10 +6,13 @@
 #include "vtkBoundingBox.h"
 #include "vtkBox.h"
 #include "vtkCellArray.h"
+#include "vtkCellLocatorBatchQueries.h"
 #include "vtkGenericCell.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <array>
@@ -62,6 +65,7 @@ struct vtkCellTree
   virtual int IntersectWithLine(const double p1[3], const double p2[3], double tol,
     vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell) = 0;
   virtual void GenerateRepresentation(int level, vtkPolyData* pd) = 0;
+  virtual bool Refit() = 0;
 
   // Utility methods
   static int getDominantAxis(const double dir[3])
@@ -210,6 +214,7 @@ struct CellTree : public vtkCellTree
   int IntersectWithLine(const double p1[3], const double p2[3], double tol, vtkPoints* points,
     vtkIdList* cellIds, vtkGenericCell* cell) override;
   void GenerateRepresentation(int level, vtkPolyData* pd) override;
+  bool Refit() override;
 };
 
 //------------------------------------------------------------------------------
@@ -319,6 +324,19 @@ private:
         this->Max = max;
       }
     }
+
+    inline void Merge(const Bucket& other)
+    {
+      this->Cnt += other.Cnt;
+      if (other.Min < this->Min)
+      {
+        this->Min = other.Min;
+      }
+      if (other.Max > this->Max)
+      {
+        this->Max = other.Max;
+      }
+    }
   };
 
   struct CellInfo
@@ -383,7 +401,9 @@ private:
 
   std::vector<CellInfo> CellsInfo;
   std::vector<CellTreeNode<T>> Nodes;
-  std::stack<SplitInfo> SplitStack;
+  // Nodes left to split once the top of the tree is built. Each of them is the
+  // root of a subtree built independently of the others.
+  std::vector<SplitInfo> Subtrees;
 
   struct BucketsType : public std::array<std::vector<Bucket>, 3>
   {
@@ -437,16 +457,72 @@ private:
   }
 
   // -------------------------------------------------------------------------
-  void Split(T index, double min[3], double max[3], BucketsType& buckets)
+  void BinCells(const CellInfo* begin, const CellInfo* end, const double min[3],
+    const double iext[3], BucketsType& buckets)
   {
-    const T& start = this->Nodes[index].Start();
-    const T& size = this->Nodes[index].Size();
+    for (const CellInfo* pc = begin; pc != end; ++pc)
+    {
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        double cen = (pc->Min[d] + pc->Max[d]) / 2.0;
+        double dblIdx = (cen - min[d]) * iext[d];
+        dblIdx = vtkMath::ClampValue(dblIdx, 0.0, static_cast<double>(this->NumberOfBuckets - 1));
+        size_t ind = static_cast<size_t>(dblIdx);
 
-    if (size < this->NumberOfNodesPerLeaf)
+        buckets[d][ind].Add(pc->Min[d], pc->Max[d]);
+      }
+    }
+  }
+
+  // -------------------------------------------------------------------------
+  // The nodes at the top of the tree hold most of the cells, and are split
+  // before any parallelism over subtrees is available. Their cells are binned
+  // in parallel, the counts and extents of the buckets do not depend on the
+  // order in which the cells are added.
+  void FillBuckets(const CellInfo* begin, const CellInfo* end, const double min[3],
+    const double iext[3], BucketsType& buckets, bool parallel)
+  {
+    buckets.Reset();
+    if (!parallel)
     {
+      this->BinCells(begin, end, min, iext, buckets);
       return;
     }
 
+    vtkSMPThreadLocal<BucketsType> tlBuckets(BucketsType(this->NumberOfBuckets));
+    vtkSMPTools::For(0, static_cast<vtkIdType>(end - begin), [&](vtkIdType first, vtkIdType last) {
+      this->BinCells(begin + first, begin + last, min, iext, tlBuckets.Local());
+    });
+    for (const BucketsType& localBuckets : tlBuckets)
+    {
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        for (int n = 0; n < this->NumberOfBuckets; ++n)
+        {
+          buckets[d][n].Merge(localBuckets[d][n]);
+        }
+      }
+    }
+  }
+
+  // -------------------------------------------------------------------------
+  // Split a leaf of nodes into two children appended to nodes. The split
+  // information of the children is appended to children. Returns false if the
+  // leaf is not split.
+  bool Split(std::vector<TCellTreeNode>& nodes, const SplitInfo& splitInfo, BucketsType& buckets,
+    std::vector<SplitInfo>& children, bool parallel)
+  {
+    const T index = splitInfo.Index;
+    const double* min = splitInfo.Min;
+    const double* max = splitInfo.Max;
+    const T start = nodes[index].Start();
+    const T size = nodes[index].Size();
+
+    if (size < this->NumberOfNodesPerLeaf)
+    {
+      return false;
+    }
+
     CellInfo* begin = &(this->CellsInfo[start]);
     CellInfo* end = this->CellsInfo.data() + start + size;
     CellInfo* mid = begin;
@@ -455,20 +531,7 @@ private:
     const double iext[3] = { this->NumberOfBuckets / ext[0], this->NumberOfBuckets / ext[1],
       this->NumberOfBuckets / ext[2] };
 
-    buckets.Reset();
-
-    for (const CellInfo* pc = begin; pc != end; ++pc)
-    {
-      for (uint8_t d = 0; d < 3; ++d)
-      {
-        double cen = (pc->Min[d] + pc->Max[d]) / 2.0;
-        double dblIdx = (cen - min[d]) * iext[d];
-        dblIdx = vtkMath::ClampValue(dblIdx, 0.0, static_cast<double>(this->NumberOfBuckets - 1));
-        size_t ind = static_cast<size_t>(dblIdx);
-
-        buckets[d][ind].Add(pc->Min[d], pc->Max[d]);
-      }
-    }
+    this->FillBuckets(begin, end, min, iext, buckets, parallel);
 
     double cost = VTK_DOUBLE_MAX;
     double plane = VTK_DOUBLE_MIN; // bad value in case it doesn't get setx
@@ -546,11 +609,63 @@ private:
     child[0].MakeLeaf(begin - this->CellsInfo.data(), mid - begin);
     child[1].MakeLeaf(mid - this->CellsInfo.data(), end - mid);
 
-    this->Nodes[index].MakeNode(static_cast<T>(this->Nodes.size()), dim, clip);
-    this->Nodes.insert(this->Nodes.end(), child, child + 2);
+    nodes[index].MakeNode(static_cast<T>(nodes.size()), dim, clip);
+    nodes.insert(nodes.end(), child, child + 2);
 
-    this->SplitStack.emplace(this->Nodes[index].GetRightChildIndex(), rMin, rMax);
-    this->SplitStack.emplace(this->Nodes[index].GetLeftChildIndex(), lMin, lMax);
+    children.emplace_back(nodes[index].GetLeftChildIndex(), lMin, lMax);
+    children.emplace_back(nodes[index].GetRightChildIndex(), rMin, rMax);
+    return true;
+  }
+
+  // -------------------------------------------------------------------------
+  // Build the subtrees in parallel, each one in its own array of nodes, then
+  // append them to the nodes of the top of the tree.
+  void BuildSubtrees()
+  {
+    const auto numberOfSubtrees = static_cast<vtkIdType>(this->Subtrees.size());
+    std::vector<std::vector<TCellTreeNode>> subtreesNodes(this->Subtrees.size());
+
+    vtkSMPThreadLocal<BucketsType> tlBuckets(BucketsType(this->NumberOfBuckets));
+    vtkSMPTools::For(0, numberOfSubtrees, 1, [&](vtkIdType subtreeId, vtkIdType endSubtreeId) {
+      BucketsType& buckets = tlBuckets.Local();
+      std::vector<SplitInfo> splitStack;
+      std::vector<SplitInfo> children;
+      for (; subtreeId < endSubtreeId; ++subtreeId)
+      {
+        const SplitInfo& subtree = this->Subtrees[subtreeId];
+        std::vector<TCellTreeNode>& nodes = subtreesNodes[subtreeId];
+        nodes.push_back(this->Nodes[subtree.Index]);
+        splitStack.emplace_back(0, subtree.Min, subtree.Max);
+        while (!splitStack.empty())
+        {
+          SplitInfo splitInfo = splitStack.back();
+          splitStack.pop_back();
+          children.clear();
+          if (this->Split(nodes, splitInfo, buckets, children, false))
+          {
+            splitStack.push_back(children[1]);
+            splitStack.push_back(children[0]);
+          }
+        }
+      }
+    });
+
+    // The root of a subtree replaces its leaf, the other nodes are appended.
+    for (size_t i = 0; i < subtreesNodes.size(); ++i)
+    {
+      std::vector<TCellTreeNode>& nodes = subtreesNodes[i];
+      const T offset = static_cast<T>(this->Nodes.size()) - 1;
+      for (auto& node : nodes)
+      {
+        if (node.IsNode())
+        {
+          node.SetChildren(node.GetLeftChildIndex() + offset);
+        }
+      }
+      this->Nodes[this->Subtrees[i].Index] = nodes[0];
+      this->Nodes.insert(this->Nodes.end(), nodes.begin() + 1, nodes.end());
+    }
+    this->Subtrees.clear();
   }
 
 public:
@@ -565,33 +680,57 @@ public:
     const auto numberOfCells = static_cast<T>(this->DataSet->GetNumberOfCells());
     this->CellsInfo.resize(static_cast<size_t>(numberOfCells));
 
+    using BoundsType = std::array<double, 6>;
+    const BoundsType emptyBounds = { VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, VTK_DOUBLE_MAX,
+      -VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+    vtkSMPThreadLocal<BoundsType> tlBounds(emptyBounds);
+    const vtkIdType numCells = this->DataSet->GetNumberOfCells();
+    if (numCells > 0)
+    {
+      // This is done to cause non-thread safe initialization to occur due to
+      // side effects from GetCellBounds().
+      double cellBounds[6];
+      this->DataSet->GetCellBounds(0, cellBounds);
+    }
+    vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+      BoundsType& bounds = tlBounds.Local();
+      double cellBounds[6], *cellBoundsPtr;
+      cellBoundsPtr = cellBounds;
+      for (; cellId < endCellId; ++cellId)
+      {
+        CellInfo& cellInfo = this->CellsInfo[cellId];
+        cellInfo.Ind = static_cast<T>(cellId);
+        this->Locator->GetCellBounds(cellId, cellBoundsPtr);
+
+        for (uint8_t d = 0; d < 3; ++d)
+        {
+          cellInfo.Min[d] = cellBoundsPtr[2 * d + 0];
+          cellInfo.Max[d] = cellBoundsPtr[2 * d + 1];
+
+          if (cellInfo.Min[d] < bounds[2 * d])
+          {
+            bounds[2 * d] = cellInfo.Min[d];
+          }
+          if (cellInfo.Max[d] > bounds[2 * d + 1])
+          {
+            bounds[2 * d + 1] = cellInfo.Max[d];
+          }
+        }
+      }
+    });
+
     double min[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
     double max[3] = {
       -VTK_DOUBLE_MAX,
       -VTK_DOUBLE_MAX,
       -VTK_DOUBLE_MAX,
     };
-
-    double cellBounds[6], *cellBoundsPtr;
-    cellBoundsPtr = cellBounds;
-    for (T i = 0; i < numberOfCells; ++i)
+    for (const BoundsType& bounds : tlBounds)
     {
-      this->CellsInfo[i].Ind = i;
-      this->Locator->GetCellBounds(i, cellBoundsPtr);
-
       for (uint8_t d = 0; d < 3; ++d)
       {
-        this->CellsInfo[i].Min[d] = cellBoundsPtr[2 * d + 0];
-        this->CellsInfo[i].Max[d] = cellBoundsPtr[2 * d + 1];
-
-        if (this->CellsInfo[i].Min[d] < min[d])
-        {
-          min[d] = this->CellsInfo[i].Min[d];
-        }
-        if (this->CellsInfo[i].Max[d] > max[d])
-        {
-          max[d] = this->CellsInfo[i].Max[d];
-        }
+        min[d] = std::min(min[d], bounds[2 * d]);
+        max[d] = std::max(max[d], bounds[2 * d + 1]);
       }
     }
 
@@ -606,7 +745,7 @@ public:
     root.MakeLeaf(0, numberOfCells);
     this->Nodes.push_back(root);
 
-    this->SplitStack.emplace(0, min, max);
+    this->Subtrees.emplace_back(0, min, max);
   }
 
   void Initialize()
@@ -617,13 +756,25 @@ public:
 
   void operator()()
   {
-    auto& buckets = this->Buckets;
-    while (!this->SplitStack.empty())
+    // Split the top of the tree breadth first until there are enough subtrees
+    // to keep the threads busy, then build the subtrees in parallel. The tree
+    // does not depend on the number of threads since a node is split the same
+    // way whatever the order in which the nodes are processed.
+    const size_t minNumberOfSubtrees =
+      8 * static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads());
+    const T parallelBinningSize = 65536;
+    std::vector<SplitInfo> children;
+    while (!this->Subtrees.empty() && this->Subtrees.size() < minNumberOfSubtrees)
     {
-      auto splitInfo = std::move(this->SplitStack.top());
-      this->SplitStack.pop();
-      this->Split(splitInfo.Index, splitInfo.Min, splitInfo.Max, buckets);
+      children.clear();
+      for (const SplitInfo& splitInfo : this->Subtrees)
+      {
+        const bool parallel = this->Nodes[splitInfo.Index].Size() >= parallelBinningSize;
+        this->Split(this->Nodes, splitInfo, this->Buckets, children, parallel);
+      }
+      std::swap(this->Subtrees, children);
     }
+    this->BuildSubtrees();
   }
 
   void Reduce()
@@ -644,12 +795,14 @@ public:
       ni->SetChildren(nn - this->Tree.Nodes.begin() - 2);
     }
 
-    const auto numberOfCells = static_cast<size_t>(this->DataSet->GetNumberOfCells());
-    this->Tree.Leaves.resize(numberOfCells);
-    for (size_t i = 0; i < numberOfCells; ++i)
-    {
-      this->Tree.Leaves[i] = this->CellsInfo[i].Ind;
-    }
+    const auto numberOfCells = this->DataSet->GetNumberOfCells();
+    this->Tree.Leaves.resize(static_cast<size_t>(numberOfCells));
+    vtkSMPTools::For(0, numberOfCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+      for (; cellId < endCellId; ++cellId)
+      {
+        this->Tree.Leaves[cellId] = this->CellsInfo[cellId].Ind;
+      }
+    });
     this->CellsInfo.clear();
   }
 };
@@ -1059,6 +1212,81 @@ void CellTree<T>::Classify(const double origin[3], const double dir[3], double&
   }
 }
 
+//------------------------------------------------------------------------------
+template <typename T>
+bool CellTree<T>::Refit()
+{
+  const vtkIdType numberOfCells = this->DataSet->GetNumberOfCells();
+  if (static_cast<vtkIdType>(this->Leaves.size()) != numberOfCells)
+  {
+    return false;
+  }
+
+  // The nodes are stored breadth first, so each level of the tree is a
+  // contiguous range of nodes, and the children of the nodes of a level form
+  // the next level.
+  std::vector<std::pair<vtkIdType, vtkIdType>> levels;
+  for (vtkIdType begin = 0, end = 1; begin < end;)
+  {
+    levels.emplace_back(begin, end);
+    vtkIdType numberOfChildren = 0;
+    for (vtkIdType nodeId = begin; nodeId < end; ++nodeId)
+    {
+      numberOfChildren += this->Nodes[nodeId].IsNode() ? 2 : 0;
+    }
+    begin = end;
+    end += numberOfChildren;
+  }
+
+  // This is done to cause non-thread safe initialization to occur due to
+  // side effects from GetCellBounds().
+  double cellBounds[6];
+  this->DataSet->GetCellBounds(0, cellBounds);
+
+  // Compute the bounding box of each node bottom-up, one level at a time, and
+  // update the split planes from the bounding boxes of the children.
+  std::vector<double> nodeBounds(6 * this->Nodes.size());
+  for (auto level = levels.rbegin(); level != levels.rend(); ++level)
+  {
+    vtkSMPTools::For(level->first, level->second, [&](vtkIdType nodeId, vtkIdType endNodeId) {
+      double cellBoundsStorage[6];
+      for (; nodeId < endNodeId; ++nodeId)
+      {
+        TCellTreeNode& node = this->Nodes[nodeId];
+        double* bounds = &nodeBounds[6 * nodeId];
+        if (node.IsLeaf())
+        {
+          bounds[0] = bounds[2] = bounds[4] = VTK_DOUBLE_MAX;
+          bounds[1] = bounds[3] = bounds[5] = -VTK_DOUBLE_MAX;
+          for (T i = 0; i < node.Size(); ++i)
+          {
+            double* cellBoundsPtr = cellBoundsStorage;
+            this->Locator->GetCellBounds(this->Leaves[node.Start() + i], cellBoundsPtr);
+            for (int d = 0; d < 3; ++d)
+            {
+              bounds[2 * d] = std::min(bounds[2 * d], cellBoundsPtr[2 * d]);
+              bounds[2 * d + 1] = std::max(bounds[2 * d + 1], cellBoundsPtr[2 * d + 1]);
+            }
+          }
+          continue;
+        }
+        const double* left = &nodeBounds[6 * node.GetLeftChildIndex()];
+        const double* right = &nodeBounds[6 * node.GetRightChildIndex()];
+        const T d = node.GetDimension();
+        node.LeftMax = left[2 * d + 1];
+        node.RightMin = right[2 * d];
+        for (int i = 0; i < 3; ++i)
+        {
+          bounds[2 * i] = std::min(left[2 * i], right[2 * i]);
+          bounds[2 * i + 1] = std::max(left[2 * i + 1], right[2 * i + 1]);
+        }
+      }
+    });
+  }
+  std::copy_n(nodeBounds.begin(), 6, this->DataBBox);
+  return true;
+}
+
 //------------------------------------------------------------------------------
 template <typename T>
 void SplitNodeBox(CellTreeNode<T>* n, vtkBoundingBox& b, vtkBoundingBox& l, vtkBoundingBox& r)
@@ -1304,6 +1532,12 @@ void vtkCellTreeLocator::BuildLocator()
     vtkDebugMacro(<< "BuildLocator exited - UseExistingSearchStructure");
     return;
   }
+  // only update the bounds of the tree if the cells have not been modified
+  if (this->Tree && this->CanRefitSearchStructure() && this->RefitLocatorInternal())
+  {
+    vtkDebugMacro(<< "BuildLocator exited - RefitSearchStructure");
+    return;
+  }
   this->BuildLocatorInternal();
 }
 
@@ -1316,6 +1550,9 @@ void vtkCellTreeLocator::ForceBuildLocator()
 //------------------------------------------------------------------------------
 void vtkCellTreeLocator::BuildLocatorInternal()
 {
+  // The tree is queried after the calling filter completes, so its build is
+  // never cancelled.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   using namespace detail;
   vtkIdType numCells;
   if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells() < 1))
@@ -1352,6 +1589,20 @@ void vtkCellTreeLocator::BuildLocatorInternal()
   this->BuildTime.Modified();
 }
 
+//------------------------------------------------------------------------------
+bool vtkCellTreeLocator::RefitLocatorInternal()
+{
+  // The refitted bounds must cover every cell.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
+  this->ComputeCellBounds();
+  if (!this->Tree->Refit())
+  {
+    return false;
+  }
+  this->BuildTime.Modified();
+  return true;
+}
+
 //------------------------------------------------------------------------------
 vtkIdType vtkCellTreeLocator::FindCell(
   double pos[3], double, vtkGenericCell* cell, int& subId, double pcoords[3], double* weights)
@@ -1399,6 +1650,41 @@ int vtkCellTreeLocator::IntersectWithLine(const double p1[3], const double p2[3]
   return this->Tree->IntersectWithLine(p1, p2, tol, points, cellIds, cell);
 }
 
+//------------------------------------------------------------------------------
+void vtkCellTreeLocator::FindCells(
+  vtkDataArray* points, double, vtkIdTypeArray* cellIds, vtkDoubleArray* pcoords)
+{
+  this->BuildLocator();
+  detail::vtkCellTree* tree = this->Tree;
+  if (!vtkCellLocatorBatchQueries::FindCells(this->DataSet, points, cellIds, pcoords,
+        [tree](double x[3], vtkGenericCell* cell, int& subId, double pc[3],
+          double* weights) -> vtkIdType {
+          return tree ? tree->FindCell(x, cell, subId, pc, weights) : -1;
+        }))
+  {
+    vtkErrorMacro(<< "FindCells requires query points with 3 components and a cellIds array.");
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkCellTreeLocator::IntersectWithLines(vtkDataArray* p1, vtkDataArray* p2, double tol,
+  vtkDoubleArray* t, vtkDoubleArray* x, vtkIdTypeArray* cellIds)
+{
+  this->BuildLocator();
+  detail::vtkCellTree* tree = this->Tree;
+  if (!vtkCellLocatorBatchQueries::IntersectWithLines(p1, p2, t, x, cellIds,
+        [tree, tol](const double a0[3], const double a1[3], double& tHit, double xHit[3],
+          double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) {
+          return tree
+            ? tree->IntersectWithLine(a0, a1, tol, tHit, xHit, pcoords, subId, cellId, cell)
+            : 0;
+        }))
+  {
+    vtkErrorMacro(<< "IntersectWithLines requires end points with 3 components and the same "
+                  << "number of tuples, a t and a cellIds array.");
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkCellTreeLocator::GenerateRepresentation(int level, vtkPolyData* pd)
 {
@@ -1427,6 +1713,7 @@ void vtkCellTreeLocator::ShallowCopy(vtkAbstractCellLocator* locator)
 
   // vtkAbstractCellLocator parameters
   this->SetNumberOfCellsPerNode(cellLocator->GetNumberOfCellsPerNode());
+  this->SetRefitSearchStructure(cellLocator->GetRefitSearchStructure());
   this->CacheCellBounds = cellLocator->CacheCellBounds;
   this->CellBoundsSharedPtr = cellLocator->CellBoundsSharedPtr; // This is important
   this->CellBounds = this->CellBoundsSharedPtr.get() ? this->CellBoundsSharedPtr->data() : nullptr;
@@ -17,6 +17,7 @@
  * - NumberOfCellsPerNode        (default 8)
  * - CacheCellBounds             (default true)
  * - UseExistingSearchStructure  (default false)
+ * - RefitSearchStructure        (default true)
  *
  * vtkCellTreeLocator does NOT utilize the following parameters:
  * - Automatic
@@ -25,10 +26,25 @@
  * - Tolerance
  * - RetainCellLists
  *
+ * The cell bounds are gathered in parallel, the top of the tree is split level
+ * by level, binning the cells of the large nodes in parallel, and the subtrees
+ * below are then built in parallel. The tree does not depend on the number of
+ * threads.
+ *
+ * When only the point coordinates of the dataset changed since the last build,
+ * the tree is refit instead of being rebuilt (see RefitSearchStructure): the
+ * nodes and the cells assigned to the leaves are kept, and the split planes are
+ * updated bottom-up, one level of the tree at a time in parallel.
+ *
  * @warning
  * This class is templated. It may run slower than serial execution if the code
  * is not optimized during compilation. Build in Release or ReleaseWithDebugInfo.
  *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
  * From the article: "Fast, Memory-Efficient Cell location in Unstructured Grids for Visualization"
  * by Christoph Garth and Kenneth I. Joy in VisWeek, 2011.
  *
@@ -147,6 +163,18 @@ public:
   vtkIdType FindCell(double pos[3], double vtkNotUsed(tol2), vtkGenericCell* cell, int& subId,
     double pcoords[3], double* weights) override;
 
+  ///@{
+  /**
+   * Batched versions of FindCell() and IntersectWithLine(), see
+   * vtkAbstractCellLocator. Reimplemented to query the tree directly from
+   * several threads.
+   */
+  void FindCells(
+    vtkDataArray* points, double tol2, vtkIdTypeArray* cellIds, vtkDoubleArray* pcoords) override;
+  void IntersectWithLines(vtkDataArray* p1, vtkDataArray* p2, double tol, vtkDoubleArray* t,
+    vtkDoubleArray* x, vtkIdTypeArray* cellIds) override;
+  ///@}
+
   ///@{
   /**
    * Satisfy vtkLocator abstract interface.
@@ -170,6 +198,13 @@ protected:
 
   void BuildLocatorInternal() override;
 
+  /**
+   * Update the split planes of the existing tree from the current cell
+   * bounds. Returns false if the tree cannot be refit, in which case it must
+   * be rebuilt.
+   */
+  bool RefitLocatorInternal();
+
   int NumberOfBuckets;
   bool LargeIds = false;
 
@@ -167,6 +167,8 @@ vtkPoints* vtkDataSet::GetPoints()
   vtkNew<vtkDoubleArray> array;
   array->SetNumberOfComponents(3);
   array->SetNumberOfTuples(this->GetNumberOfPoints());
+  // TempPoints is kept by the dataset, so it is filled completely.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(0, this->GetNumberOfPoints(), [&](vtkIdType begin, vtkIdType end) {
     double x[3];
     for (vtkIdType pointId = begin; pointId < end; ++pointId)
@@ -188,6 +190,8 @@ void vtkDataSet::ComputeBounds()
     if (this->GetNumberOfPoints())
     {
       ComputeBoundsFunctor functor(this);
+      // ComputeTime is updated below, so the bounds must be complete.
+      vtkSMPTools::CancellationScope uncancellable(nullptr);
       vtkSMPTools::For(0, this->GetNumberOfPoints(), functor);
       std::copy(functor.Bounds.begin(), functor.Bounds.end(), this->Bounds);
     }
@@ -520,6 +524,8 @@ public:
 void vtkDataSet::GetCellTypes(vtkCellTypes* types)
 {
   DistinctCellTypesWorker worker(this);
+  // Callers allocate per cell type from the result, so it must be complete.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(0, this->GetNumberOfCells(), worker);
   if (types)
   {
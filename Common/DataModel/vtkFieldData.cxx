@@ -783,6 +783,8 @@ bool vtkFieldData::HasAnyGhostBitSet(int bitFlag)
   if (this->GhostArray)
   {
     IsAnyBitSetFunctor isAnyBitSetFunctor(this->GhostArray, bitFlag);
+    // A skipped grain would report ghosts as absent.
+    vtkSMPTools::CancellationScope uncancellable(nullptr);
     vtkSMPTools::For(0, this->GhostArray->GetNumberOfValues(), isAnyBitSetFunctor);
     return isAnyBitSetFunctor.IsAnyBit;
   }
@@ -12,17 +12,22 @@
 #include "vtkDataSetCollection.h"
 #include "vtkFloatArray.h"
 #include "vtkGarbageCollector.h"
+#include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkIntArray.h"
 #include "vtkKdNode.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointSet.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTimerLog.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
@@ -32,6 +37,7 @@
 #include <map>
 #include <queue>
 #include <set>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
@@ -594,6 +600,8 @@ float* vtkKdTree::ComputeCellCenters(int set)
 //------------------------------------------------------------------------------
 float* vtkKdTree::ComputeCellCenters(vtkDataSet* set)
 {
+  // The centers are used to divide the regions, so they must all be computed.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   SCOPETIMER("ComputeCellCenters");
   this->UpdateSubOperationProgress(0);
   int totalCells;
@@ -637,52 +645,60 @@ float* vtkKdTree::ComputeCellCenters(vtkDataSet* set)
     }
   }
 
-  double* weights = new double[maxCellSize];
+  maxCellSize = std::max(maxCellSize, 1);
 
-  float* cptr = center;
-  double dcenter[3];
-
-  if (set)
-  {
-    for (int j = 0; j < totalCells; j++)
+  // The centers of the cells of a data set are computed in parallel, the
+  // thread processing the first cells reports the progress.
+  auto computeCellCenters = [&](vtkDataSet* ds, float* cptr) {
+    const vtkIdType nCells = ds->GetNumberOfCells();
+    if (nCells == 0)
     {
-      this->ComputeCellCenter(set->GetCell(j), dcenter, weights);
-      cptr[0] = static_cast<float>(dcenter[0]);
-      cptr[1] = static_cast<float>(dcenter[1]);
-      cptr[2] = static_cast<float>(dcenter[2]);
-      cptr += 3;
-      if (j % 1000 == 0)
+      return;
+    }
+    // Make GetCell(cellId, vtkGenericCell*) thread safe
+    vtkNew<vtkGenericCell> firstCell;
+    ds->GetCell(0, firstCell);
+
+    vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+    vtkSMPThreadLocal<std::vector<double>> tlWeights;
+    vtkSMPTools::For(0, nCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+      vtkGenericCell* cell = tlCell.Local();
+      std::vector<double>& weights = tlWeights.Local();
+      weights.resize(maxCellSize);
+      const bool isFirst = vtkSMPTools::GetSingleThread();
+      double dcenter[3];
+      for (; cellId < endCellId; ++cellId)
       {
-        this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
+        ds->GetCell(cellId, cell);
+        this->ComputeCellCenter(cell, dcenter, weights.data());
+        cptr[3 * cellId] = static_cast<float>(dcenter[0]);
+        cptr[3 * cellId + 1] = static_cast<float>(dcenter[1]);
+        cptr[3 * cellId + 2] = static_cast<float>(dcenter[2]);
+        if (isFirst && cellId % 1000 == 0)
+        {
+          this->UpdateSubOperationProgress(static_cast<double>(cellId) / totalCells);
+        }
       }
-    }
+    });
+  };
+
+  if (set)
+  {
+    computeCellCenters(set, center);
   }
   else
   {
+    float* cptr = center;
     vtkCollectionSimpleIterator cookie;
     this->DataSets->InitTraversal(cookie);
     for (vtkDataSet* iset = this->DataSets->GetNextDataSet(cookie); iset != nullptr;
          iset = this->DataSets->GetNextDataSet(cookie))
     {
-      int nCells = iset->GetNumberOfCells();
-
-      for (int j = 0; j < nCells; j++)
-      {
-        this->ComputeCellCenter(iset->GetCell(j), dcenter, weights);
-        cptr[0] = static_cast<float>(dcenter[0]);
-        cptr[1] = static_cast<float>(dcenter[1]);
-        cptr[2] = static_cast<float>(dcenter[2]);
-        cptr += 3;
-        if (j % 1000 == 0)
-        {
-          this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
-        }
-      }
+      computeCellCenters(iset, cptr);
+      cptr += 3 * iset->GetNumberOfCells();
     }
   }
 
-  delete[] weights;
-
   this->UpdateSubOperationProgress(1.0);
   return center;
 }
@@ -771,6 +787,8 @@ void vtkKdTree::ForceBuildLocator()
 // Build the kdtree structure based on location of cell centroids.
 void vtkKdTree::BuildLocatorInternal()
 {
+  // The regions are kept until the next build, so it is never cancelled.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   SCOPETIMER("BuildLocator");
 
   this->UpdateProgress(0);
@@ -912,7 +930,7 @@ void vtkKdTree::BuildLocatorInternal()
 
     this->ProgressOffset += this->ProgressScale;
     this->ProgressScale = 0.7;
-    this->DivideRegion(kd, ptarray, nullptr, 0);
+    this->DivideRegionInParallel(kd, ptarray, nullptr);
 
     TIMERDONE("Build tree");
 
@@ -1256,6 +1274,82 @@ int vtkKdTree::DivideTest(int size, int level)
 
 //------------------------------------------------------------------------------
 int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
+{
+  if (!this->SplitRegion(kd, c1, ids, level))
+  {
+    return 0;
+  }
+
+  int nleft = kd->GetLeft()->GetNumberOfPoints();
+
+  int* leftIds = ids;
+  int* rightIds = ids ? ids + nleft : nullptr;
+
+  this->DivideRegion(kd->GetLeft(), c1, leftIds, level + 1);
+
+  this->DivideRegion(kd->GetRight(), c1 + nleft * 3, rightIds, level + 1);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Divide the regions breadth first, the regions of a level being divided in
+// parallel, until there are enough regions to keep the threads busy. Then
+// divide the remaining regions recursively in parallel. The regions do not
+// share any node nor any point, and a region is divided the same way whatever
+// the number of threads, so the tree does not depend on the number of threads.
+void vtkKdTree::DivideRegionInParallel(vtkKdNode* kd, float* c1, int* ids)
+{
+  struct Region
+  {
+    vtkKdNode* Node;
+    float* C1;
+    int* Ids;
+  };
+  std::vector<Region> regions(1, Region{ kd, c1, ids });
+  std::vector<Region> children;
+
+  const size_t minNumberOfRegions =
+    8 * static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads());
+  int level = 0;
+  while (!regions.empty() && regions.size() < minNumberOfRegions)
+  {
+    vtkSMPTools::For(0, static_cast<vtkIdType>(regions.size()), 1,
+      [&](vtkIdType regionId, vtkIdType endRegionId) {
+        for (; regionId < endRegionId; ++regionId)
+        {
+          const Region& region = regions[regionId];
+          this->SplitRegion(region.Node, region.C1, region.Ids, level);
+        }
+      });
+
+    children.clear();
+    for (const Region& region : regions)
+    {
+      if (region.Node->GetLeft())
+      {
+        int nleft = region.Node->GetLeft()->GetNumberOfPoints();
+        children.push_back(Region{ region.Node->GetLeft(), region.C1, region.Ids });
+        children.push_back(Region{ region.Node->GetRight(), region.C1 + nleft * 3,
+          region.Ids ? region.Ids + nleft : nullptr });
+      }
+    }
+    regions.swap(children);
+    level++;
+  }
+
+  vtkSMPTools::For(0, static_cast<vtkIdType>(regions.size()), 1,
+    [&](vtkIdType regionId, vtkIdType endRegionId) {
+      for (; regionId < endRegionId; ++regionId)
+      {
+        const Region& region = regions[regionId];
+        this->DivideRegion(region.Node, region.C1, region.Ids, level);
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+int vtkKdTree::SplitRegion(vtkKdNode* kd, float* c1, int* ids, int level)
 {
   int ok = this->DivideTest(kd->GetNumberOfPoints(), level);
 
@@ -1315,16 +1409,7 @@ int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
     return 0; // unable to divide region further
   }
 
-  int nleft = kd->GetLeft()->GetNumberOfPoints();
-
-  int* leftIds = ids;
-  int* rightIds = ids ? ids + nleft : nullptr;
-
-  this->DivideRegion(kd->GetLeft(), c1, leftIds, level + 1);
-
-  this->DivideRegion(kd->GetRight(), c1 + nleft * 3, rightIds, level + 1);
-
-  return 0;
+  return 1;
 }
 
 //------------------------------------------------------------------------------
@@ -1700,6 +1785,8 @@ void vtkKdTree::BuildLocatorFromPoints(vtkPoints* ptArray)
 //------------------------------------------------------------------------------
 void vtkKdTree::BuildLocatorFromPoints(vtkPoints** ptArrays, int numPtArrays)
 {
+  // As in BuildLocatorInternal(), the build is not cancelled.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   int ptId;
   int i;
 
@@ -1850,14 +1937,20 @@ void vtkKdTree::BuildLocatorFromPoints(vtkPoints** ptArrays, int numPtArrays)
       // Hopefully point arrays are usually floats.  This conversion will
       // really slow things down.
 
-      for (vtkIdType ii = 0; ii < npoints; ii++)
-      {
-        double* pt = ptArrays[i]->GetPoint(ii);
+      vtkPoints* ptArray = ptArrays[i];
+      float* pointsPtr = points + ptId;
+      vtkSMPTools::For(0, npoints, [&](vtkIdType ii, vtkIdType endIi) {
+        double pt[3];
+        for (; ii < endIi; ii++)
+        {
+          ptArray->GetPoint(ii, pt);
 
-        points[ptId++] = static_cast<float>(pt[0]);
-        points[ptId++] = static_cast<float>(pt[1]);
-        points[ptId++] = static_cast<float>(pt[2]);
-      }
+          pointsPtr[3 * ii] = static_cast<float>(pt[0]);
+          pointsPtr[3 * ii + 1] = static_cast<float>(pt[1]);
+          pointsPtr[3 * ii + 2] = static_cast<float>(pt[2]);
+        }
+      });
+      ptId += nvals;
     }
   }
 
@@ -1873,7 +1966,7 @@ void vtkKdTree::BuildLocatorFromPoints(vtkPoints** ptArrays, int numPtArrays)
 
   TIMER("Build tree");
 
-  this->DivideRegion(kd, points, ptIds, 0);
+  this->DivideRegionInParallel(kd, points, ptIds);
 
   this->SetActualLevel();
   this->BuildRegionList();
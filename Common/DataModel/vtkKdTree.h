@@ -34,6 +34,15 @@
  *     tolerance, or you can use FindPoint and FindClosestPoint to
  *     locate points in the original set that the tree was built from.
  *
+ *     The cell centers are computed in parallel, and the top of the tree is
+ *     divided level by level before its subtrees are built in parallel. The
+ *     tree does not depend on the number of threads.
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
  * @sa
  *      vtkLocator vtkCellLocator vtkPKdTree
  */
@@ -768,6 +777,14 @@ protected:
 
   int DivideRegion(vtkKdNode* kd, float* c1, int* ids, int nlevels);
 
+  // Divide the region in parallel, building independent subtrees on
+  // different threads. The resulting tree is the same as DivideRegion's.
+  void DivideRegionInParallel(vtkKdNode* kd, float* c1, int* ids);
+
+  // Divide the region once, creating its two children. Returns 0 if the
+  // region is not divided.
+  int SplitRegion(vtkKdNode* kd, float* c1, int* ids, int nlevels);
+
   void DoMedianFind(vtkKdNode* kd, float* c1, int* ids, int d1, int d2, int d3);
 
   void SelfRegister(vtkKdNode* kd);
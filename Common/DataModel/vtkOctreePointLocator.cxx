@@ -14,7 +14,10 @@
 #include "vtkOctreePointLocatorNode.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 
+#include <algorithm>
 #include <list>
 #include <map>
 #include <queue>
@@ -225,15 +228,11 @@ int vtkOctreePointLocator::DivideTest(int size, int level)
 }
 
 //------------------------------------------------------------------------------
-void vtkOctreePointLocator::DivideRegion(vtkOctreePointLocatorNode* node, int* ordering, int level)
+int vtkOctreePointLocator::SplitRegion(vtkOctreePointLocatorNode* node, int* ordering, int level)
 {
   if (!this->DivideTest(node->GetNumberOfPoints(), level))
   {
-    return;
-  }
-  if (level >= this->Level)
-  {
-    this->Level = level + 1;
+    return 0;
   }
 
   node->CreateChildNodes();
@@ -243,9 +242,11 @@ void vtkOctreePointLocator::DivideRegion(vtkOctreePointLocatorNode* node, int* o
   std::vector<int> points[7];
   int i;
   int subOctantNumberOfPoints[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  double x[3];
   for (i = 0; i < numberOfPoints; i++)
   {
-    int index = node->GetSubOctantIndex(ds->GetPoint(ordering[i]), 0);
+    ds->GetPoint(ordering[i], x);
+    int index = node->GetSubOctantIndex(x, 0);
     if (index)
     {
       points[index - 1].push_back(ordering[i]);
@@ -266,13 +267,96 @@ void vtkOctreePointLocator::DivideRegion(vtkOctreePointLocatorNode* node, int* o
       memcpy(ordering + counter, points[i].data(), subOctantNumberOfPoints[i + 1] * sizeOfInt);
     }
   }
-  counter = 0;
   for (i = 0; i < 8; i++)
   {
     node->GetChild(i)->SetNumberOfPoints(subOctantNumberOfPoints[i]);
-    this->DivideRegion(node->GetChild(i), ordering + counter, level + 1);
-    counter += subOctantNumberOfPoints[i];
   }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkOctreePointLocator::DivideRegion(vtkOctreePointLocatorNode* node, int* ordering, int level)
+{
+  if (!this->SplitRegion(node, ordering, level))
+  {
+    return level;
+  }
+
+  int depth = level + 1;
+  int counter = 0;
+  for (int i = 0; i < 8; i++)
+  {
+    depth = std::max(depth, this->DivideRegion(node->GetChild(i), ordering + counter, level + 1));
+    counter += node->GetChild(i)->GetNumberOfPoints();
+  }
+  return depth;
+}
+
+//------------------------------------------------------------------------------
+// Divide the octants breadth first, the octants of a level being divided in
+// parallel, until there are enough octants to keep the threads busy. Then
+// divide the remaining octants recursively in parallel. The octants do not
+// share any point, so the octree does not depend on the number of threads.
+int vtkOctreePointLocator::DivideRegionInParallel(vtkOctreePointLocatorNode* node, int* ordering)
+{
+  struct Octant
+  {
+    vtkOctreePointLocatorNode* Node;
+    int* Ordering;
+  };
+  std::vector<Octant> octants(1, Octant{ node, ordering });
+  std::vector<Octant> children;
+
+  const size_t minNumberOfOctants =
+    8 * static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads());
+  int level = 0;
+  int depth = 0;
+  while (!octants.empty() && octants.size() < minNumberOfOctants)
+  {
+    vtkSMPTools::For(0, static_cast<vtkIdType>(octants.size()), 1,
+      [&](vtkIdType octantId, vtkIdType endOctantId) {
+        for (; octantId < endOctantId; ++octantId)
+        {
+          this->SplitRegion(octants[octantId].Node, octants[octantId].Ordering, level);
+        }
+      });
+
+    children.clear();
+    for (const Octant& octant : octants)
+    {
+      if (octant.Node->GetChild(0))
+      {
+        int counter = 0;
+        for (int i = 0; i < 8; i++)
+        {
+          children.push_back(Octant{ octant.Node->GetChild(i), octant.Ordering + counter });
+          counter += octant.Node->GetChild(i)->GetNumberOfPoints();
+        }
+      }
+    }
+    octants.swap(children);
+    level++;
+    if (!octants.empty())
+    {
+      depth = level;
+    }
+  }
+
+  vtkSMPThreadLocal<int> tlDepth(depth);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(octants.size()), 1,
+    [&](vtkIdType octantId, vtkIdType endOctantId) {
+      int& localDepth = tlDepth.Local();
+      for (; octantId < endOctantId; ++octantId)
+      {
+        localDepth = std::max(localDepth,
+          this->DivideRegion(octants[octantId].Node, octants[octantId].Ordering, level));
+      }
+    });
+  for (int localDepth : tlDepth)
+  {
+    depth = std::max(depth, localDepth);
+  }
+  return depth;
 }
 
 //------------------------------------------------------------------------------
@@ -302,6 +386,9 @@ void vtkOctreePointLocator::ForceBuildLocator()
 //------------------------------------------------------------------------------
 void vtkOctreePointLocator::BuildLocatorInternal()
 {
+  // A partially sorted octree would silently miss points, so the build is
+  // never cancelled.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   if (!this->DataSet || this->DataSet->GetNumberOfPoints() == 0)
   {
     vtkErrorMacro("No data set");
@@ -399,19 +486,22 @@ void vtkOctreePointLocator::BuildLocatorInternal()
   {
     this->LocatorIds[i] = i;
   }
-  this->DivideRegion(node, this->LocatorIds, 0);
+  this->Level = std::max(this->Level, this->DivideRegionInParallel(node, this->LocatorIds));
   // TODO: may want to directly check if there exists a point array that
   // is of type float and directly copy that instead of dealing with
   // all of the casts
   vtkDataSet* ds = this->GetDataSet();
-  for (i = 0; i < numPoints; i++)
-  {
-    double* pt = ds->GetPoint(this->LocatorIds[i]);
+  vtkSMPTools::For(0, numPoints, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double pt[3];
+    for (; ptId < endPtId; ptId++)
+    {
+      ds->GetPoint(this->LocatorIds[ptId], pt);
 
-    this->LocatorPoints[i * 3] = static_cast<float>(pt[0]);
-    this->LocatorPoints[i * 3 + 1] = static_cast<float>(pt[1]);
-    this->LocatorPoints[i * 3 + 2] = static_cast<float>(pt[2]);
-  }
+      this->LocatorPoints[ptId * 3] = static_cast<float>(pt[0]);
+      this->LocatorPoints[ptId * 3 + 1] = static_cast<float>(pt[1]);
+      this->LocatorPoints[ptId * 3 + 2] = static_cast<float>(pt[2]);
+    }
+  });
 
   int nextLeafNodeId = 0;
   int nextMinId = 0;
@@ -15,6 +15,14 @@
  * This class can also generate a PolyData representation of
  * the boundaries of the spatial regions in the decomposition.
  *
+ * The top of the octree is divided level by level before its subtrees are
+ * built in parallel. The octree does not depend on the number of threads.
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
  * @sa
  * vtkLocator vtkPointLocator vtkOctreePointLocatorNode
  */
@@ -219,7 +227,17 @@ protected:
   // Recursive helper for public FindPointsInArea
   void AddAllPointsInRegion(vtkOctreePointLocatorNode* node, vtkIdTypeArray* ids);
 
-  void DivideRegion(vtkOctreePointLocatorNode* node, int* ordering, int level);
+  // Recursively divide the octant. Returns the level of the deepest leaf
+  // octant below node.
+  int DivideRegion(vtkOctreePointLocatorNode* node, int* ordering, int level);
+
+  // Divide the octant in parallel, building independent subtrees on
+  // different threads. Returns the level of the deepest leaf octant.
+  int DivideRegionInParallel(vtkOctreePointLocatorNode* node, int* ordering);
+
+  // Divide the octant once, creating its eight children. Returns 0 if the
+  // octant is not divided.
+  int SplitRegion(vtkOctreePointLocatorNode* node, int* ordering, int level);
 
   int DivideTest(int size, int level);
 
@@ -1669,10 +1669,13 @@ int vtkOrderedTriangulator::TemplateTriangulation()
       vtkIdType numTets = tets->NumberOfTetras;
       vtkIdType* clist = tets->Tetras;
       OTTetra* tetra;
+      // Keep the order in which the template was recorded, so that a cell is
+      // split into the same sequence of tetrahedra whether or not its
+      // template was already cached.
       for (i = 0; i < numTets; i++)
       {
         tetra = new (this->Heap) OTTetra();
-        this->Mesh->Tetras.push_front(tetra);
+        this->Mesh->Tetras.push_back(tetra);
         tetra->Type = OTTetra::Inside;
         for (j = 0; j < 4; j++)
         {
@@ -346,6 +346,8 @@ void vtkPolyData::ComputeCellsBounds()
         {
           continue;
         }
+        // CellsBounds is cached, so this loop is never cancelled.
+        vtkSMPTools::CancellationScope uncancellable(nullptr);
         // Lambda to threaded mark used points
         vtkSMPTools::For(0, numCells, [&](vtkIdType beginCellId, vtkIdType endCellId) {
           auto cellPointIds = tlCellPointIds.Local();
@@ -744,6 +746,8 @@ struct BuildCellsImpl
     // We use Threshold to test if the data size is small enough
     // to execute the functor serially. This is faster.
     // and also potentially avoids nested multithreading which creates race conditions.
+    // The cells map outlives the caller, so it is never left half built.
+    vtkSMPTools::CancellationScope uncancellable(nullptr);
     vtkSMPTools::For(0, numCells, vtkSMPTools::THRESHOLD, buildCellsOperator);
   }
 };
@@ -385,6 +385,9 @@ template <typename TIds>
 void vtkStaticCellLinksTemplate<TIds>::ThreadedBuildLinksFromMultipleArrays(
   vtkIdType numPts, vtkIdType numCells, const std::vector<vtkCellArray*> cellArrays)
 {
+  // Links are shared by all the users of the dataset, so they are fully built
+  // even when the filter requesting them is aborted.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   // Basic information about the grid
   this->NumPts = numPts;
   this->NumCells = numCells;
@@ -638,6 +641,7 @@ unsigned long vtkStaticCellLinksTemplate<TIds>::GetActualMemorySize()
 template <typename TIds>
 void vtkStaticCellLinksTemplate<TIds>::DeepCopy(vtkStaticCellLinksTemplate* links)
 {
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   if (!links)
   {
     return;
@@ -6,6 +6,7 @@
 #include "vtkBoundingBox.h"
 #include "vtkBox.h"
 #include "vtkCellArray.h"
+#include "vtkCellLocatorBatchQueries.h"
 #include "vtkDoubleArray.h"
 #include "vtkGenericCell.h"
 #include "vtkIdList.h"
@@ -15,9 +16,14 @@
 #include "vtkPlane.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <iterator>
+#include <limits>
 #include <queue>
 #include <vector>
 
@@ -158,6 +164,15 @@ struct vtkCellBinner
 
   vtkIdType GetBinIndex(int ijk[3]) const { return ijk[0] + ijk[1] * xD + ijk[2] * xyD; }
 
+  // Given the bounds of a cell, determine the range of bins it overlaps.
+  void GetBinRange(const double* bds, int ijkMin[3], int ijkMax[3]) const
+  {
+    const double xmin[3] = { bds[0], bds[2], bds[4] };
+    const double xmax[3] = { bds[1], bds[3], bds[5] };
+    this->GetBinIndices(xmin, ijkMin);
+    this->GetBinIndices(xmax, ijkMax);
+  }
+
   // These are helper functions
   vtkIdType CountBins(const int ijkMin[3], const int ijkMax[3])
   {
@@ -175,21 +190,12 @@ struct vtkCellBinner
   {
     double* bds = this->CellBounds + cellId * 6;
     vtkIdType* counts = this->Counts + cellId;
-    double xmin[3], xmax[3];
     int ijkMin[3], ijkMax[3];
 
     for (; cellId < endCellId; ++cellId, bds += 6)
     {
       this->DataSet->GetCellBounds(cellId, bds);
-      xmin[0] = bds[0];
-      xmin[1] = bds[2];
-      xmin[2] = bds[4];
-      xmax[0] = bds[1];
-      xmax[1] = bds[3];
-      xmax[2] = bds[5];
-
-      this->GetBinIndices(xmin, ijkMin);
-      this->GetBinIndices(xmax, ijkMax);
+      this->GetBinRange(bds, ijkMin, ijkMax);
 
       *counts++ = this->CountBins(ijkMin, ijkMax);
     }
@@ -209,6 +215,50 @@ struct vtkCellBinner
     this->NumFragments = total;
   }
 
+  // Recompute the cell bounds after the points of the dataset moved, and
+  // flag in rebinned the cells which now overlap other bins. Returns false,
+  // leaving the locator unchanged, if a cell left the bounds of the locator,
+  // in which case the locator must be rebuilt.
+  bool UpdateCellBounds(std::vector<unsigned char>& rebinned)
+  {
+    auto cellBoundsSharedPtr = std::make_shared<std::vector<double>>(this->NumCells * 6);
+    double* cellBounds = cellBoundsSharedPtr->data();
+    rebinned.assign(this->NumCells, 0);
+
+    // This is done to cause non-thread safe initialization to occur due to
+    // side effects from GetCellBounds().
+    this->DataSet->GetCellBounds(0, cellBounds);
+
+    std::atomic<bool> inside(true);
+    vtkSMPTools::For(0, this->NumCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+      int ijkMin[3], ijkMax[3], newIjkMin[3], newIjkMax[3];
+      for (; cellId < endCellId && inside.load(std::memory_order_relaxed); ++cellId)
+      {
+        double* bds = cellBounds + cellId * 6;
+        this->DataSet->GetCellBounds(cellId, bds);
+        if (bds[0] < this->Bounds[0] || bds[1] > this->Bounds[1] || bds[2] < this->Bounds[2] ||
+          bds[3] > this->Bounds[3] || bds[4] < this->Bounds[4] || bds[5] > this->Bounds[5])
+        {
+          inside = false;
+          break;
+        }
+        this->GetBinRange(this->CellBounds + cellId * 6, ijkMin, ijkMax);
+        this->GetBinRange(bds, newIjkMin, newIjkMax);
+        rebinned[cellId] = !std::equal(ijkMin, ijkMin + 3, newIjkMin) ||
+          !std::equal(ijkMax, ijkMax + 3, newIjkMax);
+      }
+    });
+    if (!inside)
+    {
+      return false;
+    }
+
+    // The previous bounds may be shared with a shallow copy of the locator.
+    this->CellBoundsSharedPtr = cellBoundsSharedPtr;
+    this->CellBounds = cellBounds;
+    return true;
+  }
+
 }; // vtkCellBinner
 
 //------------------------------------------------------------------------------
@@ -244,6 +294,8 @@ struct vtkCellProcessor
   int NumBatches;
   vtkIdType xD, xyD;
   size_t MaxCellSize;
+  // Bookkeeping of the visited cells reused by the single ray queries.
+  vtkCellLocatorBatchQueries::VisitedCellsPool VisitedCellsPool;
 
   vtkCellProcessor() = default;
 
@@ -276,6 +328,9 @@ struct vtkCellProcessor
     const double o[3], const double n[3], double tolerance, vtkIdList* cells) = 0;
   virtual int IntersectWithLine(const double a0[3], const double a1[3], double tol, double& t,
     double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) = 0;
+  virtual int IntersectWithLine(const double a0[3], const double a1[3], double tol, double& t,
+    double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell,
+    vtkCellLocatorBatchQueries::VisitedCells& visited) = 0;
   virtual int IntersectWithLine(const double p1[3], const double p2[3], double tol,
     vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell) = 0;
   virtual bool InsideCellBounds(const double x[3], vtkIdType cellId) = 0;
@@ -285,6 +340,11 @@ struct vtkCellProcessor
 
   // Convenience for computing
   virtual int IsEmpty(vtkIdType binId) = 0;
+
+  // Replace the fragments of the cells flagged in rebinned by the fragments
+  // of their current bounds. Returns false if the fragments no longer fit in
+  // the id type of the processor.
+  virtual bool Rebin(const std::vector<unsigned char>& rebinned) = 0;
 };
 
 namespace
@@ -356,6 +416,9 @@ struct CellProcessor : public vtkCellProcessor
     const double o[3], const double n[3], double tolerance, vtkIdList* cells) override;
   int IntersectWithLine(const double p1[3], const double p2[3], double tol, double& t, double x[3],
     double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) override;
+  int IntersectWithLine(const double p1[3], const double p2[3], double tol, double& t, double x[3],
+    double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell,
+    vtkCellLocatorBatchQueries::VisitedCells& visited) override;
   int IntersectWithLine(const double p1[3], const double p2[3], double tol, vtkPoints* points,
     vtkIdList* cellIds, vtkGenericCell* cell) override;
   bool InsideCellBounds(const double x[3], vtkIdType cellId) override;
@@ -365,6 +428,7 @@ struct CellProcessor : public vtkCellProcessor
   {
     return (this->GetNumberOfIds(static_cast<T>(binId)) > 0 ? 0 : 1);
   }
+  bool Rebin(const std::vector<unsigned char>& rebinned) override;
 
   // This functor is used to perform the final cell binning
   void Initialize() {}
@@ -478,6 +542,65 @@ struct MapOffsets
 
 }; // MapOffsets
 
+//------------------------------------------------------------------------------
+// The fragments of the cells keeping their bins are still sorted by bin, so
+// only the fragments of the rebinned cells are sorted before the two runs are
+// merged, which is cheaper than sorting all the fragments again.
+template <typename T>
+bool CellProcessor<T>::Rebin(const std::vector<unsigned char>& rebinned)
+{
+  std::vector<CellFragments<T>> kept;
+  kept.reserve(this->NumFragments);
+  std::copy_if(this->Map, this->Map + this->NumFragments, std::back_inserter(kept),
+    [&rebinned](const CellFragments<T>& fragment) { return !rebinned[fragment.CellId]; });
+
+  std::vector<CellFragments<T>> added;
+  int ijkMin[3], ijkMax[3];
+  CellFragments<T> fragment;
+  for (vtkIdType cellId = 0; cellId < this->NumCells; ++cellId)
+  {
+    if (!rebinned[cellId])
+    {
+      continue;
+    }
+    this->Binner->GetBinRange(this->CellBounds + cellId * 6, ijkMin, ijkMax);
+    fragment.CellId = static_cast<T>(cellId);
+    for (int k = ijkMin[2]; k <= ijkMax[2]; ++k)
+    {
+      for (int j = ijkMin[1]; j <= ijkMax[1]; ++j)
+      {
+        for (int i = ijkMin[0]; i <= ijkMax[0]; ++i)
+        {
+          fragment.BinId = static_cast<T>(i + j * this->xD + k * this->xyD);
+          added.push_back(fragment);
+        }
+      }
+    }
+  }
+
+  const vtkIdType numFragments = static_cast<vtkIdType>(kept.size() + added.size());
+  if (numFragments >= static_cast<vtkIdType>(std::numeric_limits<T>::max()))
+  {
+    return false;
+  }
+  vtkSMPTools::Sort(added.begin(), added.end());
+
+  // The previous map may be shared with a shallow copy of the locator.
+  this->NumFragments = numFragments;
+  this->MapSharedPtr = std::make_shared<std::vector<CellFragments<T>>>(numFragments + 1);
+  this->Map = this->MapSharedPtr->data();
+  std::merge(kept.begin(), kept.end(), added.begin(), added.end(), this->Map);
+  this->Map[numFragments].BinId = this->NumBins;
+  this->OffsetsShardPtr = std::make_shared<std::vector<T>>(this->NumBins + 1);
+  this->Offsets = this->OffsetsShardPtr->data();
+  this->Offsets[this->NumBins] = numFragments;
+  this->NumBatches =
+    static_cast<int>(std::ceil(static_cast<double>(numFragments) / this->BatchSize));
+  MapOffsets<T> mapOffsets(this);
+  vtkSMPTools::For(0, this->NumBatches, mapOffsets);
+  return true;
+}
+
 //------------------------------------------------------------------------------
 template <typename T>
 vtkIdType CellProcessor<T>::FindCell(
@@ -1132,6 +1255,16 @@ vtkIdType CellProcessor<T>::FindClosestPointWithinRadius(const double x[3], doub
 template <typename T>
 int CellProcessor<T>::IntersectWithLine(const double p1[3], const double p2[3], double tol,
   double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell)
+{
+  vtkCellLocatorBatchQueries::VisitedCellsPool::Lease visited(this->VisitedCellsPool);
+  return this->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId, cellId, cell, visited.Get());
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+int CellProcessor<T>::IntersectWithLine(const double p1[3], const double p2[3], double tol,
+  double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell,
+  vtkCellLocatorBatchQueries::VisitedCells& visited)
 {
   double* bounds = this->Binner->Bounds;
   int* ndivs = this->Binner->Divisions;
@@ -1157,9 +1290,9 @@ int CellProcessor<T>::IntersectWithLine(const double p1[3], const double p2[3],
     return 0; // No intersections possible, line is outside the locator
   }
 
-  // Initialize intersection query array if necessary. This is done
-  // locally to ensure thread safety.
-  std::vector<bool> cellHasBeenVisited(this->NumCells, false);
+  // Clear the cells visited by the previous ray. Each thread uses its own
+  // bookkeeping to ensure thread safety.
+  visited.Reset(this->NumCells);
 
   // Get the i-j-k point of intersection and bin index. This is
   // clamped to the boundary of the locator.
@@ -1198,9 +1331,9 @@ int CellProcessor<T>::IntersectWithLine(const double p1[3], const double p2[3],
       for (i = 0; i < numCellsInBin; i++)
       {
         cId = cellIds[i].CellId;
-        if (!cellHasBeenVisited[cId])
+        if (!visited.IsVisited(cId))
         {
-          cellHasBeenVisited[cId] = true;
+          visited.SetVisited(cId, true);
 
           // check whether we intersect the cell bounds
           int hitCellBounds = vtkBox::IntersectBox(
@@ -1217,7 +1350,7 @@ int CellProcessor<T>::IntersectWithLine(const double p1[3], const double p2[3],
               // intersections can occur behind this bin which are not the correct answer.
               if (!CellProcessor::IsInBounds(binBounds, x, tol))
               {
-                cellHasBeenVisited[cId] = false; // mark the cell non-visited
+                visited.SetVisited(cId, false); // mark the cell non-visited
               }
               else
               {
@@ -1233,7 +1366,7 @@ int CellProcessor<T>::IntersectWithLine(const double p1[3], const double p2[3],
               }
             } // if intersection
           }   // if (hitCellBounds)
-        }     // if (!cellHasBeenVisited[cId])
+        }     // if (!visited.IsVisited(cId))
       }       // over all cells in bin
     }         // if cells in bin
 
@@ -1432,6 +1565,64 @@ int vtkStaticCellLocator::IntersectWithLine(const double p1[3], const double p2[
   return this->Processor->IntersectWithLine(p1, p2, tol, points, cellIds, cell);
 }
 
+//------------------------------------------------------------------------------
+void vtkStaticCellLocator::FindCells(
+  vtkDataArray* points, double, vtkIdTypeArray* cellIds, vtkDoubleArray* pcoords)
+{
+  this->BuildLocator();
+  vtkCellProcessor* processor = this->Processor;
+  if (!vtkCellLocatorBatchQueries::FindCells(this->DataSet, points, cellIds, pcoords,
+        [processor](double x[3], vtkGenericCell* cell, int& subId, double pc[3],
+          double* weights) -> vtkIdType {
+          return processor ? processor->FindCell(x, cell, subId, pc, weights) : -1;
+        }))
+  {
+    vtkErrorMacro(<< "FindCells requires query points with 3 components and a cellIds array.");
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticCellLocator::FindClosestPoints(vtkDataArray* points, vtkDoubleArray* closestPoints,
+  vtkIdTypeArray* cellIds, vtkDoubleArray* dist2)
+{
+  this->BuildLocator();
+  vtkCellProcessor* processor = this->Processor;
+  if (!vtkCellLocatorBatchQueries::FindClosestPoints(points, closestPoints, cellIds, dist2,
+        [processor](const double x[3], double closestPoint[3], vtkGenericCell* cell,
+          vtkIdType& cellId, int& subId, double& d2) {
+          int inside;
+          if (processor)
+          {
+            processor->FindClosestPointWithinRadius(
+              x, vtkMath::Inf(), closestPoint, cell, cellId, subId, d2, inside);
+          }
+        }))
+  {
+    vtkErrorMacro(<< "FindClosestPoints requires query points with 3 components, "
+                  << "a closestPoints and a cellIds array.");
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticCellLocator::IntersectWithLines(vtkDataArray* p1, vtkDataArray* p2, double tol,
+  vtkDoubleArray* t, vtkDoubleArray* x, vtkIdTypeArray* cellIds)
+{
+  this->BuildLocator();
+  vtkCellProcessor* processor = this->Processor;
+  vtkSMPThreadLocal<vtkCellLocatorBatchQueries::VisitedCells> tlVisited;
+  if (!vtkCellLocatorBatchQueries::IntersectWithLines(p1, p2, t, x, cellIds,
+        [processor, tol, &tlVisited](const double a0[3], const double a1[3], double& tHit,
+          double xHit[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) {
+          return processor ? processor->IntersectWithLine(a0, a1, tol, tHit, xHit, pcoords, subId,
+                               cellId, cell, tlVisited.Local())
+                           : 0;
+        }))
+  {
+    vtkErrorMacro(<< "IntersectWithLines requires end points with 3 components and the same "
+                  << "number of tuples, a t and a cellIds array.");
+  }
+}
+
 //------------------------------------------------------------------------------
 bool vtkStaticCellLocator::InsideCellBounds(double x[3], vtkIdType cellId)
 {
@@ -1453,6 +1644,12 @@ void vtkStaticCellLocator::BuildLocator()
     vtkDebugMacro(<< "BuildLocator exited - UseExistingSearchStructure");
     return;
   }
+  // only update the cell bounds if the cells have not been modified
+  if (this->Binner && this->CanRefitSearchStructure() && this->RefitLocatorInternal())
+  {
+    vtkDebugMacro(<< "BuildLocator exited - RefitSearchStructure");
+    return;
+  }
   this->BuildLocatorInternal();
 }
 
@@ -1462,9 +1659,35 @@ void vtkStaticCellLocator::ForceBuildLocator()
   this->BuildLocatorInternal();
 }
 
+//------------------------------------------------------------------------------
+bool vtkStaticCellLocator::RefitLocatorInternal()
+{
+  // Like a build, a refit must not stop halfway.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
+  std::vector<unsigned char> rebinned;
+  if (this->DataSet->GetNumberOfCells() != this->Binner->NumCells ||
+    !this->Binner->UpdateCellBounds(rebinned))
+  {
+    return false;
+  }
+  this->Processor->CellBounds = this->Binner->CellBounds;
+  if (std::find(rebinned.begin(), rebinned.end(), 1) != rebinned.end())
+  {
+    if (!this->Processor->Rebin(rebinned))
+    {
+      return false;
+    }
+    this->Binner->NumFragments = this->Processor->NumFragments;
+  }
+  this->BuildTime.Modified();
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkStaticCellLocator::BuildLocatorInternal()
 {
+  // The bins are reused by later queries, so binning is never cancelled.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkDebugMacro(<< "Building static cell locator");
   vtkIdType numCells;
   if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells()) < 1)
@@ -1712,6 +1935,7 @@ void vtkStaticCellLocator::ShallowCopy(vtkAbstractCellLocator* locator)
 
   // vtkAbstractCellLocator parameters
   this->SetNumberOfCellsPerNode(cellLocator->GetNumberOfCellsPerNode());
+  this->SetRefitSearchStructure(cellLocator->GetRefitSearchStructure());
 
   // vtkStaticCellLocator parameters
   std::copy_n(cellLocator->Bounds, 6, this->Bounds);
@@ -13,11 +13,17 @@
  * threaded (via vtkSMPTools), and supports one-time static construction
  * (i.e., incremental cell insertion is not supported).
  *
+ * When only the point coordinates of the dataset changed since the last build
+ * (see RefitSearchStructure), the cell bounds are recomputed in parallel and
+ * only the cells now overlapping other bins are binned again. The locator is
+ * rebuilt if a cell left its bounds.
+ *
  * @warning
  * vtkStaticCellLocator utilizes the following parent class parameters:
  * - Automatic                   (default true)
  * - NumberOfCellsPerNode        (default 10)
  * - UseExistingSearchStructure  (default false)
+ * - RefitSearchStructure        (default true)
  *
  * vtkStaticCellLocator does NOT utilize the following parameters:
  * - CacheCellBounds             (always cached)
@@ -193,6 +199,20 @@ public:
   vtkIdType FindCell(double x[3], double vtkNotUsed(tol2), vtkGenericCell* GenCell, int& subId,
     double pcoords[3], double* weights) override;
 
+  ///@{
+  /**
+   * Batched versions of FindCell(), FindClosestPoint() and
+   * IntersectWithLine(), see vtkAbstractCellLocator. Reimplemented to query
+   * the bins directly from several threads.
+   */
+  void FindCells(
+    vtkDataArray* points, double tol2, vtkIdTypeArray* cellIds, vtkDoubleArray* pcoords) override;
+  void FindClosestPoints(vtkDataArray* points, vtkDoubleArray* closestPoints,
+    vtkIdTypeArray* cellIds, vtkDoubleArray* dist2) override;
+  void IntersectWithLines(vtkDataArray* p1, vtkDataArray* p2, double tol, vtkDoubleArray* t,
+    vtkDoubleArray* x, vtkIdTypeArray* cellIds) override;
+  ///@}
+
   /**
    * Quickly test if a point is inside the bounds of a particular cell.
    * This function should be used ONLY after the locator is built.
@@ -222,6 +242,13 @@ protected:
 
   void BuildLocatorInternal() override;
 
+  /**
+   * Update the cell bounds of the existing locator and bin again the cells
+   * overlapping other bins. Returns false if a cell left the bounds of the
+   * locator, in which case the locator must be rebuilt.
+   */
+  bool RefitLocatorInternal();
+
   double Bounds[6]; // Bounding box of the whole dataset
   int Divisions[3]; // Number of sub-divisions in x-y-z directions
   double H[3];      // Width of each bin in x-y-z directions
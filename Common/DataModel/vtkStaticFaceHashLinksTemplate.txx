@@ -518,6 +518,8 @@ template <typename TCellOffSetIdType>
 void vtkStaticFaceHashLinksTemplate<TInputIdType, TFaceIdType>::BuildHashLinksInternal(
   vtkUnstructuredGrid* input, GeometryInformation& geometryInfo)
 {
+  // The links are kept once built, so their construction is never cancelled.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   const vtkIdType numberOfCells = input->GetNumberOfCells();
   this->NumberOfHashes = input->GetNumberOfPoints() + 1 /* for the 0D-1D-2D faces */;
   // allocate memory for the cell offsets and face hash values
@@ -564,6 +566,7 @@ template <typename TInputIdType, typename TFaceIdType>
 void vtkStaticFaceHashLinksTemplate<TInputIdType, TFaceIdType>::BuildHashLinks(
   vtkUnstructuredGrid* input)
 {
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   const vtkIdType numberOfCells = input->GetNumberOfCells();
   GeometryInformation geometryInfo;
   geometryInfo.Batches.Initialize(numberOfCells);
@@ -7,6 +7,7 @@
 #include "vtkCellArray.h"
 #include "vtkDataArray.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIntArray.h"
 #include "vtkLine.h"
 #include "vtkMath.h"
@@ -18,6 +19,7 @@
 #include "vtkSMPTools.h"
 #include "vtkStructuredData.h"
 
+#include <algorithm>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -1013,6 +1015,13 @@ struct BucketList : public vtkBucketList
       vtkSMPTools::For(0, this->NumPts, mapper);
     }
 
+    // The sort cannot be interrupted, so skip it if the mapping was cancelled.
+    // The caller then discards the incomplete locator.
+    if (vtkSMPTools::IsCancelled())
+    {
+      return;
+    }
+
     // Now group the points into contiguous runs within buckets (recall that
     // sorting is occurring based on bin/bucket id).
     vtkSMPTools::Sort(this->Map, this->Map + this->NumPts);
@@ -2040,8 +2049,15 @@ void vtkStaticPointLocator::BuildLocatorInternal()
     this->Buckets = new BucketList<int>(this, numPts, numBuckets);
   }
 
-  // Actually construct the locator
+  // Actually construct the locator. If the enclosing vtkSMPTools loops were
+  // cancelled (e.g., the calling filter was aborted), the locator is
+  // incomplete and is discarded.
   this->Buckets->BuildLocator();
+  if (vtkSMPTools::IsCancelled())
+  {
+    this->FreeSearchStructure();
+    return;
+  }
 
   this->BuildTime.Modified();
 }
@@ -2133,8 +2149,14 @@ void vtkStaticPointLocator::BuildLocator(const double* inBounds)
     this->Buckets = new BucketList<int>(this, numPts, numBuckets);
   }
 
-  // Actually construct the locator
+  // Actually construct the locator. An incomplete locator is discarded, as
+  // in BuildLocatorInternal().
   this->Buckets->BuildLocator();
+  if (vtkSMPTools::IsCancelled())
+  {
+    this->FreeSearchStructure();
+    return;
+  }
 
   this->BuildTime.Modified();
 }
@@ -2218,6 +2240,110 @@ void vtkStaticPointLocator::FindClosestNPoints(int N, const double x[3], vtkIdLi
   }
 }
 
+//------------------------------------------------------------------------------
+// Batched queries performed directly on the bucket list.
+namespace
+{
+template <typename TIds>
+struct BatchFindClosestPoints
+{
+  static void Execute(BucketList<TIds>* buckets, vtkDataArray* points, vtkIdTypeArray* closestIds)
+  {
+    vtkSMPTools::For(0, points->GetNumberOfTuples(), [&](vtkIdType queryId, vtkIdType endQueryId) {
+      double x[3];
+      for (; queryId < endQueryId; ++queryId)
+      {
+        points->GetTuple(queryId, x);
+        closestIds->SetValue(queryId, buckets->FindClosestPoint(x));
+      }
+    });
+  }
+
+  static void Execute(
+    BucketList<TIds>* buckets, int N, vtkDataArray* points, vtkIdTypeArray* closestIds)
+  {
+    vtkSMPThreadLocalObject<vtkIdList> tlResult;
+    vtkSMPTools::For(0, points->GetNumberOfTuples(), [&](vtkIdType queryId, vtkIdType endQueryId) {
+      vtkIdList* result = tlResult.Local();
+      double x[3];
+      for (; queryId < endQueryId; ++queryId)
+      {
+        points->GetTuple(queryId, x);
+        result->Reset();
+        buckets->FindClosestNPoints(N, x, result);
+        vtkIdType* ids = closestIds->GetPointer(queryId * N);
+        vtkIdType numFound = std::min<vtkIdType>(result->GetNumberOfIds(), N);
+        std::copy_n(result->GetPointer(0), numFound, ids);
+        std::fill(ids + numFound, ids + N, -1);
+      }
+    });
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkStaticPointLocator::FindClosestPoints(vtkDataArray* points, vtkIdTypeArray* closestIds)
+{
+  if (!points || !closestIds || points->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro(<< "FindClosestPoints requires query points with 3 components "
+                  << "and a closestIds array.");
+    return;
+  }
+  closestIds->SetNumberOfComponents(1);
+  closestIds->SetNumberOfTuples(points->GetNumberOfTuples());
+
+  this->BuildLocator(); // will subdivide if modified; otherwise returns
+  if (!this->Buckets)
+  {
+    closestIds->Fill(-1);
+    return;
+  }
+
+  if (this->LargeIds)
+  {
+    BatchFindClosestPoints<vtkIdType>::Execute(
+      static_cast<BucketList<vtkIdType>*>(this->Buckets), points, closestIds);
+  }
+  else
+  {
+    BatchFindClosestPoints<int>::Execute(
+      static_cast<BucketList<int>*>(this->Buckets), points, closestIds);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticPointLocator::FindClosestPoints(
+  int N, vtkDataArray* points, vtkIdTypeArray* closestIds)
+{
+  if (N < 1 || !points || !closestIds || points->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro(<< "FindClosestPoints requires N > 0, query points with 3 components "
+                  << "and a closestIds array.");
+    return;
+  }
+  closestIds->SetNumberOfComponents(N);
+  closestIds->SetNumberOfTuples(points->GetNumberOfTuples());
+
+  this->BuildLocator(); // will subdivide if modified; otherwise returns
+  if (!this->Buckets)
+  {
+    closestIds->Fill(-1);
+    return;
+  }
+
+  if (this->LargeIds)
+  {
+    BatchFindClosestPoints<vtkIdType>::Execute(
+      static_cast<BucketList<vtkIdType>*>(this->Buckets), N, points, closestIds);
+  }
+  else
+  {
+    BatchFindClosestPoints<int>::Execute(
+      static_cast<BucketList<int>*>(this->Buckets), N, points, closestIds);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkStaticPointLocator::FindPointsWithinRadius(double R, const double x[3], vtkIdList* result)
 {
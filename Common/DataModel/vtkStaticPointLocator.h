@@ -131,6 +131,16 @@ public:
    */
   void FindClosestNPoints(int N, const double x[3], vtkIdList* result) override;
 
+  ///@{
+  /**
+   * Batched versions of FindClosestPoint() and FindClosestNPoints(), see
+   * vtkAbstractPointLocator. Reimplemented to query the buckets directly from
+   * several threads.
+   */
+  void FindClosestPoints(vtkDataArray* points, vtkIdTypeArray* closestIds) override;
+  void FindClosestPoints(int N, vtkDataArray* points, vtkIdTypeArray* closestIds) override;
+  ///@}
+
   /**
    * Find all points within a specified radius R of position x.
    * The result is not sorted in any specific manner.
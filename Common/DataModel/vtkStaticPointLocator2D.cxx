@@ -1759,6 +1759,8 @@ void vtkStaticPointLocator2D::ForceBuildLocator()
 //
 void vtkStaticPointLocator2D::BuildLocatorInternal()
 {
+  // The buckets must hold every point, so the build is not cancelled.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   int ndivs[3];
   int i;
   vtkIdType numPts;
@@ -0,0 +1,236 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkAlgorithm::UpdateAsync updates a pipeline without blocking the
+// calling thread, hands off an output that later executions do not modify,
+// reports the progress, and cancels pending and running updates, also when the
+// executing algorithm is upstream of the updated one or checks for abort from
+// another thread, without resetting the abort flags set by the user. The
+// updates still running when the program exits are canceled.
+
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkUpdateFuture.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+namespace
+{
+// A source producing one point per millisecond.
+class vtkSlowSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkSlowSource* New();
+  vtkTypeMacro(vtkSlowSource, vtkPolyDataAlgorithm);
+
+  vtkSetMacro(NumberOfSteps, int);
+  vtkSetMacro(Value, double);
+  vtkSetMacro(UseHelperThread, bool);
+
+protected:
+  vtkSlowSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector* outInfo) override
+  {
+    vtkNew<vtkPoints> points;
+    auto generate = [&]() {
+      for (int step = 0; step < this->NumberOfSteps; ++step)
+      {
+        if (this->CheckAbort())
+        {
+          break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        points->InsertNextPoint(this->Value, step, 0.0);
+        this->UpdateProgress(static_cast<double>(step) / this->NumberOfSteps);
+      }
+    };
+    // Like the threads of vtkSMPTools, the helper thread does not run the
+    // update itself.
+    if (this->UseHelperThread)
+    {
+      std::thread helper(generate);
+      helper.join();
+    }
+    else
+    {
+      generate();
+    }
+    vtkPolyData::GetData(outInfo)->SetPoints(points);
+    return 1;
+  }
+
+  int NumberOfSteps = 50;
+  double Value = 0.0;
+  bool UseHelperThread = false;
+
+private:
+  vtkSlowSource(const vtkSlowSource&) = delete;
+  void operator=(const vtkSlowSource&) = delete;
+};
+vtkStandardNewMacro(vtkSlowSource);
+
+// A filter passing its input through.
+class vtkPassFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkPassFilter* New();
+  vtkTypeMacro(vtkPassFilter, vtkPolyDataAlgorithm);
+
+protected:
+  vtkPassFilter() = default;
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector** inInfo, vtkInformationVector* outInfo) override
+  {
+    vtkPolyData::GetData(outInfo)->ShallowCopy(vtkPolyData::GetData(inInfo[0]));
+    return 1;
+  }
+
+private:
+  vtkPassFilter(const vtkPassFilter&) = delete;
+  void operator=(const vtkPassFilter&) = delete;
+};
+vtkStandardNewMacro(vtkPassFilter);
+
+using Future = vtkUpdateFuture;
+}
+
+int TestAlgorithmUpdateAsync(int, char*[])
+{
+  vtkNew<vtkSlowSource> source;
+
+  // The update runs while the calling thread keeps going.
+  auto future = source->UpdateAsync();
+  if (future->WaitFor(0.0))
+  {
+    vtkLog(ERROR, "The update should not be done yet.");
+    return EXIT_FAILURE;
+  }
+  vtkPolyData* output = vtkPolyData::SafeDownCast(future->GetOutput());
+  if (future->GetStatus() != Future::SUCCEEDED || !output || output->GetNumberOfPoints() != 50 ||
+    future->GetProgress() != 1.0)
+  {
+    vtkLog(ERROR, "The update did not succeed.");
+    return EXIT_FAILURE;
+  }
+
+  // Later executions do not modify the output handed off.
+  source->SetValue(1.0);
+  auto second = source->UpdateAsync();
+  vtkPolyData* secondOutput = vtkPolyData::SafeDownCast(second->GetOutput());
+  if (!secondOutput || secondOutput->GetPoint(0)[0] != 1.0 || output->GetPoint(0)[0] != 0.0)
+  {
+    vtkLog(ERROR, "The output of the first update was modified.");
+    return EXIT_FAILURE;
+  }
+
+  // Cancel a running update, and the update queued after it.
+  source->SetNumberOfSteps(5000);
+  source->SetValue(2.0);
+  auto running = source->UpdateAsync();
+  auto pending = source->UpdateAsync();
+  while (running->GetStatus() == Future::PENDING)
+  {
+    std::this_thread::yield();
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  auto start = std::chrono::steady_clock::now();
+  pending->Cancel();
+  running->Cancel();
+  running->Wait();
+  double latency = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  pending->Wait();
+  if (running->GetStatus() != Future::CANCELED || running->GetOutput() ||
+    pending->GetStatus() != Future::CANCELED || latency > 1.0)
+  {
+    vtkLog(ERROR, "The updates were not canceled, latency " << latency << " s.");
+    return EXIT_FAILURE;
+  }
+
+  // The pipeline can be updated again after a cancellation.
+  source->SetNumberOfSteps(10);
+  auto last = source->UpdateAsync();
+  output = vtkPolyData::SafeDownCast(last->GetOutput());
+  if (source->GetAbortExecute() || !output || output->GetNumberOfPoints() != 10)
+  {
+    vtkLog(ERROR, "The update after the cancellation failed.");
+    return EXIT_FAILURE;
+  }
+
+  // Canceling the update of a filter aborts the source executing upstream.
+  vtkNew<vtkPassFilter> filter;
+  filter->SetInputConnection(source->GetOutputPort());
+  source->SetNumberOfSteps(5000);
+  auto downstream = filter->UpdateAsync();
+  while (downstream->GetStatus() == Future::PENDING)
+  {
+    std::this_thread::yield();
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  downstream->Cancel();
+  if (!downstream->WaitFor(1.0) || downstream->GetStatus() != Future::CANCELED)
+  {
+    vtkLog(ERROR, "The update of the filter was not canceled.");
+    return EXIT_FAILURE;
+  }
+  source->SetNumberOfSteps(10);
+  // The output is owned by the future.
+  auto filtered = filter->UpdateAsync();
+  output = vtkPolyData::SafeDownCast(filtered->GetOutput());
+  if (source->GetAbortExecute() || filter->GetAbortExecute() || !output ||
+    output->GetNumberOfPoints() != 10)
+  {
+    vtkLog(ERROR, "The update of the filter after the cancellation failed.");
+    return EXIT_FAILURE;
+  }
+
+  // Threads other than the worker thread see the cancellation.
+  source->SetUseHelperThread(true);
+  source->SetNumberOfSteps(5000);
+  auto helper = filter->UpdateAsync();
+  while (helper->GetStatus() == Future::PENDING)
+  {
+    std::this_thread::yield();
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  helper->Cancel();
+  if (!helper->WaitFor(1.0) || helper->GetStatus() != Future::CANCELED)
+  {
+    vtkLog(ERROR, "The update checking for abort from another thread was not canceled.");
+    return EXIT_FAILURE;
+  }
+  source->SetUseHelperThread(false);
+
+  // The abort flags set by the user are kept.
+  source->AbortExecuteOn();
+  auto aborted = filter->UpdateAsync();
+  aborted->Cancel();
+  aborted->Wait();
+  if (!source->GetAbortExecute() || filter->GetAbortExecute())
+  {
+    vtkLog(ERROR, "The abort flags set by the user were not kept.");
+    return EXIT_FAILURE;
+  }
+  source->AbortExecuteOff();
+
+  // Updates left running and pending at exit are canceled, instead of making
+  // the exit wait for them.
+  source->SetNumberOfSteps(600000);
+  auto leftRunning = filter->UpdateAsync();
+  auto leftPending = filter->UpdateAsync();
+  while (leftRunning->GetStatus() == Future::PENDING)
+  {
+    std::this_thread::yield();
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkCachedCompositeDataPipeline restores the outputs of requests
+// already served instead of executing the algorithm, that the cache is
+// discarded when the pipeline is modified, and that the least recently used
+// entries are evicted when the cache exceeds its memory limit.
+
+#include "vtkCachedCompositeDataPipeline.h"
+#include "vtkDataArray.h"
+#include "vtkImageAlgorithm.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// A source producing a 32^3 image filled with the requested time.
+class vtkTimeImageSource : public vtkImageAlgorithm
+{
+public:
+  static vtkTimeImageSource* New();
+  vtkTypeMacro(vtkTimeImageSource, vtkImageAlgorithm);
+
+  int GetNumberOfExecutions() const { return this->NumberOfExecutions; }
+
+protected:
+  vtkTimeImageSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    int extent[6] = { 0, 31, 0, 31, 0, 31 };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent, 6);
+    double times[10];
+    for (int i = 0; i < 10; ++i)
+    {
+      times[i] = i;
+    }
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), times, 10);
+    double range[2] = { times[0], times[9] };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), range, 2);
+    return 1;
+  }
+
+  void ExecuteDataWithInformation(vtkDataObject* data, vtkInformation* outInfo) override
+  {
+    ++this->NumberOfExecutions;
+    vtkImageData* output = this->AllocateOutputData(data, outInfo);
+    double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+    output->GetPointData()->GetScalars()->Fill(time);
+    output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+  }
+
+  int NumberOfExecutions = 0;
+
+private:
+  vtkTimeImageSource(const vtkTimeImageSource&) = delete;
+  void operator=(const vtkTimeImageSource&) = delete;
+};
+vtkStandardNewMacro(vtkTimeImageSource);
+
+bool Check(vtkTimeImageSource* source, double time, int executions, const char* step)
+{
+  source->UpdateTimeStep(time);
+  vtkImageData* output = source->GetOutput();
+  vtkDataArray* scalars = output->GetPointData()->GetScalars();
+  if (!scalars || scalars->GetNumberOfTuples() != 32 * 32 * 32)
+  {
+    std::cerr << step << ": wrong output for time " << time << "." << std::endl;
+    return false;
+  }
+  double range[2];
+  scalars->GetRange(range);
+  if (range[0] != time || range[1] != time ||
+    output->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP()) != time)
+  {
+    std::cerr << step << ": output of time " << range[0] << " instead of " << time << "."
+              << std::endl;
+    return false;
+  }
+  if (source->GetNumberOfExecutions() != executions)
+  {
+    std::cerr << step << ": " << source->GetNumberOfExecutions() << " executions instead of "
+              << executions << " for time " << time << "." << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestCachedCompositeDataPipeline(int, char*[])
+{
+  vtkNew<vtkTimeImageSource> source;
+  vtkNew<vtkCachedCompositeDataPipeline> cache;
+  source->SetExecutive(cache);
+
+  bool success = true;
+
+  // Every time step executes once, going back is served by the cache.
+  for (int t = 0; t < 5; ++t)
+  {
+    success &= ::Check(source, t, t + 1, "forward");
+  }
+  for (int t = 4; t >= 0; --t)
+  {
+    success &= ::Check(source, t, 5, "backward");
+  }
+  if (cache->GetNumberOfCacheEntries() != 5 || cache->GetNumberOfCacheMisses() != 5 ||
+    cache->GetNumberOfCacheHits() != 4)
+  {
+    std::cerr << "Wrong statistics: " << cache->GetNumberOfCacheEntries() << " entries, "
+              << cache->GetNumberOfCacheHits() << " hits, " << cache->GetNumberOfCacheMisses()
+              << " misses." << std::endl;
+    success = false;
+  }
+
+  // Modifying the pipeline discards the cache.
+  source->Modified();
+  success &= ::Check(source, 2, 6, "modified");
+  success &= ::Check(source, 3, 7, "modified");
+  success &= ::Check(source, 2, 7, "modified");
+  if (cache->GetNumberOfCacheEntries() != 2)
+  {
+    std::cerr << "Expecting 2 entries after modification, got "
+              << cache->GetNumberOfCacheEntries() << "." << std::endl;
+    success = false;
+  }
+
+  // Each entry is 256 KiB and a bit more: only the 2 most recently used ones
+  // fit in 600 KiB.
+  cache->SetCacheMemoryLimit(600);
+  success &= ::Check(source, 4, 8, "limited");
+  success &= ::Check(source, 2, 8, "limited");
+  success &= ::Check(source, 5, 9, "limited");
+  success &= ::Check(source, 2, 9, "limited");
+  success &= ::Check(source, 4, 10, "limited");
+  if (cache->GetNumberOfCacheEntries() != 2 ||
+    cache->GetCacheMemorySize() > cache->GetCacheMemoryLimit())
+  {
+    std::cerr << "Expecting 2 entries within the limit, got " << cache->GetNumberOfCacheEntries()
+              << " entries and " << cache->GetCacheMemorySize() << " KiB." << std::endl;
+    success = false;
+  }
+
+  cache->ClearCache();
+  success &= ::Check(source, 2, 11, "cleared");
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
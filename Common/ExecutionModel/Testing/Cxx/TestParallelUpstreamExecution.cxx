@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the independent upstream branches of a filter executed
+// concurrently by vtkCompositeDataPipeline produce the same output as the
+// serial pipeline, that every source executes once, that up to date branches
+// do not execute again, and that failures are reported.
+
+#include "vtkAppendPolyData.h"
+#include "vtkCellArray.h"
+#include "vtkCleanPolyData.h"
+#include "vtkCompositeDataPipeline.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSMPTools.h"
+#include "vtkTestErrorObserver.h"
+#include "vtkTimerLog.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+// A slow source producing a single point.
+class vtkSlowPointSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkSlowPointSource* New();
+  vtkTypeMacro(vtkSlowPointSource, vtkPolyDataAlgorithm);
+
+  vtkSetMacro(Value, double);
+  vtkSetMacro(Fail, bool);
+  int GetNumberOfExecutions() const { return this->NumberOfExecutions; }
+
+protected:
+  vtkSlowPointSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector* outInfo) override
+  {
+    ++this->NumberOfExecutions;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    if (this->Fail)
+    {
+      return 0;
+    }
+    vtkPolyData* output = vtkPolyData::GetData(outInfo);
+    vtkNew<vtkPoints> points;
+    points->InsertNextPoint(this->Value, 0.0, 0.0);
+    output->SetPoints(points);
+    vtkNew<vtkCellArray> verts;
+    verts->InsertNextCell(1);
+    verts->InsertCellPoint(0);
+    output->SetVerts(verts);
+    return 1;
+  }
+
+  double Value = 0.0;
+  bool Fail = false;
+  std::atomic<int> NumberOfExecutions{ 0 };
+
+private:
+  vtkSlowPointSource(const vtkSlowPointSource&) = delete;
+  void operator=(const vtkSlowPointSource&) = delete;
+};
+vtkStandardNewMacro(vtkSlowPointSource);
+
+const int NumberOfSources = 4;
+
+bool CheckExecutions(vtkSlowPointSource* sources[], const int expected[], const char* step)
+{
+  bool success = true;
+  for (int i = 0; i < ::NumberOfSources; ++i)
+  {
+    if (sources[i]->GetNumberOfExecutions() != expected[i])
+    {
+      std::cerr << step << ": source " << i << " executed " << sources[i]->GetNumberOfExecutions()
+                << " times instead of " << expected[i] << "." << std::endl;
+      success = false;
+    }
+  }
+  return success;
+}
+
+bool CheckOutput(vtkPolyData* output, vtkIdType numPts, const char* step)
+{
+  if (output->GetNumberOfPoints() != numPts)
+  {
+    std::cerr << step << ": " << output->GetNumberOfPoints() << " points instead of " << numPts
+              << "." << std::endl;
+    return false;
+  }
+  // The order of the points must be the order of the input connections.
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    if (output->GetPoint(ptId)[0] != static_cast<double>(ptId))
+    {
+      std::cerr << step << ": wrong point " << ptId << "." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestParallelUpstreamExecution(int, char*[])
+{
+  bool success = true;
+
+  // Independent sources feeding an append filter.
+  vtkNew<vtkSlowPointSource> sourceObjects[::NumberOfSources];
+  vtkSlowPointSource* sources[::NumberOfSources];
+  vtkNew<vtkAppendPolyData> append;
+  for (int i = 0; i < ::NumberOfSources; ++i)
+  {
+    sources[i] = sourceObjects[i];
+    sources[i]->SetValue(i);
+    append->AddInputConnection(sources[i]->GetOutputPort());
+  }
+  vtkCompositeDataPipeline* executive =
+    vtkCompositeDataPipeline::SafeDownCast(append->GetExecutive());
+  if (!executive)
+  {
+    std::cerr << "Expecting a vtkCompositeDataPipeline." << std::endl;
+    return EXIT_FAILURE;
+  }
+  executive->ParallelUpstreamExecutionOn();
+
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  append->Update();
+  timer->StopTimer();
+  std::cout << ::NumberOfSources << " branches of 50 ms executed in " << timer->GetElapsedTime()
+            << " s with " << vtkSMPTools::GetEstimatedNumberOfThreads() << " threads."
+            << std::endl;
+  success &= ::CheckOutput(append->GetOutput(), ::NumberOfSources, "first update");
+  const int once[] = { 1, 1, 1, 1 };
+  success &= ::CheckExecutions(sources, once, "first update");
+
+  // Nothing changed, nothing executes.
+  append->Update();
+  success &= ::CheckExecutions(sources, once, "second update");
+
+  // Only the modified branch executes.
+  sources[2]->Modified();
+  append->Update();
+  const int modified[] = { 1, 1, 2, 1 };
+  success &= ::CheckExecutions(sources, modified, "modified source");
+  success &= ::CheckOutput(append->GetOutput(), ::NumberOfSources, "modified source");
+
+  // Branches sharing a source must execute it once: 0 -> clean -> append
+  // and 0 -> append are forwarded serially.
+  vtkNew<vtkCleanPolyData> clean;
+  clean->SetInputConnection(sources[0]->GetOutputPort());
+  vtkNew<vtkAppendPolyData> diamond;
+  diamond->AddInputConnection(clean->GetOutputPort());
+  diamond->AddInputConnection(sources[0]->GetOutputPort());
+  diamond->AddInputConnection(sources[1]->GetOutputPort());
+  vtkCompositeDataPipeline::SafeDownCast(diamond->GetExecutive())->ParallelUpstreamExecutionOn();
+  sources[0]->Modified();
+  sources[1]->Modified();
+  diamond->Update();
+  const int diamondExecutions[] = { 2, 2, 2, 1 };
+  success &= ::CheckExecutions(sources, diamondExecutions, "shared source");
+  if (diamond->GetOutput()->GetNumberOfPoints() != 3)
+  {
+    std::cerr << "shared source: " << diamond->GetOutput()->GetNumberOfPoints()
+              << " points instead of 3." << std::endl;
+    success = false;
+  }
+
+  // A failing branch fails the update, and is reported by the executive.
+  vtkNew<vtkTest::ErrorObserver> sourceObserver;
+  sources[3]->GetExecutive()->AddObserver(vtkCommand::ErrorEvent, sourceObserver);
+  vtkNew<vtkTest::ErrorObserver> appendObserver;
+  executive->AddObserver(vtkCommand::ErrorEvent, appendObserver);
+  sources[3]->SetFail(true);
+  if (executive->Update())
+  {
+    std::cerr << "The update should fail." << std::endl;
+    success = false;
+  }
+  if (!sourceObserver->GetError() ||
+    appendObserver->CheckErrorMessage("input port 0, connection 3") != 0)
+  {
+    std::cerr << "The failure was not reported." << std::endl;
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
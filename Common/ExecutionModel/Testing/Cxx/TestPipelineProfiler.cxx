@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkPipelineProfiler records the requests of every algorithm of a
+// pipeline when enabled, and only then, and that the records are summarized
+// and exported in the Chrome trace format.
+
+#include "vtkAbstractArray.h"
+#include "vtkElevationFilter.h"
+#include "vtkNew.h"
+#include "vtkPipelineProfiler.h"
+#include "vtkSphereSource.h"
+#include "vtkTable.h"
+#include "vtkVariant.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+// Return the summary row of the given algorithm and request, or -1.
+vtkIdType FindRow(vtkTable* summary, vtkAlgorithm* algorithm, const char* request)
+{
+  for (vtkIdType row = 0; row < summary->GetNumberOfRows(); ++row)
+  {
+    if (summary->GetValueByName(row, "Algorithm").ToString() ==
+        algorithm->GetObjectDescription() &&
+      summary->GetValueByName(row, "Request").ToString() == request)
+    {
+      return row;
+    }
+  }
+  return -1;
+}
+}
+
+int TestPipelineProfiler(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+
+  vtkPipelineProfiler::SetEnabled(true);
+  vtkPipelineProfiler::Clear();
+  elevation->Update();
+
+  bool success = true;
+  vtkNew<vtkTable> summary;
+  vtkPipelineProfiler::GetSummary(summary);
+  summary->Dump(20);
+  const char* requests[] = { "RequestInformation", "RequestUpdateExtent", "RequestData" };
+  vtkAlgorithm* algorithms[] = { sphere, elevation };
+  for (vtkAlgorithm* algorithm : algorithms)
+  {
+    for (const char* request : requests)
+    {
+      vtkIdType row = ::FindRow(summary, algorithm, request);
+      if (row < 0 || summary->GetValueByName(row, "Count").ToInt() != 1)
+      {
+        std::cerr << "Expecting one " << request << " for " << algorithm->GetClassName() << "."
+                  << std::endl;
+        success = false;
+      }
+    }
+  }
+  vtkIdType row = ::FindRow(summary, elevation, "RequestData");
+  if (row >= 0 &&
+    (summary->GetValueByName(row, "InputSize").ToInt() <= 0 ||
+      summary->GetValueByName(row, "OutputSize").ToInt() <=
+        summary->GetValueByName(row, "InputSize").ToInt() ||
+      summary->GetValueByName(row, "WallTime").ToDouble() < 0.0))
+  {
+    std::cerr << "Wrong sizes or times for the elevation filter." << std::endl;
+    success = false;
+  }
+
+  std::ostringstream trace;
+  vtkPipelineProfiler::PrintChromeTrace(trace);
+  const std::string json = trace.str();
+  if (json.compare(0, 15, "{\"traceEvents\":") != 0 ||
+    json.find("\"name\":\"vtkElevationFilter\",\"cat\":\"RequestData\",\"ph\":\"X\"") ==
+      std::string::npos)
+  {
+    std::cerr << "Wrong Chrome trace:\n" << json << std::endl;
+    success = false;
+  }
+
+  // Nothing is recorded when the profiler is disabled.
+  const vtkIdType numberOfRecords = vtkPipelineProfiler::GetNumberOfRecords();
+  vtkPipelineProfiler::SetEnabled(false);
+  sphere->Modified();
+  elevation->Update();
+  if (vtkPipelineProfiler::GetNumberOfRecords() != numberOfRecords)
+  {
+    std::cerr << "Requests recorded while the profiler is disabled." << std::endl;
+    success = false;
+  }
+  vtkPipelineProfiler::Clear();
+  if (vtkPipelineProfiler::GetNumberOfRecords() != 0)
+  {
+    std::cerr << "The records were not cleared." << std::endl;
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -31,8 +31,13 @@
 #include "vtkProgressObserver.h"
 #include "vtkSmartPointer.h"
 #include "vtkTable.h"
+#include "vtkThreadedCallbackQueue.h"
 #include "vtkTrivialProducer.h"
+#include "vtkUpdateFuture.h"
 
+#include <cstdlib>
+#include <list>
+#include <mutex>
 #include <set>
 #include <vector>
 #include <vtksys/SystemTools.hxx>
@@ -76,6 +81,91 @@ public:
   }
 };
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Queue executing the asynchronous updates of all the algorithms. It is
+// created on first use and finalized by an exit handler, which runs before
+// the static objects constructed until then are destroyed: the updates still
+// pending are canceled, the running ones are aborted, and the threads of the
+// queue are joined. The instance itself is never deleted, so updates requested
+// after finalization are canceled instead of executed.
+class vtkAsyncUpdateQueue
+{
+public:
+  static vtkAsyncUpdateQueue& GetInstance()
+  {
+    static vtkAsyncUpdateQueue* instance = []() {
+      auto* queue = new vtkAsyncUpdateQueue;
+      std::atexit(&vtkAsyncUpdateQueue::Finalize);
+      return queue;
+    }();
+    return *instance;
+  }
+
+  // Execute run() on a thread of the queue to update future.
+  template <typename RunT>
+  void Push(const vtkSmartPointer<vtkUpdateFuture>& future, RunT run)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    if (!this->Queue)
+    {
+      future->Cancel();
+      run();
+      return;
+    }
+    auto pushed = this->Futures.insert(this->Futures.end(), future);
+    this->Queue->Push([this, run, pushed]() {
+      run();
+      std::lock_guard<std::mutex> runLock(this->Mutex);
+      this->Futures.erase(pushed);
+    });
+  }
+
+  void SetNumberOfThreads(int numberOfThreads)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    if (this->Queue)
+    {
+      this->Queue->SetNumberOfThreads(numberOfThreads);
+    }
+  }
+
+  int GetNumberOfThreads()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    return this->Queue ? this->Queue->GetNumberOfThreads() : 0;
+  }
+
+private:
+  vtkAsyncUpdateQueue() = default;
+
+  static void Finalize()
+  {
+    vtkAsyncUpdateQueue& self = vtkAsyncUpdateQueue::GetInstance();
+    vtkSmartPointer<vtkThreadedCallbackQueue> queue;
+    {
+      std::lock_guard<std::mutex> lock(self.Mutex);
+      for (vtkUpdateFuture* future : self.Futures)
+      {
+        future->Cancel();
+      }
+      queue = self.Queue;
+      self.Queue = nullptr;
+    }
+    // The queue executes its remaining tasks before joining its threads, which
+    // only terminates the canceled updates.
+    queue = nullptr;
+  }
+
+  std::mutex Mutex;
+  vtkSmartPointer<vtkThreadedCallbackQueue> Queue =
+    vtkSmartPointer<vtkThreadedCallbackQueue>::New();
+  // Updates pending or running, removed by their task once terminated.
+  std::list<vtkUpdateFuture*> Futures;
+};
+}
+
 //------------------------------------------------------------------------------
 vtkAlgorithm::vtkAlgorithm()
 {
@@ -173,6 +263,8 @@ void vtkAlgorithm::UpdateProgress(double amount)
 // algorithm's AbortExecute is set. If either is set, return true.
 bool vtkAlgorithm::CheckAbort()
 {
+  vtkUpdateFuture::CheckCancel(this);
+
   if (this->GetAbortExecute())
   {
     this->LastAbortCheckTime.Modified();
@@ -1517,6 +1609,34 @@ void vtkAlgorithm::Update()
   this->Update(port);
 }
 
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkUpdateFuture> vtkAlgorithm::UpdateAsync(int port)
+{
+  if (port < 0 || port >= this->GetNumberOfOutputPorts())
+  {
+    vtkErrorMacro("Attempt to update output port index " << port << " for an algorithm with "
+                                                         << this->GetNumberOfOutputPorts()
+                                                         << " output ports.");
+    return nullptr;
+  }
+  auto future = vtk::TakeSmartPointer(new vtkUpdateFuture(this, port));
+  future->InitializeObjectBase();
+  vtkAsyncUpdateQueue::GetInstance().Push(future, [future]() { future->Run(); });
+  return future;
+}
+
+//------------------------------------------------------------------------------
+void vtkAlgorithm::SetNumberOfAsyncUpdateThreads(int numberOfThreads)
+{
+  vtkAsyncUpdateQueue::GetInstance().SetNumberOfThreads(numberOfThreads);
+}
+
+//------------------------------------------------------------------------------
+int vtkAlgorithm::GetNumberOfAsyncUpdateThreads()
+{
+  return vtkAsyncUpdateQueue::GetInstance().GetNumberOfThreads();
+}
+
 //------------------------------------------------------------------------------
 void vtkAlgorithm::Update(int port)
 {
@@ -22,6 +22,7 @@
 
 #include "vtkCommonExecutionModelModule.h" // For export macro
 #include "vtkObject.h"
+#include "vtkSmartPointer.h"  // For vtkSmartPointer
 #include "vtkWrappingHints.h" // For VTK_MARSHALMANUAL
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -39,6 +40,7 @@ class vtkInformationStringKey;
 class vtkInformationStringVectorKey;
 class vtkInformationVector;
 class vtkProgressObserver;
+class vtkUpdateFuture;
 
 class VTKCOMMONEXECUTIONMODEL_EXPORT VTK_MARSHALMANUAL vtkAlgorithm : public vtkObject
 {
@@ -218,6 +220,13 @@ public:
    */
   bool CheckAbort();
 
+  /**
+   * Return true if setting AbortExecute cancels the vtkSMPTools loops of
+   * RequestData(), i.e. if the executive executes the algorithm in a
+   * vtkSMPTools::CancellationScope on its AbortExecute flag.
+   */
+  vtkGetMacro(CancellableExecution, bool);
+
   ///@{
   /**
    * Set/get a Container algorithm for this algorithm. Allows this algorithm
@@ -565,6 +574,34 @@ public:
   virtual void Update();
   ///@}
 
+  /**
+   * Bring the given output port up-to-date on a background thread, and return
+   * immediately a vtkUpdateFuture to wait for the update, follow its progress,
+   * cancel it and get its output. Returns nullptr if the port does not exist.
+   *
+   * The asynchronous updates of all the algorithms are executed on a shared
+   * vtkThreadedCallbackQueue, one at a time and in the order they were
+   * requested unless SetNumberOfAsyncUpdateThreads() is called. The observers
+   * of the algorithms, e.g. of ProgressEvent, are invoked on the worker
+   * threads, and a pipeline must not be updated by another thread while an
+   * asynchronous update of it is running.
+   *
+   * When the program exits, the updates still pending or running are
+   * canceled and the threads of the queue are joined, before the static
+   * objects constructed before the first asynchronous update are destroyed.
+   */
+  vtkSmartPointer<vtkUpdateFuture> UpdateAsync(int port = 0);
+
+  ///@{
+  /**
+   * Set/Get the number of threads executing the asynchronous updates.
+   * Default is 1. More threads may be used to update independent pipelines
+   * concurrently.
+   */
+  static void SetNumberOfAsyncUpdateThreads(int numberOfThreads);
+  static int GetNumberOfAsyncUpdateThreads();
+  ///@}
+
   /**
    * This method enables the passing of data requests to the algorithm
    * to be used during execution (in addition to bringing a particular
@@ -766,6 +803,15 @@ protected:
   // Arbitrary extra information associated with this algorithm
   vtkInformation* Information;
 
+  /**
+   * Set by algorithms whose RequestData() copes with the grains of its
+   * vtkSMPTools loops being skipped once AbortExecute is set, typically by
+   * calling CheckAbort() after the loops whose results are used afterwards.
+   * The executive then discards the output of a cancelled execution. False
+   * by default.
+   */
+  bool CancellableExecution = false;
+
   /**
    * Checks to see if an upstream filter has been aborted. If an abort
    * has occurred, return true.
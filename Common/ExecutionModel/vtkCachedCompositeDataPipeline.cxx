@@ -0,0 +1,317 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCachedCompositeDataPipeline.h"
+
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkInformationDoubleKey.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkInformationIntegerVectorKey.h"
+#include "vtkInformationKey.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkCachedCompositeDataPipeline);
+
+//------------------------------------------------------------------------------
+class vtkCachedCompositeDataPipeline::vtkInternals
+{
+public:
+  struct Entry
+  {
+    std::string Key;
+    vtkMTimeType PipelineMTime = 0;
+    unsigned long Size = 0;
+    // One item per output port
+    std::vector<vtkSmartPointer<vtkDataObject>> Outputs;
+    std::vector<vtkSmartPointer<vtkInformation>> DataInformation;
+    std::vector<std::vector<int>> CompositeIndices;
+  };
+
+  // Most recently used entries first
+  std::list<Entry> Entries;
+  std::map<std::string, std::list<Entry>::iterator> Index;
+  unsigned long MemorySize = 0;
+  std::vector<vtkInformationKey*> RequestKeys;
+
+  void ResetRequestKeys()
+  {
+    this->RequestKeys = { vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(),
+      vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(),
+      vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(),
+      vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(),
+      vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(),
+      vtkCompositeDataPipeline::UPDATE_COMPOSITE_INDICES() };
+  }
+
+  // Identify the request made on the given output port information.
+  std::string GetKey(int outputPort, vtkInformation* outInfo) const
+  {
+    std::ostringstream key;
+    key.precision(std::numeric_limits<double>::max_digits10);
+    key << outputPort;
+    for (vtkInformationKey* requestKey : this->RequestKeys)
+    {
+      if (outInfo->Has(requestKey))
+      {
+        key << ';' << requestKey->GetLocation() << "::" << requestKey->GetName() << '=';
+        requestKey->Print(key, outInfo);
+      }
+    }
+    return key.str();
+  }
+
+  void Erase(std::list<Entry>::iterator entry)
+  {
+    this->MemorySize -= entry->Size;
+    this->Index.erase(entry->Key);
+    this->Entries.erase(entry);
+  }
+
+  void Clear()
+  {
+    this->Entries.clear();
+    this->Index.clear();
+    this->MemorySize = 0;
+  }
+
+  // Discard the entries produced before the pipeline was last modified.
+  void Prune(vtkMTimeType pipelineMTime)
+  {
+    for (auto it = this->Entries.begin(); it != this->Entries.end();)
+    {
+      auto entry = it++;
+      if (entry->PipelineMTime < pipelineMTime)
+      {
+        this->Erase(entry);
+      }
+    }
+  }
+
+  // Evict the least recently used entries until the cache fits in limit.
+  void Shrink(unsigned long limit)
+  {
+    while (!this->Entries.empty() && this->MemorySize > limit)
+    {
+      this->Erase(std::prev(this->Entries.end()));
+    }
+  }
+
+  // Make room for an entry of the given size and add it, unless it is
+  // larger than the limit.
+  void Insert(Entry&& entry, unsigned long limit)
+  {
+    auto existing = this->Index.find(entry.Key);
+    if (existing != this->Index.end())
+    {
+      this->Erase(existing->second);
+    }
+    if (entry.Size > limit)
+    {
+      return;
+    }
+    this->Shrink(limit - entry.Size);
+    this->MemorySize += entry.Size;
+    this->Entries.push_front(std::move(entry));
+    this->Index[this->Entries.front().Key] = this->Entries.begin();
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkCachedCompositeDataPipeline::vtkCachedCompositeDataPipeline()
+  : Internals(new vtkInternals)
+{
+  this->CacheMemoryLimit = 512 * 1024;
+  this->NumberOfCacheHits = 0;
+  this->NumberOfCacheMisses = 0;
+  this->Internals->ResetRequestKeys();
+}
+
+//------------------------------------------------------------------------------
+vtkCachedCompositeDataPipeline::~vtkCachedCompositeDataPipeline() = default;
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::SetCacheMemoryLimit(unsigned long limit)
+{
+  if (limit == this->CacheMemoryLimit)
+  {
+    return;
+  }
+  this->CacheMemoryLimit = limit;
+  this->Internals->Shrink(limit);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkCachedCompositeDataPipeline::GetCacheMemorySize()
+{
+  return this->Internals->MemorySize;
+}
+
+//------------------------------------------------------------------------------
+int vtkCachedCompositeDataPipeline::GetNumberOfCacheEntries()
+{
+  return static_cast<int>(this->Internals->Entries.size());
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::ClearCache()
+{
+  this->Internals->Clear();
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::AddRequestKey(vtkInformationKey* key)
+{
+  if (key)
+  {
+    this->Internals->RequestKeys.push_back(key);
+    this->Internals->Clear();
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::ResetRequestKeys()
+{
+  this->Internals->ResetRequestKeys();
+  this->Internals->Clear();
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+int vtkCachedCompositeDataPipeline::NeedToExecuteData(
+  int outputPort, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  int result = this->Superclass::NeedToExecuteData(outputPort, inInfoVec, outInfoVec);
+
+  // Nothing to do if the outputs are up to date, or if the algorithm asked
+  // to be executed again.
+  if (!result || outputPort < 0 || this->ContinueExecuting)
+  {
+    return result;
+  }
+
+  vtkInternals* internals = this->Internals.get();
+  internals->Prune(this->GetPipelineMTime());
+  vtkInformation* outInfo = outInfoVec->GetInformationObject(outputPort);
+  auto found = internals->Index.find(internals->GetKey(outputPort, outInfo));
+  if (found == internals->Index.end())
+  {
+    return result;
+  }
+
+  // Check that the cached outputs can be restored into the current ones.
+  const vtkInternals::Entry& entry = *found->second;
+  const int numberOfOutputs = outInfoVec->GetNumberOfInformationObjects();
+  if (static_cast<int>(entry.Outputs.size()) != numberOfOutputs)
+  {
+    return result;
+  }
+  for (int i = 0; i < numberOfOutputs; ++i)
+  {
+    vtkDataObject* output = outInfoVec->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT());
+    if (!output || !entry.Outputs[i] ||
+      strcmp(output->GetClassName(), entry.Outputs[i]->GetClassName()) != 0)
+    {
+      return result;
+    }
+  }
+
+  // Restore the outputs as if the algorithm had just produced them.
+  for (int i = 0; i < numberOfOutputs; ++i)
+  {
+    vtkInformation* info = outInfoVec->GetInformationObject(i);
+    vtkDataObject* output = info->Get(vtkDataObject::DATA_OBJECT());
+    output->ShallowCopy(entry.Outputs[i]);
+    output->GetInformation()->Copy(entry.DataInformation[i]);
+    if (entry.CompositeIndices[i].empty())
+    {
+      info->Remove(DATA_COMPOSITE_INDICES());
+    }
+    else
+    {
+      info->Set(DATA_COMPOSITE_INDICES(), entry.CompositeIndices[i].data(),
+        static_cast<int>(entry.CompositeIndices[i].size()));
+    }
+    output->DataHasBeenGenerated();
+  }
+  this->DataTime.Modified();
+  internals->Entries.splice(internals->Entries.begin(), internals->Entries, found->second);
+  ++this->NumberOfCacheHits;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+int vtkCachedCompositeDataPipeline::ExecuteData(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  const bool continuation = this->ContinueExecuting != 0;
+  int result = this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+  if (!result || continuation || this->ContinueExecuting)
+  {
+    // Streaming algorithms are cached once all their passes completed.
+    return result;
+  }
+  ++this->NumberOfCacheMisses;
+
+  int outputPort = request->Has(FROM_OUTPUT_PORT()) ? request->Get(FROM_OUTPUT_PORT()) : 0;
+  const int numberOfOutputs = outInfoVec->GetNumberOfInformationObjects();
+  if (outputPort < 0 || outputPort >= numberOfOutputs || this->CacheMemoryLimit == 0)
+  {
+    return result;
+  }
+
+  vtkInternals* internals = this->Internals.get();
+  vtkInternals::Entry entry;
+  entry.Key = internals->GetKey(outputPort, outInfoVec->GetInformationObject(outputPort));
+  entry.PipelineMTime = this->GetPipelineMTime();
+  for (int i = 0; i < numberOfOutputs; ++i)
+  {
+    vtkInformation* info = outInfoVec->GetInformationObject(i);
+    vtkDataObject* output = info->Get(vtkDataObject::DATA_OBJECT());
+    if (!output || info->Get(DATA_NOT_GENERATED()))
+    {
+      // Outputs that were not generated cannot be restored.
+      return result;
+    }
+    auto copy = vtk::TakeSmartPointer(output->NewInstance());
+    copy->ShallowCopy(output);
+    auto dataInfo = vtkSmartPointer<vtkInformation>::New();
+    dataInfo->Copy(output->GetInformation());
+    std::vector<int> indices;
+    if (int* ids = info->Get(DATA_COMPOSITE_INDICES()))
+    {
+      indices.assign(ids, ids + info->Length(DATA_COMPOSITE_INDICES()));
+    }
+    entry.Size += copy->GetActualMemorySize();
+    entry.Outputs.push_back(copy);
+    entry.DataInformation.push_back(dataInfo);
+    entry.CompositeIndices.push_back(std::move(indices));
+  }
+  internals->Insert(std::move(entry), this->CacheMemoryLimit);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "CacheMemoryLimit: " << this->CacheMemoryLimit << "\n";
+  os << indent << "CacheMemorySize: " << this->Internals->MemorySize << "\n";
+  os << indent << "NumberOfCacheEntries: " << this->Internals->Entries.size() << "\n";
+  os << indent << "NumberOfCacheHits: " << this->NumberOfCacheHits << "\n";
+  os << indent << "NumberOfCacheMisses: " << this->NumberOfCacheMisses << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkCachedCompositeDataPipeline
+ * @brief   executive caching the outputs of an algorithm per request
+ *
+ * vtkCachedCompositeDataPipeline is a vtkCompositeDataPipeline that keeps the
+ * outputs of its algorithm for the last requests, so that requesting again a
+ * time step, piece or extent already produced restores the outputs instead of
+ * executing the algorithm and its upstream pipeline. This is typically useful
+ * when scrubbing back and forth through time steps with expensive filters. It
+ * can be set as the executive of any algorithm of a pipeline:
+ *
+ * \code{.cpp}
+ * vtkNew<vtkCachedCompositeDataPipeline> cache;
+ * cache->SetCacheMemoryLimit(1024 * 1024); // 1 GiB
+ * filter->SetExecutive(cache);
+ * \endcode
+ *
+ * The cache entries are identified by the values of the request keys found in
+ * the information of the requested output port. By default these are
+ * UPDATE_TIME_STEP, UPDATE_PIECE_NUMBER, UPDATE_NUMBER_OF_PIECES,
+ * UPDATE_NUMBER_OF_GHOST_LEVELS, UPDATE_EXTENT and UPDATE_COMPOSITE_INDICES.
+ * Other keys, e.g. keys used by a downstream algorithm to request a subset of
+ * the arrays, can be added with AddRequestKey(). All the entries are
+ * discarded when the pipeline is modified, since they would no longer match
+ * what the algorithm would produce.
+ *
+ * The entries are shallow copies of the outputs. The cache is bounded by the
+ * memory footprint of the entries (see vtkDataObject::GetActualMemorySize()):
+ * the least recently used entries are evicted first.
+ *
+ * @sa
+ * vtkCachedStreamingDemandDrivenPipeline vtkCompositeDataPipeline
+ */
+
+#ifndef vtkCachedCompositeDataPipeline_h
+#define vtkCachedCompositeDataPipeline_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkCompositeDataPipeline.h"
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkInformationKey;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkCachedCompositeDataPipeline
+  : public vtkCompositeDataPipeline
+{
+public:
+  static vtkCachedCompositeDataPipeline* New();
+  vtkTypeMacro(vtkCachedCompositeDataPipeline, vtkCompositeDataPipeline);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the maximum memory footprint of the cache, in kibibytes (the unit
+   * of vtkDataObject::GetActualMemorySize()). Outputs larger than the limit
+   * are not cached. Default is 512 MiB.
+   */
+  void SetCacheMemoryLimit(unsigned long limit);
+  vtkGetMacro(CacheMemoryLimit, unsigned long);
+  ///@}
+
+  /**
+   * Return the current memory footprint of the cache, in kibibytes.
+   */
+  unsigned long GetCacheMemorySize();
+
+  /**
+   * Return the number of requests whose outputs are cached.
+   */
+  int GetNumberOfCacheEntries();
+
+  ///@{
+  /**
+   * Return the number of requests served from the cache, and the number of
+   * requests that executed the algorithm, since the creation of the
+   * executive.
+   */
+  vtkGetMacro(NumberOfCacheHits, vtkIdType);
+  vtkGetMacro(NumberOfCacheMisses, vtkIdType);
+  ///@}
+
+  /**
+   * Discard all the cache entries.
+   */
+  void ClearCache();
+
+  ///@{
+  /**
+   * Add a key of the output port information identifying the cache entries,
+   * in addition to the default ones, or restore the default keys.
+   */
+  void AddRequestKey(vtkInformationKey* key);
+  void ResetRequestKeys();
+  ///@}
+
+protected:
+  vtkCachedCompositeDataPipeline();
+  ~vtkCachedCompositeDataPipeline() override;
+
+  int NeedToExecuteData(
+    int outputPort, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec) override;
+  int ExecuteData(vtkInformation* request, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec) override;
+
+  unsigned long CacheMemoryLimit;
+  vtkIdType NumberOfCacheHits;
+  vtkIdType NumberOfCacheMisses;
+
+private:
+  vtkCachedCompositeDataPipeline(const vtkCachedCompositeDataPipeline&) = delete;
+  void operator=(const vtkCachedCompositeDataPipeline&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
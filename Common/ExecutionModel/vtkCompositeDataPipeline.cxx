@@ -19,16 +19,21 @@
 #include "vtkInformationObjectBaseKey.h"
 #include "vtkInformationStringKey.h"
 #include "vtkInformationVector.h"
+#include "vtkLogger.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkObjectFactory.h"
 #include "vtkPartitionedDataSetCollection.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredGrid.h"
 #include "vtkTrivialProducer.h"
 #include "vtkUniformGrid.h"
 
+#include <algorithm>
+#include <set>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCompositeDataPipeline);
 
@@ -39,10 +44,82 @@ vtkInformationKeyMacro(vtkCompositeDataPipeline, DATA_COMPOSITE_INDICES, Integer
 vtkInformationKeyMacro(vtkCompositeDataPipeline, SUPPRESS_RESET_PI, Integer);
 vtkInformationKeyMacro(vtkCompositeDataPipeline, BLOCK_AMOUNT_OF_DETAIL, Double);
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Collect the executive and all the executives upstream of it.
+void CollectUpstreamExecutives(vtkExecutive* executive, std::set<vtkExecutive*>& executives)
+{
+  if (!executive || !executives.insert(executive).second)
+  {
+    return;
+  }
+  for (int i = 0; i < executive->GetNumberOfInputPorts(); ++i)
+  {
+    for (int j = 0; j < executive->GetNumberOfInputConnections(i); ++j)
+    {
+      CollectUpstreamExecutives(executive->GetInputExecutive(i, j), executives);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// An input connection, and the upstream branch it belongs to.
+struct UpstreamConnection
+{
+  int Port;
+  int Index;
+  vtkExecutive* Producer;
+  int ProducerPort;
+  int Result;
+
+  // Order of the connections in the serial pipeline
+  bool operator<(const UpstreamConnection& other) const
+  {
+    return this->Port < other.Port || (this->Port == other.Port && this->Index < other.Index);
+  }
+};
+
+struct UpstreamBranch
+{
+  std::vector<UpstreamConnection> Connections;
+  std::set<vtkExecutive*> Executives;
+
+  bool SharesExecutives(const UpstreamBranch& other) const
+  {
+    const auto& smaller =
+      this->Executives.size() < other.Executives.size() ? this->Executives : other.Executives;
+    const auto& larger =
+      this->Executives.size() < other.Executives.size() ? other.Executives : this->Executives;
+    for (vtkExecutive* executive : smaller)
+    {
+      if (larger.count(executive))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Forward the request to the producers of the branch, in order.
+  void Forward(vtkInformation* request)
+  {
+    for (UpstreamConnection& connection : this->Connections)
+    {
+      vtkExecutive* e = connection.Producer;
+      request->Set(vtkExecutive::FROM_OUTPUT_PORT(), connection.ProducerPort);
+      connection.Result =
+        e->ProcessRequest(request, e->GetInputInformation(), e->GetOutputInformation());
+    }
+  }
+};
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 vtkCompositeDataPipeline::vtkCompositeDataPipeline()
 {
   this->InLocalLoop = 0;
+  this->ParallelUpstreamExecution = 0;
   this->InformationCache = vtkInformation::New();
 
   this->GenericRequest = vtkInformation::New();
@@ -699,6 +776,16 @@ int vtkCompositeDataPipeline::ForwardUpstream(vtkInformation* request)
   {
     return 0;
   }
+  if (this->ParallelUpstreamExecution && request->Has(REQUEST_DATA()))
+  {
+    int result = this->ForwardUpstreamConcurrently(request);
+    if (!this->Algorithm->ModifyRequest(request, AfterForward))
+    {
+      return 0;
+    }
+    return result;
+  }
+
   int port = request->Get(FROM_OUTPUT_PORT());
 
   // Forward the request upstream through all input connections.
@@ -735,6 +822,116 @@ int vtkCompositeDataPipeline::ForwardUpstream(vtkInformation* request)
   return result;
 }
 
+//------------------------------------------------------------------------------
+int vtkCompositeDataPipeline::ForwardUpstreamConcurrently(vtkInformation* request)
+{
+  // Group the input connections whose upstream pipelines share an executive
+  // into branches. The connections keep their order within a branch, and the
+  // branches are ordered by their first connection.
+  std::vector<UpstreamBranch> branches;
+  for (int i = 0; i < this->GetNumberOfInputPorts(); ++i)
+  {
+    int nic = this->Algorithm->GetNumberOfInputConnections(i);
+    vtkInformationVector* inVector = this->GetInputInformation()[i];
+    for (int j = 0; j < nic; ++j)
+    {
+      vtkInformation* info = inVector->GetInformationObject(j);
+      vtkExecutive* e;
+      int producerPort;
+      vtkExecutive::PRODUCER()->Get(info, e, producerPort);
+      if (!e)
+      {
+        continue;
+      }
+      UpstreamBranch branch;
+      branch.Connections.push_back(UpstreamConnection{ i, j, e, producerPort, 1 });
+      ::CollectUpstreamExecutives(e, branch.Executives);
+
+      // Merge the branches sharing an executive with this one
+      for (auto it = branches.begin(); it != branches.end();)
+      {
+        if (it->SharesExecutives(branch))
+        {
+          branch.Connections.insert(
+            branch.Connections.end(), it->Connections.begin(), it->Connections.end());
+          branch.Executives.insert(it->Executives.begin(), it->Executives.end());
+          it = branches.erase(it);
+        }
+        else
+        {
+          ++it;
+        }
+      }
+      branches.push_back(std::move(branch));
+    }
+  }
+  for (UpstreamBranch& branch : branches)
+  {
+    std::sort(branch.Connections.begin(), branch.Connections.end());
+  }
+  std::sort(branches.begin(), branches.end(),
+    [](const UpstreamBranch& a, const UpstreamBranch& b) {
+      return a.Connections.front() < b.Connections.front();
+    });
+
+  const vtkIdType numberOfBranches = static_cast<vtkIdType>(branches.size());
+  if (numberOfBranches < 2)
+  {
+    int port = request->Get(FROM_OUTPUT_PORT());
+    for (UpstreamBranch& branch : branches)
+    {
+      branch.Forward(request);
+    }
+    request->Set(FROM_OUTPUT_PORT(), port);
+  }
+  else
+  {
+    // The executives record state in the request (e.g. the output port the
+    // request comes from), so every branch gets its own copy.
+    std::vector<vtkSmartPointer<vtkInformation>> requests(numberOfBranches);
+    for (auto& branchRequest : requests)
+    {
+      branchRequest = vtkSmartPointer<vtkInformation>::New();
+      branchRequest->Copy(request);
+    }
+    vtkLogF(TRACE, "%s forward-upstream-concurrently %lld branches",
+      vtkLogIdentifier(this->Algorithm), static_cast<long long>(numberOfBranches));
+    // Every branch must be updated; the algorithms upstream handle their own
+    // cancellation.
+    vtkSMPTools::CancellationScope uncancellable(nullptr);
+    vtkSMPTools::For(0, numberOfBranches, 1, [&](vtkIdType branchId, vtkIdType endBranchId) {
+      for (; branchId < endBranchId; ++branchId)
+      {
+        branches[branchId].Forward(requests[branchId]);
+      }
+    });
+  }
+
+  // Report the failures in the order of the input connections, whatever the
+  // order in which the branches completed.
+  std::vector<UpstreamConnection> connections;
+  for (const UpstreamBranch& branch : branches)
+  {
+    connections.insert(connections.end(), branch.Connections.begin(), branch.Connections.end());
+  }
+  std::sort(connections.begin(), connections.end());
+  int result = 1;
+  for (const UpstreamConnection& connection : connections)
+  {
+    if (!connection.Result)
+    {
+      if (numberOfBranches > 1)
+      {
+        vtkErrorMacro("Upstream execution failed for input port "
+          << connection.Port << ", connection " << connection.Index << " of algorithm "
+          << this->Algorithm->GetObjectDescription() << ".");
+      }
+      result = 0;
+    }
+  }
+  return result;
+}
+
 //------------------------------------------------------------------------------
 int vtkCompositeDataPipeline::ForwardUpstream(int i, int j, vtkInformation* request)
 {
@@ -1115,5 +1312,7 @@ void vtkCompositeDataPipeline::MarkOutputsGenerated(
 void vtkCompositeDataPipeline::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "ParallelUpstreamExecution: " << this->ParallelUpstreamExecution << endl;
 }
 VTK_ABI_NAMESPACE_END
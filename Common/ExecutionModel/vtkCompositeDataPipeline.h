@@ -25,6 +25,10 @@
  * it will invoke the  vtkStreamingDemandDrivenPipeline passes in a loop,
  * passing a different block each time and will collect the results in a
  * composite dataset.
+ *
+ * Optionally, the REQUEST_DATA pass can be forwarded concurrently to the
+ * independent upstream branches of an algorithm, see
+ * ParallelUpstreamExecution.
  * @sa
  *  vtkCompositeDataSet
  */
@@ -105,6 +109,30 @@ public:
    */
   static vtkInformationDoubleKey* BLOCK_AMOUNT_OF_DETAIL();
 
+  ///@{
+  /**
+   * When on, the REQUEST_DATA pass is forwarded concurrently, with
+   * vtkSMPTools, to the upstream branches of the algorithm that do not share
+   * any executive, e.g., to the readers feeding the inputs of an append
+   * filter. Input connections whose upstream pipelines share an algorithm are
+   * forwarded serially by the same task, so that every algorithm still
+   * executes at most once, from a single thread. The other passes, and the
+   * decision to execute an algorithm (modification times, update extents,
+   * time steps), are unchanged. When some branches fail, the failures are
+   * reported once all the branches completed, in the order of the input
+   * connections. Off by default.
+   *
+   * The algorithms of concurrent branches, and the observers of their
+   * events, must be safe to execute concurrently. In particular, they should
+   * not share objects outside of the pipeline connections. Unless nested
+   * parallelism is enabled (see vtkSMPTools::SetNestedParallelism()), the
+   * vtkSMPTools loops of the algorithms executing in a branch run serially.
+   */
+  vtkSetMacro(ParallelUpstreamExecution, vtkTypeBool);
+  vtkGetMacro(ParallelUpstreamExecution, vtkTypeBool);
+  vtkBooleanMacro(ParallelUpstreamExecution, vtkTypeBool);
+  ///@}
+
 protected:
   vtkCompositeDataPipeline();
   ~vtkCompositeDataPipeline() override;
@@ -112,6 +140,13 @@ protected:
   int ForwardUpstream(vtkInformation* request) override;
   virtual int ForwardUpstream(int i, int j, vtkInformation* request);
 
+  // Forward the request to the independent upstream branches concurrently.
+  // Used by ForwardUpstream() for REQUEST_DATA when
+  // ParallelUpstreamExecution is on.
+  virtual int ForwardUpstreamConcurrently(vtkInformation* request);
+
+  vtkTypeBool ParallelUpstreamExecution;
+
   // Copy information for the given request.
   void CopyDefaultInformation(vtkInformation* request, int direction,
     vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec) override;
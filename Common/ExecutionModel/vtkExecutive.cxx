@@ -14,6 +14,8 @@
 #include "vtkInformationKeyVectorKey.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
+#include "vtkPipelineProfiler.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 
 #include <sstream>
@@ -720,7 +722,24 @@ int vtkExecutive::CallAlgorithm(vtkInformation* request, int direction,
 
   // Invoke the request on the algorithm.
   this->InAlgorithm = 1;
-  int result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  int result;
+  const bool cancellable = this->Algorithm->GetCancellableExecution() &&
+    request->Has(vtkDemandDrivenPipeline::REQUEST_DATA());
+  {
+    // Setting AbortExecute skips the remaining grains of the vtkSMPTools
+    // loops of the algorithms supporting it. The loops of the other
+    // algorithms, such as the internal filters of a cancellable one, are
+    // never cancelled.
+    vtkSMPTools::CancellationScope cancellation(
+      cancellable ? &this->Algorithm->AbortExecute : nullptr);
+    vtkPipelineProfiler::RequestScope profile(this->Algorithm, request, inInfo, outInfo);
+    result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  }
+  if (cancellable && this->Algorithm->GetAbortExecute())
+  {
+    // Skipped grains leave the output incomplete.
+    this->Algorithm->SetAbortOutput(true);
+  }
   this->InAlgorithm = 0;
 
   // If the algorithm failed report it now.
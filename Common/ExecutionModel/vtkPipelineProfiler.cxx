@@ -0,0 +1,419 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPipelineProfiler.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDataObject.h"
+#include "vtkDemandDrivenPipeline.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkSMPTools.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemInformation.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+struct vtkPipelineProfilerRecord
+{
+  std::string ClassName;
+  std::string Algorithm;
+  std::string Request;
+  int Thread;
+  double Start;
+  double WallTime;
+  double CPUTime;
+  int NumberOfThreads;
+  unsigned long InputSize;
+  unsigned long OutputSize;
+  long long MemoryDelta;
+};
+
+//------------------------------------------------------------------------------
+class vtkPipelineProfilerState
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  vtkPipelineProfilerState()
+    : Origin(Clock::now())
+  {
+    std::string value;
+    if (vtksys::SystemTools::GetEnv("VTK_PIPELINE_PROFILER", value) && !value.empty() &&
+      value != "0")
+    {
+      this->Enabled = true;
+      if (vtksys::SystemTools::StringEndsWith(value, ".json"))
+      {
+        this->TraceFileName = value;
+      }
+    }
+  }
+
+  ~vtkPipelineProfilerState()
+  {
+    if (!this->TraceFileName.empty())
+    {
+      vtksys::ofstream os(this->TraceFileName.c_str());
+      this->PrintChromeTrace(os);
+    }
+  }
+
+  double Now() const
+  {
+    return std::chrono::duration<double>(Clock::now() - this->Origin).count();
+  }
+
+  // Small, stable identifiers for the threads of the trace.
+  int GetThread(std::thread::id id)
+  {
+    auto it = this->Threads.find(id);
+    if (it == this->Threads.end())
+    {
+      it = this->Threads.emplace(id, static_cast<int>(this->Threads.size())).first;
+    }
+    return it->second;
+  }
+
+  void Add(vtkPipelineProfilerRecord&& record, std::thread::id id)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    record.Thread = this->GetThread(id);
+    this->Records.push_back(std::move(record));
+  }
+
+  void PrintChromeTrace(ostream& os)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    os << "{\"traceEvents\":[";
+    const char* separator = "\n";
+    for (const auto& record : this->Records)
+    {
+      const double utilization =
+        Utilization(record.CPUTime, record.WallTime, record.NumberOfThreads);
+      os << separator << "{\"name\":\"" << Escape(record.ClassName) << "\",\"cat\":\""
+         << record.Request << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << record.Thread
+         << ",\"ts\":" << static_cast<long long>(record.Start * 1e6)
+         << ",\"dur\":" << static_cast<long long>(record.WallTime * 1e6)
+         << ",\"args\":{\"algorithm\":\"" << Escape(record.Algorithm)
+         << "\",\"cpu_time\":" << record.CPUTime << ",\"thread_utilization\":" << utilization
+         << ",\"input_size_kib\":" << record.InputSize
+         << ",\"output_size_kib\":" << record.OutputSize
+         << ",\"memory_delta_kib\":" << record.MemoryDelta << "}}";
+      separator = ",\n";
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  }
+
+  static double Utilization(double cpuTime, double wallTime, int numberOfThreads)
+  {
+    return wallTime > 0.0 ? cpuTime / (wallTime * std::max(numberOfThreads, 1)) : 0.0;
+  }
+
+  static std::string Escape(const std::string& text)
+  {
+    std::string escaped;
+    for (char c : text)
+    {
+      if (c == '"' || c == '\\')
+      {
+        escaped += '\\';
+        escaped += c;
+      }
+      else if (static_cast<unsigned char>(c) >= 0x20)
+      {
+        escaped += c;
+      }
+    }
+    return escaped;
+  }
+
+  std::atomic<bool> Enabled{ false };
+  std::string TraceFileName;
+  Clock::time_point Origin;
+  std::mutex Mutex;
+  std::vector<vtkPipelineProfilerRecord> Records;
+  std::map<std::thread::id, int> Threads;
+};
+
+vtkPipelineProfilerState& GetState()
+{
+  static vtkPipelineProfilerState state;
+  return state;
+}
+
+//------------------------------------------------------------------------------
+// Memory used by the data objects of an information vector, in KiB.
+unsigned long GetDataSize(vtkInformationVector* infoVec)
+{
+  unsigned long size = 0;
+  for (int i = 0; infoVec && i < infoVec->GetNumberOfInformationObjects(); ++i)
+  {
+    if (vtkDataObject* data = infoVec->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT()))
+    {
+      size += data->GetActualMemorySize();
+    }
+  }
+  return size;
+}
+
+// Resident memory of the process, in KiB. On macOS,
+// vtksys::SystemInformation::GetProcMemoryUsed() runs "ps" in a subprocess,
+// so the Mach task is queried directly instead.
+long long GetProcessMemory()
+{
+#if defined(__APPLE__)
+  mach_task_basic_info_data_t info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info),
+        &count) != KERN_SUCCESS)
+  {
+    return -1;
+  }
+  return static_cast<long long>(info.resident_size / 1024);
+#else
+  static vtksys::SystemInformation info;
+  return info.GetProcMemoryUsed();
+#endif
+}
+}
+
+//------------------------------------------------------------------------------
+class vtkPipelineProfiler::RequestScope::RSInternals
+{
+public:
+  vtkPipelineProfilerRecord Record;
+  vtkInformationVector* OutInfoVec = nullptr;
+  double CPUTime = 0.0;
+  long long Memory = 0;
+};
+
+//------------------------------------------------------------------------------
+vtkPipelineProfiler::RequestScope::RequestScope(vtkAlgorithm* algorithm,
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+  : Internals(nullptr)
+{
+  vtkPipelineProfilerState& state = GetState();
+  if (!state.Enabled || !algorithm || !request)
+  {
+    return;
+  }
+  const char* name = nullptr;
+  bool data = false;
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA()))
+  {
+    name = "RequestData";
+    data = true;
+  }
+  else if (request->Has(vtkDemandDrivenPipeline::REQUEST_INFORMATION()))
+  {
+    name = "RequestInformation";
+  }
+  else if (request->Has(vtkStreamingDemandDrivenPipeline::REQUEST_UPDATE_EXTENT()))
+  {
+    name = "RequestUpdateExtent";
+  }
+  else
+  {
+    return;
+  }
+
+  this->Internals = new RSInternals;
+  vtkPipelineProfilerRecord& record = this->Internals->Record;
+  record.ClassName = algorithm->GetClassName();
+  record.Algorithm = algorithm->GetObjectDescription();
+  record.Request = name;
+  record.NumberOfThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  record.InputSize = 0;
+  record.OutputSize = 0;
+  if (data)
+  {
+    for (int port = 0; port < algorithm->GetNumberOfInputPorts(); ++port)
+    {
+      record.InputSize += GetDataSize(inInfoVec[port]);
+    }
+    this->Internals->OutInfoVec = outInfoVec;
+  }
+  this->Internals->Memory = GetProcessMemory();
+  this->Internals->CPUTime = vtkTimerLog::GetCPUTime();
+  record.Start = state.Now();
+}
+
+//------------------------------------------------------------------------------
+vtkPipelineProfiler::RequestScope::~RequestScope()
+{
+  if (!this->Internals)
+  {
+    return;
+  }
+  vtkPipelineProfilerState& state = GetState();
+  vtkPipelineProfilerRecord& record = this->Internals->Record;
+  record.WallTime = state.Now() - record.Start;
+  record.CPUTime = vtkTimerLog::GetCPUTime() - this->Internals->CPUTime;
+  record.MemoryDelta = GetProcessMemory() - this->Internals->Memory;
+  record.OutputSize = GetDataSize(this->Internals->OutInfoVec);
+  state.Add(std::move(record), std::this_thread::get_id());
+  delete this->Internals;
+}
+
+//------------------------------------------------------------------------------
+vtkPipelineProfiler::vtkPipelineProfiler() = default;
+
+//------------------------------------------------------------------------------
+vtkPipelineProfiler::~vtkPipelineProfiler() = default;
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::SetEnabled(bool enabled)
+{
+  GetState().Enabled = enabled;
+}
+
+//------------------------------------------------------------------------------
+bool vtkPipelineProfiler::GetEnabled()
+{
+  return GetState().Enabled;
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::Clear()
+{
+  vtkPipelineProfilerState& state = GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  state.Records.clear();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkPipelineProfiler::GetNumberOfRecords()
+{
+  vtkPipelineProfilerState& state = GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  return static_cast<vtkIdType>(state.Records.size());
+}
+
+//------------------------------------------------------------------------------
+bool vtkPipelineProfiler::WriteChromeTrace(const std::string& fileName)
+{
+  vtksys::ofstream os(fileName.c_str());
+  if (!os)
+  {
+    return false;
+  }
+  GetState().PrintChromeTrace(os);
+  return static_cast<bool>(os);
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::PrintChromeTrace(ostream& os)
+{
+  GetState().PrintChromeTrace(os);
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::GetSummary(vtkTable* summary)
+{
+  if (!summary)
+  {
+    return;
+  }
+  vtkNew<vtkStringArray> algorithms;
+  algorithms->SetName("Algorithm");
+  vtkNew<vtkStringArray> requests;
+  requests->SetName("Request");
+  vtkNew<vtkIdTypeArray> counts;
+  counts->SetName("Count");
+  vtkNew<vtkDoubleArray> wallTimes;
+  wallTimes->SetName("WallTime");
+  vtkNew<vtkDoubleArray> cpuTimes;
+  cpuTimes->SetName("CPUTime");
+  vtkNew<vtkDoubleArray> utilizations;
+  utilizations->SetName("ThreadUtilization");
+  vtkNew<vtkIdTypeArray> inputSizes;
+  inputSizes->SetName("InputSize");
+  vtkNew<vtkIdTypeArray> outputSizes;
+  outputSizes->SetName("OutputSize");
+  vtkNew<vtkIdTypeArray> memoryDeltas;
+  memoryDeltas->SetName("MemoryDelta");
+
+  vtkPipelineProfilerState& state = GetState();
+  {
+    std::lock_guard<std::mutex> lock(state.Mutex);
+    std::map<std::pair<std::string, std::string>, vtkIdType> rows;
+    std::vector<double> threadTimes;
+    for (const auto& record : state.Records)
+    {
+      auto inserted = rows.emplace(
+        std::make_pair(record.Algorithm, record.Request), algorithms->GetNumberOfValues());
+      const vtkIdType row = inserted.first->second;
+      if (inserted.second)
+      {
+        algorithms->InsertNextValue(record.Algorithm);
+        requests->InsertNextValue(record.Request);
+        counts->InsertNextValue(0);
+        wallTimes->InsertNextValue(0.0);
+        cpuTimes->InsertNextValue(0.0);
+        utilizations->InsertNextValue(0.0);
+        inputSizes->InsertNextValue(0);
+        outputSizes->InsertNextValue(0);
+        memoryDeltas->InsertNextValue(0);
+        threadTimes.push_back(0.0);
+      }
+      counts->SetValue(row, counts->GetValue(row) + 1);
+      wallTimes->SetValue(row, wallTimes->GetValue(row) + record.WallTime);
+      cpuTimes->SetValue(row, cpuTimes->GetValue(row) + record.CPUTime);
+      threadTimes[row] += record.WallTime * std::max(record.NumberOfThreads, 1);
+      inputSizes->SetValue(
+        row, std::max(inputSizes->GetValue(row), static_cast<vtkIdType>(record.InputSize)));
+      outputSizes->SetValue(
+        row, std::max(outputSizes->GetValue(row), static_cast<vtkIdType>(record.OutputSize)));
+      memoryDeltas->SetValue(
+        row, memoryDeltas->GetValue(row) + static_cast<vtkIdType>(record.MemoryDelta));
+    }
+    for (vtkIdType row = 0; row < utilizations->GetNumberOfValues(); ++row)
+    {
+      utilizations->SetValue(
+        row, threadTimes[row] > 0.0 ? cpuTimes->GetValue(row) / threadTimes[row] : 0.0);
+    }
+  }
+
+  summary->Initialize();
+  summary->AddColumn(algorithms);
+  summary->AddColumn(requests);
+  summary->AddColumn(counts);
+  summary->AddColumn(wallTimes);
+  summary->AddColumn(cpuTimes);
+  summary->AddColumn(utilizations);
+  summary->AddColumn(inputSizes);
+  summary->AddColumn(outputSizes);
+  summary->AddColumn(memoryDeltas);
+}
+
+//------------------------------------------------------------------------------
+void vtkPipelineProfiler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << vtkPipelineProfiler::GetEnabled() << "\n";
+  os << indent << "NumberOfRecords: " << vtkPipelineProfiler::GetNumberOfRecords() << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPipelineProfiler
+ * @brief   record the execution of the requests of every algorithm
+ *
+ * vtkPipelineProfiler records, for every algorithm of every pipeline, the
+ * REQUEST_INFORMATION, REQUEST_UPDATE_EXTENT and REQUEST_DATA requests
+ * processed by the algorithm. Unlike vtkExecutionTimer, there is nothing to
+ * attach to the algorithms: once enabled, the executives report every request
+ * to the profiler. For each request, the profiler records:
+ *
+ * - the wall clock time and the CPU time of the process, in seconds,
+ * - the thread utilization, i.e., the CPU time divided by the wall clock time
+ *   and the number of threads of vtkSMPTools, which tells how well the
+ *   threaded parts of the algorithm use the available threads,
+ * - the memory size of the inputs and outputs (for REQUEST_DATA), and the
+ *   change of the memory used by the process, in kibibytes.
+ *
+ * The profiler is disabled by default. It can be enabled with SetEnabled(),
+ * or by setting the environment variable VTK_PIPELINE_PROFILER to a value
+ * other than 0. If the value of the environment variable is a file name
+ * ending with ".json", the recorded requests are written to this file in the
+ * Chrome trace format when the program exits.
+ *
+ * The recorded requests can be exported in the Chrome trace event format
+ * (see WriteChromeTrace()), which can be loaded in chrome://tracing or
+ * https://ui.perfetto.dev, or summarized in a vtkTable with one row per
+ * algorithm and request type (see GetSummary()).
+ *
+ * \code{.cpp}
+ * vtkPipelineProfiler::SetEnabled(true);
+ * writer->Update();
+ * vtkPipelineProfiler::WriteChromeTrace("pipeline.json");
+ * vtkNew<vtkTable> summary;
+ * vtkPipelineProfiler::GetSummary(summary);
+ * \endcode
+ *
+ * @warning
+ * The CPU time is the time of the whole process: when algorithms execute
+ * concurrently (see vtkCompositeDataPipeline::SetParallelUpstreamExecution()),
+ * or when other threads are busy, the CPU time and the thread utilization of
+ * an algorithm also account for the other threads. The same holds for the
+ * memory change.
+ *
+ * @sa
+ * vtkExecutionTimer vtkTimerLog vtkLogger
+ */
+
+#ifndef vtkPipelineProfiler_h
+#define vtkPipelineProfiler_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <string> // For std::string
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAlgorithm;
+class vtkInformation;
+class vtkInformationVector;
+class vtkTable;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkPipelineProfiler : public vtkObject
+{
+public:
+  vtkAbstractTypeMacro(vtkPipelineProfiler, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Enable or disable the recording of the requests. The initial value is
+   * given by the environment variable VTK_PIPELINE_PROFILER.
+   */
+  static void SetEnabled(bool enabled);
+  static bool GetEnabled();
+  ///@}
+
+  /**
+   * Discard the recorded requests.
+   */
+  static void Clear();
+
+  /**
+   * Return the number of recorded requests.
+   */
+  static vtkIdType GetNumberOfRecords();
+
+  ///@{
+  /**
+   * Write the recorded requests in the Chrome trace event format. Each
+   * request is a complete event named after the class of the algorithm, in
+   * the category of the request, on the thread that processed it. The other
+   * recorded values are the arguments of the event. WriteChromeTrace()
+   * returns false if the file cannot be written.
+   */
+  static bool WriteChromeTrace(const std::string& fileName);
+  static void PrintChromeTrace(ostream& os);
+  ///@}
+
+  /**
+   * Fill the table with one row per algorithm and request type, in the order
+   * of their first execution. The columns are "Algorithm", "Request",
+   * "Count", the total "WallTime" and "CPUTime", the "ThreadUtilization",
+   * the largest "InputSize" and "OutputSize", and the total "MemoryDelta".
+   */
+  static void GetSummary(vtkTable* summary);
+
+#if !defined(__WRAP__)
+  /**
+   * Record the request processed by an algorithm during the lifetime of the
+   * scope, if the profiler is enabled. Used by vtkExecutive::CallAlgorithm().
+   */
+  class VTKCOMMONEXECUTIONMODEL_EXPORT RequestScope
+  {
+  public:
+    RequestScope(vtkAlgorithm* algorithm, vtkInformation* request,
+      vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec);
+    ~RequestScope();
+
+  private:
+    RequestScope(const RequestScope&) = delete;
+    void operator=(const RequestScope&) = delete;
+    class RSInternals;
+    RSInternals* Internals;
+  };
+#endif
+
+protected:
+  vtkPipelineProfiler();
+  ~vtkPipelineProfiler() override;
+
+private:
+  vtkPipelineProfiler(const vtkPipelineProfiler&) = delete;
+  void operator=(const vtkPipelineProfiler&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -458,6 +458,8 @@ void vtkSpanSpace::Initialize()
 // reconstructs the tree if necessary.
 void vtkSpanSpace::BuildTree()
 {
+  // The tree is reused until the scalars change, so its build is not cancelled.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkIdType numCells;
 
   // Check input...see whether we have to rebuild
@@ -1033,6 +1033,8 @@ void vtkSphereTree::Build()
 //------------------------------------------------------------------------------
 void vtkSphereTree::Build(vtkDataSet* input)
 {
+  // BuildTime marks the spheres as valid, so they are never left half computed.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   this->SetDataSet(input);
 
   if (this->Tree != nullptr && this->Hierarchy != nullptr && this->BuildTime > this->MTime &&
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkUpdateFuture.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkCallbackCommand.h"
+#include "vtkCommand.h"
+#include "vtkDataObject.h"
+#include "vtkExecutive.h"
+#include "vtkInformation.h"
+#include "vtkNew.h"
+
+#include <chrono>
+#include <set>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// The asynchronous update executed by the calling thread, if any.
+VTK_THREAD_LOCAL vtkUpdateFuture* CurrentUpdate = nullptr;
+
+//------------------------------------------------------------------------------
+void CollectUpstreamAlgorithms(vtkAlgorithm* algorithm, std::set<vtkAlgorithm*>& visited,
+  std::vector<vtkSmartPointer<vtkAlgorithm>>& algorithms)
+{
+  if (!algorithm || !visited.insert(algorithm).second)
+  {
+    return;
+  }
+  algorithms.emplace_back(algorithm);
+  for (int port = 0; port < algorithm->GetNumberOfInputPorts(); ++port)
+  {
+    for (int index = 0; index < algorithm->GetNumberOfInputConnections(port); ++index)
+    {
+      ::CollectUpstreamAlgorithms(algorithm->GetInputAlgorithm(port, index), visited, algorithms);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void ProgressCallback(vtkObject*, unsigned long, void* clientData, void* callData)
+{
+  static_cast<std::atomic<double>*>(clientData)->store(*static_cast<double*>(callData));
+}
+}
+
+//------------------------------------------------------------------------------
+vtkUpdateFuture::vtkUpdateFuture(vtkAlgorithm* algorithm, int port)
+  : Algorithm(algorithm)
+  , Port(port)
+  , UpdateStatus(PENDING)
+  , Progress(0.0)
+  , CancelRequested(false)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkUpdateFuture::~vtkUpdateFuture() = default;
+
+//------------------------------------------------------------------------------
+void vtkUpdateFuture::Wait() const
+{
+  std::unique_lock<std::mutex> lock(this->Mutex);
+  this->ConditionVariable.wait(lock, [this] { return this->IsReady(); });
+}
+
+//------------------------------------------------------------------------------
+bool vtkUpdateFuture::WaitFor(double seconds) const
+{
+  std::unique_lock<std::mutex> lock(this->Mutex);
+  return this->ConditionVariable.wait_for(
+    lock, std::chrono::duration<double>(seconds), [this] { return this->IsReady(); });
+}
+
+//------------------------------------------------------------------------------
+vtkDataObject* vtkUpdateFuture::GetOutput()
+{
+  this->Wait();
+  return this->Output;
+}
+
+//------------------------------------------------------------------------------
+void vtkUpdateFuture::Cancel()
+{
+  this->CancelRequested = true;
+  std::lock_guard<std::mutex> lock(this->Mutex);
+  if (this->UpdateStatus == RUNNING)
+  {
+    // Set the flags from the calling thread, so that the algorithms see them
+    // from any thread, including the threads of vtkSMPTools.
+    for (vtkAlgorithm* algorithm : this->PipelineAlgorithms)
+    {
+      this->Abort(algorithm);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkUpdateFuture::Abort(vtkAlgorithm* algorithm)
+{
+  // Flags already set, e.g. by the user, are left as they are.
+  if (!algorithm->GetAbortExecute())
+  {
+    algorithm->SetAbortExecuteAndUpdateTime();
+    this->AbortedAlgorithms.emplace_back(algorithm);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkUpdateFuture::CheckCancel(vtkAlgorithm* algorithm)
+{
+  // The algorithms of the updated pipeline are aborted by Cancel(). This
+  // catches the algorithms of internal pipelines executed by the worker
+  // thread.
+  vtkUpdateFuture* self = ::CurrentUpdate;
+  if (!self || !self->CancelRequested || algorithm->GetAbortExecute())
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(self->Mutex);
+  self->Abort(algorithm);
+}
+
+//------------------------------------------------------------------------------
+void vtkUpdateFuture::Finish(int status)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    for (vtkAlgorithm* algorithm : this->AbortedAlgorithms)
+    {
+      algorithm->SetAbortExecute(0);
+    }
+    this->AbortedAlgorithms.clear();
+    this->PipelineAlgorithms.clear();
+    this->UpdateStatus = status;
+  }
+  this->ConditionVariable.notify_all();
+}
+
+//------------------------------------------------------------------------------
+void vtkUpdateFuture::Run()
+{
+  vtkAlgorithm* algorithm = this->Algorithm;
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    std::set<vtkAlgorithm*> visited;
+    ::CollectUpstreamAlgorithms(algorithm, visited, this->PipelineAlgorithms);
+    this->UpdateStatus = RUNNING;
+  }
+  if (this->CancelRequested)
+  {
+    this->Finish(CANCELED);
+    return;
+  }
+
+  vtkNew<vtkCallbackCommand> progressObserver;
+  progressObserver->SetCallback(::ProgressCallback);
+  progressObserver->SetClientData(&this->Progress);
+  unsigned long tag = algorithm->AddObserver(vtkCommand::ProgressEvent, progressObserver);
+  vtkUpdateFuture* previousUpdate = ::CurrentUpdate;
+  ::CurrentUpdate = this;
+  int result = algorithm->GetExecutive()->Update(this->Port);
+  ::CurrentUpdate = previousUpdate;
+  algorithm->RemoveObserver(tag);
+
+  vtkInformation* outInfo = algorithm->GetOutputInformation(this->Port);
+  if (this->CancelRequested || (outInfo && outInfo->Get(vtkAlgorithm::ABORTED())))
+  {
+    this->Finish(CANCELED);
+    return;
+  }
+  vtkDataObject* output = algorithm->GetOutputDataObject(this->Port);
+  if (!result || !output)
+  {
+    this->Finish(FAILED);
+    return;
+  }
+
+  // Hand off a copy that later executions of the pipeline do not modify.
+  this->Output = vtk::TakeSmartPointer(output->NewInstance());
+  this->Output->ShallowCopy(output);
+  this->Progress = 1.0;
+  this->Finish(SUCCEEDED);
+}
+
+//------------------------------------------------------------------------------
+void vtkUpdateFuture::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Algorithm: " << this->Algorithm.Get() << "\n";
+  os << indent << "Port: " << this->Port << "\n";
+  os << indent << "Status: " << this->UpdateStatus << "\n";
+  os << indent << "Progress: " << this->Progress << "\n";
+  os << indent << "CancelRequested: " << this->CancelRequested << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class vtkUpdateFuture
+ * @brief handle on an asynchronous update of an algorithm
+ *
+ * vtkUpdateFuture is returned by vtkAlgorithm::UpdateAsync(). It allows to
+ * wait for the update, to follow its progress, to cancel it and to get its
+ * output. All its methods are thread safe.
+ *
+ * @code
+ *   auto future = reader->UpdateAsync();
+ *   // ... keep serving, poll future->IsReady() or future->GetProgress() ...
+ *   if (vtkDataObject* output = future->GetOutput())
+ *   {
+ *     // use output
+ *   }
+ * @endcode
+ *
+ * The output of a future is a shallow copy of the output of the algorithm, made
+ * on the worker thread as soon as the update completes: it is owned by the
+ * future and is not modified by later executions of the pipeline, so it can be
+ * safely handed over to the calling thread.
+ *
+ * Cancel() sets the AbortExecute flag of every algorithm of the pipeline being
+ * updated, so that vtkAlgorithm::CheckAbort() returns true from any thread,
+ * including the threads of vtkSMPTools. The algorithms of internal pipelines
+ * executed by the worker thread are aborted when they call CheckAbort(). The
+ * flags set this way are reset when the update terminates, while the flags
+ * already set by the user are left as they are.
+ *
+ * @sa
+ * vtkAlgorithm
+ */
+
+#ifndef vtkUpdateFuture_h
+#define vtkUpdateFuture_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkObject.h"
+#include "vtkSmartPointer.h" // For vtkSmartPointer
+
+#include <atomic>             // For std::atomic
+#include <condition_variable> // For std::condition_variable
+#include <mutex>              // For std::mutex
+#include <vector>             // For std::vector
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAlgorithm;
+class vtkDataObject;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkUpdateFuture : public vtkObject
+{
+public:
+  vtkAbstractTypeMacro(vtkUpdateFuture, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  enum Status
+  {
+    PENDING,
+    RUNNING,
+    SUCCEEDED,
+    FAILED,
+    CANCELED
+  };
+
+  /**
+   * Return the status of the update.
+   */
+  int GetStatus() const { return this->UpdateStatus; }
+
+  /**
+   * Return true when the update has terminated, whatever its status.
+   */
+  bool IsReady() const { return this->UpdateStatus > RUNNING; }
+
+  /**
+   * Block the calling thread until the update has terminated.
+   */
+  void Wait() const;
+
+  /**
+   * Block the calling thread until the update has terminated, or until the
+   * given number of seconds has elapsed. Return true if the update has
+   * terminated.
+   */
+  bool WaitFor(double seconds) const;
+
+  /**
+   * Return the progress of the update, between 0 and 1.
+   */
+  double GetProgress() const { return this->Progress; }
+
+  /**
+   * Request the cancellation of the update and return immediately. A pending
+   * update is not executed, the algorithms of a running one are aborted.
+   */
+  void Cancel();
+
+  /**
+   * Wait for the update and return its output, or nullptr if the update
+   * failed or was canceled.
+   */
+  vtkDataObject* GetOutput();
+
+protected:
+  vtkUpdateFuture(vtkAlgorithm* algorithm, int port);
+  ~vtkUpdateFuture() override;
+
+private:
+  vtkUpdateFuture(const vtkUpdateFuture&) = delete;
+  void operator=(const vtkUpdateFuture&) = delete;
+
+  friend class vtkAlgorithm;
+
+  /**
+   * Execute the update. Called on the worker thread.
+   */
+  void Run();
+
+  /**
+   * Abort the algorithm if the update running on the calling thread was
+   * canceled. Called by vtkAlgorithm::CheckAbort().
+   */
+  static void CheckCancel(vtkAlgorithm* algorithm);
+
+  /**
+   * Set the AbortExecute flag of the algorithm, unless it is already set.
+   * Mutex must be locked.
+   */
+  void Abort(vtkAlgorithm* algorithm);
+
+  void Finish(int status);
+
+  vtkSmartPointer<vtkAlgorithm> Algorithm;
+  int Port;
+  vtkSmartPointer<vtkDataObject> Output;
+  std::vector<vtkSmartPointer<vtkAlgorithm>> PipelineAlgorithms;
+  std::vector<vtkSmartPointer<vtkAlgorithm>> AbortedAlgorithms;
+  std::atomic<int> UpdateStatus;
+  std::atomic<double> Progress;
+  std::atomic<bool> CancelRequested;
+  mutable std::mutex Mutex;
+  mutable std::condition_variable ConditionVariable;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,313 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkDelaunay2D and vtkDelaunay3D produce the same Delaunay
+// triangulation of random points (in general position, so the triangulation
+// is unique) whether the points are inserted in given or in spatially coherent
+// order, that the parallel triangulation of vtkDelaunay2D contains it, and
+// report the time spent in each mode. The number of points can be
+// given on the command line to benchmark large inputs, e.g.:
+//   TestDelaunaySpatialInsertion 10000000 1000000
+// in which case only the number of cells is compared.
+
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkDataSet.h"
+#include "vtkDelaunay2D.h"
+#include "vtkDelaunay3D.h"
+#include "vtkIdList.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkStaticPointLocator.h"
+#include "vtkTetra.h"
+#include "vtkTimerLog.h"
+#include "vtkTriangle.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+void RandomPoints(vtkPoints* points, vtkIdType numPts, bool planar)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(8775070);
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(numPts);
+  double x[3] = { 0.0, 0.0, 0.0 };
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    for (int i = 0; i < (planar ? 2 : 3); ++i)
+    {
+      x[i] = random->GetNextValue();
+    }
+    points->SetPoint(ptId, x);
+  }
+}
+
+// Return the cells as sorted lists of sorted point ids, so that two
+// triangulations can be compared independently of the cell and vertex order.
+std::vector<std::vector<vtkIdType>> SortedCells(vtkCellArray* cells)
+{
+  std::vector<std::vector<vtkIdType>> sorted;
+  auto iter = vtk::TakeSmartPointer(cells->NewIterator());
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    iter->GetCurrentCell(npts, pts);
+    std::vector<vtkIdType> cell(pts, pts + npts);
+    std::sort(cell.begin(), cell.end());
+    sorted.emplace_back(cell);
+  }
+  std::sort(sorted.begin(), sorted.end());
+  return sorted;
+}
+
+// Check the empty circumsphere property: no input point lies strictly inside
+// the circumcircle (2D) or circumsphere (3D) of any output cell.
+bool IsDelaunay(vtkDataSet* output, vtkCellArray* cells, bool planar)
+{
+  vtkNew<vtkStaticPointLocator> locator;
+  locator->SetDataSet(output);
+  locator->BuildLocator();
+
+  vtkNew<vtkIdList> inside;
+  auto iter = vtk::TakeSmartPointer(cells->NewIterator());
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    iter->GetCurrentCell(npts, pts);
+    double x[4][3];
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      output->GetPoint(pts[i], x[i]);
+    }
+    double center[3] = { 0.0, 0.0, 0.0 };
+    double radius2;
+    if (planar)
+    {
+      radius2 = vtkTriangle::Circumcircle(x[0], x[1], x[2], center);
+    }
+    else
+    {
+      radius2 = vtkTetra::Circumsphere(x[0], x[1], x[2], x[3], center);
+    }
+    // Shrink the sphere slightly so that its own vertices are not reported.
+    locator->FindPointsWithinRadius(std::sqrt(radius2) * (1.0 - 1.0e-6), center, inside);
+    for (vtkIdType i = 0; i < inside->GetNumberOfIds(); ++i)
+    {
+      if (std::find(pts, pts + npts, inside->GetId(i)) == pts + npts)
+      {
+        std::cerr << "Point " << inside->GetId(i) << " lies inside the circumsphere of cell "
+                  << iter->GetCurrentCellId() << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool Test2D(vtkIdType numPts, double alpha, bool benchmark)
+{
+  vtkNew<vtkPoints> points;
+  RandomPoints(points, numPts, true);
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+
+  // Given order, spatial order, and divide-and-conquer (which falls back to
+  // the given order when alpha is non-zero).
+  const char* modes[3] = { "given order", "spatial order", "parallel" };
+  vtkIdType numTris[3];
+  std::vector<std::vector<vtkIdType>> cells[3];
+  vtkNew<vtkTimerLog> timer;
+  for (int mode = 0; mode < 3; ++mode)
+  {
+    vtkNew<vtkDelaunay2D> delaunay;
+    delaunay->SetInputData(input);
+    delaunay->SetAlpha(alpha);
+    delaunay->SetSpatialPointInsertion(mode == 1);
+    delaunay->SetParallelTriangulation(mode == 2);
+    timer->StartTimer();
+    delaunay->Update();
+    timer->StopTimer();
+    vtkPolyData* output = delaunay->GetOutput();
+    numTris[mode] = output->GetNumberOfPolys();
+    std::cout << "vtkDelaunay2D (" << numPts << " points, alpha " << alpha << ", " << modes[mode]
+              << "): " << timer->GetElapsedTime() << " s, " << numTris[mode] << " triangles"
+              << std::endl;
+    if (benchmark)
+    {
+      continue;
+    }
+    cells[mode] = ::SortedCells(output->GetPolys());
+    if (alpha == 0.0 && !::IsDelaunay(output, output->GetPolys(), true))
+    {
+      std::cerr << "vtkDelaunay2D (" << modes[mode] << ") output is not Delaunay." << std::endl;
+      return false;
+    }
+  }
+
+  // Without alpha, the triangulation of the convex hull of n points in general
+  // position has at most 2n-5 triangles.
+  if (numTris[0] == 0 || numTris[0] > 2 * numPts - 5)
+  {
+    std::cerr << "Unexpected number of triangles: " << numTris[0] << std::endl;
+    return false;
+  }
+  if (numTris[0] != numTris[1] || cells[0] != cells[1])
+  {
+    std::cerr << "vtkDelaunay2D (alpha " << alpha
+              << "): insertion orders produced different triangulations." << std::endl;
+    return false;
+  }
+  // The insertion may drop triangles along the convex hull, which the
+  // parallel triangulation always covers.
+  if (alpha == 0.0 &&
+    !std::includes(cells[2].begin(), cells[2].end(), cells[0].begin(), cells[0].end()))
+  {
+    std::cerr << "vtkDelaunay2D: the parallel triangulation misses inserted triangles."
+              << std::endl;
+    return false;
+  }
+  if (alpha != 0.0 && (numTris[0] != numTris[2] || cells[0] != cells[2]))
+  {
+    std::cerr << "vtkDelaunay2D (alpha " << alpha
+              << "): the parallel mode did not fall back to the insertion." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Points of a regular grid, with duplicates, triangulated in parallel: one
+// point of each duplicate pair is left unconnected, and the cocircular points
+// of each grid square are split into two triangles.
+bool TestGrid2D()
+{
+  const int dim = 100;
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  for (int j = 0; j < dim; ++j)
+  {
+    for (int i = 0; i < dim; ++i)
+    {
+      points->InsertNextPoint(i, j, 0.0);
+    }
+  }
+  // Duplicate the first row, at a different z.
+  for (int i = 0; i < dim; ++i)
+  {
+    points->InsertNextPoint(i, 0.0, 1.0);
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+
+  vtkNew<vtkDelaunay2D> delaunay;
+  delaunay->SetInputData(input);
+  delaunay->ParallelTriangulationOn();
+  delaunay->Update();
+  vtkPolyData* output = delaunay->GetOutput();
+  const vtkIdType numTris = output->GetNumberOfPolys();
+  if (numTris != 2 * (dim - 1) * (dim - 1))
+  {
+    std::cerr << "Unexpected number of triangles on a grid: " << numTris << std::endl;
+    return false;
+  }
+  output->BuildLinks();
+  vtkNew<vtkIdList> cellIds;
+  vtkIdType numUnconnected = 0;
+  for (vtkIdType ptId = 0; ptId < output->GetNumberOfPoints(); ++ptId)
+  {
+    output->GetPointCells(ptId, cellIds);
+    numUnconnected += (cellIds->GetNumberOfIds() == 0);
+  }
+  if (numUnconnected != dim)
+  {
+    std::cerr << numUnconnected << " points are unconnected instead of the " << dim
+              << " duplicates." << std::endl;
+    return false;
+  }
+  return ::IsDelaunay(output, output->GetPolys(), true);
+}
+
+bool Test3D(vtkIdType numPts, double alpha, bool benchmark)
+{
+  vtkNew<vtkPoints> points;
+  RandomPoints(points, numPts, false);
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+
+  vtkIdType numTets[2];
+  std::vector<std::vector<vtkIdType>> cells[2];
+  vtkNew<vtkTimerLog> timer;
+  for (int spatial = 0; spatial < 2; ++spatial)
+  {
+    vtkNew<vtkDelaunay3D> delaunay;
+    delaunay->SetInputData(input);
+    delaunay->SetAlpha(alpha);
+    delaunay->SetAlphaTris(false);
+    delaunay->SetAlphaLines(false);
+    delaunay->SetAlphaVerts(false);
+    delaunay->SetSpatialPointInsertion(spatial);
+    timer->StartTimer();
+    delaunay->Update();
+    timer->StopTimer();
+    vtkUnstructuredGrid* output = delaunay->GetOutput();
+    numTets[spatial] = output->GetNumberOfCells();
+    std::cout << "vtkDelaunay3D (" << numPts << " points, alpha " << alpha << ", "
+              << (spatial ? "spatial" : "given") << " order): " << timer->GetElapsedTime()
+              << " s, " << numTets[spatial] << " cells" << std::endl;
+    if (benchmark)
+    {
+      continue;
+    }
+    cells[spatial] = ::SortedCells(output->GetCells());
+    if (alpha == 0.0 && !::IsDelaunay(output, output->GetCells(), false))
+    {
+      std::cerr << "vtkDelaunay3D (" << (spatial ? "spatial" : "given")
+                << " order) output is not Delaunay." << std::endl;
+      return false;
+    }
+  }
+
+  if (numTets[0] == 0 || numTets[0] != numTets[1] || cells[0] != cells[1])
+  {
+    std::cerr << "vtkDelaunay3D (alpha " << alpha
+              << "): insertion orders produced different triangulations." << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestDelaunaySpatialInsertion(int argc, char* argv[])
+{
+  vtkIdType numPts2D = 10000;
+  vtkIdType numPts3D = 2000;
+  bool benchmark = false;
+  if (argc > 2 && std::atoll(argv[1]) > 0 && std::atoll(argv[2]) > 0)
+  {
+    numPts2D = std::atoll(argv[1]);
+    numPts3D = std::atoll(argv[2]);
+    benchmark = true;
+  }
+
+  bool success = ::Test2D(numPts2D, 0.0, benchmark);
+  success &= ::Test2D(numPts2D, 0.01, benchmark);
+  if (!benchmark)
+  {
+    success &= ::TestGrid2D();
+  }
+  success &= ::Test3D(numPts3D, 0.0, benchmark);
+  success &= ::Test3D(numPts3D, 0.1, benchmark);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the parallel smoothing mode of vtkSmoothPolyDataFilter produces
+// the same points whatever the number of threads, with feature edge and
+// boundary smoothing enabled, and that it differs from the default in-place
+// smoothing.
+
+#include "vtkClipPolyData.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPlane.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSmoothPolyDataFilter.h"
+#include "vtkSphereSource.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> Smooth(
+  vtkPolyData* input, vtkPolyData* source, bool parallel, int maxThreads)
+{
+  vtkNew<vtkSmoothPolyDataFilter> smooth;
+  smooth->SetInputData(input);
+  if (source)
+  {
+    smooth->SetSourceData(source);
+  }
+  smooth->SetNumberOfIterations(30);
+  smooth->SetRelaxationFactor(0.1);
+  smooth->FeatureEdgeSmoothingOn();
+  smooth->SetFeatureAngle(30.0);
+  smooth->BoundarySmoothingOn();
+  smooth->SetParallelSmoothing(parallel);
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ maxThreads }, [&]() { smooth->Update(); });
+
+  auto output = vtkSmartPointer<vtkPolyData>::New();
+  output->ShallowCopy(smooth->GetOutput());
+  return output;
+}
+
+bool Compare(vtkPolyData* ref, vtkPolyData* output, const char* label)
+{
+  if (ref->GetNumberOfPoints() != output->GetNumberOfPoints())
+  {
+    std::cerr << label << ": the number of points differ." << std::endl;
+    return false;
+  }
+  double x[3], y[3];
+  for (vtkIdType ptId = 0; ptId < ref->GetNumberOfPoints(); ++ptId)
+  {
+    ref->GetPoint(ptId, x);
+    output->GetPoint(ptId, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      std::cerr << label << ": point " << ptId << " differs." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestSmoothPolyDataFilterThreading(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  sphere->Update();
+
+  // Clip the sphere to have boundary edges.
+  vtkNew<vtkPlane> plane;
+  plane->SetOrigin(0.0, 0.0, 0.1);
+  plane->SetNormal(0.3, 0.2, 1.0);
+  vtkNew<vtkClipPolyData> clip;
+  clip->SetInputConnection(sphere->GetOutputPort());
+  clip->SetClipFunction(plane);
+  clip->Update();
+  vtkPolyData* input = clip->GetOutput();
+
+  bool success = true;
+  for (vtkPolyData* source : { static_cast<vtkPolyData*>(nullptr), sphere->GetOutput() })
+  {
+    const char* label = source ? "constrained" : "unconstrained";
+    vtkSmartPointer<vtkPolyData> ref = ::Smooth(input, source, true, 1);
+    vtkSmartPointer<vtkPolyData> output = ::Smooth(input, source, true, 0);
+    success &= ::Compare(ref, output, label);
+
+    // The in-place smoothing reads the updated coordinates of the points
+    // already moved, so it produces different points.
+    vtkSmartPointer<vtkPolyData> inPlace = ::Smooth(input, source, false, 0);
+    double x[3], y[3];
+    double maxDifference = 0.0;
+    for (vtkIdType ptId = 0; ptId < input->GetNumberOfPoints(); ++ptId)
+    {
+      ref->GetPoint(ptId, x);
+      inPlace->GetPoint(ptId, y);
+      maxDifference = std::max(maxDifference, vtkMath::Distance2BetweenPoints(x, y));
+    }
+    if (maxDifference == 0.0)
+    {
+      std::cerr << label << ": parallel smoothing matches in-place smoothing." << std::endl;
+      success = false;
+    }
+
+    double maxDisplacement = 0.0;
+    for (vtkIdType ptId = 0; ptId < input->GetNumberOfPoints(); ++ptId)
+    {
+      input->GetPoint(ptId, x);
+      ref->GetPoint(ptId, y);
+      maxDisplacement = std::max(maxDisplacement, vtkMath::Distance2BetweenPoints(x, y));
+    }
+    if (maxDisplacement == 0.0)
+    {
+      std::cerr << label << ": no point was moved." << std::endl;
+      success = false;
+    }
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,236 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Abort the threaded filters supporting cancellable execution from a progress
+// observer, and check that their output is aborted and that they execute
+// normally afterwards. The abort is either raised by the progress event
+// emitted before the filter executes, so that every vtkSMPTools loop is
+// skipped, or by the first progress reported during the execution, so that
+// the loops running at that time are left incomplete. The latency between
+// the abort and the end of the update only depends on the duration of a grain
+// and the SMP backend, so it is reported but not checked.
+
+#include "vtkAppendFilter.h"
+#include "vtkCallbackCommand.h"
+#include "vtkCellDataToPointData.h"
+#include "vtkContour3DLinearGrid.h"
+#include "vtkElevationFilter.h"
+#include "vtkFlyingEdges3D.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPlane.h"
+#include "vtkPlaneCutter.h"
+#include "vtkPointData.h"
+#include "vtkPointDataToCellData.h"
+#include "vtkPolyDataNormals.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkSMPTools.h"
+#include "vtkShortArray.h"
+#include "vtkSmoothPolyDataFilter.h"
+#include "vtkSphereSource.h"
+#include "vtkStaticCleanUnstructuredGrid.h"
+#include "vtkSurfaceNets3D.h"
+#include "vtkThreshold.h"
+#include "vtkWindowedSincPolyDataFilter.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct AbortObserver
+{
+  vtkAlgorithm* Filter;
+  // Progress from which the filter is aborted.
+  double AbortProgress;
+  std::atomic<bool> Aborted{ false };
+  Clock::time_point AbortTime;
+
+  AbortObserver(vtkAlgorithm* filter, double abortProgress)
+    : Filter(filter)
+    , AbortProgress(abortProgress)
+  {
+  }
+
+  // Progress events may be emitted by any thread executing the filter.
+  static void OnProgress(vtkObject*, unsigned long, void* clientData, void* callData)
+  {
+    auto* self = static_cast<AbortObserver*>(clientData);
+    const double progress = *static_cast<double*>(callData);
+    if (progress >= self->AbortProgress && progress < 1.0 && !self->Aborted.exchange(true))
+    {
+      self->AbortTime = Clock::now();
+      self->Filter->SetAbortExecuteAndUpdateTime();
+    }
+  }
+};
+
+// Abort the filter once it reports abortProgress, which is either 0 for an
+// abort before the execution or a fraction of the execution reported by the
+// filter itself.
+bool TestAbort(vtkAlgorithm* filter, double abortProgress = 0.0)
+{
+  // Bring the upstream pipeline up to date, then time the filter alone.
+  filter->Update();
+  filter->Modified();
+  const auto start = Clock::now();
+  filter->Update();
+  const double fullTime = std::chrono::duration<double>(Clock::now() - start).count();
+
+  AbortObserver observer(filter, abortProgress);
+  vtkNew<vtkCallbackCommand> callback;
+  callback->SetCallback(AbortObserver::OnProgress);
+  callback->SetClientData(&observer);
+  const unsigned long tag = filter->AddObserver(vtkCommand::ProgressEvent, callback);
+  filter->Modified();
+  filter->Update();
+  const auto end = Clock::now();
+  filter->RemoveObserver(tag);
+
+  const bool aborted = filter->GetOutputInformation(0)->Get(vtkAlgorithm::ABORTED()) != 0;
+  filter->SetAbortExecute(0);
+  if (!observer.Aborted)
+  {
+    vtkLog(ERROR, << filter->GetClassName() << " never reported a progress of " << abortProgress);
+    return false;
+  }
+  vtkLog(INFO,
+    << filter->GetClassName() << ": execution " << fullTime << " s, abort latency "
+    << std::chrono::duration<double>(end - observer.AbortTime).count() << " s at progress "
+    << abortProgress << " with the " << vtkSMPTools::GetBackend() << " backend.");
+  if (!aborted)
+  {
+    vtkLog(ERROR, << filter->GetClassName() << " was not aborted.");
+    return false;
+  }
+
+  // The filter executes normally afterwards.
+  filter->Update();
+  if (filter->GetOutputInformation(0)->Get(vtkAlgorithm::ABORTED()))
+  {
+    vtkLog(ERROR, << filter->GetClassName() << " is still aborted.");
+    return false;
+  }
+  return true;
+}
+
+// Nested spherical shells of labels.
+void MakeLabels(vtkImageData* image, int dim)
+{
+  image->SetDimensions(dim, dim, dim);
+  vtkNew<vtkShortArray> labels;
+  labels->SetNumberOfTuples(static_cast<vtkIdType>(dim) * dim * dim);
+  vtkIdType id = 0;
+  const double center = 0.5 * (dim - 1);
+  for (int k = 0; k < dim; ++k)
+  {
+    for (int j = 0; j < dim; ++j)
+    {
+      for (int i = 0; i < dim; ++i)
+      {
+        const double r = std::sqrt((i - center) * (i - center) + (j - center) * (j - center) +
+          (k - center) * (k - center));
+        labels->SetValue(id++, static_cast<short>(r / 8.0));
+      }
+    }
+  }
+  image->GetPointData()->SetScalars(labels);
+}
+}
+
+int TestThreadedFiltersAbort(int, char*[])
+{
+  bool success = true;
+
+  vtkNew<vtkRTAnalyticSource> wavelet;
+  wavelet->SetWholeExtent(-50, 50, -50, 50, -50, 50);
+  vtkNew<vtkFlyingEdges3D> flyingEdges;
+  flyingEdges->SetInputConnection(wavelet->GetOutputPort());
+  flyingEdges->GenerateValues(8, 70.0, 250.0);
+  success &= ::TestAbort(flyingEdges);
+
+  vtkNew<vtkImageData> labels;
+  ::MakeLabels(labels, 100);
+  vtkNew<vtkSurfaceNets3D> surfaceNets;
+  surfaceNets->SetInputData(labels);
+  surfaceNets->GenerateLabels(6, 1.0, 6.0);
+  surfaceNets->SmoothingOff();
+  success &= ::TestAbort(surfaceNets);
+
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(200);
+  sphere->SetPhiResolution(200);
+  vtkNew<vtkWindowedSincPolyDataFilter> windowedSinc;
+  windowedSinc->SetInputConnection(sphere->GetOutputPort());
+  windowedSinc->SetNumberOfIterations(20);
+  success &= ::TestAbort(windowedSinc);
+
+  // Aborted between its two passes.
+  vtkNew<vtkPolyDataNormals> normals;
+  normals->SetInputConnection(sphere->GetOutputPort());
+  normals->ComputeCellNormalsOn();
+  success &= ::TestAbort(normals);
+  success &= ::TestAbort(normals, 0.5);
+
+  // Aborted once the edges are classified.
+  vtkNew<vtkSmoothPolyDataFilter> smooth;
+  smooth->SetInputConnection(sphere->GetOutputPort());
+  smooth->SetNumberOfIterations(10);
+  success &= ::TestAbort(smooth);
+  success &= ::TestAbort(smooth, 0.375);
+
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(wavelet->GetOutputPort());
+  success &= ::TestAbort(elevation);
+
+  vtkNew<vtkPointDataToCellData> pointToCell;
+  pointToCell->SetInputConnection(wavelet->GetOutputPort());
+  success &= ::TestAbort(pointToCell);
+
+  // Aborted from the first thread while averaging the cell data.
+  vtkNew<vtkCellDataToPointData> cellToPoint;
+  cellToPoint->SetInputConnection(pointToCell->GetOutputPort());
+  success &= ::TestAbort(cellToPoint);
+  success &= ::TestAbort(cellToPoint, 0.01);
+
+  vtkNew<vtkPlane> plane;
+  plane->SetNormal(1.0, 1.0, 1.0);
+  vtkNew<vtkPlaneCutter> planeCutter;
+  planeCutter->SetInputConnection(wavelet->GetOutputPort());
+  planeCutter->SetPlane(plane);
+  success &= ::TestAbort(planeCutter);
+
+  // Aborted from the first thread while evaluating the cells.
+  vtkNew<vtkThreshold> threshold;
+  threshold->SetInputConnection(wavelet->GetOutputPort());
+  threshold->SetLowerThreshold(100.0);
+  threshold->SetThresholdFunction(vtkThreshold::THRESHOLD_UPPER);
+  success &= ::TestAbort(threshold);
+  success &= ::TestAbort(threshold, 0.01);
+
+  vtkNew<vtkContour3DLinearGrid> contour;
+  contour->SetInputConnection(threshold->GetOutputPort());
+  contour->GenerateValues(4, 120.0, 240.0);
+  success &= ::TestAbort(contour);
+
+  // Two copies of the same grid, so that every point is merged.
+  vtkNew<vtkRTAnalyticSource> smallWavelet;
+  smallWavelet->SetWholeExtent(-30, 30, -30, 30, -30, 30);
+  vtkNew<vtkAppendFilter> append;
+  append->AddInputConnection(smallWavelet->GetOutputPort());
+  append->AddInputConnection(smallWavelet->GetOutputPort());
+  vtkNew<vtkStaticCleanUnstructuredGrid> clean;
+  clean->SetInputConnection(append->GetOutputPort());
+  clean->ToleranceIsAbsoluteOn();
+  clean->SetAbsoluteTolerance(0.25);
+  clean->AveragePointDataOn();
+  success &= ::TestAbort(clean);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -681,6 +681,9 @@ vtk3DLinearGridCrinkleExtractor::vtk3DLinearGridCrinkleExtractor()
   this->OutputPointsPrecision = DEFAULT_PRECISION;
   this->SequentialProcessing = false;
   this->NumberOfThreadsUsed = 0;
+  // The extracted cells are counted per thread, so the extraction can stop
+  // at any cell.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -830,8 +830,9 @@ int ProcessEdges(vtkIdType numCells, vtkPoints* inPts, CellIter* cellIter, vtkPl
   }
   int nt = numThreads;
 
-  // Make sure data was produced
-  if (numTris <= 0)
+  // Make sure data was produced. Edges skipped because of an abort are left
+  // uninitialized and cannot be merged.
+  if (numTris <= 0 || filter->CheckAbort())
   {
     outPts->SetNumberOfPoints(0);
     delete[] mergeEdges;
@@ -1087,6 +1088,9 @@ vtk3DLinearGridPlaneCutter::vtk3DLinearGridPlaneCutter()
   this->SequentialProcessing = false;
   this->NumberOfThreadsUsed = 0;
   this->LargeIds = false;
+  // The edges are only merged once CheckAbort() passed, so the threads can
+  // stop as soon as the filter is aborted.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
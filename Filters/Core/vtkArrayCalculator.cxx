@@ -52,6 +52,8 @@ vtkArrayCalculator::vtkArrayCalculator()
   this->ReplacementValue = 0.0;
   this->IgnoreMissingArrays = false;
   this->ResultArrayType = VTK_DOUBLE;
+  // Evaluating the function can be stopped at any tuple.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -87,6 +87,9 @@ vtkStandardNewMacro(vtkAttributeDataToTableFilter);
 vtkAttributeDataToTableFilter::vtkAttributeDataToTableFilter()
   : FieldAssociation(vtkDataObject::FIELD_ASSOCIATION_POINTS)
 {
+  // The columns are only filled by the threads; the maximum cell size is
+  // checked before it is used.
+  this->CancellableExecution = true;
 }
 
 //----------------------------------------------------------------------------
@@ -169,6 +172,10 @@ void vtkAttributeDataToTableFilter::AddCellTypeAndConnectivity(vtkTable* output,
     vtkSMPTools::For(0, numcells, worker);
     maxpoints = worker.ReducedMaxCellSize;
   }
+  if (this->CheckAbort())
+  {
+    return;
+  }
 
   if (this->GenerateCellConnectivity)
   {
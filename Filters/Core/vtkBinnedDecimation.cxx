@@ -370,6 +370,17 @@ void ReuseDecimate(vtkIdType numPts, PointsT* pts, vtkIdType numTris, vtkCellArr
   InitializePointMap<TIds> initPtMap(binIds, ptUses, ptMap, filter);
   vtkSMPTools::For(0, numPts, initPtMap);
 
+  // Points or triangles skipped because of an abort leave the maps
+  // uninitialized, so they cannot be rolled up.
+  if (filter->CheckAbort())
+  {
+    delete[] triMap;
+    delete[] ptMap;
+    delete[] ptUses;
+    delete[] binIds;
+    return;
+  }
+
   // Prefix sums to roll up the points and cells, and setup offsets for
   // subsequent threading. This could be threaded, although the gains
   // are likely modest.
@@ -741,10 +752,18 @@ void BinPointsDecimate(int genMode, vtkIdType numPts, PointsT* pts, vtkPointData
   // and cells.
   MapOutput<TIds> mapOutput(binIds, ptMap, tris, triMap, filter);
   vtkSMPTools::For(0, numTris, mapOutput);
+  if (filter->CheckAbort())
+  {
+    delete[] triMap;
+    delete[] ptMap;
+    delete[] binIds;
+    return;
+  }
 
   // Now generate the new points. First generate new point ids, and then
-  // produce the actual points.
-  int* sliceOffsets = new int[dims[2] + 1];
+  // produce the actual points. The slices are zero initialized in case some
+  // of them are skipped because of an abort.
+  int* sliceOffsets = new int[dims[2] + 1]();
   CountPoints<TIds> countPts(dims, ptMap, sliceOffsets, filter);
   vtkSMPTools::For(0, dims[2], countPts);
   int numNewPts = sliceOffsets[dims[2]];
@@ -1369,6 +1388,12 @@ void AvePointsDecimate(vtkIdType numPts, PointsT* pts, vtkPointData* inPD, vtkPo
   // and cells. First identify the triangles to be sent to the output.
   MarkBinnedTris<TIds> markBinnedTris(binTuples, tris, triMap, filter);
   vtkSMPTools::For(0, numTris, markBinnedTris);
+  if (filter->CheckAbort())
+  {
+    delete[] binTuples;
+    delete[] triMap;
+    return;
+  }
 
   // Create a mapping of the input triangles to the output triangles.
   vtkIdType mark, numOutTris = 0;
@@ -1414,12 +1439,20 @@ void AvePointsDecimate(vtkIdType numPts, PointsT* pts, vtkPointData* inPD, vtkPo
   MapOffsets<TIds> offMapper(binTuples, offsets, numPts, numBins, numBatches, filter);
   vtkSMPTools::For(0, numBatches, offMapper);
   offsets[numBins] = numPts;
+  if (filter->CheckAbort())
+  {
+    delete[] binTuples;
+    delete[] triMap;
+    delete[] offsets;
+    return;
+  }
 
   // Now to generate the new points, build an offset array that basically
   // represents the number of new points generated in each z-slice. First we
   // have to count the new points, and then accumulate them with a prefix
-  // sum. For convenience, this is done on a bin slice-by-slice manner.
-  int* sliceOffsets = new int[dims[2] + 1];
+  // sum. For convenience, this is done on a bin slice-by-slice manner. The
+  // slices skipped because of an abort count no points.
+  int* sliceOffsets = new int[dims[2] + 1]();
   CountAvePts<TIds> countPts(dims, offsets, sliceOffsets, filter);
   vtkSMPTools::For(0, dims[2], countPts);
   int numNewPts = sliceOffsets[dims[2]];
@@ -1512,6 +1545,8 @@ vtkBinnedDecimation::vtkBinnedDecimation()
   this->ProducePointData = true;
   this->ProduceCellData = false;
   this->LargeIds = false;
+  // The maps are checked for an abort before they are rolled up.
+  this->CancellableExecution = true;
 }
 
 //----------------------------------------------------------------------------
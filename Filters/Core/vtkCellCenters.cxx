@@ -28,6 +28,13 @@
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCellCenters);
 
+//------------------------------------------------------------------------------
+vtkCellCenters::vtkCellCenters()
+{
+  // The centers are checked for an abort before being compacted.
+  this->CancellableExecution = true;
+}
+
 namespace
 {
 
@@ -341,6 +341,9 @@ vtkCellDataToPointData::vtkCellDataToPointData()
   this->ProcessAllArrays = true;
   this->PieceInvariant = true;
   this->Implementation = new Internals();
+  // The points are averaged independently, so the threads can stop at any
+  // point.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
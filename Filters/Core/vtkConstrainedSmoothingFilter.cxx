@@ -428,6 +428,9 @@ vtkConstrainedSmoothingFilter::vtkConstrainedSmoothingFilter()
   this->GenerateErrorScalars = false;
   this->GenerateErrorVectors = false;
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
+  // Building the stencils and smoothing the points stop once the filter is
+  // aborted.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -537,6 +540,11 @@ int vtkConstrainedSmoothingFilter::RequestData(vtkInformation* vtkNotUsed(reques
   {
     stencils = BuildStencils(input);
   }
+  if (this->CheckAbort())
+  {
+    // Skipped points leave holes in the stencils.
+    return 1;
+  }
 
   // With the stencil defined, perform the smoothing. Use a double buffering
   // approach: smooth over point array #1 using the point array #0; then swap
@@ -1133,8 +1133,9 @@ int ProcessMerged(vtkContour3DLinearGrid* filter, vtkPoints* inPts, vtkPoints* o
   }
   int nt = numThreads;
 
-  // Make sure data was produced
-  if (numTris <= 0)
+  // Make sure data was produced. Edges skipped because of an abort are left
+  // uninitialized and cannot be merged.
+  if (numTris <= 0 || filter->CheckAbort())
   {
     delete[] mergeEdges;
     return 1;
@@ -1396,6 +1397,9 @@ vtkContour3DLinearGrid::vtkContour3DLinearGrid()
   this->UseScalarTree = 0;
   this->ScalarTree = nullptr;
   this->ScalarTreeMap = new vtkScalarTreeMap;
+  // Threads stop contouring cells once the filter is aborted; the edges are
+  // merged only if CheckAbort() passed.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
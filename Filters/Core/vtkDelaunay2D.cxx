@@ -4,6 +4,8 @@
 
 #include "vtkAbstractTransform.h"
 #include "vtkCellArray.h"
+#include "vtkDelaunayDivideAndConquer.h"
+#include "vtkDelaunayInsertionOrder.h"
 #include "vtkDoubleArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -13,6 +15,8 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
 #include "vtkTriangle.h"
@@ -33,11 +37,16 @@ vtkDelaunay2D::vtkDelaunay2D()
   this->BoundingTriangulation = 0;
   this->Offset = 1.0;
   this->RandomPointInsertion = 0;
+  this->SpatialPointInsertion = 0;
+  this->ParallelTriangulation = 0;
   this->Transform = nullptr;
   this->ProjectionPlaneMode = VTK_DELAUNAY_XY_PLANE;
 
   // optional 2nd input
   this->SetNumberOfInputPorts(2);
+  // The threaded loops are followed by abort checks, and the triangles the
+  // alpha test skips are left in the mesh that an abort discards.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -454,7 +463,8 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
     points->DeepCopy(tPoints);
   }
 
-  const double* bounds = points->GetBounds();
+  double bounds[6];
+  points->GetBounds(bounds);
   center[0] = (bounds[0] + bounds[1]) / 2.0;
   center[1] = (bounds[2] + bounds[3]) / 2.0;
   center[2] = (bounds[4] + bounds[5]) / 2.0;
@@ -463,6 +473,23 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
   this->BoundingRadius2 = 4 * radius * radius; // use (2*r)**2
   tol *= this->Tolerance;
 
+  // The divide-and-conquer triangulation does not build the bounding
+  // triangulation the other options rely on.
+  if (this->ParallelTriangulation && !this->BoundingTriangulation && this->Alpha == 0.0 &&
+    !source)
+  {
+    vtkNew<vtkCellArray> triangles;
+    if (this->TriangulateInParallel(points, tol, triangles))
+    {
+      output->SetPoints(inPoints);
+      output->GetPointData()->PassData(input->GetPointData());
+      output->SetPolys(triangles);
+    }
+    this->Mesh = nullptr;
+    this->Transform = nullptr;
+    return 1;
+  }
+
   // Add the eight bounding points to the end of the points list.
   for (ptId = 0; ptId < 8; ptId++)
   {
@@ -513,12 +540,25 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
   // neighboring triangles for Delaunay criterion. Triangles that do not
   // satisfy criterion have their edges swapped. This continues recursively
   // until all triangles have been shown to be Delaunay. The points may be
-  // traversed in given order, or pseudo-random order.
+  // traversed in given order, pseudo-random order, or spatially coherent
+  // order.
   //
   GCDTraversal gcdIter(numPoints);
-  for (auto idx = 0; idx < numPoints; idx++)
+  std::vector<vtkIdType> spatialOrder;
+  if (this->SpatialPointInsertion)
+  {
+    vtkDelaunayInsertionOrder::Compute(points, numPoints, bounds, true, spatialOrder);
+  }
+  for (vtkIdType idx = 0; idx < numPoints; idx++)
   {
-    ptId = (this->RandomPointInsertion ? gcdIter.GetPointId(idx) : idx);
+    if (this->SpatialPointInsertion)
+    {
+      ptId = spatialOrder[idx];
+    }
+    else
+    {
+      ptId = (this->RandomPointInsertion ? gcdIter.GetPointId(idx) : idx);
+    }
     this->GetPoint(ptId, x);
     nei[0] = (-1); // where we are coming from...nowhere initially
 
@@ -670,8 +710,7 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
   if (this->Alpha > 0.0)
   {
     double alpha2 = this->Alpha * this->Alpha;
-    double x1[3], x2[3], x3[3];
-    double xx1[3], xx2[3], xx3[3];
+    double x1[3], x2[3];
     vtkIdType cellId, numNei, ap1, ap2, neighbor;
 
     vtkNew<vtkCellArray> alphaVerts;
@@ -681,12 +720,22 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
 
     std::vector<char> pointUse(numPoints + 8, 0);
 
-    // traverse all triangles; evaluating Delaunay criterion
-    for (i = 0; i < numTriangles; i++)
-    {
-      if (triUse[i] == 1)
+    // Traverse all triangles, evaluating the alpha criterion. The
+    // circumcircle evaluation is independent for each triangle and is
+    // performed in parallel; the used points are then marked serially.
+    vtkSMPTools::For(0, numTriangles, [&](vtkIdType begin, vtkIdType end) {
+      vtkNew<vtkIdList> cellPtIds;
+      vtkIdType ntpts;
+      const vtkIdType* tPts;
+      double tx1[3], tx2[3], tx3[3];
+      double txx1[3], txx2[3], txx3[3], tcenter[3];
+      for (vtkIdType triId = begin; triId < end; triId++)
       {
-        this->Mesh->GetCellPoints(i, npts, triPts);
+        if (triUse[triId] != 1)
+        {
+          continue;
+        }
+        this->Mesh->GetCellPoints(triId, ntpts, tPts, cellPtIds);
 
         // if any point is one of the bounding points that was added
         // at the beginning of the algorithm, then grab the points
@@ -695,34 +744,39 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
         // input transform).  if none of the points are bounding points,
         // then grab the points from the variable "inPoints" so the alpha
         // criterion is applied in the nontransformed space.
-        if (triPts[0] < numPoints && triPts[1] < numPoints && triPts[2] < numPoints)
+        if (tPts[0] < numPoints && tPts[1] < numPoints && tPts[2] < numPoints)
         {
-          inPoints->GetPoint(triPts[0], x1);
-          inPoints->GetPoint(triPts[1], x2);
-          inPoints->GetPoint(triPts[2], x3);
+          inPoints->GetPoint(tPts[0], tx1);
+          inPoints->GetPoint(tPts[1], tx2);
+          inPoints->GetPoint(tPts[2], tx3);
         }
         else
         {
-          points->GetPoint(triPts[0], x1);
-          points->GetPoint(triPts[1], x2);
-          points->GetPoint(triPts[2], x3);
+          points->GetPoint(tPts[0], tx1);
+          points->GetPoint(tPts[1], tx2);
+          points->GetPoint(tPts[2], tx3);
         }
 
         // evaluate the alpha criterion in 3D
-        vtkTriangle::ProjectTo2D(x1, x2, x3, xx1, xx2, xx3);
-        if (vtkTriangle::Circumcircle(xx1, xx2, xx3, center) > alpha2)
+        vtkTriangle::ProjectTo2D(tx1, tx2, tx3, txx1, txx2, txx3);
+        if (vtkTriangle::Circumcircle(txx1, txx2, txx3, tcenter) > alpha2)
         {
-          triUse[i] = 0;
+          triUse[triId] = 0;
         }
-        else
+      } // for all triangles in this range
+    });
+
+    for (i = 0; i < numTriangles; i++)
+    {
+      if (triUse[i] == 1)
+      {
+        this->Mesh->GetCellPoints(i, npts, triPts);
+        for (int j = 0; j < 3; j++)
         {
-          for (int j = 0; j < 3; j++)
-          {
-            pointUse[triPts[j]] = 1;
-          }
+          pointUse[triPts[j]] = 1;
         }
-      } // if non-deleted triangle
-    }   // for all triangles
+      }
+    }
 
     // traverse all edges see whether we need to create some
     for (cellId = 0, triangles->InitTraversal(); triangles->GetNextCell(npts, triPts); cellId++)
@@ -1017,6 +1071,72 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
   return 1;
 }
 
+//------------------------------------------------------------------------------
+// Triangulate the points with the divide-and-conquer algorithm. Return 0 if
+// the execution was aborted.
+int vtkDelaunay2D::TriangulateInParallel(vtkPoints* points, double tol, vtkCellArray* triangles)
+{
+  const vtkIdType numPoints = points->GetNumberOfPoints();
+  const double* x = static_cast<vtkDoubleArray*>(points->GetData())->GetPointer(0);
+
+  // Project the points onto the x-y plane, so that the points differing
+  // only by their z coordinate are merged.
+  vtkNew<vtkPoints> planarPoints;
+  planarPoints->SetDataTypeToDouble();
+  planarPoints->SetNumberOfPoints(numPoints);
+  double* px = static_cast<vtkDoubleArray*>(planarPoints->GetData())->GetPointer(0);
+  vtkSMPTools::For(0, numPoints, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      px[3 * ptId] = x[3 * ptId];
+      px[3 * ptId + 1] = x[3 * ptId + 1];
+      px[3 * ptId + 2] = 0.0;
+    }
+  });
+  if (this->CheckAbort())
+  {
+    return 0;
+  }
+
+  vtkNew<vtkPolyData> planarSet;
+  planarSet->SetPoints(planarPoints);
+  vtkNew<vtkStaticPointLocator> locator;
+  locator->SetDataSet(planarSet);
+  locator->BuildLocator();
+  std::vector<vtkIdType> mergeMap(numPoints);
+  locator->MergePoints(tol, mergeMap.data());
+  if (this->CheckAbort())
+  {
+    return 0;
+  }
+
+  std::vector<vtkIdType> ids;
+  ids.reserve(numPoints);
+  for (vtkIdType ptId = 0; ptId < numPoints; ++ptId)
+  {
+    if (mergeMap[ptId] == ptId)
+    {
+      ids.push_back(ptId);
+    }
+  }
+  this->NumberOfDuplicatePoints = static_cast<int>(numPoints - ids.size());
+  vtkSMPTools::Sort(ids.begin(), ids.end(), [px](vtkIdType a, vtkIdType b) {
+    const double* xa = px + 3 * a;
+    const double* xb = px + 3 * b;
+    return xa[0] < xb[0] || (xa[0] == xb[0] && xa[1] < xb[1]);
+  });
+
+  vtkDelaunayDivideAndConquer::Triangulator triangulator(px, ids);
+  if (!triangulator.Execute(triangles))
+  {
+    return 0;
+  }
+
+  vtkDebugMacro(<< "Triangulated " << numPoints << " points, " << this->NumberOfDuplicatePoints
+                << " of which were duplicates");
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 // Methods used to recover edges. Uses lines and polygons to determine boundary
 // and inside/outside.
@@ -1641,6 +1761,10 @@ void vtkDelaunay2D::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Tolerance: " << this->Tolerance << "\n";
   os << indent << "Offset: " << this->Offset << "\n";
   os << indent << "Random Point Insertion: " << (this->RandomPointInsertion ? "On" : "Off") << "\n";
+  os << indent << "Spatial Point Insertion: " << (this->SpatialPointInsertion ? "On" : "Off")
+     << "\n";
+  os << indent << "Parallel Triangulation: " << (this->ParallelTriangulation ? "On" : "Off")
+     << "\n";
   os << indent << "Bounding Triangulation: " << (this->BoundingTriangulation ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
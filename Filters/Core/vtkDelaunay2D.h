@@ -56,7 +56,12 @@
  * problems are present, you will see a warning message to this effect at
  * the end of the triangulation process. Note also that the
  * RandomPointInsertion mode can be set which will insert the points in
- * pseudo-random order.
+ * pseudo-random order. For large point sets, SpatialPointInsertion is
+ * usually much faster: it inserts the points following a spatially
+ * coherent order so that locating the triangle containing each new point
+ * only requires a short walk through the mesh. Unconstrained triangulations
+ * without alpha can also be computed in parallel with a divide-and-conquer
+ * algorithm by enabling ParallelTriangulation.
  *
  * To create constrained meshes, you must define an additional
  * input. This input is an instance of vtkPolyData which contains
@@ -255,6 +260,43 @@ public:
   vtkBooleanMacro(RandomPointInsertion, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to insert the points following a spatially coherent
+   * order. The points are sorted in parallel (using vtkSMPTools) along a
+   * serpentine traversal of buckets covering the points, so that
+   * consecutive points are close to each other. This considerably reduces
+   * the cost of locating the triangle containing each point for large
+   * inputs, while the resulting triangulation is still Delaunay. Only the
+   * ordering is computed in parallel: the points are still inserted one at
+   * a time. When enabled, this option takes precedence over
+   * RandomPointInsertion. Off by default.
+   */
+  vtkSetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkGetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkBooleanMacro(SpatialPointInsertion, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * Indicate whether to triangulate the points in parallel (using
+   * vtkSMPTools) with a divide-and-conquer algorithm instead of inserting
+   * them one at a time. The points, sorted along the x axis, are split into
+   * blocks that are triangulated independently, then the triangulations are
+   * merged pairwise along their common boundary. This mode only supports
+   * unconstrained triangulations without alpha and bounding triangulation:
+   * when a Source is given, Alpha is non-zero or BoundingTriangulation is on,
+   * the points are inserted one at a time as usual. Points closer than the
+   * tolerance are merged, and the extra points are left unconnected. The
+   * whole convex hull is triangulated, including the thin triangles along
+   * the hull that the insertion may drop with the bounding triangulation.
+   * The output triangles are sorted by point id. Off by default.
+   */
+  vtkSetMacro(ParallelTriangulation, vtkTypeBool);
+  vtkGetMacro(ParallelTriangulation, vtkTypeBool);
+  vtkBooleanMacro(ParallelTriangulation, vtkTypeBool);
+  ///@}
+
 protected:
   vtkDelaunay2D();
 
@@ -265,6 +307,8 @@ protected:
   vtkTypeBool BoundingTriangulation;
   double Offset;
   vtkTypeBool RandomPointInsertion;
+  vtkTypeBool SpatialPointInsertion;
+  vtkTypeBool ParallelTriangulation;
 
   // Transform input points (if necessary)
   vtkSmartPointer<vtkAbstractTransform> Transform;
@@ -301,6 +345,7 @@ private:
   int NumberOfDegeneracies;
 
   // Various methods to support the Delaunay algorithm
+  int TriangulateInParallel(vtkPoints* points, double tol, vtkCellArray* triangles);
   int* RecoverBoundary(vtkPolyData* source);
   int RecoverEdge(vtkPolyData* source, vtkIdType p1, vtkIdType p2);
   void FillPolygons(vtkCellArray* polys, int* triUse);
@@ -3,6 +3,7 @@
 
 #include "vtkDelaunay3D.h"
 
+#include "vtkDelaunayInsertionOrder.h"
 #include "vtkEdgeTable.h"
 #include "vtkExecutive.h"
 #include "vtkIncrementalPointLocator.h"
@@ -17,6 +18,8 @@
 #include "vtkTriangle.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkDelaunay3D);
 
@@ -126,6 +129,7 @@ vtkDelaunay3D::vtkDelaunay3D()
   this->Tolerance = 0.001;
   this->BoundingTriangulation = 0;
   this->Offset = 2.5;
+  this->SpatialPointInsertion = 0;
   this->OutputPointsPrecision = DEFAULT_PRECISION;
   this->Locator = nullptr;
   this->TetraArray = nullptr;
@@ -484,17 +488,25 @@ int vtkDelaunay3D::RequestData(vtkInformation* vtkNotUsed(request),
   // Insert each point into triangulation. Points laying "inside"
   // of tetra cause tetra to be deleted, leaving a void with bounding
   // faces. Combination of point and each face is used to form new
-  // tetrahedra.
-  for (ptId = 0; ptId < numPoints; ptId++)
+  // tetrahedra. The points are traversed in given order, or in spatially
+  // coherent order.
+  std::vector<vtkIdType> spatialOrder;
+  if (this->SpatialPointInsertion)
+  {
+    vtkDelaunayInsertionOrder::Compute(
+      inPoints, numPoints, input->GetBounds(), false, spatialOrder);
+  }
+  for (vtkIdType idx = 0; idx < numPoints; idx++)
   {
+    ptId = (this->SpatialPointInsertion ? spatialOrder[idx] : idx);
     inPoints->GetPoint(ptId, x);
 
     this->InsertPoint(Mesh, points, ptId, x, holeTetras);
 
-    if (!(ptId % 250))
+    if (!(idx % 250))
     {
-      vtkDebugMacro(<< "point #" << ptId);
-      this->UpdateProgress(static_cast<double>(ptId) / numPoints);
+      vtkDebugMacro(<< "point #" << idx);
+      this->UpdateProgress(static_cast<double>(idx) / numPoints);
       if (this->CheckAbort())
       {
         break;
@@ -1051,6 +1063,7 @@ void vtkDelaunay3D::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Tolerance: " << this->Tolerance << "\n";
   os << indent << "Offset: " << this->Offset << "\n";
   os << indent << "Bounding Triangulation: " << (this->BoundingTriangulation ? "On\n" : "Off\n");
+  os << indent << "Spatial Point Insertion: " << (this->SpatialPointInsertion ? "On\n" : "Off\n");
 
   if (this->Locator)
   {
@@ -186,6 +186,24 @@ public:
   vtkBooleanMacro(BoundingTriangulation, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to insert the points following a spatially coherent
+   * order rather than in the given order. The points are sorted in parallel
+   * (using vtkSMPTools) along a serpentine traversal of buckets covering the
+   * points, so that consecutive points are close to each other. The search
+   * of the tetrahedron containing each new point starts from a tetrahedron
+   * using the closest inserted point, found with the point locator, so this
+   * order keeps the locator queries and the walks through the mesh within a
+   * small region, which improves memory locality on large inputs. Only the
+   * ordering is computed in parallel: the points are still inserted one at a
+   * time. Off by default.
+   */
+  vtkSetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkGetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkBooleanMacro(SpatialPointInsertion, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Set / get a spatial locator for merging points. By default,
@@ -266,6 +284,7 @@ protected:
   double Tolerance;
   vtkTypeBool BoundingTriangulation;
   double Offset;
+  vtkTypeBool SpatialPointInsertion;
   int OutputPointsPrecision;
 
   vtkIncrementalPointLocator* Locator; // help locate points faster
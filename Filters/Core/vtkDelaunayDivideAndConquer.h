@@ -0,0 +1,430 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkDelaunayDivideAndConquer
+ * @brief   parallel divide-and-conquer 2D Delaunay triangulation
+ *
+ * vtkDelaunayDivideAndConquer triangulates a set of distinct points in the
+ * x-y plane with the divide-and-conquer algorithm of Guibas and Stolfi. The
+ * points, sorted by x and then y, are recursively split into halves which are
+ * triangulated independently and then merged by zipping the two
+ * triangulations together along their lower common tangent. The mesh is
+ * represented with the quad-edge data structure, so that each merge only
+ * edits the edges of the two triangulations it merges.
+ *
+ * The sorted points are divided into a number of blocks only depending on the
+ * number of points. The blocks are triangulated in parallel with
+ * vtkSMPTools, then merged pairwise level by level, the merges of a level
+ * being performed in parallel too. The output triangles are sorted, so that
+ * the output does not depend on the number of threads.
+ *
+ * Reference: L. Guibas and J. Stolfi, "Primitives for the manipulation of
+ * general subdivisions and the computation of Voronoi diagrams", ACM
+ * Transactions on Graphics, 4(2), 1985.
+ *
+ * @warning
+ * The predicates are evaluated in double precision without exact arithmetic.
+ * Four or more cocircular points are triangulated consistently, but points
+ * that are nearly collinear or cocircular up to round-off may produce an
+ * invalid mesh.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkDelaunay2D
+ */
+
+#ifndef vtkDelaunayDivideAndConquer_h
+#define vtkDelaunayDivideAndConquer_h
+
+#include "vtkCellArray.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace vtkDelaunayDivideAndConquer
+{
+
+// Minimum number of points of the blocks triangulated by a single thread.
+constexpr vtkIdType MinimumBlockSize = 1024;
+// Maximum number of levels of merges performed in parallel.
+constexpr int MaximumNumberOfLevels = 10;
+
+// One of the four directed edges of a quad-edge: the two orientations of an
+// edge of the triangulation (Index 0 and 2), and the two orientations of its
+// dual edge (Index 1 and 3).
+struct Edge
+{
+  Edge* ONext;       // next edge counterclockwise around the origin
+  vtkIdType Origin;  // point id of the origin, primal edges only
+  unsigned char Index;
+  bool Deleted;      // set on the edge of Index 0 only
+};
+using QuadEdge = std::array<Edge, 4>;
+// Edges are never moved once created, so that they can reference each other.
+using EdgePool = std::deque<QuadEdge>;
+
+inline Edge* Rot(Edge* e)
+{
+  return e->Index < 3 ? e + 1 : e - 3;
+}
+inline Edge* InvRot(Edge* e)
+{
+  return e->Index > 0 ? e - 1 : e + 3;
+}
+inline Edge* Sym(Edge* e)
+{
+  return e->Index < 2 ? e + 2 : e - 2;
+}
+inline Edge* OPrev(Edge* e)
+{
+  return Rot(Rot(e)->ONext);
+}
+inline Edge* LNext(Edge* e)
+{
+  return Rot(InvRot(e)->ONext);
+}
+inline Edge* RPrev(Edge* e)
+{
+  return Sym(e)->ONext;
+}
+inline vtkIdType Dest(Edge* e)
+{
+  return Sym(e)->Origin;
+}
+
+inline Edge* MakeEdge(EdgePool& pool, vtkIdType origin, vtkIdType dest)
+{
+  pool.emplace_back();
+  QuadEdge& q = pool.back();
+  for (unsigned char i = 0; i < 4; ++i)
+  {
+    q[i].Origin = -1;
+    q[i].Index = i;
+    q[i].Deleted = false;
+  }
+  q[0].ONext = &q[0];
+  q[1].ONext = &q[3];
+  q[2].ONext = &q[2];
+  q[3].ONext = &q[1];
+  q[0].Origin = origin;
+  q[2].Origin = dest;
+  return &q[0];
+}
+
+// Exchange the origin rings of a and b, and the left face rings of their
+// dual edges.
+inline void Splice(Edge* a, Edge* b)
+{
+  Edge* alpha = Rot(a->ONext);
+  Edge* beta = Rot(b->ONext);
+  std::swap(a->ONext, b->ONext);
+  std::swap(alpha->ONext, beta->ONext);
+}
+
+// Add an edge from the destination of a to the origin of b, so that a, the
+// new edge and b share the same left face.
+inline Edge* Connect(EdgePool& pool, Edge* a, Edge* b)
+{
+  Edge* e = MakeEdge(pool, Dest(a), b->Origin);
+  Splice(e, LNext(a));
+  Splice(Sym(e), b);
+  return e;
+}
+
+inline void DeleteEdge(Edge* e)
+{
+  Splice(e, OPrev(e));
+  Splice(Sym(e), OPrev(Sym(e)));
+  (e - e->Index)->Deleted = true;
+}
+
+class Triangulator
+{
+public:
+  /**
+   * x holds the coordinates of the points (three per point, the z coordinate
+   * is ignored) and ids the ids of the points to triangulate, sorted by x and
+   * then y, without duplicate coordinates.
+   */
+  Triangulator(const double* x, const std::vector<vtkIdType>& ids)
+    : X(x)
+    , Ids(ids)
+  {
+  }
+
+  /**
+   * Triangulate the points and insert the counterclockwise triangles into
+   * triangles. Return false, leaving triangles empty, if the loops were
+   * cancelled (see vtkSMPTools::CancellationScope).
+   */
+  bool Execute(vtkCellArray* triangles)
+  {
+    const vtkIdType numIds = static_cast<vtkIdType>(this->Ids.size());
+    if (numIds < 3)
+    {
+      return true;
+    }
+
+    // Split the points the way the serial recursion does, so that the blocks
+    // of a level are merged pairwise into the blocks of the level above.
+    int numLevels = 0;
+    while (numLevels < MaximumNumberOfLevels && (numIds >> (numLevels + 1)) >= MinimumBlockSize)
+    {
+      ++numLevels;
+    }
+    std::vector<std::pair<vtkIdType, vtkIdType>> blocks;
+    this->Split(0, numIds, numLevels, blocks);
+
+    std::vector<std::vector<Hull>> hulls(numLevels + 1);
+    hulls[numLevels].resize(blocks.size());
+    vtkSMPTools::For(0, static_cast<vtkIdType>(blocks.size()), [&](vtkIdType begin, vtkIdType end) {
+      EdgePool& pool = this->Pools.Local();
+      for (vtkIdType block = begin; block < end; ++block)
+      {
+        hulls[numLevels][block] = this->Build(pool, blocks[block].first, blocks[block].second);
+      }
+    });
+    for (int level = numLevels - 1; level >= 0; --level)
+    {
+      // A cancelled loop leaves hulls unset.
+      if (vtkSMPTools::IsCancelled())
+      {
+        return false;
+      }
+      const std::vector<Hull>& children = hulls[level + 1];
+      hulls[level].resize(children.size() / 2);
+      vtkSMPTools::For(0, static_cast<vtkIdType>(hulls[level].size()),
+        [&](vtkIdType begin, vtkIdType end) {
+          EdgePool& pool = this->Pools.Local();
+          for (vtkIdType node = begin; node < end; ++node)
+          {
+            hulls[level][node] = this->Merge(pool, children[2 * node], children[2 * node + 1]);
+          }
+        });
+    }
+    if (vtkSMPTools::IsCancelled())
+    {
+      return false;
+    }
+
+    this->ExtractTriangles(triangles);
+    return true;
+  }
+
+private:
+  // Counterclockwise convex hull edge out of the leftmost point, and
+  // clockwise convex hull edge out of the rightmost point.
+  using Hull = std::pair<Edge*, Edge*>;
+
+  const double* X;
+  const std::vector<vtkIdType>& Ids;
+  vtkSMPThreadLocal<EdgePool> Pools;
+
+  bool CCW(vtkIdType a, vtkIdType b, vtkIdType c) const
+  {
+    const double* xa = this->X + 3 * a;
+    const double* xb = this->X + 3 * b;
+    const double* xc = this->X + 3 * c;
+    return (xb[0] - xa[0]) * (xc[1] - xa[1]) - (xb[1] - xa[1]) * (xc[0] - xa[0]) > 0.0;
+  }
+
+  // Whether d lies strictly inside the circumcircle of the counterclockwise
+  // triangle (a,b,c).
+  bool InCircle(vtkIdType a, vtkIdType b, vtkIdType c, vtkIdType d) const
+  {
+    const double* xd = this->X + 3 * d;
+    double dx[3], dy[3], lift[3];
+    const vtkIdType ids[3] = { a, b, c };
+    for (int i = 0; i < 3; ++i)
+    {
+      const double* xi = this->X + 3 * ids[i];
+      dx[i] = xi[0] - xd[0];
+      dy[i] = xi[1] - xd[1];
+      lift[i] = dx[i] * dx[i] + dy[i] * dy[i];
+    }
+    return lift[0] * (dx[1] * dy[2] - dx[2] * dy[1]) + lift[1] * (dx[2] * dy[0] - dx[0] * dy[2]) +
+      lift[2] * (dx[0] * dy[1] - dx[1] * dy[0]) >
+      0.0;
+  }
+
+  bool RightOf(vtkIdType p, Edge* e) const { return this->CCW(p, Dest(e), e->Origin); }
+  bool LeftOf(vtkIdType p, Edge* e) const { return this->CCW(p, e->Origin, Dest(e)); }
+
+  void Split(vtkIdType begin, vtkIdType end, int numLevels,
+    std::vector<std::pair<vtkIdType, vtkIdType>>& blocks) const
+  {
+    if (numLevels == 0)
+    {
+      blocks.emplace_back(begin, end);
+      return;
+    }
+    const vtkIdType mid = begin + (end - begin) / 2;
+    this->Split(begin, mid, numLevels - 1, blocks);
+    this->Split(mid, end, numLevels - 1, blocks);
+  }
+
+  // Triangulate the sorted points [begin,end), at least two of them.
+  Hull Build(EdgePool& pool, vtkIdType begin, vtkIdType end) const
+  {
+    const vtkIdType* s = this->Ids.data() + begin;
+    const vtkIdType numIds = end - begin;
+    if (numIds == 2)
+    {
+      Edge* a = MakeEdge(pool, s[0], s[1]);
+      return { a, Sym(a) };
+    }
+    if (numIds == 3)
+    {
+      Edge* a = MakeEdge(pool, s[0], s[1]);
+      Edge* b = MakeEdge(pool, s[1], s[2]);
+      Splice(Sym(a), b);
+      if (this->CCW(s[0], s[1], s[2]))
+      {
+        Connect(pool, b, a);
+        return { a, Sym(b) };
+      }
+      if (this->CCW(s[0], s[2], s[1]))
+      {
+        Edge* c = Connect(pool, b, a);
+        return { Sym(c), c };
+      }
+      // Collinear points.
+      return { a, Sym(b) };
+    }
+    const vtkIdType mid = begin + numIds / 2;
+    return this->Merge(pool, this->Build(pool, begin, mid), this->Build(pool, mid, end));
+  }
+
+  // Merge two triangulations, the points of left preceding those of right.
+  Hull Merge(EdgePool& pool, const Hull& left, const Hull& right) const
+  {
+    Edge* ldo = left.first;
+    Edge* ldi = left.second;
+    Edge* rdi = right.first;
+    Edge* rdo = right.second;
+
+    // Find the lower common tangent of the two convex hulls.
+    for (;;)
+    {
+      if (this->LeftOf(rdi->Origin, ldi))
+      {
+        ldi = LNext(ldi);
+      }
+      else if (this->RightOf(ldi->Origin, rdi))
+      {
+        rdi = RPrev(rdi);
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    Edge* basel = Connect(pool, Sym(rdi), ldi);
+    if (ldi->Origin == ldo->Origin)
+    {
+      ldo = Sym(basel);
+    }
+    if (rdi->Origin == rdo->Origin)
+    {
+      rdo = basel;
+    }
+
+    // Zip the triangulations from bottom to top, deleting the edges that
+    // are no longer Delaunay.
+    auto valid = [&](Edge* e) { return this->RightOf(Dest(e), basel); };
+    for (;;)
+    {
+      Edge* lcand = Sym(basel)->ONext;
+      if (valid(lcand))
+      {
+        while (this->InCircle(Dest(basel), basel->Origin, Dest(lcand), Dest(lcand->ONext)))
+        {
+          Edge* next = lcand->ONext;
+          DeleteEdge(lcand);
+          lcand = next;
+        }
+      }
+      Edge* rcand = OPrev(basel);
+      if (valid(rcand))
+      {
+        while (this->InCircle(Dest(basel), basel->Origin, Dest(rcand), Dest(OPrev(rcand))))
+        {
+          Edge* next = OPrev(rcand);
+          DeleteEdge(rcand);
+          rcand = next;
+        }
+      }
+      const bool lvalid = valid(lcand);
+      const bool rvalid = valid(rcand);
+      if (!lvalid && !rvalid)
+      {
+        break;
+      }
+      if (!lvalid ||
+        (rvalid && this->InCircle(Dest(lcand), lcand->Origin, rcand->Origin, Dest(rcand))))
+      {
+        basel = Connect(pool, rcand, Sym(basel));
+      }
+      else
+      {
+        basel = Connect(pool, Sym(basel), Sym(lcand));
+      }
+    }
+    return { ldo, rdo };
+  }
+
+  // Each triangle is the left face of its three edges; it is output once,
+  // from the edge whose origin has the smallest id. The outer face is
+  // traversed clockwise and is therefore skipped.
+  void ExtractTriangles(vtkCellArray* triangles)
+  {
+    std::vector<std::array<vtkIdType, 3>> tris;
+    for (EdgePool& pool : this->Pools)
+    {
+      for (QuadEdge& q : pool)
+      {
+        if (q[0].Deleted)
+        {
+          continue;
+        }
+        for (Edge* e : { &q[0], &q[2] })
+        {
+          Edge* f = LNext(e);
+          Edge* g = LNext(f);
+          const vtkIdType a = e->Origin;
+          const vtkIdType b = f->Origin;
+          const vtkIdType c = g->Origin;
+          if (LNext(g) == e && a < b && a < c && this->CCW(a, b, c))
+          {
+            tris.push_back({ a, b, c });
+          }
+        }
+      }
+    }
+    vtkSMPTools::Sort(tris.begin(), tris.end());
+
+    triangles->AllocateExact(static_cast<vtkIdType>(tris.size()), 3 * tris.size());
+    for (const auto& tri : tris)
+    {
+      triangles->InsertNextCell({ tri[0], tri[1], tri[2] });
+    }
+  }
+};
+
+} // namespace vtkDelaunayDivideAndConquer
+VTK_ABI_NAMESPACE_END
+
+#endif
+// VTK-HeaderTest-Exclude: vtkDelaunayDivideAndConquer.h
@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkDelaunayInsertionOrder
+ * @brief   spatially coherent point insertion order for Delaunay triangulation
+ *
+ * vtkDelaunayInsertionOrder computes an ordering of points such that points
+ * that are consecutive in the ordering are close to each other in space. The
+ * points are binned into a regular grid of buckets which is traversed in a
+ * serpentine (boustrophedon) fashion, so that two consecutive buckets are
+ * always face neighbors. The binning and the sort are performed in parallel
+ * with vtkSMPTools, and the result only depends on the point coordinates
+ * (not on the number of threads).
+ *
+ * vtkDelaunay2D locates the triangle containing each new point by walking
+ * through the mesh from the triangle found for the previous insertion:
+ * inserting the points in this order keeps these walks short, which otherwise
+ * dominate the execution time on large inputs. vtkDelaunay3D instead starts
+ * its walk from a tetrahedron using the closest inserted point, found with its
+ * point locator: this order keeps the locator queries and the walks within a
+ * small region of the locator and of the mesh, which improves memory locality.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkDelaunay2D vtkDelaunay3D vtkStaticPointLocator
+ */
+
+#ifndef vtkDelaunayInsertionOrder_h
+#define vtkDelaunayInsertionOrder_h
+
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace vtkDelaunayInsertionOrder
+{
+
+// Average number of points per bucket.
+constexpr double PointsPerBucket = 2.0;
+
+struct BucketedPoint
+{
+  vtkIdType Bucket;
+  vtkIdType PointId;
+
+  bool operator<(const BucketedPoint& other) const
+  {
+    return this->Bucket < other.Bucket ||
+      (this->Bucket == other.Bucket && this->PointId < other.PointId);
+  }
+};
+
+/**
+ * Fill order with the ids of the first numPts points of pts, sorted along a
+ * serpentine traversal of buckets covering bounds. If planar is true, the z
+ * coordinate is ignored (points are only binned in the x-y plane).
+ */
+inline void Compute(vtkPoints* pts, vtkIdType numPts, const double bounds[6], bool planar,
+  std::vector<vtkIdType>& order)
+{
+  order.resize(numPts);
+  if (numPts <= 0)
+  {
+    return;
+  }
+
+  // Determine the bucket divisions. Degenerate directions get a single
+  // division; the others are subdivided proportionally to their length.
+  const int numAxes = planar ? 2 : 3;
+  double length[3] = { 0.0, 0.0, 0.0 };
+  double volume = 1.0;
+  int dim = 0;
+  for (int axis = 0; axis < numAxes; ++axis)
+  {
+    length[axis] = bounds[2 * axis + 1] - bounds[2 * axis];
+    if (length[axis] > 0.0)
+    {
+      volume *= length[axis];
+      ++dim;
+    }
+  }
+  const double numBuckets = std::max(1.0, static_cast<double>(numPts) / PointsPerBucket);
+  const double factor = (dim > 0 ? std::pow(numBuckets / volume, 1.0 / dim) : 0.0);
+  vtkIdType divs[3] = { 1, 1, 1 };
+  double scale[3] = { 0.0, 0.0, 0.0 };
+  for (int axis = 0; axis < numAxes; ++axis)
+  {
+    if (length[axis] > 0.0)
+    {
+      divs[axis] = std::max<vtkIdType>(1, static_cast<vtkIdType>(length[axis] * factor));
+      scale[axis] = divs[axis] / length[axis];
+    }
+  }
+
+  // Compute the serpentine bucket index of each point.
+  std::vector<BucketedPoint> bucketed(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    vtkIdType ijk[3];
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      pts->GetPoint(ptId, x);
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        const vtkIdType idx =
+          static_cast<vtkIdType>((x[axis] - bounds[2 * axis]) * scale[axis]);
+        ijk[axis] = std::min(std::max<vtkIdType>(idx, 0), divs[axis] - 1);
+      }
+      // Reverse every other row and layer so that consecutive buckets touch.
+      const vtkIdType j = (ijk[2] % 2 ? divs[1] - 1 - ijk[1] : ijk[1]);
+      const vtkIdType row = ijk[2] * divs[1] + j;
+      const vtkIdType i = (row % 2 ? divs[0] - 1 - ijk[0] : ijk[0]);
+      bucketed[ptId].Bucket = row * divs[0] + i;
+      bucketed[ptId].PointId = ptId;
+    }
+  });
+
+  vtkSMPTools::Sort(bucketed.begin(), bucketed.end());
+
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType idx = begin; idx < end; ++idx)
+    {
+      order[idx] = bucketed[idx].PointId;
+    }
+  });
+}
+
+} // namespace vtkDelaunayInsertionOrder
+VTK_ABI_NAMESPACE_END
+
+#endif
+// VTK-HeaderTest-Exclude: vtkDelaunayInsertionOrder.h
@@ -126,6 +126,8 @@ vtkElevationFilter::vtkElevationFilter()
 
   this->ScalarRange[0] = 0.0;
   this->ScalarRange[1] = 1.0;
+  // Points are processed independently.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -256,6 +256,13 @@ ExtractedCellsT ExtractCells(vtkDataSet* input, const CellWorkT& work, unsigned
       }
     }
   });
+  // Batches skipped by an abort have no connectivity size: extract no cells.
+  if (vtkSMPTools::IsCancelled())
+  {
+    result.CellTypes->Initialize();
+    result.Connectivity.TakeReference(vtkCellArray::New());
+    return result;
+  }
   // assign BeginCellsConnectivity and calculate connectivity size
   const auto globalSum = batches.BuildOffsetsAndGetGlobalSum();
   const auto totalConnectivitySize = globalSum.CellsConnectivityOffset;
@@ -512,6 +519,8 @@ vtkStandardNewMacro(vtkExtractCells);
 vtkExtractCells::vtkExtractCells()
 {
   this->CellList = vtkSmartPointer<vtkExtractCellsIdList>::New();
+  // Each step is checked for an abort before its results are used.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -561,6 +570,8 @@ void vtkExtractCells::AddCellIds(const vtkIdType* ptr, vtkIdType numValues)
     cellIds->Resize(newSize);
   }
   cellIds->SetNumberOfIds(newSize);
+  // The list is kept by the filter, so it is never left partially copied.
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(0, numValues, [&](vtkIdType begin, vtkIdType end) {
     std::copy(ptr + begin, ptr + end, cellIds->GetPointer(oldSize + begin));
   });
@@ -589,6 +600,7 @@ void vtkExtractCells::AddCellRange(vtkIdType from, vtkIdType to)
     cellIds->Resize(newSize);
   }
   cellIds->SetNumberOfIds(newSize);
+  vtkSMPTools::CancellationScope uncancellable(nullptr);
   vtkSMPTools::For(0, numValues, [&](vtkIdType begin, vtkIdType end) {
     std::iota(
       cellIds->GetPointer(oldSize + begin), cellIds->GetPointer(oldSize + end), from + begin);
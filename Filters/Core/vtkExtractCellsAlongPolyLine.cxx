@@ -817,6 +817,9 @@ vtkExtractCellsAlongPolyLine::vtkExtractCellsAlongPolyLine()
   : OutputPointsPrecision(vtkAlgorithm::DEFAULT_PRECISION)
 {
   this->SetNumberOfInputPorts(2);
+  // The intersected cells are gathered per thread, so threads can stop at
+  // any line.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
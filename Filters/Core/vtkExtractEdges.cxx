@@ -29,6 +29,9 @@ vtkStandardNewMacro(vtkExtractEdges);
 vtkExtractEdges::vtkExtractEdges()
 {
   this->UseAllPoints = false;
+  // The threads only gather the edges of the cells they process, so the
+  // extraction can stop at any cell.
+  this->CancellableExecution = true;
 }
 VTK_ABI_NAMESPACE_END
 
@@ -854,6 +854,12 @@ void vtkFlyingEdges2DAlgorithm<T>::ContourImage(vtkFlyingEdges2D* self, T* scala
     Pass2<T> pass2(&algo, self);
     vtkSMPTools::For(0, algo.Dims[1] - 1, pass2);
 
+    // Rows skipped because of an abort leave the edge metadata incomplete.
+    if (self->CheckAbort())
+    {
+      break;
+    }
+
     // PASS 3: Now allocate and generate output. First we have to update the
     // x-Edge meta data to partition the output into separate pieces so
     // independent threads can write into separate memory partitions. Once
@@ -924,6 +930,8 @@ vtkFlyingEdges2D::vtkFlyingEdges2D()
   // by default process active point scalars
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+  // The rows are checked for an abort before the output is allocated.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -1419,6 +1419,13 @@ void vtkFlyingEdges3DAlgorithm<T>::Contour(vtkFlyingEdges3D* self, vtkImageData*
     Pass2<T> pass2(&algo, self);
     vtkSMPTools::For(0, algo.Dims[2] - 1, pass2);
 
+    // The passes stop early when the filter is aborted, leaving the edge
+    // metadata incomplete: it must not be used to allocate the output.
+    if (self->CheckAbort())
+    {
+      break;
+    }
+
     // PASS 3: Now allocate and generate output. First we have to update the
     // edge meta data to partition the output into separate pieces so
     // independent threads can write without collisions. Once allocation is
@@ -1506,6 +1513,10 @@ void vtkFlyingEdges3DAlgorithm<T>::Contour(vtkFlyingEdges3D* self, vtkImageData*
       // maximum performance.
       Pass4<T> pass4(&algo, value, self);
       vtkSMPTools::For(0, algo.Dims[2] - 1, pass4);
+      if (self->CheckAbort())
+      {
+        break;
+      }
     } // if anything generated
 
     // Handle multiple contours
@@ -1543,6 +1554,9 @@ vtkFlyingEdges3D::vtkFlyingEdges3D()
   this->InterpolateAttributes = 0;
   this->ArrayComponent = 0;
 
+  // The threaded passes stop as soon as the filter is aborted.
+  this->CancellableExecution = true;
+
   // by default process active point scalars
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
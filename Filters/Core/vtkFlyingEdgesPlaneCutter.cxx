@@ -1399,6 +1399,15 @@ void vtkFlyingEdgesPlaneCutterAlgorithm<T>::Contour(vtkFlyingEdgesPlaneCutter* s
   Pass2<T> pass2(&algo, self);
   vtkSMPTools::For(0, algo.Dims[2] - 1, pass2);
 
+  // The passes stop early when the filter is aborted, leaving the edge
+  // metadata incomplete: it must not be used to allocate the output.
+  if (self->CheckAbort())
+  {
+    delete[] algo.XCases;
+    delete[] algo.EdgeMetaData;
+    return;
+  }
+
   // PASS 3: Now allocate and generate output. First we have to update the
   // edge meta data to partition the output into separate pieces so
   // independent threads can write without collisions. Once allocation is
@@ -1506,6 +1515,9 @@ vtkFlyingEdgesPlaneCutter::vtkFlyingEdgesPlaneCutter()
   // by default process active point scalars
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+  // As in vtkFlyingEdges3D, the threaded passes stop as soon as the filter
+  // is aborted.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -14,6 +14,13 @@
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkHull);
 
+//------------------------------------------------------------------------------
+vtkHull::vtkHull()
+{
+  // The plane distances only bound the hull that an abort discards.
+  this->CancellableExecution = true;
+}
+
 //------------------------------------------------------------------------------
 int vtkHull::GetNumberOfPlanes()
 {
@@ -158,7 +158,7 @@ public:
   ///@}
 
 protected:
-  vtkHull() = default;
+  vtkHull();
   ~vtkHull() override = default;
 
   // The planes - 4 doubles per plane for A, B, C, D.
@@ -80,6 +80,9 @@ vtkHyperTreeGridProbeFilter::vtkHyperTreeGridProbeFilter()
   : Locator(vtkSmartPointer<vtkHyperTreeGridGeometricLocator>::New())
 {
   this->SetNumberOfInputPorts(2);
+  // The probed points are gathered per thread, so probing can stop at any
+  // point.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
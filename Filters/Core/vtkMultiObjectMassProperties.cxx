@@ -267,6 +267,9 @@ vtkMultiObjectMassProperties::vtkMultiObjectMassProperties()
   this->CellNeighbors = vtkIdList::New();
   this->Wave = nullptr;
   this->Wave2 = nullptr;
+  // The properties are accumulated per polygon, so the threads can stop at
+  // any polygon.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
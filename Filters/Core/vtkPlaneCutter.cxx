@@ -511,6 +511,9 @@ vtkPlaneCutter::vtkPlaneCutter()
   , DataChanged(true)
 {
   this->InputInfo = vtkInputInfo(nullptr, 0);
+  // Each thread cuts its cells into its own polydata, so threads can stop
+  // at any cell.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -322,6 +322,8 @@ vtkPointDataToCellData::vtkPointDataToCellData()
   this->CategoricalData = false;
   this->ProcessAllArrays = true;
   this->Implementation = new Internals();
+  // Like the averaging, a cancelled loop only leaves cell values unset.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -42,6 +42,9 @@ vtkPolyDataNormals::vtkPolyDataNormals()
   this->NonManifoldTraversal = 1;
   this->AutoOrientNormals = 0;
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
+  // Incomplete normals are only stored in the output, which an abort
+  // discards.
+  this->CancellableExecution = true;
 }
 
 //-----------------------------------------------------------------------------
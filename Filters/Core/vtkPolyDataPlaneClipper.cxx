@@ -44,6 +44,8 @@ vtkPolyDataPlaneClipper::vtkPolyDataPlaneClipper()
   vtkPolyData* output2 = vtkPolyData::New();
   this->GetExecutive()->SetOutputData(1, output2);
   output2->Delete();
+  // Each pass is checked for an abort before its maps and offsets are used.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -849,6 +851,11 @@ int vtkPolyDataPlaneClipper::RequestData(vtkInformation* vtkNotUsed(request),
     epWorker(inPts->GetData(), this->Plane);
   }
   vtkIdType numKeptPts = epWorker.NumberOfKeptPoints;
+  // Points skipped because of an abort are left out of the point map.
+  if (this->CheckAbort())
+  {
+    return 1;
+  }
 
   // Return quickly in two special cases: 1) when all points are discarded;
   // 2) when all points are kept.
@@ -871,6 +878,10 @@ int vtkPolyDataPlaneClipper::RequestData(vtkInformation* vtkNotUsed(request),
   // what's output, and then to actually create the output.
   EvaluateCells ec(epWorker.KeptPtMap, cells, this->BatchSize, this);
   ec.Execute();
+  if (this->CheckAbort())
+  {
+    return 1;
+  }
   PolyClipperBatches& batchInfo = ec.Batches;
   vtkIdType numOutCells = ec.NumberOfKeptOrClippedCells;
 
@@ -898,6 +909,11 @@ int vtkPolyDataPlaneClipper::RequestData(vtkInformation* vtkNotUsed(request),
   ext.Execute();
   cellOffsets->SetComponent(numOutCells, 0, ec.CellsConnSize);
   lineOffsets->SetComponent(ec.NumberOfClippedCells, 0, 2 * numEdges);
+  if (this->CheckAbort())
+  {
+    delete[] mergeEdges;
+    return 1;
+  }
 
   // New points are generated from groups of duplicate edges. The groups are
   // formed via sorting.
@@ -552,6 +552,9 @@ vtkPolyDataPlaneCutter::vtkPolyDataPlaneCutter()
   this->InterpolateAttributes = true;
   this->OutputPointsPrecision = DEFAULT_PRECISION;
   this->BatchSize = 10000;
+  // Loops skipped by an abort only leave lines and points unset; the sizes
+  // of the output are bounded by the cut cells.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
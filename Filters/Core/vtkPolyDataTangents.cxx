@@ -112,6 +112,13 @@ private:
 
 vtkStandardNewMacro(vtkPolyDataTangents);
 
+//------------------------------------------------------------------------------
+vtkPolyDataTangents::vtkPolyDataTangents()
+{
+  // Skipped cells only leave unset tangents in the discarded output.
+  this->CancellableExecution = true;
+}
+
 //------------------------------------------------------------------------------
 int vtkPolyDataTangents::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -49,7 +49,7 @@ public:
   ///@}
 
 protected:
-  vtkPolyDataTangents() = default;
+  vtkPolyDataTangents();
   ~vtkPolyDataTangents() override = default;
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
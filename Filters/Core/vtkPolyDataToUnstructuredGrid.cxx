@@ -26,6 +26,8 @@ vtkPolyDataToUnstructuredGrid::~vtkPolyDataToUnstructuredGrid() = default;
 void vtkPolyDataToUnstructuredGrid::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  // Partially copied cells are only stored in the discarded output.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -76,6 +76,8 @@ vtkProbeFilter::vtkProbeFilter()
   this->Tolerance = 1.0;
   this->ComputeTolerance = true;
   this->SnapToCellWithClosestPoint = false;
+  // Skipped points keep a zero mask, so they are reported as invalid.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -150,6 +150,8 @@ vtkRemoveUnusedPoints::vtkRemoveUnusedPoints()
   , OriginalPointIdsArrayName(nullptr)
 {
   this->SetOriginalPointIdsArrayName("vtkOriginalPointIds");
+  // The point map is built serially; only its copies are threaded.
+  this->CancellableExecution = true;
 }
 
 //----------------------------------------------------------------------------
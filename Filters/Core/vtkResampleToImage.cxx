@@ -33,6 +33,8 @@ vtkResampleToImage::vtkResampleToImage()
   this->SamplingBounds[0] = this->SamplingBounds[2] = this->SamplingBounds[4] = 0;
   this->SamplingBounds[1] = this->SamplingBounds[3] = this->SamplingBounds[5] = 1;
   this->SamplingDimensions[0] = this->SamplingDimensions[1] = this->SamplingDimensions[2] = 10;
+  // Blanking loops only write into the output ghost arrays.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -30,6 +30,8 @@ vtkResampleWithDataSet::vtkResampleWithDataSet()
 {
   this->SetNumberOfInputPorts(2);
   this->SetNumberOfOutputPorts(1);
+  // Blanking loops only write into the output ghost arrays.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -94,6 +94,8 @@ vtkSimpleElevationFilter::vtkSimpleElevationFilter()
   this->Vector[0] = 0.0;
   this->Vector[1] = 0.0;
   this->Vector[2] = 1.0;
+  // Each point is computed independently of the others.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
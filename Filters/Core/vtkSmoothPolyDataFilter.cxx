@@ -6,6 +6,7 @@
 #include "vtkCellData.h"
 #include "vtkCellLocator.h"
 #include "vtkFloatArray.h"
+#include "vtkGenericCell.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
@@ -13,11 +14,16 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTriangleFilter.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkSmoothPolyDataFilter);
@@ -118,12 +124,17 @@ vtkSmoothPolyDataFilter::vtkSmoothPolyDataFilter()
   this->GenerateErrorScalars = 0;
   this->GenerateErrorVectors = 0;
 
+  this->ParallelSmoothing = 0;
+
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
 
   this->SmoothPoints = nullptr;
 
   // optional second input
   this->SetNumberOfInputPorts(2);
+  // Unclassified edges are zero (not a feature edge) and the smoothing
+  // iterations stop on CheckAbort() before using the skipped loops.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -163,8 +174,54 @@ typedef struct _vtkMeshVertex
     type = VTK_SIMPLE_VERTEX; // can smooth
     edges = nullptr;
   }
+  ~_vtkMeshVertex()
+  {
+    if (edges)
+    {
+      edges->Delete();
+    }
+  }
 } vtkMeshVertex, *vtkMeshVertexPtr;
 
+// Static point-neighbor structure in compressed sparse row layout. The points
+// connected to point ptId (used to smooth it) are stored in
+// Neighbors[Offsets[ptId]] ... Neighbors[Offsets[ptId+1]-1]. Points that are
+// not smoothed have no neighbors.
+struct vtkSPDF_Connectivity
+{
+  std::vector<vtkIdType> Offsets;
+  std::vector<vtkIdType> Neighbors;
+
+  // Build the structure from the result of the topological analysis.
+  void Build(vtkMeshVertex* verts, vtkIdType numPts)
+  {
+    this->Offsets.resize(numPts + 1);
+    vtkIdType offset = 0;
+    for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+    {
+      this->Offsets[ptId] = offset;
+      if (verts[ptId].type != VTK_FIXED_VERTEX && verts[ptId].edges)
+      {
+        offset += verts[ptId].edges->GetNumberOfIds();
+      }
+    }
+    this->Offsets[numPts] = offset;
+    this->Neighbors.resize(offset);
+
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        const vtkIdType numNei = this->Offsets[ptId + 1] - this->Offsets[ptId];
+        if (numNei > 0)
+        {
+          const vtkIdType* nei = verts[ptId].edges->GetPointer(0);
+          std::copy(nei, nei + numNei, this->Neighbors.begin() + this->Offsets[ptId]);
+        }
+      }
+    });
+  }
+};
+
 template <typename T>
 struct vtkSPDF_InternalParams
 {
@@ -174,16 +231,125 @@ struct vtkSPDF_InternalParams
   T factor;
   T conv;
   vtkIdType numPts;
-  vtkMeshVertexPtr vertexPtr;
+  bool parallel;
+  const vtkSPDF_Connectivity* conn;
   vtkPolyData* source;
   vtkSmoothPoints* SmoothPoints;
-  double* w;
   vtkCellLocator* cellLocator;
 };
 
+// Perform one smoothing pass. Each point is moved toward the mean position
+// of its connected points, read from InPts. When InPts and OutPts differ
+// (parallel smoothing), InPts holds the point coordinates of the previous
+// pass so that the points can be processed independently. Otherwise, the
+// points are updated in place and the pass must be executed serially, in
+// point order.
+template <typename T>
+struct vtkSPDF_SmoothPass
+{
+  const vtkSPDF_InternalParams<T>& Params;
+  const T* InPts;
+  T* OutPts;
+  int MaxCellSize;
+  vtkSMPThreadLocal<T> MaxDist;
+  vtkSMPThreadLocalObject<vtkGenericCell> Cell;
+  vtkSMPThreadLocal<std::vector<double>> Weights;
+
+  vtkSPDF_SmoothPass(const vtkSPDF_InternalParams<T>& params, const T* inPts, T* outPts)
+    : Params(params)
+    , InPts(inPts)
+    , OutPts(outPts)
+    , MaxCellSize(params.source ? params.source->GetMaxCellSize() : 0)
+  {
+  }
+
+  void Initialize()
+  {
+    this->MaxDist.Local() = 0.0;
+    this->Weights.Local().resize(this->MaxCellSize);
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    const vtkIdType* offsets = this->Params.conn->Offsets.data();
+    const vtkIdType* neighbors = this->Params.conn->Neighbors.data();
+    T& maxDist = this->MaxDist.Local();
+    vtkGenericCell* cell = this->Cell.Local();
+    double* w = this->Weights.Local().data();
+    T dist, deltaX[3];
+    double dist2, xNew[3], closestPt[3];
+
+    for (; ptId < endPtId; ++ptId)
+    {
+      const T* x = this->InPts + 3 * ptId;
+      T* xOut = this->OutPts + 3 * ptId;
+      const vtkIdType npts = offsets[ptId + 1] - offsets[ptId];
+      if (npts == 0) // fixed point
+      {
+        std::copy(x, x + 3, xOut);
+        continue;
+      }
+
+      // Compute the mean (cumulated) direction vector
+      deltaX[0] = deltaX[1] = deltaX[2] = 0.0;
+      for (const vtkIdType* nei = neighbors + offsets[ptId]; nei != neighbors + offsets[ptId + 1];
+           ++nei)
+      {
+        for (int k = 0; k < 3; ++k)
+        {
+          deltaX[k] += this->InPts[3 * (*nei) + k];
+        }
+      }
+
+      // Move the point
+      for (int k = 0; k < 3; ++k)
+      {
+        xOut[k] = x[k] + this->Params.factor * (deltaX[k] / npts - x[k]);
+        xNew[k] = xOut[k];
+      }
+
+      // Constrain point to surface
+      if (this->Params.source)
+      {
+        vtkSmoothPoint* sPtr = this->Params.SmoothPoints->GetSmoothPoint(ptId);
+        bool inCell = false;
+        if (sPtr->cellId >= 0) // in cell
+        {
+          this->Params.source->GetCell(sPtr->cellId, cell);
+          inCell =
+            cell->EvaluatePosition(xNew, closestPt, sPtr->subId, sPtr->p, dist2, w) != 0;
+        }
+        if (!inCell) // not in cell anymore
+        {
+          this->Params.cellLocator->FindClosestPoint(
+            xNew, closestPt, cell, sPtr->cellId, sPtr->subId, dist2);
+        }
+        for (int k = 0; k < 3; ++k)
+        {
+          xOut[k] = static_cast<T>(closestPt[k]);
+        }
+      }
+
+      if ((dist = vtkMath::Norm(deltaX)) > maxDist)
+      {
+        maxDist = dist;
+      }
+    } // for all points
+  }
+
+  void Reduce() {}
+};
+
 template <typename T>
 void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
 {
+  // In parallel mode, the smoothing passes alternate between the output
+  // points and a temporary buffer. Otherwise the points are moved in place.
+  T* newPtsCoords = static_cast<T*>(params.newPts->GetVoidPointer(0));
+  std::vector<T> buffer(params.parallel ? 3 * params.numPts : 0);
+  const T* inPts = newPtsCoords;
+  T* outPts = params.parallel ? buffer.data() : newPtsCoords;
+
   int iterationNumber = 0;
   for (T maxDist = std::numeric_limits<T>::max();
        maxDist > params.conv && iterationNumber < params.numberOfIterations; ++iterationNumber)
@@ -197,82 +363,152 @@ void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
       }
     }
 
-    maxDist = 0.0;
-    T* newPtsCoords = static_cast<T*>(params.newPts->GetVoidPointer(0));
-    T* start = newPtsCoords;
-    vtkMeshVertexPtr vertsPtr = params.vertexPtr;
-    vtkIdType npts, *edgeIdPtr;
-    T dist, deltaX[3];
-    double dist2, xNew[3], closestPt[3];
+    vtkSPDF_SmoothPass<T> pass(params, inPts, outPts);
+    if (params.parallel)
+    {
+      vtkSMPTools::For(0, params.numPts, pass);
+      maxDist = 0.0;
+      for (const T& threadMaxDist : pass.MaxDist)
+      {
+        maxDist = std::max(maxDist, threadMaxDist);
+      }
+      inPts = outPts;
+      outPts = (outPts == newPtsCoords ? buffer.data() : newPtsCoords);
+    }
+    else
+    {
+      pass.Initialize();
+      pass(0, params.numPts);
+      maxDist = pass.MaxDist.Local();
+    }
+  } // for not converged or within iteration count
+
+  if (inPts != newPtsCoords)
+  {
+    std::copy(inPts, inPts + 3 * params.numPts, newPtsCoords);
+  }
 
-    // For each non-fixed vertex of the mesh, move the point toward the mean
-    // position of its connected neighbors using the relaxation factor.
-    for (vtkIdType i = 0; i < params.numPts; ++i)
+  vtkDebugWithObjectMacro(params.spdf, << "Performed " << iterationNumber << " smoothing passes");
+}
+
+// Classify the edges of the polygons in parallel. The classification of the
+// edge (pts[i],pts[i+1]) of the cell cellId is stored at EdgeTypes[offset+i],
+// where offset is the offset of the cell in the polygon connectivity. A
+// negative value indicates an edge already visited from another cell.
+struct vtkSPDF_ClassifyEdges
+{
+  vtkSmoothPolyDataFilter* Filter;
+  vtkPolyData* Mesh;
+  vtkPoints* InPts;
+  double CosFeatureAngle;
+  bool FeatureEdgeSmoothing;
+  std::vector<signed char>& EdgeTypes;
+  vtkSMPThreadLocalObject<vtkIdList> Neighbors;
+  vtkSMPThreadLocalObject<vtkIdList> CellIds;
+  vtkSMPThreadLocalObject<vtkIdList> NeiIds;
+
+  vtkSPDF_ClassifyEdges(vtkSmoothPolyDataFilter* filter, vtkPolyData* mesh, vtkPoints* inPts,
+    double cosFeatureAngle, std::vector<signed char>& edgeTypes)
+    : Filter(filter)
+    , Mesh(mesh)
+    , InPts(inPts)
+    , CosFeatureAngle(cosFeatureAngle)
+    , FeatureEdgeSmoothing(filter->GetFeatureEdgeSmoothing() != 0)
+    , EdgeTypes(edgeTypes)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkCellArray* polys = this->Mesh->GetPolys();
+    vtkDataArray* offsets = polys->GetOffsetsArray();
+    vtkIdList* neighbors = this->Neighbors.Local();
+    vtkIdList* cellIds = this->CellIds.Local();
+    vtkIdList* neiIds = this->NeiIds.Local();
+    vtkIdType npts, numNeiPts, nei;
+    const vtkIdType *pts, *neiPts;
+    double normal[3], neiNormal[3];
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    const vtkIdType checkAbortInterval = std::min((endCellId - cellId) / 10 + 1, (vtkIdType)1000);
+
+    for (const vtkIdType beginCellId = cellId; cellId < endCellId; ++cellId)
     {
-      if (vertsPtr->type != VTK_FIXED_VERTEX && vertsPtr->edges &&
-        (npts = vertsPtr->edges->GetNumberOfIds()) > 0)
+      if ((cellId - beginCellId) % checkAbortInterval == 0)
       {
-        deltaX[0] = deltaX[1] = deltaX[2] = 0.0;
-        edgeIdPtr = vertsPtr->edges->GetPointer(0);
-        // Compute the mean (cumulated) direction vector
-        for (vtkIdType j = 0; j < npts; ++j)
+        if (isFirst)
         {
-          for (unsigned short k = 0; k < 3; ++k)
-          {
-            deltaX[k] += *(start + 3 * (*edgeIdPtr) + k);
-          }
-          ++edgeIdPtr;
-        } // for all connected points
-
-        // Move the point
-        *newPtsCoords += params.factor * (deltaX[0] / npts - (*newPtsCoords));
-        xNew[0] = *newPtsCoords;
-        ++newPtsCoords;
-        *newPtsCoords += params.factor * (deltaX[1] / npts - (*newPtsCoords));
-        xNew[1] = *newPtsCoords;
-        ++newPtsCoords;
-        *newPtsCoords += params.factor * (deltaX[2] / npts - (*newPtsCoords));
-        xNew[2] = *newPtsCoords;
-        ++newPtsCoords;
-
-        // Constrain point to surface
-        if (params.source)
+          this->Filter->CheckAbort();
+        }
+        if (this->Filter->GetAbortOutput())
         {
-          vtkSmoothPoint* sPtr = params.SmoothPoints->GetSmoothPoint(i);
-          vtkCell* cell = nullptr;
+          break;
+        }
+      }
 
-          if (sPtr->cellId >= 0) // in cell
-          {
-            cell = params.source->GetCell(sPtr->cellId);
-          }
+      polys->GetCellAtId(cellId, npts, pts, cellIds);
+      signed char* edgeTypes =
+        this->EdgeTypes.data() + static_cast<vtkIdType>(offsets->GetComponent(cellId, 0));
+      bool normalComputed = false;
+      for (vtkIdType j = 0; j < npts; ++j)
+      {
+        const vtkIdType p1 = pts[j];
+        const vtkIdType p2 = pts[(j + 1) % npts];
+
+        this->Mesh->GetCellEdgeNeighbors(cellId, p1, p2, neighbors);
+        const vtkIdType numNei = neighbors->GetNumberOfIds();
 
-          if (!cell ||
-            cell->EvaluatePosition(xNew, closestPt, sPtr->subId, sPtr->p, dist2, params.w) == 0)
-          { // not in cell anymore
-            params.cellLocator->FindClosestPoint(xNew, closestPt, sPtr->cellId, sPtr->subId, dist2);
+        signed char edge = VTK_SIMPLE_VERTEX;
+        if (numNei == 0)
+        {
+          edge = VTK_BOUNDARY_EDGE_VERTEX;
+        }
+        else if (numNei >= 2)
+        {
+          // check to make sure that this edge hasn't been marked already
+          vtkIdType k;
+          for (k = 0; k < numNei; k++)
+          {
+            if (neighbors->GetId(k) < cellId)
+            {
+              break;
+            }
           }
-          for (int k = 0; k < 3; ++k)
+          if (k >= numNei)
           {
-            xNew[k] = closestPt[k];
+            edge = VTK_FEATURE_EDGE_VERTEX;
           }
-          params.newPts->SetPoint(i, xNew);
         }
+        else if (numNei == 1 && (nei = neighbors->GetId(0)) > cellId)
+        {
+          if (this->FeatureEdgeSmoothing)
+          {
+            if (!normalComputed)
+            {
+              vtkPolygon::ComputeNormal(this->InPts, npts, pts, normal);
+              normalComputed = true;
+            }
+            polys->GetCellAtId(nei, numNeiPts, neiPts, neiIds);
+            vtkPolygon::ComputeNormal(this->InPts, numNeiPts, neiPts, neiNormal);
 
-        if ((dist = vtkMath::Norm(deltaX)) > maxDist)
+            if (vtkMath::Dot(normal, neiNormal) <= this->CosFeatureAngle)
+            {
+              edge = VTK_FEATURE_EDGE_VERTEX;
+            }
+          }
+        }
+        else // a visited edge; skip rest of analysis
         {
-          maxDist = dist;
+          edge = -1;
         }
-      } // if can move point
-      else
-      {
-        newPtsCoords += 3;
+        edgeTypes[j] = edge;
       }
-      ++vertsPtr;
-    } // for all points
-  }   // for not converged or within iteration count
+    }
+  }
 
-  vtkDebugWithObjectMacro(params.spdf, << "Performed " << iterationNumber << " smoothing passes");
-}
+  void Reduce() {}
+};
 
 } // namespace
 
@@ -303,7 +539,6 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
   double x1[3], x2[3], x3[3], l1[3], l2[3];
   double CosFeatureAngle; // Cosine of angle between adjacent polys
   double CosEdgeAngle;    // Cosine of angle between adjacent edges
-  double closestPt[3], dist2;
   vtkIdType numSimple = 0, numBEdges = 0, numFixed = 0, numFEdges = 0;
   vtkPolyData* Mesh;
   vtkPoints* inPts;
@@ -421,13 +656,7 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
   { // build cell structure
     vtkCellArray* polys;
     vtkIdType cellId;
-    int numNei, nei, edge;
-    vtkIdType numNeiPts;
-    const vtkIdType* neiPts;
-    double normal[3], neiNormal[3];
-
-    vtkNew<vtkIdList> neighbors;
-    neighbors->Allocate(VTK_CELL_SIZE);
+    int edge;
 
     vtkNew<vtkPolyData> inMesh;
     inMesh->SetPoints(inPts);
@@ -448,15 +677,17 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
     polys = Mesh->GetPolys();
     this->UpdateProgress(0.375);
 
-    checkAbortInterval = std::min(polys->GetNumberOfCells() / 10 + 1, (vtkIdType)1000);
+    // Classify the polygon edges in parallel, then update the vertices
+    // serially in cell order.
+    std::vector<signed char> edgeTypes(polys->GetNumberOfConnectivityIds());
+    vtkSPDF_ClassifyEdges classifyEdges(this, Mesh, inPts, CosFeatureAngle, edgeTypes);
+    vtkSMPTools::For(0, polys->GetNumberOfCells(), classifyEdges);
 
-    for (cellId = 0, polys->InitTraversal(); polys->GetNextCell(npts, pts); cellId++)
+    const signed char* edgeType = edgeTypes.data();
+    for (cellId = 0, polys->InitTraversal();
+         !this->GetAbortOutput() && polys->GetNextCell(npts, pts); cellId++)
     {
-      if (cellId % checkAbortInterval == 0 && this->CheckAbort())
-      {
-        break;
-      }
-      for (i = 0; i < npts; i++)
+      for (i = 0; i < npts; i++, edgeType++)
       {
         p1 = pts[i];
         p2 = pts[(i + 1) % npts];
@@ -472,46 +703,7 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
           Verts[p2].edges->Allocate(16, 6);
         }
 
-        Mesh->GetCellEdgeNeighbors(cellId, p1, p2, neighbors);
-        numNei = neighbors->GetNumberOfIds();
-
-        edge = VTK_SIMPLE_VERTEX;
-        if (numNei == 0)
-        {
-          edge = VTK_BOUNDARY_EDGE_VERTEX;
-        }
-
-        else if (numNei >= 2)
-        {
-          // check to make sure that this edge hasn't been marked already
-          for (j = 0; j < numNei; j++)
-          {
-            if (neighbors->GetId(j) < cellId)
-            {
-              break;
-            }
-          }
-          if (j >= numNei)
-          {
-            edge = VTK_FEATURE_EDGE_VERTEX;
-          }
-        }
-
-        else if (numNei == 1 && (nei = neighbors->GetId(0)) > cellId)
-        {
-          if (this->FeatureEdgeSmoothing)
-          {
-            vtkPolygon::ComputeNormal(inPts, npts, pts, normal);
-            Mesh->GetCellPoints(nei, numNeiPts, neiPts);
-            vtkPolygon::ComputeNormal(inPts, numNeiPts, neiPts, neiNormal);
-
-            if (vtkMath::Dot(normal, neiNormal) <= CosFeatureAngle)
-            {
-              edge = VTK_FEATURE_EDGE_VERTEX;
-            }
-          }
-        }
-        else // a visited edge; skip rest of analysis
+        if ((edge = *edgeType) < 0) // a visited edge; skip rest of analysis
         {
           continue;
         }
@@ -651,49 +843,59 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
   newPts->SetNumberOfPoints(numPts);
 
+  // Gather the connected points of the smoothed vertices into a static
+  // structure, and release the per-vertex lists.
+  vtkSPDF_Connectivity conn;
+  conn.Build(Verts, numPts);
+  uVerts.reset();
+  Verts = nullptr;
+
   // If a Source is defined, we do constrained smoothing (that is, points are
   // constrained to the surface of the mesh object).
-  std::unique_ptr<double[]> w;
   vtkSmartPointer<vtkCellLocator> cellLocator;
   if (source)
   {
     this->SmoothPoints = std::unique_ptr<vtkSmoothPoints>(new vtkSmoothPoints);
-    vtkSmoothPoint* sPtr;
+    this->SmoothPoints->InsertSmoothPoint(numPts - 1);
     cellLocator.TakeReference(vtkCellLocator::New());
-    auto maxCellSize = source->GetMaxCellSize();
-    w.reset(new double[maxCellSize]);
     cellLocator->SetDataSet(source);
     cellLocator->BuildLocator();
-
-    for (i = 0; i < numPts; i++)
+    if (source->NeedToBuildCells())
     {
-      sPtr = this->SmoothPoints->InsertSmoothPoint(i);
-      cellLocator->FindClosestPoint(
-        inPts->GetPoint(i), closestPt, sPtr->cellId, sPtr->subId, dist2);
-      newPts->SetPoint(i, closestPt);
+      source->BuildCells(); // so that GetCell() is thread safe
     }
+
+    vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      vtkGenericCell* cell = tlCell.Local();
+      double x[3], closest[3], d2;
+      for (; ptId < endPtId; ++ptId)
+      {
+        vtkSmoothPoint* sPtr = this->SmoothPoints->GetSmoothPoint(ptId);
+        inPts->GetPoint(ptId, x);
+        cellLocator->FindClosestPoint(x, closest, cell, sPtr->cellId, sPtr->subId, d2);
+        newPts->SetPoint(ptId, closest);
+      }
+    });
   }
   else // smooth normally
   {
-    for (i = 0; i < numPts; i++) // initialize to old coordinates
-    {
-      newPts->SetPoint(i, inPts->GetPoint(i));
-    }
+    newPts->GetData()->DeepCopy(inPts->GetData()); // initialize to old coordinates
   }
 
   if (newPts->GetDataType() == VTK_DOUBLE)
   {
     vtkSPDF_InternalParams<double> params = { this, this->NumberOfIterations, newPts,
-      this->RelaxationFactor, conv, numPts, Verts, source, this->SmoothPoints.get(), w.get(),
-      cellLocator };
+      this->RelaxationFactor, conv, numPts, this->ParallelSmoothing != 0, &conn, source,
+      this->SmoothPoints.get(), cellLocator };
 
     vtkSPDF_MovePoints(params);
   }
   else
   {
     vtkSPDF_InternalParams<float> params = { this, this->NumberOfIterations, newPts,
-      static_cast<float>(this->RelaxationFactor), static_cast<float>(conv), numPts, Verts, source,
-      this->SmoothPoints.get(), w.get(), cellLocator };
+      static_cast<float>(this->RelaxationFactor), static_cast<float>(conv), numPts,
+      this->ParallelSmoothing != 0, &conn, source, this->SmoothPoints.get(), cellLocator };
 
     vtkSPDF_MovePoints(params);
   }
@@ -745,16 +947,6 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
   output->SetPolys(input->GetPolys());
   output->SetStrips(input->GetStrips());
 
-  // free up connectivity storage
-  for (i = 0; i < numPts; i++)
-  {
-    if (Verts[i].edges)
-    {
-      Verts[i].edges->Delete();
-      Verts[i].edges = nullptr;
-    }
-  }
-
   return 1;
 }
 
@@ -787,6 +979,7 @@ void vtkSmoothPolyDataFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Boundary Smoothing: " << (this->BoundarySmoothing ? "On\n" : "Off\n");
   os << indent << "Generate Error Scalars: " << (this->GenerateErrorScalars ? "On\n" : "Off\n");
   os << indent << "Generate Error Vectors: " << (this->GenerateErrorVectors ? "On\n" : "Off\n");
+  os << indent << "Parallel Smoothing: " << (this->ParallelSmoothing ? "On\n" : "Off\n");
   if (this->GetSource())
   {
     os << indent << "Source: " << static_cast<void*>(this->GetSource()) << "\n";
@@ -20,7 +20,12 @@
  * relaxation factor is available to control the amount of displacement of
  * v).  The process repeats for each vertex. This pass over the list of
  * vertices is a single iteration. Many iterations (generally around 20 or
- * so) are repeated until the desired result is obtained.
+ * so) are repeated until the desired result is obtained. By default, the
+ * vertices are moved in place one after the other, so that each vertex is
+ * moved toward the already updated positions of the vertices preceding it.
+ * The ParallelSmoothing option computes the new coordinates of all the
+ * vertices from the coordinates obtained at the end of the previous
+ * iteration instead, so that the vertices can be processed in parallel.
  *
  * There are some special instance variables used to control the execution
  * of this filter. (These ivars basically control what vertices can be
@@ -75,6 +80,11 @@
  * minimizing shrinkage. Another option is vtkConstrainedSmoothingFilter
  * which limits the distance that points can move.
  *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
  * @sa
  * vtkWindowedSincPolyDataFilter vtkConstrainedSmoothingFilter
  * vtkDecimate vtkDecimatePro
@@ -193,6 +203,23 @@ public:
   vtkBooleanMacro(GenerateErrorVectors, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off parallel smoothing. By default, the vertices are moved in
+   * place, in order, during each iteration: the new position of a vertex
+   * depends on the new positions of its neighbors moved before it
+   * (Gauss-Seidel update). When this option is on, the new positions of all
+   * the vertices are computed from the positions of the previous iteration
+   * (Jacobi update) in parallel with vtkSMPTools. The result does not depend
+   * on the number of threads, but differs from the default mode and usually
+   * requires more iterations to reach the same amount of smoothing. Off by
+   * default.
+   */
+  vtkSetMacro(ParallelSmoothing, vtkTypeBool);
+  vtkGetMacro(ParallelSmoothing, vtkTypeBool);
+  vtkBooleanMacro(ParallelSmoothing, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Specify the source object which is used to constrain smoothing. The
@@ -229,6 +256,7 @@ protected:
   vtkTypeBool BoundarySmoothing;
   vtkTypeBool GenerateErrorScalars;
   vtkTypeBool GenerateErrorVectors;
+  vtkTypeBool ParallelSmoothing;
   int OutputPointsPrecision;
 
   std::unique_ptr<vtkSmoothPoints> SmoothPoints;
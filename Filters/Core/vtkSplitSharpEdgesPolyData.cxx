@@ -31,6 +31,8 @@ vtkSplitSharpEdgesPolyData::vtkSplitSharpEdgesPolyData()
   : FeatureAngle(30.0)
   , OutputPointsPrecision(vtkAlgorithm::DEFAULT_PRECISION)
 {
+  // RequestData() stops before mapping points after a skipped split.
+  this->CancellableExecution = true;
 }
 
 //----------------------------------------------------------------------------
@@ -427,6 +429,11 @@ int vtkSplitSharpEdgesPolyData::RequestData(vtkInformation* vtkNotUsed(request),
 
   MarkAndSplitFunctor functor(input, output, cellNormals, newToOldPointsMap, this);
   vtkSMPTools::For(0, functor.PointBatches.GetNumberOfBatches(), functor);
+  if (this->CheckAbort())
+  {
+    // Skipped batches leave the new points unmapped.
+    return 1;
+  }
   const vtkIdType numOutPoints = newToOldPointsMap->GetNumberOfIds();
 
   vtkDebugMacro(<< "Created " << numOutPoints - numInPoints << " new points");
@@ -339,6 +339,10 @@ vtkStaticCleanUnstructuredGrid::vtkStaticCleanUnstructuredGrid()
   this->Locator = vtkSmartPointer<vtkStaticPointLocator>::New();
 
   this->PieceInvariant = true;
+
+  // The threaded loops stop as soon as the filter is aborted. The maps are
+  // then incomplete, so CheckAbort() is called before they are used.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -412,6 +416,10 @@ int vtkStaticCleanUnstructuredGrid::RequestData(vtkInformation* vtkNotUsed(reque
   // Build the locator, this is needed for all execution paths.
   this->Locator->SetDataSet(input);
   this->Locator->BuildLocator();
+  if (this->CheckAbort())
+  {
+    return 1;
+  }
 
   // Compute the tolerance
   double tol =
@@ -431,6 +439,11 @@ int vtkStaticCleanUnstructuredGrid::RequestData(vtkInformation* vtkNotUsed(reque
   {
     this->Locator->MergePoints(tol, mergeMap.data());
   }
+  if (this->CheckAbort())
+  {
+    this->Locator->Initialize();
+    return 1;
+  }
 
   // If removing unused points, traverse the connectivity array to mark the
   // points that are used by one or more cells.
@@ -490,6 +503,11 @@ int vtkStaticCleanUnstructuredGrid::RequestData(vtkInformation* vtkNotUsed(reque
   {
     vtkStaticCleanUnstructuredGrid::CopyPoints(inPts, inPD, newPts, outPD, pmap);
   }
+  if (this->CheckAbort())
+  {
+    this->Locator->Initialize();
+    return 1;
+  }
 
   // At this point, we need to construct the unstructured grid topology using
   // the point map. This means updating the connectivity arrays (including
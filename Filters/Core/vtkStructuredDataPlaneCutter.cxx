@@ -42,6 +42,8 @@ vtkStructuredDataPlaneCutter::vtkStructuredDataPlaneCutter()
 {
   this->Plane = vtkPlane::New();
   this->InputInfo = vtkInputInfo(nullptr, 0);
+  // Slicing stops before merging edges from skipped batches.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -812,6 +814,11 @@ vtkSmartPointer<vtkPolyData> SliceStructuredData(TGrid* inputGrid, vtkDataArray*
     evaluateCellsStructuredWorker(pointsArray, inputGrid, origin, normal, selected, inOut, slice,
       generatePolygons, allCellsVisible, batchSize, filter);
   }
+  if (filter->CheckAbort())
+  {
+    // Skipped batches leave the edges to merge uninitialized.
+    return vtkSmartPointer<vtkPolyData>::New();
+  }
 
   using TEdge = EdgeType<TInputIdType>;
   const vtkIdType connectivitySize = evaluateCellsStructuredWorker.ConnectivitySize;
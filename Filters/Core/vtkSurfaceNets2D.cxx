@@ -1132,13 +1132,29 @@ struct NetsWorker
     Pass2<ValueType> pass2(&algo);
     vtkSMPTools::For(0, algo.DyadDims[1] - 1, pass2);
 
+    // Rows skipped because of an abort leave the dyads partially
+    // classified: bail out before the output is allocated.
+    if (self->CheckAbort())
+    {
+      delete[] algo.DyadCases;
+      delete[] algo.EdgeMetaData;
+      return;
+    }
+
     // Prefix sum to determine the size and character of the output, and
     // then allocate it.
     Pass3(&algo, newPts, newLines, newScalars, stencils);
+    if (self->CheckAbort())
+    {
+      delete[] algo.DyadCases;
+      delete[] algo.EdgeMetaData;
+      return;
+    }
 
     // Generate the output points, lines, and scalar data.
     Pass4<ValueType> pass4(&algo);
     vtkSMPTools::For(0, algo.DyadDims[1] - 1, pass4);
+    self->CheckAbort();
 
     // Clean up and return
     delete[] algo.DyadCases;
@@ -1184,6 +1200,10 @@ vtkSurfaceNets2D::vtkSurfaceNets2D()
   this->GeometryCache = vtkSmartPointer<vtkPolyData>::New();
   this->StencilsCache = vtkSmartPointer<vtkCellArray>::New();
 
+  // Threads stop classifying rows as soon as the filter is aborted; the
+  // partial geometry is never cached.
+  this->CancellableExecution = true;
+
   // by default process active point scalars
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
@@ -1282,6 +1302,10 @@ int vtkSurfaceNets2D::RequestData(vtkInformation* vtkNotUsed(request),
       vtkLog(ERROR, "Unsupported data type"); // shouldn't happen because all types are supported
       return 1;
     }
+    if (this->CheckAbort())
+    {
+      return 1;
+    }
 
     vtkLog(INFO,
       "Extracted: " << newPts->GetNumberOfPoints() << " points, " << newLines->GetNumberOfCells()
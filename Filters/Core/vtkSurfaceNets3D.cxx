@@ -1780,6 +1780,15 @@ struct NetsWorker
     Pass2<ValueType> pass2(&algo);
     vtkSMPTools::For(1, algo.TriadDims[2] - 1, pass2);
 
+    // Slices skipped because of an abort leave the triads partially
+    // classified: bail out before the output is allocated.
+    if (self->CheckAbort())
+    {
+      delete[] algo.Triads;
+      delete[] algo.EdgeMetaData;
+      return;
+    }
+
     // Prefix sum to determine the size and character of the output, and
     // then allocate it.
     Pass3(&algo, newPts, newQuads, newScalars, stencils);
@@ -1789,6 +1798,7 @@ struct NetsWorker
     // processed.
     Pass4<ValueType> pass4(&algo);
     vtkSMPTools::For(0, algo.TriadDims[2] - 1, pass4);
+    self->CheckAbort();
 
     // Clean up and return
     delete[] algo.Triads;
@@ -2252,6 +2262,9 @@ vtkSurfaceNets3D::vtkSurfaceNets3D()
   this->GeometryCache = vtkSmartPointer<vtkPolyData>::New();
   this->StencilsCache = vtkSmartPointer<vtkCellArray>::New();
 
+  // Threads stop processing slices as soon as the filter is aborted.
+  this->CancellableExecution = true;
+
   // by default process active point scalars
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
@@ -2390,6 +2403,10 @@ int vtkSurfaceNets3D::RequestData(vtkInformation* vtkNotUsed(request),
       vtkErrorMacro(<< "Unsupported data type");
       return 1;
     }
+    if (this->CheckAbort())
+    {
+      return 1;
+    }
 
     vtkLog(INFO,
       "Extracted: " << newPts->GetNumberOfPoints() << " points, " << newQuads->GetNumberOfCells()
@@ -36,6 +36,8 @@ vtkThreshold::vtkThreshold()
   // by default process active point scalars
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS_THEN_CELLS, vtkDataSetAttributes::SCALARS);
+  // The kept cell list is discarded by the CheckAbort() following it.
+  this->CancellableExecution = true;
 }
 
 vtkThreshold::~vtkThreshold() = default;
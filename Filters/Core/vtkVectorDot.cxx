@@ -81,6 +81,12 @@ struct LaunchDotWorker
     Worker worker{ normals, vectors, scalars };
 
     vtkSMPTools::For(0, numPts, worker);
+    if (vtkSMPTools::IsCancelled())
+    {
+      // An abort may have skipped every thread, leaving no range to reduce.
+      scalarRange[0] = scalarRange[1] = 0.f;
+      return;
+    }
 
     // Reduce the scalar ranges:
     auto minElem = std::min_element(worker.LocalMin.begin(), worker.LocalMin.end());
@@ -149,6 +155,8 @@ vtkVectorDot::vtkVectorDot()
 
   this->ActualRange[0] = -1.0;
   this->ActualRange[1] = 1.0;
+  // The range of a cancelled evaluation is reset to zero.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
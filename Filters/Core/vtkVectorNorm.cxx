@@ -121,6 +121,8 @@ vtkVectorNorm::vtkVectorNorm()
 {
   this->Normalize = 0;
   this->AttributeMode = VTK_ATTRIBUTE_MODE_DEFAULT;
+  // Each norm is computed independently of the others.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -851,6 +851,9 @@ vtkVoronoi2D::vtkVoronoi2D()
 
   // Optional second and third outputs for Voroni flower
   this->SetNumberOfOutputPorts(3);
+  // Tiles are composited from thread local data, so skipped points
+  // simply produce no tile.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
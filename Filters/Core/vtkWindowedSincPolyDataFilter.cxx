@@ -1372,6 +1372,11 @@ vtkSmartPointer<vtkPoints> SmoothMesh(
   // for the rest of the iterations
   for (auto iterNum = 2; iterNum <= numIters; iterNum++)
   {
+    if (filter->CheckAbort())
+    {
+      break;
+    }
+
     // Threaded execute smoothing pass
     if (!SmoothingDispatch::Execute(
           newDA[0], sWorker, numPts, newDA, ptConn, iterNum, c.data(), ptSelect, filter))
@@ -1592,6 +1597,10 @@ vtkWindowedSincPolyDataFilter::vtkWindowedSincPolyDataFilter()
 
   this->GenerateErrorScalars = false;
   this->GenerateErrorVectors = false;
+
+  // The threaded loops stop as soon as the filter is aborted. Their results
+  // are then incomplete, so CheckAbort() is called before they are used.
+  this->CancellableExecution = true;
 }
 
 //------------------------------------------------------------------------------
@@ -1657,6 +1666,11 @@ int vtkWindowedSincPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(reques
     ptConn = BuildConnectivity<int>(input, this);
     AnalyzePointTopology<int>(ptConn, this);
   }
+  if (this->CheckAbort())
+  {
+    delete ptConn;
+    return 1;
+  }
 
   vtkDebugMacro(<< "Found\n\t" << ptConn->NumSimple << " simple vertices\n\t" << ptConn->NumEdges
                 << " edge vertices\n\t" << ptConn->NumFixed << " fixed vertices\n\t");
@@ -1666,6 +1680,11 @@ int vtkWindowedSincPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(reques
   double length = 1.0, center[3];
   vtkSmartPointer<vtkPoints> newPts =
     InitializePoints(this->NormalizeCoordinates, input, length, center, this);
+  if (this->CheckAbort())
+  {
+    delete ptConn;
+    return 1;
+  }
 
   // Now smooth the mesh. Basically what is happening is that the input point
   // positions are adjusted to remove high-frequency information / noise.
@@ -1679,6 +1698,11 @@ int vtkWindowedSincPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(reques
   {
     outPts = SmoothMesh<int>(static_cast<PointConnectivity<int>*>(ptConn), newPts, this);
   }
+  if (this->CheckAbort())
+  {
+    delete ptConn;
+    return 1;
+  }
 
   // If the points were normalized, reverse the normalization process.
   if (this->NormalizeCoordinates)
@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Build the tree based locators with one thread and with the default number
+// of threads, report the build times, and check that both locators answer
+// queries the same way. The resolution of the sphere can be given on the
+// command line to benchmark large inputs, e.g.:
+//   TestLocatorsParallelBuild 2000
+
+#include "vtkCellTreeLocator.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkKdTree.h"
+#include "vtkKdTreePointLocator.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkModifiedBSPTree.h"
+#include "vtkNew.h"
+#include "vtkOctreePointLocator.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkTimerLog.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+void RandomPoints(vtkDoubleArray* points, vtkIdType numPts, double radius, int seed)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(seed);
+  points->SetNumberOfComponents(3);
+  points->SetNumberOfTuples(numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    double x[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      x[i] = random->GetNextRangeValue(-radius, radius);
+    }
+    points->SetTypedTuple(ptId, x);
+  }
+}
+
+// Build the locator with one thread, then with the default number of threads.
+// vtkModifiedBSPTree draws the axes of its nodes from rand(), so both builds
+// start from the same state.
+template <typename LocatorT>
+void BuildLocators(vtkPolyData* input, LocatorT* serial, LocatorT* parallel)
+{
+  vtkNew<vtkTimerLog> timer;
+  serial->SetDataSet(input);
+  std::srand(1);
+  timer->StartTimer();
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { serial->BuildLocator(); });
+  timer->StopTimer();
+  const double serialTime = timer->GetElapsedTime();
+
+  parallel->SetDataSet(input);
+  std::srand(1);
+  timer->StartTimer();
+  parallel->BuildLocator();
+  timer->StopTimer();
+  std::cout << serial->GetClassName() << " (" << input->GetNumberOfCells()
+            << " cells): 1 thread " << serialTime << " s, "
+            << vtkSMPTools::GetEstimatedNumberOfThreads() << " threads " << timer->GetElapsedTime()
+            << " s" << std::endl;
+}
+
+bool TestCellLocator(
+  vtkPolyData* input, vtkAbstractCellLocator* serial, vtkAbstractCellLocator* parallel)
+{
+  ::BuildLocators(input, serial, parallel);
+
+  const vtkIdType numQueries = 1000;
+  vtkNew<vtkDoubleArray> p1;
+  ::RandomPoints(p1, numQueries, 2.0, 3275);
+  vtkNew<vtkDoubleArray> p2;
+  ::RandomPoints(p2, numQueries, 2.0, 9874);
+
+  vtkNew<vtkDoubleArray> t[2];
+  vtkNew<vtkIdTypeArray> cellIds[2];
+  serial->IntersectWithLines(p1, p2, 0.0, t[0], nullptr, cellIds[0]);
+  parallel->IntersectWithLines(p1, p2, 0.0, t[1], nullptr, cellIds[1]);
+  vtkIdType numHits = 0;
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    // The trees must be identical, so even a line going through an edge
+    // reports the same cell.
+    if (t[0]->GetValue(i) != t[1]->GetValue(i) ||
+      cellIds[0]->GetValue(i) != cellIds[1]->GetValue(i))
+    {
+      std::cerr << serial->GetClassName() << ": line " << i << " differs." << std::endl;
+      return false;
+    }
+    numHits += (cellIds[0]->GetValue(i) >= 0);
+  }
+  if (numHits == 0)
+  {
+    std::cerr << serial->GetClassName() << ": no intersection found." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestPointLocator(
+  vtkPolyData* input, vtkAbstractPointLocator* serial, vtkAbstractPointLocator* parallel)
+{
+  ::BuildLocators(input, serial, parallel);
+
+  const vtkIdType numQueries = 1000;
+  vtkNew<vtkDoubleArray> points;
+  ::RandomPoints(points, numQueries, 1.5, 6431);
+
+  vtkNew<vtkIdTypeArray> ids[2];
+  serial->FindClosestPoints(points, ids[0]);
+  parallel->FindClosestPoints(points, ids[1]);
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    if (ids[0]->GetValue(i) != ids[1]->GetValue(i))
+    {
+      std::cerr << serial->GetClassName() << ": query " << i << " differs." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestKdTree(vtkPolyData* input)
+{
+  vtkNew<vtkKdTree> serial;
+  vtkNew<vtkKdTree> parallel;
+  ::BuildLocators(input, serial.GetPointer(), parallel.GetPointer());
+
+  if (serial->GetNumberOfRegions() < 2 ||
+    serial->GetNumberOfRegions() != parallel->GetNumberOfRegions())
+  {
+    std::cerr << "vtkKdTree: " << serial->GetNumberOfRegions() << " and "
+              << parallel->GetNumberOfRegions() << " regions." << std::endl;
+    return false;
+  }
+  for (int regionId = 0; regionId < serial->GetNumberOfRegions(); ++regionId)
+  {
+    double bounds[2][6];
+    serial->GetRegionBounds(regionId, bounds[0]);
+    parallel->GetRegionBounds(regionId, bounds[1]);
+    for (int i = 0; i < 6; ++i)
+    {
+      if (bounds[0][i] != bounds[1][i])
+      {
+        std::cerr << "vtkKdTree: region " << regionId << " differs." << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestLocatorsParallelBuild(int argc, char* argv[])
+{
+  int resolution = 300;
+  if (argc > 1 && std::atoi(argv[1]) > 0)
+  {
+    resolution = std::atoi(argv[1]);
+  }
+
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(resolution);
+  sphere->SetPhiResolution(resolution);
+  sphere->Update();
+  vtkPolyData* input = sphere->GetOutput();
+
+  bool success = true;
+
+  vtkNew<vtkCellTreeLocator> cellTree[2];
+  success &= ::TestCellLocator(input, cellTree[0], cellTree[1]);
+  vtkNew<vtkModifiedBSPTree> bspTree[2];
+  success &= ::TestCellLocator(input, bspTree[0], bspTree[1]);
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 3 }, [&]() {
+    vtkNew<vtkModifiedBSPTree> threeThreadsBSPTree[2];
+    success &= ::TestCellLocator(input, threeThreadsBSPTree[0], threeThreadsBSPTree[1]);
+  });
+
+  vtkNew<vtkKdTreePointLocator> kdTreePointLocator[2];
+  success &= ::TestPointLocator(input, kdTreePointLocator[0], kdTreePointLocator[1]);
+  vtkNew<vtkOctreePointLocator> octreePointLocator[2];
+  success &= ::TestPointLocator(input, octreePointLocator[0], octreePointLocator[1]);
+
+  success &= ::TestKdTree(input);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -10,10 +10,12 @@
 #include "vtkIdListCollection.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <stack>
 #include <vector>
 
@@ -70,7 +72,7 @@ public:
 
 typedef cell_extents* cell_extents_List;
 
-static int global_list_count = 0;
+static std::atomic<int> global_list_count(0);
 
 //------------------------------------------------------------------------------
 class Sorted_cell_extents_Lists
@@ -145,6 +147,11 @@ void vtkModifiedBSPTree::BuildLocatorInternal()
 
   this->ComputeCellBounds();
 
+  // This is done to cause non-thread safe initialization to occur due to
+  // side effects from GetCellBounds().
+  double cellBounds[6];
+  this->DataSet->GetCellBounds(0, cellBounds);
+
   // sort the cells into 6 lists using structure for subdividing tests
   Sorted_cell_extents_Lists* lists = new Sorted_cell_extents_Lists(numCells);
   vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
@@ -175,9 +182,74 @@ void vtkModifiedBSPTree::BuildLocatorInternal()
   // call the recursive subdivision routine
   vtkDebugMacro(<< "Beginning Subdivision");
 
-  Subdivide(this->mRoot.get(), lists, this->DataSet, numCells, 0, this->MaxLevel,
-    this->NumberOfCellsPerNode, this->Level);
-  delete lists;
+  // Subdivide the top of the tree breadth first until there are enough
+  // subtrees to keep the threads busy, then subdivide the subtrees in
+  // parallel. The start axes of the nodes of a subtree are drawn from its own
+  // random sequence, seeded before the parallel section. The number of
+  // subtrees does not depend on the number of threads, so that the tree only
+  // depends on the state of rand().
+  const size_t minNumberOfSubtrees = 256;
+  std::vector<BSPSubtree> subtrees(1, BSPSubtree{ this->mRoot.get(), lists, numCells, 0 });
+  std::vector<BSPSubtree> children;
+  while (!subtrees.empty() && subtrees.size() < minNumberOfSubtrees)
+  {
+    children.clear();
+    for (const BSPSubtree& subtree : subtrees)
+    {
+      this->Subdivide(subtree.Node, subtree.Lists, this->DataSet, subtree.NumberOfCells,
+        subtree.Depth, this->MaxLevel, this->NumberOfCellsPerNode, this->Level, nullptr, &children);
+      delete subtree.Lists;
+    }
+    subtrees.swap(children);
+  }
+
+  std::vector<unsigned int> seeds(subtrees.size());
+  for (auto& seed : seeds)
+  {
+    seed = static_cast<unsigned int>(rand());
+  }
+  vtkSMPThreadLocal<int> tlMaxDepth(this->Level);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(subtrees.size()), 1,
+    [&](vtkIdType subtreeId, vtkIdType endSubtreeId) {
+      int& maxDepth = tlMaxDepth.Local();
+      for (; subtreeId < endSubtreeId; ++subtreeId)
+      {
+        const BSPSubtree& subtree = subtrees[subtreeId];
+        std::minstd_rand random(seeds[subtreeId]);
+        this->Subdivide(subtree.Node, subtree.Lists, this->DataSet, subtree.NumberOfCells,
+          subtree.Depth, this->MaxLevel, this->NumberOfCellsPerNode, maxDepth, &random);
+        delete subtree.Lists;
+      }
+    });
+  for (int maxDepth : tlMaxDepth)
+  {
+    this->Level = std::max(this->Level, maxDepth);
+  }
+
+  // Gather the statistics of the tree
+  std::stack<BSPNode*, std::vector<BSPNode*>> nodes;
+  nodes.push(this->mRoot.get());
+  while (!nodes.empty())
+  {
+    BSPNode* node = nodes.top();
+    nodes.pop();
+    if (node->mChild[0])
+    {
+      this->npn += 1; // Parent node
+      for (int i = 0; i < 3; i++)
+      {
+        if (node->mChild[i])
+        {
+          nodes.push(node->mChild[i]);
+        }
+      }
+    }
+    else
+    {
+      this->nln += 1; // Leaf node
+      this->tot_depth += node->depth;
+    }
+  }
 
   // Child nodes are responsible for freeing the temporary sorted lists
   this->BuildTime.Modified();
@@ -190,7 +262,8 @@ void vtkModifiedBSPTree::BuildLocatorInternal()
 // The main BSP subdivision routine : The code which does the division is only
 // a small part of this, the rest is just bookkeeping - it looks worse than it is.
 void vtkModifiedBSPTree::Subdivide(BSPNode* node, Sorted_cell_extents_Lists* lists,
-  vtkDataSet* dataset, vtkIdType nCells, int depth, int maxlevel, vtkIdType maxCells, int& MaxDepth)
+  vtkDataSet* dataset, vtkIdType nCells, int depth, int maxlevel, vtkIdType maxCells, int& MaxDepth,
+  std::minstd_rand* random, std::vector<BSPSubtree>* subtrees)
 {
   // We've got lists sorted on the axes, so we can easily get BBox
   // NOTE: this->mRoot->Bounds is set here
@@ -253,7 +326,7 @@ void vtkModifiedBSPTree::Subdivide(BSPNode* node, Sorted_cell_extents_Lists* lis
       {
         node->mChild[i] = new BSPNode();
         node->mChild[i]->depth = node->depth + 1;
-        node->mChild[i]->mAxis = rand() % 3;
+        node->mChild[i]->mAxis = random ? static_cast<int>((*random)() % 3) : rand() % 3;
       }
       Daxis = node->mAxis;
       Sorted_cell_extents_Lists* left = new Sorted_cell_extents_Lists(nCells);
@@ -393,41 +466,49 @@ void vtkModifiedBSPTree::Subdivide(BSPNode* node, Sorted_cell_extents_Lists* lis
         //
         // And of course, we really ought to subdivide again - Hoorah!
         // NB: it is possible for a node to be empty now, so check and delete if necessary
+        // The children are left to the caller when it collects the subtrees.
+        auto subdivideChild =
+          [&](BSPNode* child, Sorted_cell_extents_Lists* childLists, vtkIdType n) {
+            if (subtrees)
+            {
+              subtrees->push_back(BSPSubtree{ child, childLists, n, depth + 1 });
+              return;
+            }
+            this->Subdivide(
+              child, childLists, dataset, n, depth + 1, maxlevel, maxCells, MaxDepth, random);
+            delete childLists;
+          };
+
         if (Cmin_l[0])
         {
-          Subdivide(
-            node->mChild[0], left, dataset, Cmin_l[0], depth + 1, maxlevel, maxCells, MaxDepth);
+          subdivideChild(node->mChild[0], left, Cmin_l[0]);
         }
         else
         {
           vtkWarningMacro(<< "Child 0 Empty ! - this shouldn't happen");
+          delete left;
         }
-        delete left;
 
         if (Cmin_m[0])
         {
-          Subdivide(
-            node->mChild[1], mid, dataset, Cmin_m[0], depth + 1, maxlevel, maxCells, MaxDepth);
+          subdivideChild(node->mChild[1], mid, Cmin_m[0]);
         }
         else
         {
           delete node->mChild[1];
           node->mChild[1] = nullptr;
+          delete mid;
         }
-        delete mid;
 
         if (Cmin_r[0])
         {
-          Subdivide(
-            node->mChild[2], right, dataset, Cmin_r[0], depth + 1, maxlevel, maxCells, MaxDepth);
+          subdivideChild(node->mChild[2], right, Cmin_r[0]);
         }
         else
         {
           vtkWarningMacro(<< "Child 2 Empty ! - this shouldn't happen");
+          delete right;
         }
-        delete right;
-        //
-        npn += 1; // Parent node
         //
         // we've done all we were asked to do
         //
@@ -440,8 +521,6 @@ void vtkModifiedBSPTree::Subdivide(BSPNode* node, Sorted_cell_extents_Lists* lis
   //
   // Copy the cell IDs into the actual node structure for proper use
   node->num_cells = nCells;
-  nln += 1; // Leaf node
-  tot_depth += node->depth;
   for (int i = 0; i < 6; i++)
   {
     node->sorted_cell_lists[i] = new vtkIdType[nCells];
@@ -77,6 +77,14 @@
  * - Tolerance
  * - RetainCellLists
  *
+ * The top of the tree is subdivided breadth first, then the subtrees below are
+ * subdivided in parallel.
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
  * NB. The following reference has been sent to me
  * \code
  *   @Article{formella-1995-ray,
@@ -133,6 +141,9 @@
 #include "vtkFiltersFlowPathsModule.h" // For export macro
 #include "vtkSmartPointer.h"           // required because it is nice
 
+#include <random> // For std::minstd_rand
+#include <vector> // For std::vector
+
 VTK_ABI_NAMESPACE_BEGIN
 class Sorted_cell_extents_Lists;
 class BSPNode;
@@ -244,9 +255,22 @@ protected:
   int nln;
   int tot_depth;
 
-  // The main subdivision routine
+  // A node left to subdivide, with its sorted cell lists
+  struct BSPSubtree
+  {
+    BSPNode* Node;
+    Sorted_cell_extents_Lists* Lists;
+    vtkIdType NumberOfCells;
+    int Depth;
+  };
+
+  // The main subdivision routine. The start axes of the child nodes are drawn
+  // from random, or from rand() if random is null. If subtrees is not null,
+  // the children of node are appended to it instead of being subdivided, and
+  // the caller is responsible for deleting their lists.
   void Subdivide(BSPNode* node, Sorted_cell_extents_Lists* lists, vtkDataSet* dataSet,
-    vtkIdType nCells, int depth, int maxlevel, vtkIdType maxCells, int& MaxDepth);
+    vtkIdType nCells, int depth, int maxlevel, vtkIdType maxCells, int& MaxDepth,
+    std::minstd_rand* random = nullptr, std::vector<BSPSubtree>* subtrees = nullptr);
 
 private:
   vtkModifiedBSPTree(const vtkModifiedBSPTree&) = delete;
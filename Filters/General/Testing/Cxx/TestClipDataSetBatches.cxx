@@ -0,0 +1,308 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the threaded clipping of vtkClipDataSet and vtkBoxClipDataSet
+// does not depend on how the input cells are split into batches, and that it
+// matches clipping the cells one by one into a single locator.
+
+#include "vtkBoxClipDataSet.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkClipDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkFloatArray.h"
+#include "vtkGenericCell.h"
+#include "vtkImageDataToPointSet.h"
+#include "vtkMergePoints.h"
+#include "vtkNew.h"
+#include "vtkPlane.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+bool AreIdentical(vtkUnstructuredGrid* ref, vtkUnstructuredGrid* grid, const char* label)
+{
+  if (ref->GetNumberOfPoints() != grid->GetNumberOfPoints() ||
+    ref->GetNumberOfCells() != grid->GetNumberOfCells())
+  {
+    std::cerr << label << ": expected " << ref->GetNumberOfPoints() << " points and "
+              << ref->GetNumberOfCells() << " cells, got " << grid->GetNumberOfPoints()
+              << " points and " << grid->GetNumberOfCells() << " cells." << std::endl;
+    return false;
+  }
+  double x[3], y[3];
+  for (vtkIdType ptId = 0; ptId < ref->GetNumberOfPoints(); ++ptId)
+  {
+    ref->GetPoint(ptId, x);
+    grid->GetPoint(ptId, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      std::cerr << label << ": point " << ptId << " differs." << std::endl;
+      return false;
+    }
+  }
+  vtkDataArray* refScalars = ref->GetPointData()->GetScalars();
+  vtkDataArray* scalars = grid->GetPointData()->GetScalars();
+  if (!refScalars || !scalars)
+  {
+    std::cerr << label << ": missing point scalars." << std::endl;
+    return false;
+  }
+  for (vtkIdType ptId = 0; ptId < ref->GetNumberOfPoints(); ++ptId)
+  {
+    if (refScalars->GetComponent(ptId, 0) != scalars->GetComponent(ptId, 0))
+    {
+      std::cerr << label << ": scalar of point " << ptId << " differs." << std::endl;
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> refIds, ids;
+  for (vtkIdType cellId = 0; cellId < ref->GetNumberOfCells(); ++cellId)
+  {
+    ref->GetCellPoints(cellId, refIds);
+    grid->GetCellPoints(cellId, ids);
+    if (ref->GetCellType(cellId) != grid->GetCellType(cellId) ||
+      refIds->GetNumberOfIds() != ids->GetNumberOfIds())
+    {
+      std::cerr << label << ": cell " << cellId << " differs." << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < ids->GetNumberOfIds(); ++i)
+    {
+      if (refIds->GetId(i) != ids->GetId(i))
+      {
+        std::cerr << label << ": connectivity of cell " << cellId << " differs." << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Clip the cells one by one into a single locator, as vtkClipDataSet did
+// before it was threaded. The second output keeps what is clipped away.
+void ClipDataSetSerially(vtkPointSet* input, vtkImplicitFunction* function, int insideOut,
+  vtkUnstructuredGrid* output, vtkUnstructuredGrid* clippedOutput)
+{
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  vtkNew<vtkFloatArray> clipScalars;
+  clipScalars->SetName("ClipDataSetScalars");
+  clipScalars->SetNumberOfTuples(numPts);
+  double x[3];
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    input->GetPoint(ptId, x);
+    clipScalars->SetValue(ptId, function->FunctionValue(x));
+  }
+  vtkNew<vtkPointData> inPD;
+  inPD->ShallowCopy(input->GetPointData());
+  inPD->SetScalars(clipScalars);
+
+  vtkNew<vtkPoints> points;
+  points->SetDataType(input->GetPoints()->GetDataType());
+  vtkNew<vtkMergePoints> locator;
+  locator->InitPointInsertion(points, input->GetBounds());
+  vtkPointData* outPD = output->GetPointData();
+  outPD->InterpolateAllocate(inPD);
+  vtkNew<vtkCellData> outCD;
+
+  vtkNew<vtkCellArray> conn[2];
+  vtkNew<vtkUnsignedCharArray> types[2];
+  vtkNew<vtkGenericCell> cell;
+  vtkNew<vtkFloatArray> cellScalars;
+  for (vtkIdType cellId = 0; cellId < input->GetNumberOfCells(); ++cellId)
+  {
+    input->GetCell(cellId, cell);
+    vtkIdList* cellIds = cell->GetPointIds();
+    cellScalars->SetNumberOfTuples(cellIds->GetNumberOfIds());
+    for (vtkIdType i = 0; i < cellIds->GetNumberOfIds(); ++i)
+    {
+      cellScalars->SetValue(i, clipScalars->GetValue(cellIds->GetId(i)));
+    }
+    for (int i = 0; i < 2; ++i)
+    {
+      const vtkIdType numCells = conn[i]->GetNumberOfCells();
+      cell->Clip(0.0, cellScalars, locator, conn[i], inPD, outPD, input->GetCellData(), cellId,
+        outCD, i == 0 ? insideOut : !insideOut);
+      for (vtkIdType newCellId = numCells; newCellId < conn[i]->GetNumberOfCells(); ++newCellId)
+      {
+        types[i]->InsertNextValue(conn[i]->GetCellSize(newCellId) == 4 ? VTK_TETRA : VTK_WEDGE);
+      }
+    }
+  }
+
+  output->SetPoints(points);
+  output->SetCells(types[0], conn[0]);
+  clippedOutput->SetPoints(points);
+  clippedOutput->SetCells(types[1], conn[1]);
+  clippedOutput->GetPointData()->ShallowCopy(outPD);
+}
+
+// Clip the cells one by one into a single locator, as vtkBoxClipDataSet did
+// before it was threaded, using the clipping methods of the given filter.
+void BoxClipSerially(vtkBoxClipDataSet* filter, vtkDataSet* input, vtkUnstructuredGrid* output,
+  vtkUnstructuredGrid* clippedOutput)
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkMergePoints> locator;
+  locator->InitPointInsertion(points, input->GetBounds());
+  vtkPointData* inPD = input->GetPointData();
+  vtkCellData* inCD = input->GetCellData();
+  vtkNew<vtkPointData> pointData;
+  pointData->InterpolateAllocate(inPD);
+  vtkPointData* outPD[2] = { pointData, pointData };
+  vtkNew<vtkCellData> cellData;
+  vtkCellData* outCD[2] = { cellData, cellData };
+
+  vtkNew<vtkCellArray> conn[2];
+  vtkCellArray* outConn[2] = { conn[0], conn[1] };
+  vtkNew<vtkUnsignedCharArray> types[2];
+  vtkNew<vtkGenericCell> cell;
+  for (vtkIdType cellId = 0; cellId < input->GetNumberOfCells(); ++cellId)
+  {
+    input->GetCell(cellId, cell);
+    const vtkIdType numCells[2] = { conn[0]->GetNumberOfCells(), conn[1]->GetNumberOfCells() };
+    if (filter->GetOrientation())
+    {
+      filter->ClipHexahedronInOut(points, cell, locator, outConn, inPD, outPD, inCD, cellId, outCD);
+    }
+    else
+    {
+      filter->ClipBoxInOut(points, cell, locator, outConn, inPD, outPD, inCD, cellId, outCD);
+    }
+    for (int i = 0; i < 2; ++i)
+    {
+      for (vtkIdType newCellId = numCells[i]; newCellId < conn[i]->GetNumberOfCells(); ++newCellId)
+      {
+        types[i]->InsertNextValue(VTK_TETRA);
+      }
+    }
+  }
+
+  output->SetPoints(points);
+  output->SetCells(types[0], conn[0]);
+  output->GetPointData()->ShallowCopy(pointData);
+  clippedOutput->SetPoints(points);
+  clippedOutput->SetCells(types[1], conn[1]);
+  clippedOutput->GetPointData()->ShallowCopy(pointData);
+}
+}
+
+int TestClipDataSetBatches(int, char*[])
+{
+  vtkNew<vtkRTAnalyticSource> wavelet;
+  wavelet->SetWholeExtent(-8, 8, -8, 8, -8, 8);
+
+  // Go through a structured grid so that the cells are actually clipped one
+  // by one and not handed over to vtkClipVolume.
+  vtkNew<vtkImageDataToPointSet> toPointSet;
+  toPointSet->SetInputConnection(wavelet->GetOutputPort());
+
+  vtkNew<vtkPlane> plane;
+  plane->SetOrigin(0.3, 0.2, 0.1);
+  plane->SetNormal(1.0, 1.0, 0.5);
+
+  const unsigned int batchSizes[] = { 1, 7, 1000, 100000 };
+  int status = EXIT_SUCCESS;
+
+  for (int insideOut = 0; insideOut < 2; ++insideOut)
+  {
+    vtkNew<vtkClipDataSet> refClip;
+    refClip->SetInputConnection(toPointSet->GetOutputPort());
+    refClip->SetClipFunction(plane);
+    refClip->SetInsideOut(insideOut);
+    refClip->GenerateClipScalarsOn();
+    refClip->GenerateClippedOutputOn();
+    refClip->SetBatchSize(batchSizes[0]);
+    refClip->Update();
+
+    if (refClip->GetOutput()->GetNumberOfCells() == 0 ||
+      refClip->GetClippedOutput()->GetNumberOfCells() == 0)
+    {
+      std::cerr << "vtkClipDataSet generated an empty output." << std::endl;
+      status = EXIT_FAILURE;
+    }
+
+    vtkNew<vtkUnstructuredGrid> serial, serialClipped;
+    ::ClipDataSetSerially(toPointSet->GetOutput(), plane, insideOut, serial, serialClipped);
+    if (!::AreIdentical(serial, refClip->GetOutput(), "vtkClipDataSet serial") ||
+      !::AreIdentical(serialClipped, refClip->GetClippedOutput(), "vtkClipDataSet serial clipped"))
+    {
+      status = EXIT_FAILURE;
+    }
+
+    for (unsigned int batchSize : batchSizes)
+    {
+      vtkNew<vtkClipDataSet> clip;
+      clip->SetInputConnection(toPointSet->GetOutputPort());
+      clip->SetClipFunction(plane);
+      clip->SetInsideOut(insideOut);
+      clip->GenerateClipScalarsOn();
+      clip->GenerateClippedOutputOn();
+      clip->SetBatchSize(batchSize);
+      clip->Update();
+
+      if (!::AreIdentical(refClip->GetOutput(), clip->GetOutput(), "vtkClipDataSet") ||
+        !::AreIdentical(
+          refClip->GetClippedOutput(), clip->GetClippedOutput(), "vtkClipDataSet clipped"))
+      {
+        status = EXIT_FAILURE;
+      }
+    }
+  }
+
+  for (int orientation = 0; orientation < 2; ++orientation)
+  {
+    vtkNew<vtkBoxClipDataSet> refClip;
+    refClip->SetInputConnection(toPointSet->GetOutputPort());
+    refClip->SetBoxClip(-3.3, 4.1, -2.7, 5.2, -6.0, 1.5);
+    refClip->SetOrientation(orientation);
+    refClip->GenerateClippedOutputOn();
+    refClip->SetBatchSize(batchSizes[0]);
+    refClip->Update();
+
+    if (refClip->GetOutput()->GetNumberOfCells() == 0 ||
+      refClip->GetClippedOutput()->GetNumberOfCells() == 0)
+    {
+      std::cerr << "vtkBoxClipDataSet generated an empty output." << std::endl;
+      status = EXIT_FAILURE;
+    }
+
+    vtkNew<vtkUnstructuredGrid> serial, serialClipped;
+    ::BoxClipSerially(refClip, toPointSet->GetOutput(), serial, serialClipped);
+    if (!::AreIdentical(serial, refClip->GetOutput(), "vtkBoxClipDataSet serial") ||
+      !::AreIdentical(
+        serialClipped, refClip->GetClippedOutput(), "vtkBoxClipDataSet serial clipped"))
+    {
+      status = EXIT_FAILURE;
+    }
+
+    for (unsigned int batchSize : batchSizes)
+    {
+      vtkNew<vtkBoxClipDataSet> clip;
+      clip->SetInputConnection(toPointSet->GetOutputPort());
+      clip->SetBoxClip(-3.3, 4.1, -2.7, 5.2, -6.0, 1.5);
+      clip->SetOrientation(orientation);
+      clip->GenerateClippedOutputOn();
+      clip->SetBatchSize(batchSize);
+      clip->Update();
+
+      if (!::AreIdentical(refClip->GetOutput(), clip->GetOutput(), "vtkBoxClipDataSet") ||
+        !::AreIdentical(
+          refClip->GetClippedOutput(), clip->GetClippedOutput(), "vtkBoxClipDataSet clipped"))
+      {
+        status = EXIT_FAILURE;
+      }
+    }
+  }
+
+  return status;
+}
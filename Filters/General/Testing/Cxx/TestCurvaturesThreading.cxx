@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the curvatures computed by vtkCurvatures on a sphere, and that they
+// do not depend on the number of threads.
+
+#include "vtkCurvatures.h"
+#include "vtkDataArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkDataArray> ComputeCurvature(vtkPolyData* input, int type, int maxThreads)
+{
+  vtkNew<vtkCurvatures> curvatures;
+  curvatures->SetInputData(input);
+  curvatures->SetCurvatureType(type);
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ maxThreads }, [&]() { curvatures->Update(); });
+  return curvatures->GetOutput()->GetPointData()->GetScalars();
+}
+}
+
+int TestCurvaturesThreading(int, char*[])
+{
+  const double radius = 2.0;
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetRadius(radius);
+  sphere->SetThetaResolution(128);
+  sphere->SetPhiResolution(128);
+  sphere->Update();
+  vtkPolyData* input = sphere->GetOutput();
+
+  // Expected magnitudes on a sphere.
+  struct
+  {
+    int Type;
+    const char* Name;
+    double Expected;
+  } cases[] = {
+    { VTK_CURVATURE_GAUSS, "Gauss", 1.0 / (radius * radius) },
+    { VTK_CURVATURE_MEAN, "Mean", 1.0 / radius },
+    { VTK_CURVATURE_MAXIMUM, "Maximum", 1.0 / radius },
+    { VTK_CURVATURE_MINIMUM, "Minimum", 1.0 / radius },
+  };
+
+  int status = EXIT_SUCCESS;
+  for (const auto& test : cases)
+  {
+    vtkSmartPointer<vtkDataArray> ref = ::ComputeCurvature(input, test.Type, 1);
+    vtkSmartPointer<vtkDataArray> curvature = ::ComputeCurvature(input, test.Type, 0);
+    if (!ref || !curvature || ref->GetNumberOfTuples() != input->GetNumberOfPoints() ||
+      curvature->GetNumberOfTuples() != input->GetNumberOfPoints())
+    {
+      std::cerr << test.Name << ": missing curvature array." << std::endl;
+      status = EXIT_FAILURE;
+      continue;
+    }
+
+    // Skip the poles, where the triangles are degenerate.
+    double sum = 0.0;
+    for (vtkIdType ptId = 0; ptId < ref->GetNumberOfTuples(); ++ptId)
+    {
+      if (ref->GetComponent(ptId, 0) != curvature->GetComponent(ptId, 0))
+      {
+        std::cerr << test.Name << ": curvature at point " << ptId
+                  << " depends on the number of threads." << std::endl;
+        status = EXIT_FAILURE;
+        break;
+      }
+      if (ptId >= 2)
+      {
+        sum += std::abs(ref->GetComponent(ptId, 0));
+      }
+    }
+    const double mean = sum / (ref->GetNumberOfTuples() - 2);
+    if (std::abs(mean - test.Expected) > 0.1 * test.Expected)
+    {
+      std::cerr << test.Name << ": expected an average curvature of " << test.Expected << ", got "
+                << mean << std::endl;
+      status = EXIT_FAILURE;
+    }
+  }
+
+  return status;
+}
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the intersection lines and the split surfaces computed by
+// vtkIntersectionPolyDataFilter do not depend on the number of threads.
+
+#include "vtkCellArray.h"
+#include "vtkIdList.h"
+#include "vtkIntersectionPolyDataFilter.h"
+#include "vtkNew.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+bool AreIdentical(vtkPolyData* ref, vtkPolyData* pd, const char* label)
+{
+  if (ref->GetNumberOfPoints() != pd->GetNumberOfPoints() ||
+    ref->GetNumberOfCells() != pd->GetNumberOfCells())
+  {
+    std::cerr << label << ": expected " << ref->GetNumberOfPoints() << " points and "
+              << ref->GetNumberOfCells() << " cells, got " << pd->GetNumberOfPoints()
+              << " points and " << pd->GetNumberOfCells() << " cells." << std::endl;
+    return false;
+  }
+  double x[3], y[3];
+  for (vtkIdType ptId = 0; ptId < ref->GetNumberOfPoints(); ++ptId)
+  {
+    ref->GetPoint(ptId, x);
+    pd->GetPoint(ptId, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      std::cerr << label << ": point " << ptId << " differs." << std::endl;
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> refIds, ids;
+  for (vtkIdType cellId = 0; cellId < ref->GetNumberOfCells(); ++cellId)
+  {
+    ref->GetCellPoints(cellId, refIds);
+    pd->GetCellPoints(cellId, ids);
+    if (refIds->GetNumberOfIds() != ids->GetNumberOfIds())
+    {
+      std::cerr << label << ": cell " << cellId << " differs." << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < ids->GetNumberOfIds(); ++i)
+    {
+      if (refIds->GetId(i) != ids->GetId(i))
+      {
+        std::cerr << label << ": connectivity of cell " << cellId << " differs." << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestIntersectionPolyDataFilterThreading(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere0;
+  sphere0->SetCenter(0.0, 0.0, 0.0);
+  sphere0->SetPhiResolution(40);
+  sphere0->SetThetaResolution(40);
+
+  vtkNew<vtkSphereSource> sphere1;
+  sphere1->SetCenter(0.3, 0.05, 0.02);
+  sphere1->SetPhiResolution(45);
+  sphere1->SetThetaResolution(45);
+
+  vtkNew<vtkIntersectionPolyDataFilter> ref;
+  ref->SetInputConnection(0, sphere0->GetOutputPort());
+  ref->SetInputConnection(1, sphere1->GetOutputPort());
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { ref->Update(); });
+
+  if (ref->GetNumberOfIntersectionLines() == 0)
+  {
+    std::cerr << "No intersection found." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkIntersectionPolyDataFilter> intersection;
+  intersection->SetInputConnection(0, sphere0->GetOutputPort());
+  intersection->SetInputConnection(1, sphere1->GetOutputPort());
+  intersection->Update();
+
+  int status = EXIT_SUCCESS;
+  const char* labels[] = { "Intersection lines", "First surface", "Second surface" };
+  for (int port = 0; port < 3; ++port)
+  {
+    if (!::AreIdentical(ref->GetOutput(port), intersection->GetOutput(port), labels[port]))
+    {
+      status = EXIT_FAILURE;
+    }
+  }
+  return status;
+}
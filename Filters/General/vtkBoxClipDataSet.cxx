@@ -3,8 +3,10 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkBoxClipDataSet.h"
 
+#include "vtkBoundingBox.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkCellTypes.h"
 #include "vtkExecutive.h"
 #include "vtkFloatArray.h"
 #include "vtkGenericCell.h"
@@ -17,13 +19,476 @@
 #include "vtkMergePoints.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <memory>
+#include <utility>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+// The input cells are clipped in batches of contiguous cell ids. Each batch
+// owns its points, point data and point locator so that batches can be
+// clipped concurrently. Batches are then merged in order through the
+// filter's locator, which produces the same point ordering as clipping the
+// cells one after the other, whatever the number of threads.
+struct BoxClipBatch
+{
+  vtkIdType BeginCellId = 0;
+  vtkIdType EndCellId = 0;
+  vtkSmartPointer<vtkPoints> Points;
+  // Both outputs share their points, hence a single point data is enough.
+  vtkSmartPointer<vtkPointData> PD;
+  vtkSmartPointer<vtkCellArray> Conn[2];
+  std::vector<unsigned char> Types[2];
+  std::vector<vtkIdType> InputCellIds[2]; // input cell of each generated cell
+  vtkIdType NumberOfInsertedPoints = 0;   // leading points inserted by earlier batches
+};
+
+//------------------------------------------------------------------------------
+unsigned char GetBoxClippedCellType(int cellDimension, vtkIdType npts)
+{
+  switch (cellDimension)
+  {
+    case 0: // points are generated-------------------------------
+      return (npts > 1 ? VTK_POLY_VERTEX : VTK_VERTEX);
+
+    case 1: // lines are generated----------------------------------
+      return (npts > 2 ? VTK_POLY_LINE : VTK_LINE);
+
+    case 2: // polygons are generated------------------------------
+      return (npts == 3 ? VTK_TRIANGLE : (npts == 4 ? VTK_QUAD : VTK_POLYGON));
+
+    case 3: // tetrahedra are generated------------------------------
+      return VTK_TETRA;
+  }
+  return VTK_EMPTY_CELL;
+}
+
+//------------------------------------------------------------------------------
+// The tetrahedra a cell is split into depend on the order of the ids of its
+// points. A batch produces the cells obtained by clipping the cells one after
+// the other only if its points keep their order once merged: the points
+// already in the output first, in the same order, then the new points.
+// Otherwise, the sorted ids of the output points used by the batch are given.
+bool KeepsPointOrder(vtkIncrementalPointLocator* locator, vtkPoints* outPoints,
+  const BoxClipBatch& batch, std::vector<vtkIdType>& insertedPointIds)
+{
+  insertedPointIds.clear();
+  vtkIdType nextId = outPoints->GetNumberOfPoints();
+  vtkIdType lastId = -1;
+  bool inOrder = true;
+  double x[3];
+  for (vtkIdType ptId = 0; ptId < batch.Points->GetNumberOfPoints(); ++ptId)
+  {
+    batch.Points->GetPoint(ptId, x);
+    vtkIdType id = locator->IsInsertedPoint(x);
+    if (id < 0)
+    {
+      // The points inserted first must already be in the output.
+      inOrder = inOrder && ptId >= batch.NumberOfInsertedPoints;
+      id = nextId++;
+    }
+    else
+    {
+      insertedPointIds.push_back(id);
+    }
+    inOrder = inOrder && id > lastId;
+    lastId = id;
+  }
+  if (!inOrder)
+  {
+    std::sort(insertedPointIds.begin(), insertedPointIds.end());
+  }
+  return inOrder;
+}
+
+//------------------------------------------------------------------------------
+// Record for each input point the 3D cell which inserts it first, and its
+// position in the tetrahedra this cell is split into, as
+// cellId * VTK_CELL_SIZE + position. Sorting these keys gives the order in
+// which the points are inserted when every tetrahedron inserts its points, as
+// when the clipped output is generated. Otherwise, the tetrahedra outside of
+// the box insert none and KeepsPointOrder() detects the wrong guesses.
+struct ComputeBoxInsertionKeys
+{
+  vtkBoxClipDataSet* Filter;
+  vtkDataSet* Input;
+  std::vector<std::atomic<vtkIdType>>& Keys;
+
+  vtkSMPThreadLocalObject<vtkIdList> TLPointIds;
+  vtkSMPThreadLocalObject<vtkCellArray> TLTetras;
+
+  ComputeBoxInsertionKeys(
+    vtkBoxClipDataSet* filter, vtkDataSet* input, std::vector<std::atomic<vtkIdType>>& keys)
+    : Filter(filter)
+    , Input(input)
+    , Keys(keys)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType beginCellId, vtkIdType endCellId)
+  {
+    vtkIdList* pointIds = this->TLPointIds.Local();
+    vtkCellArray* tetras = this->TLTetras.Local();
+    for (vtkIdType cellId = beginCellId; cellId < endCellId; ++cellId)
+    {
+      const int cellType = this->Input->GetCellType(cellId);
+      if (vtkCellTypes::GetDimension(static_cast<unsigned char>(cellType)) != 3)
+      {
+        continue;
+      }
+      this->Input->GetCellPoints(cellId, pointIds);
+      tetras->Reset();
+      this->Filter->CellGrid(
+        cellType, pointIds->GetNumberOfIds(), pointIds->GetPointer(0), tetras);
+
+      vtkIdType position = 0;
+      vtkIdType npts;
+      const vtkIdType* pts;
+      for (tetras->InitTraversal(); tetras->GetNextCell(npts, pts);)
+      {
+        for (vtkIdType i = 0; i < npts; ++i, ++position)
+        {
+          std::atomic<vtkIdType>& key = this->Keys[pointIds->GetId(pts[i])];
+          const vtkIdType cellKey = cellId * VTK_CELL_SIZE + position;
+          vtkIdType current = key.load();
+          while (cellKey < current && !key.compare_exchange_weak(current, cellKey))
+          {
+          }
+        }
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+struct BoxClipBatches
+{
+  vtkBoxClipDataSet* Filter;
+  vtkDataSet* Input;
+  vtkPointData* InPD;
+  vtkCellData* InCD;
+  vtkIncrementalPointLocator* Locator; // prototype of the batch locators
+  bool CopyScalars;
+  bool GenerateClippedOutput;
+  std::vector<BoxClipBatch>& Batches;
+  const std::vector<std::atomic<vtkIdType>>& InsertionKeys;
+  std::atomic<vtkIdType> NumberOfStartedBatches;
+
+  vtkSMPThreadLocalObject<vtkGenericCell> TLCell;
+  vtkSMPThreadLocalObject<vtkIdList> TLPointIds;
+  // Cell data is copied from the input cells when the batches are merged, so
+  // the cell clipping methods write into empty (never allocated) instances.
+  vtkSMPThreadLocalObject<vtkCellData> TLCellData;
+
+  BoxClipBatches(vtkBoxClipDataSet* filter, vtkDataSet* input, vtkPointData* inPD,
+    vtkCellData* inCD, vtkIncrementalPointLocator* locator, bool copyScalars,
+    bool generateClippedOutput, std::vector<BoxClipBatch>& batches,
+    const std::vector<std::atomic<vtkIdType>>& insertionKeys)
+    : Filter(filter)
+    , Input(input)
+    , InPD(inPD)
+    , InCD(inCD)
+    , Locator(locator)
+    , CopyScalars(copyScalars)
+    , GenerateClippedOutput(generateClippedOutput)
+    , Batches(batches)
+    , InsertionKeys(insertionKeys)
+    , NumberOfStartedBatches(0)
+  {
+    // Make sure GetCell() is thread safe by building the cell structures on
+    // the main thread first.
+    vtkNew<vtkGenericCell> cell;
+    this->Input->GetCell(0, cell);
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType beginBatchId, vtkIdType endBatchId)
+  {
+    // Clipping accounts for 90% of the progress, merging for the rest.
+    const vtkIdType numBatches = static_cast<vtkIdType>(this->Batches.size());
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    for (vtkIdType batchId = beginBatchId; batchId < endBatchId; ++batchId)
+    {
+      const vtkIdType numStarted = this->NumberOfStartedBatches++;
+      if (isFirst)
+      {
+        this->Filter->UpdateProgress(0.9 * numStarted / numBatches);
+        this->Filter->CheckAbort();
+      }
+      if (this->Filter->GetAbortOutput())
+      {
+        break;
+      }
+      this->ClipBatch(this->Batches[batchId], nullptr, nullptr, nullptr);
+    }
+  }
+
+  // Clip the cells of a batch. The given points, already inserted in the
+  // output, are inserted first in the batch locator with their point data.
+  // Without them, the input points that earlier batches probably inserted are
+  // inserted first instead.
+  void ClipBatch(BoxClipBatch& batch, const std::vector<vtkIdType>* insertedPointIds,
+    vtkPoints* outPoints, vtkPointData* outPD)
+  {
+    vtkGenericCell* cell = this->TLCell.Local();
+    vtkIdList* pointIds = this->TLPointIds.Local();
+    vtkCellData* cellData[2] = { this->TLCellData.Local(), this->TLCellData.Local() };
+    const unsigned int orientation = this->Filter->GetOrientation();
+    const int numOutputs = this->GenerateClippedOutput ? 2 : 1;
+    const vtkIdType numBatchCells = batch.EndCellId - batch.BeginCellId;
+    double x[3];
+
+    // Size the batch locator on the region actually covered by the batch.
+    vtkBoundingBox bbox;
+    for (vtkIdType cellId = batch.BeginCellId; cellId < batch.EndCellId; ++cellId)
+    {
+      this->Input->GetCellPoints(cellId, pointIds);
+      for (vtkIdType i = 0; i < pointIds->GetNumberOfIds(); ++i)
+      {
+        this->Input->GetPoint(pointIds->GetId(i), x);
+        bbox.AddPoint(x);
+      }
+    }
+    if (!bbox.IsValid())
+    {
+      return;
+    }
+    double bounds[6];
+    bbox.GetBounds(bounds);
+
+    batch.Points = vtkSmartPointer<vtkPoints>::New();
+    batch.Points->Allocate(numBatchCells);
+    auto locator = vtk::TakeSmartPointer(this->Locator->NewInstance());
+    locator->SetTolerance(this->Locator->GetTolerance());
+    locator->InitPointInsertion(batch.Points, bounds, numBatchCells);
+    batch.PD = vtkSmartPointer<vtkPointData>::New();
+    if (!this->CopyScalars)
+    {
+      batch.PD->CopyScalarsOff();
+    }
+    batch.PD->InterpolateAllocate(this->InPD, numBatchCells, numBatchCells / 2);
+    vtkPointData* pointData[2] = { batch.PD, batch.PD };
+
+    if (insertedPointIds)
+    {
+      // The output point data has the same arrays as the batch point data.
+      for (vtkIdType outPtId : *insertedPointIds)
+      {
+        vtkIdType ptId;
+        outPoints->GetPoint(outPtId, x);
+        locator->InsertUniquePoint(x, ptId);
+        for (int i = 0; i < batch.PD->GetNumberOfArrays(); ++i)
+        {
+          batch.PD->GetAbstractArray(i)->InsertTuple(ptId, outPtId, outPD->GetAbstractArray(i));
+        }
+      }
+    }
+    else
+    {
+      // Guess which input points of the batch earlier batches inserted, and
+      // insert them first in the same order.
+      std::vector<std::pair<vtkIdType, vtkIdType>> inputPoints;
+      const vtkIdType firstBatchKey = batch.BeginCellId * VTK_CELL_SIZE;
+      for (vtkIdType cellId = batch.BeginCellId; cellId < batch.EndCellId; ++cellId)
+      {
+        this->Input->GetCellPoints(cellId, pointIds);
+        for (vtkIdType i = 0; i < pointIds->GetNumberOfIds(); ++i)
+        {
+          const vtkIdType inPtId = pointIds->GetId(i);
+          const vtkIdType key = this->InsertionKeys[inPtId].load(std::memory_order_relaxed);
+          if (key < firstBatchKey)
+          {
+            inputPoints.emplace_back(key, inPtId);
+          }
+        }
+      }
+      std::sort(inputPoints.begin(), inputPoints.end());
+      inputPoints.erase(std::unique(inputPoints.begin(), inputPoints.end()), inputPoints.end());
+      for (const auto& inputPoint : inputPoints)
+      {
+        vtkIdType ptId;
+        this->Input->GetPoint(inputPoint.second, x);
+        if (locator->InsertUniquePoint(x, ptId))
+        {
+          batch.PD->CopyData(this->InPD, inputPoint.second, ptId);
+        }
+      }
+    }
+    batch.NumberOfInsertedPoints = batch.Points->GetNumberOfPoints();
+
+    vtkCellArray* conn[2] = { nullptr, nullptr };
+    vtkIdType numCells[2] = { 0, 0 };
+    for (int i = 0; i < numOutputs; ++i)
+    {
+      batch.Conn[i] = vtkSmartPointer<vtkCellArray>::New();
+      batch.Conn[i]->AllocateEstimate(numBatchCells, 4);
+      batch.Types[i].clear();
+      batch.Types[i].reserve(numBatchCells);
+      batch.InputCellIds[i].clear();
+      batch.InputCellIds[i].reserve(numBatchCells);
+      conn[i] = batch.Conn[i];
+    }
+
+    for (vtkIdType cellId = batch.BeginCellId; cellId < batch.EndCellId; ++cellId)
+    {
+      this->Input->GetCell(cellId, cell);
+      const int cellDimension = cell->GetCellDimension();
+      this->ClipCell(orientation, cellDimension, batch.Points, cell, locator, conn, pointData,
+        cellId, cellData);
+
+      for (int i = 0; i < numOutputs; ++i)
+      {
+        const vtkIdType numNew = conn[i]->GetNumberOfCells() - numCells[i];
+        for (vtkIdType j = 0; j < numNew; ++j)
+        {
+          const vtkIdType newPts = conn[i]->GetCellSize(numCells[i] + j);
+          batch.Types[i].push_back(GetBoxClippedCellType(cellDimension, newPts));
+          batch.InputCellIds[i].push_back(cellId);
+        }
+        numCells[i] += numNew;
+      }
+    }
+  }
+
+  void ClipCell(unsigned int orientation, int cellDimension, vtkPoints* newPoints,
+    vtkGenericCell* cell, vtkIncrementalPointLocator* locator, vtkCellArray** conn,
+    vtkPointData** outPD, vtkIdType cellId, vtkCellData** outCD)
+  {
+    vtkBoxClipDataSet* self = this->Filter;
+    vtkPointData* inPD = this->InPD;
+    vtkCellData* inCD = this->InCD;
+    if (this->GenerateClippedOutput)
+    {
+      if (cellDimension == 3)
+      {
+        if (orientation)
+        {
+          self->ClipHexahedronInOut(
+            newPoints, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+        }
+        else
+        {
+          self->ClipBoxInOut(newPoints, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+        }
+      }
+      else if (cellDimension == 2)
+      {
+        if (orientation)
+        {
+          self->ClipHexahedronInOut2D(
+            newPoints, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+        }
+        else
+        {
+          self->ClipBoxInOut2D(newPoints, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+        }
+      }
+      else if (cellDimension == 1)
+      {
+        if (orientation)
+        {
+          self->ClipHexahedronInOut1D(
+            newPoints, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+        }
+        else
+        {
+          self->ClipBoxInOut1D(newPoints, cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+        }
+      }
+      else if (cellDimension == 0)
+      {
+        if (orientation)
+        {
+          self->ClipHexahedronInOut0D(cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+        }
+        else
+        {
+          self->ClipBoxInOut0D(cell, locator, conn, inPD, outPD, inCD, cellId, outCD);
+        }
+      }
+      else
+      {
+        vtkErrorWithObjectMacro(self, << "Do not support cells of dimension " << cellDimension);
+      }
+    }
+    else
+    {
+      if (cellDimension == 3)
+      {
+        if (orientation)
+        {
+          self->ClipHexahedron(
+            newPoints, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+        }
+        else
+        {
+          self->ClipBox(
+            newPoints, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+        }
+      }
+      else if (cellDimension == 2)
+      {
+        if (orientation)
+        {
+          self->ClipHexahedron2D(
+            newPoints, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+        }
+        else
+        {
+          self->ClipBox2D(
+            newPoints, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+        }
+      }
+      else if (cellDimension == 1)
+      {
+        if (orientation)
+        {
+          self->ClipHexahedron1D(
+            newPoints, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+        }
+        else
+        {
+          self->ClipBox1D(
+            newPoints, cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+        }
+      }
+      else if (cellDimension == 0)
+      {
+        if (orientation)
+        {
+          self->ClipHexahedron0D(cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+        }
+        else
+        {
+          self->ClipBox0D(cell, locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+        }
+      }
+      else
+      {
+        vtkErrorWithObjectMacro(self, << "Do not support cells of dimension " << cellDimension);
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+} // anonymous namespace
+
 vtkStandardNewMacro(vtkBoxClipDataSet);
 vtkCxxSetObjectMacro(vtkBoxClipDataSet, Locator, vtkIncrementalPointLocator);
 //------------------------------------------------------------------------------
@@ -34,6 +499,7 @@ vtkBoxClipDataSet::vtkBoxClipDataSet()
 
   this->GenerateClippedOutput = 0;
   // this->MergeTolerance = 0.01;
+  this->BatchSize = 10000;
 
   this->SetNumberOfOutputPorts(2);
 
@@ -175,12 +641,9 @@ int vtkBoxClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
   vtkCellData* inCD = input->GetCellData();
   vtkCellData* outCD[2];
   vtkPoints* newPoints;
-  vtkPoints* cellPts;
   vtkDebugMacro(<< "Clip by Box\n");
   vtkUnsignedCharArray* types[2];
 
-  int j;
-  int cellType = 0;
   int numOutputs = 1;
 
   // Initialize self; create output objects
@@ -201,7 +664,6 @@ int vtkBoxClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
   vtkCellArray* conn[2];
   conn[0] = vtkCellArray::New();
   conn[0]->AllocateEstimate(estimatedSize, 1);
-  conn[0]->InitTraversal();
   types[0] = vtkUnsignedCharArray::New();
   types[0]->Allocate(estimatedSize, estimatedSize / 2);
 
@@ -210,7 +672,6 @@ int vtkBoxClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     numOutputs = 2;
     conn[1] = vtkCellArray::New();
     conn[1]->AllocateEstimate(estimatedSize, 1);
-    conn[1]->InitTraversal();
     types[1] = vtkUnsignedCharArray::New();
     types[1]->Allocate(estimatedSize, estimatedSize / 2);
   }
@@ -225,243 +686,127 @@ int vtkBoxClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
   }
   this->Locator->InitPointInsertion(newPoints, input->GetBounds());
 
-  outPD[0] = output->GetPointData();
-  if (this->GenerateClippedOutput)
-  {
-    outPD[1] = output->GetPointData();
-  }
-
   vtkDataArray* scalars = this->GetInputArrayToProcess(0, inputVector);
-  if (!this->GenerateClipScalars && !scalars)
-  {
-    outPD[0]->CopyScalarsOff();
-    if (this->GenerateClippedOutput)
-    {
-      outPD[1]->CopyScalarsOff();
-    }
-  }
-  else
-  {
-    outPD[0]->CopyScalarsOn();
-    if (this->GenerateClippedOutput)
-    {
-      outPD[1]->CopyScalarsOn();
-    }
-  }
-  outPD[0]->InterpolateAllocate(inPD, estimatedSize, estimatedSize / 2);
+  const bool copyScalars = this->GenerateClipScalars || scalars;
+
   outCD[0] = output->GetCellData();
   outCD[0]->CopyAllocate(inCD, estimatedSize, estimatedSize / 2);
   if (this->GenerateClippedOutput)
   {
-    outPD[1] = clippedOutput->GetPointData();
-    outPD[1]->InterpolateAllocate(inPD, estimatedSize, estimatedSize / 2);
     outCD[1] = clippedOutput->GetCellData();
     outCD[1]->CopyAllocate(inCD, estimatedSize, estimatedSize / 2);
   }
 
-  // Process all cells and clip each in turn
-
-  vtkIdType updateTime = numCells / 20 + 1; // update roughly every 5%
-  vtkGenericCell* cell = vtkGenericCell::New();
-  vtkIdType cellId;
-
-  bool abort = false;
-  int num[2];
-  int numNew[2];
-
-  num[0] = num[1] = 0;
-  numNew[0] = numNew[1] = 0;
+  // Process all cells and clip each batch in turn
 
-  unsigned int orientation = this->GetOrientation(); // Test if there is a transformation
+  const vtkIdType batchSize = static_cast<vtkIdType>(this->BatchSize);
+  std::vector<BoxClipBatch> batches((numCells + batchSize - 1) / batchSize);
+  for (std::size_t batchId = 0; batchId < batches.size(); ++batchId)
+  {
+    batches[batchId].BeginCellId = static_cast<vtkIdType>(batchId) * batchSize;
+    batches[batchId].EndCellId = std::min(numCells, batches[batchId].BeginCellId + batchSize);
+  }
+  std::vector<std::atomic<vtkIdType>> insertionKeys(numPts);
+  std::unique_ptr<BoxClipBatches> clipBatches;
+  if (numCells > 0)
+  {
+    clipBatches.reset(new BoxClipBatches(this, input, inPD, inCD, this->Locator, copyScalars,
+      this->GenerateClippedOutput != 0, batches, insertionKeys));
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        insertionKeys[ptId].store(VTK_ID_MAX, std::memory_order_relaxed);
+      }
+    });
+    ComputeBoxInsertionKeys computeKeys(this, input, insertionKeys);
+    vtkSMPTools::For(0, numCells, computeKeys);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(batches.size()), *clipBatches);
+  }
 
-  // clock_t init_tmp = clock();
-  for (cellId = 0; cellId < numCells && !abort; cellId++)
+  // Merge the batches in order. The point data layout of every batch is the
+  // same, so any of them can serve to allocate the output point data.
+  outPD[0] = output->GetPointData();
+  outPD[1] = this->GenerateClippedOutput ? clippedOutput->GetPointData() : nullptr;
+  auto firstBatch = std::find_if(batches.begin(), batches.end(),
+    [](const BoxClipBatch& batch) { return batch.PD != nullptr; });
+  for (i = 0; i < numOutputs; i++)
   {
-    if (!(cellId % updateTime))
+    if (firstBatch != batches.end())
     {
-      this->UpdateProgress(static_cast<float>(cellId) / numCells);
-      abort = this->CheckAbort();
+      outPD[i]->CopyAllocate(firstBatch->PD, estimatedSize, estimatedSize / 2);
     }
-
-    input->GetCell(cellId, cell);
-    cellPts = cell->GetPoints();
-    npts = cellPts->GetNumberOfPoints();
-
-    if (this->GenerateClippedOutput)
+    else
     {
-      if ((cell->GetCellDimension()) == 3)
-      {
-        if (orientation)
-        {
-          this->ClipHexahedronInOut(
-            newPoints, cell, this->Locator, conn, inPD, outPD, inCD, cellId, outCD);
-        }
-        else
-        {
-          this->ClipBoxInOut(
-            newPoints, cell, this->Locator, conn, inPD, outPD, inCD, cellId, outCD);
-        }
-
-        numNew[0] = conn[0]->GetNumberOfCells() - num[0];
-        numNew[1] = conn[1]->GetNumberOfCells() - num[1];
-        num[0] = conn[0]->GetNumberOfCells();
-        num[1] = conn[1]->GetNumberOfCells();
-      }
-      else if ((cell->GetCellDimension()) == 2)
-      {
-        if (orientation)
-        {
-          this->ClipHexahedronInOut2D(
-            newPoints, cell, this->Locator, conn, inPD, outPD, inCD, cellId, outCD);
-        }
-        else
-        {
-          this->ClipBoxInOut2D(
-            newPoints, cell, this->Locator, conn, inPD, outPD, inCD, cellId, outCD);
-        }
-        numNew[0] = conn[0]->GetNumberOfCells() - num[0];
-        numNew[1] = conn[1]->GetNumberOfCells() - num[1];
-        num[0] = conn[0]->GetNumberOfCells();
-        num[1] = conn[1]->GetNumberOfCells();
-      }
-      else if (cell->GetCellDimension() == 1)
-      {
-        if (orientation)
-        {
-          this->ClipHexahedronInOut1D(
-            newPoints, cell, this->Locator, conn, inPD, outPD, inCD, cellId, outCD);
-        }
-        else
-        {
-          this->ClipBoxInOut1D(
-            newPoints, cell, this->Locator, conn, inPD, outPD, inCD, cellId, outCD);
-        }
-        numNew[0] = conn[0]->GetNumberOfCells() - num[0];
-        numNew[1] = conn[1]->GetNumberOfCells() - num[1];
-        num[0] = conn[0]->GetNumberOfCells();
-        num[1] = conn[1]->GetNumberOfCells();
-      }
-      else if (cell->GetCellDimension() == 0)
-      {
-        if (orientation)
-        {
-          this->ClipHexahedronInOut0D(cell, this->Locator, conn, inPD, outPD, inCD, cellId, outCD);
-        }
-        else
-        {
-          this->ClipBoxInOut0D(cell, this->Locator, conn, inPD, outPD, inCD, cellId, outCD);
-        }
-        numNew[0] = conn[0]->GetNumberOfCells() - num[0];
-        numNew[1] = conn[1]->GetNumberOfCells() - num[1];
-        num[0] = conn[0]->GetNumberOfCells();
-        num[1] = conn[1]->GetNumberOfCells();
-      }
-      else
+      if (!copyScalars)
       {
-        vtkErrorMacro(<< "Do not support cells of dimension " << cell->GetCellDimension());
+        outPD[i]->CopyScalarsOff();
       }
+      outPD[i]->InterpolateAllocate(inPD, estimatedSize, estimatedSize / 2);
     }
-    else
+  }
+  std::vector<vtkIdType> pointMap;
+  std::vector<vtkIdType> cellPointIds;
+  std::vector<vtkIdType> insertedPointIds;
+  const vtkIdType numBatches = static_cast<vtkIdType>(batches.size());
+  const vtkIdType updateTime = numBatches / 10 + 1;
+  for (vtkIdType batchId = 0; batchId < numBatches; ++batchId)
+  {
+    if (!(batchId % updateTime))
     {
-      if ((cell->GetCellDimension()) == 3)
-      {
-        if (orientation)
-        {
-          this->ClipHexahedron(
-            newPoints, cell, this->Locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
-        }
-        else
-        {
-          this->ClipBox(
-            newPoints, cell, this->Locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
-        }
+      this->UpdateProgress(0.9 + 0.1 * batchId / numBatches);
+    }
+    BoxClipBatch& batch = batches[batchId];
+    if (!batch.Points)
+    {
+      continue;
+    }
 
-        numNew[0] = conn[0]->GetNumberOfCells() - num[0];
-        num[0] = conn[0]->GetNumberOfCells();
-      }
-      else if ((cell->GetCellDimension()) == 2)
-      {
-        if (orientation)
-        {
-          this->ClipHexahedron2D(
-            newPoints, cell, this->Locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
-        }
-        else
-        {
-          this->ClipBox2D(
-            newPoints, cell, this->Locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
-        }
-        numNew[0] = conn[0]->GetNumberOfCells() - num[0];
-        num[0] = conn[0]->GetNumberOfCells();
-      }
-      else if (cell->GetCellDimension() == 1)
-      {
-        if (orientation)
-        {
-          this->ClipHexahedron1D(
-            newPoints, cell, this->Locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
-        }
-        else
-        {
-          this->ClipBox1D(
-            newPoints, cell, this->Locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
-        }
-        numNew[0] = conn[0]->GetNumberOfCells() - num[0];
-        num[0] = conn[0]->GetNumberOfCells();
-      }
-      else if (cell->GetCellDimension() == 0)
+    // A batch which did not insert first the points of the earlier batches
+    // it uses may have split its cells differently. It is then clipped again,
+    // inserting these points first, until it uses no other point of the
+    // earlier batches.
+    std::size_t numInsertedPoints = 0;
+    while (!::KeepsPointOrder(this->Locator, newPoints, batch, insertedPointIds) &&
+      (numInsertedPoints == 0 || insertedPointIds.size() > numInsertedPoints))
+    {
+      numInsertedPoints = insertedPointIds.size();
+      clipBatches->ClipBatch(batch, &insertedPointIds, newPoints, outPD[0]);
+    }
+
+    const vtkIdType numBatchPts = batch.Points->GetNumberOfPoints();
+    pointMap.resize(numBatchPts);
+    double x[3];
+    for (vtkIdType ptId = 0; ptId < numBatchPts; ++ptId)
+    {
+      batch.Points->GetPoint(ptId, x);
+      if (this->Locator->InsertUniquePoint(x, pointMap[ptId]))
       {
-        if (orientation)
-        {
-          this->ClipHexahedron0D(
-            cell, this->Locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
-        }
-        else
+        for (i = 0; i < numOutputs; i++)
         {
-          this->ClipBox0D(cell, this->Locator, conn[0], inPD, outPD[0], inCD, cellId, outCD[0]);
+          outPD[i]->CopyData(batch.PD, ptId, pointMap[ptId]);
         }
-        numNew[0] = conn[0]->GetNumberOfCells() - num[0];
-        num[0] = conn[0]->GetNumberOfCells();
-      }
-      else
-      {
-        vtkErrorMacro(<< "Do not support cells of dimension " << cell->GetCellDimension());
       }
     }
 
     for (i = 0; i < numOutputs; i++) // for both outputs
     {
-      for (j = 0; j < numNew[i]; j++)
+      vtkIdType batchCellId = 0;
+      for (batch.Conn[i]->InitTraversal(); batch.Conn[i]->GetNextCell(npts, pts); ++batchCellId)
       {
-        conn[i]->GetNextCell(npts, pts);
-
-        // For each new cell added, got to set the type of the cell
-        switch (cell->GetCellDimension())
+        cellPointIds.resize(npts);
+        for (vtkIdType j = 0; j < npts; ++j)
         {
-          case 0: // points are generated-------------------------------
-            cellType = (npts > 1 ? VTK_POLY_VERTEX : VTK_VERTEX);
-            break;
-
-          case 1: // lines are generated----------------------------------
-            cellType = (npts > 2 ? VTK_POLY_LINE : VTK_LINE);
-            break;
-
-          case 2: // polygons are generated------------------------------
-            cellType = (npts == 3 ? VTK_TRIANGLE : (npts == 4 ? VTK_QUAD : VTK_POLYGON));
-            break;
-
-          case 3: // tetrahedra are generated------------------------------
-            cellType = VTK_TETRA;
-            break;
-        } // switch
-
-        newCellId = types[i]->InsertNextValue(cellType);
-        outCD[i]->CopyData(inCD, cellId, newCellId);
+          cellPointIds[j] = pointMap[pts[j]];
+        }
+        conn[i]->InsertNextCell(npts, cellPointIds.data());
+        newCellId = types[i]->InsertNextValue(batch.Types[i][batchCellId]);
+        outCD[i]->CopyData(inCD, batch.InputCellIds[i][batchCellId], newCellId);
       } // for each new cell
     }   // for both outputs
-  }     // for each cell
 
-  cell->Delete();
+    // release the batch as soon as it is merged
+    batch = BoxClipBatch();
+  } // for each batch
 
   output->SetPoints(newPoints);
   output->SetCells(types[0], conn[0]);
@@ -649,6 +994,7 @@ void vtkBoxClipDataSet::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Generate Clipped Output: " << (this->GenerateClippedOutput ? "Yes\n" : "Off\n");
   os << indent << "Generate Clip Scalars: " << (this->GenerateClipScalars ? "On\n" : "Off\n");
+  os << indent << "Batch Size: " << this->BatchSize << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -28,6 +28,11 @@
  *       PlanePoint[] point on the plane
  * 2) Apply the GenerateClipScalarsOn()
  * 3) Execute clipping  Update();
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
  */
 
 #ifndef vtkBoxClipDataSet_h
@@ -139,6 +144,23 @@ public:
   vtkSetMacro(Orientation, unsigned int);
   ///@}
 
+  ///@{
+  /**
+   * Specify the number of input cells in a batch, where a batch defines
+   * a subset of the input cells operated on during threaded
+   * execution. Batches are merged in order, so the output does not depend
+   * on the number of threads or on the batch size. A batch using points
+   * created by the earlier batches, for instance where the box crosses the
+   * boundary between two batches, is clipped again while merging it.
+   * Generally this is only used for debugging or performance studies
+   * (since batch size affects the thread workload).
+   *
+   * Default is 10000.
+   */
+  vtkSetClampMacro(BatchSize, unsigned int, 1, VTK_INT_MAX);
+  vtkGetMacro(BatchSize, unsigned int);
+  ///@}
+
   static void InterpolateEdge(vtkDataSetAttributes* attributes, vtkIdType toId, vtkIdType fromId1,
     vtkIdType fromId2, double t);
 
@@ -220,6 +242,8 @@ protected:
   double PlaneNormal[6][3]; // normal of each plane
   double PlanePoint[6][3];  // point on the plane
 
+  unsigned int BatchSize;
+
 private:
   vtkBoxClipDataSet(const vtkBoxClipDataSet&) = delete;
   void operator=(const vtkBoxClipDataSet&) = delete;
@@ -3,6 +3,7 @@
 
 #include "vtkClipDataSet.h"
 
+#include "vtkBoundingBox.h"
 #include "vtkCallbackCommand.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
@@ -20,11 +21,362 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyhedron.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+// The input cells are clipped in batches of contiguous cell ids. Each batch
+// owns its points, point data and point locator so that batches can be
+// clipped concurrently. Batches are then merged in order through the
+// filter's locator, which produces the same point ordering as clipping the
+// cells one after the other, whatever the number of threads.
+struct ClipBatch
+{
+  vtkIdType BeginCellId = 0;
+  vtkIdType EndCellId = 0;
+  vtkSmartPointer<vtkPoints> Points;
+  vtkSmartPointer<vtkPointData> PD;
+  vtkSmartPointer<vtkCellArray> Conn[2];
+  std::vector<unsigned char> Types[2];
+  std::vector<vtkIdType> InputCellIds[2]; // input cell of each generated cell
+};
+
+//------------------------------------------------------------------------------
+VTKCellType GetClippedCellType(vtkGenericCell* cell, vtkIdType npts, bool isSameCell)
+{
+  if (isSameCell)
+  {
+    return static_cast<VTKCellType>(cell->GetCellType());
+  }
+  else if (cell->GetCellType() == VTK_POLYHEDRON)
+  {
+    return VTK_POLYHEDRON;
+  }
+
+  switch (cell->GetCellDimension())
+  {
+    case 0: // points are generated--------------------------------
+      return (npts > 1 ? VTK_POLY_VERTEX : VTK_VERTEX);
+
+    case 1: // lines are generated---------------------------------
+      return (npts > 2 ? VTK_POLY_LINE : VTK_LINE);
+
+    case 2: // polygons are generated------------------------------
+      return (npts == 3 ? VTK_TRIANGLE : (npts == 4 ? VTK_QUAD : VTK_POLYGON));
+
+    case 3: // tetrahedra or wedges are generated------------------
+      return (npts == 4 ? VTK_TETRA : VTK_WEDGE);
+
+    default:
+      vtkErrorWithObjectMacro(nullptr, "Dimension cannot be lower than 0 or higher than 3");
+      break;
+  }
+
+  return VTK_EMPTY_CELL;
+}
+
+//------------------------------------------------------------------------------
+// Cells clipped by vtkCell3D::Clip() are split into tetrahedra using
+// templates chosen from the order of the ids that the locator gives to their
+// points. Neighboring cells of different batches are split consistently, and
+// as when clipping the cells one after the other, only if the points already
+// inserted by earlier batches keep their relative order in the batch locator.
+bool IsClippedWithTemplates(int cellType)
+{
+  switch (cellType)
+  {
+    case VTK_VOXEL:
+    case VTK_HEXAHEDRON:
+    case VTK_WEDGE:
+    case VTK_PYRAMID:
+    case VTK_PENTAGONAL_PRISM:
+    case VTK_HEXAGONAL_PRISM:
+      return true;
+    default:
+      return false;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Record for each input point the cell clipped with templates which inserts it
+// first, and its position in this cell, as cellId * VTK_CELL_SIZE + position.
+// Sorting these keys gives the order in which the points are inserted.
+struct ComputeInsertionKeys
+{
+  vtkDataSet* Input;
+  vtkDataArray* ClipScalars;
+  double Value;
+  bool InsideOut;
+  bool GenerateClippedOutput;
+  std::vector<std::atomic<vtkIdType>>& Keys;
+
+  vtkSMPThreadLocalObject<vtkIdList> TLPointIds;
+
+  ComputeInsertionKeys(vtkDataSet* input, vtkDataArray* clipScalars, double value, bool insideOut,
+    bool generateClippedOutput, std::vector<std::atomic<vtkIdType>>& keys)
+    : Input(input)
+    , ClipScalars(clipScalars)
+    , Value(value)
+    , InsideOut(insideOut)
+    , GenerateClippedOutput(generateClippedOutput)
+    , Keys(keys)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType beginCellId, vtkIdType endCellId)
+  {
+    vtkIdList* pointIds = this->TLPointIds.Local();
+    for (vtkIdType cellId = beginCellId; cellId < endCellId; ++cellId)
+    {
+      if (!IsClippedWithTemplates(this->Input->GetCellType(cellId)))
+      {
+        continue;
+      }
+      this->Input->GetCellPoints(cellId, pointIds);
+      const vtkIdType npts = pointIds->GetNumberOfIds();
+
+      // vtkCell3D::Clip() inserts no point if the cell is entirely clipped
+      // away, which cannot happen for both outputs.
+      bool inserted = this->GenerateClippedOutput;
+      for (vtkIdType i = 0; i < npts && !inserted; ++i)
+      {
+        // The cell scalars are single precision, as in ClipBatches.
+        const double s =
+          static_cast<float>(this->ClipScalars->GetComponent(pointIds->GetId(i), 0));
+        inserted = (s >= this->Value) != this->InsideOut;
+      }
+      if (!inserted)
+      {
+        continue;
+      }
+
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        std::atomic<vtkIdType>& key = this->Keys[pointIds->GetId(i)];
+        const vtkIdType cellKey = cellId * VTK_CELL_SIZE + i;
+        vtkIdType current = key.load();
+        while (cellKey < current && !key.compare_exchange_weak(current, cellKey))
+        {
+        }
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+struct ClipBatches
+{
+  vtkClipDataSet* Filter;
+  vtkDataSet* Input;
+  vtkDataArray* ClipScalars;
+  vtkPointData* InPD;
+  vtkCellData* InCD;
+  vtkIncrementalPointLocator* Locator; // prototype of the batch locators
+  double Value;
+  bool InsideOut;
+  bool StableClipNonLinear;
+  int NumOutputs;
+  int PointsDataType;
+  std::vector<ClipBatch>& Batches;
+  const std::vector<std::atomic<vtkIdType>>& InsertionKeys;
+  std::atomic<vtkIdType> NumberOfStartedBatches;
+
+  vtkSMPThreadLocalObject<vtkGenericCell> TLCell;
+  vtkSMPThreadLocalObject<vtkFloatArray> TLCellScalars;
+  vtkSMPThreadLocalObject<vtkIdList> TLPointIds;
+  // Cell data is copied from the input cells when the batches are merged, so
+  // the cell clipping methods write into an empty (never allocated) instance.
+  vtkSMPThreadLocalObject<vtkCellData> TLCellData;
+
+  ClipBatches(vtkClipDataSet* filter, vtkDataSet* input, vtkDataArray* clipScalars,
+    vtkPointData* inPD, vtkCellData* inCD, vtkIncrementalPointLocator* locator, double value,
+    bool insideOut, bool stableClipNonLinear, int numOutputs, int pointsDataType,
+    std::vector<ClipBatch>& batches, const std::vector<std::atomic<vtkIdType>>& insertionKeys)
+    : Filter(filter)
+    , Input(input)
+    , ClipScalars(clipScalars)
+    , InPD(inPD)
+    , InCD(inCD)
+    , Locator(locator)
+    , Value(value)
+    , InsideOut(insideOut)
+    , StableClipNonLinear(stableClipNonLinear)
+    , NumOutputs(numOutputs)
+    , PointsDataType(pointsDataType)
+    , Batches(batches)
+    , InsertionKeys(insertionKeys)
+    , NumberOfStartedBatches(0)
+  {
+    // Make sure GetCell() is thread safe by building the cell structures on
+    // the main thread first.
+    vtkNew<vtkGenericCell> cell;
+    this->Input->GetCell(0, cell);
+  }
+
+  void Initialize() { this->TLCellScalars.Local()->Allocate(VTK_CELL_SIZE); }
+
+  void operator()(vtkIdType beginBatchId, vtkIdType endBatchId)
+  {
+    vtkGenericCell* cell = this->TLCell.Local();
+    vtkFloatArray* cellScalars = this->TLCellScalars.Local();
+    vtkIdList* pointIds = this->TLPointIds.Local();
+    vtkCellData* cellData = this->TLCellData.Local();
+    std::vector<std::pair<vtkIdType, vtkIdType>> insertedPoints;
+    double x[3], s;
+
+    // Clipping accounts for 90% of the progress, merging for the rest.
+    const vtkIdType numBatches = static_cast<vtkIdType>(this->Batches.size());
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    for (vtkIdType batchId = beginBatchId; batchId < endBatchId; ++batchId)
+    {
+      const vtkIdType numStarted = this->NumberOfStartedBatches++;
+      if (isFirst)
+      {
+        this->Filter->UpdateProgress(0.9 * numStarted / numBatches);
+        this->Filter->CheckAbort();
+      }
+      if (this->Filter->GetAbortOutput())
+      {
+        break;
+      }
+      ClipBatch& batch = this->Batches[batchId];
+      const vtkIdType numBatchCells = batch.EndCellId - batch.BeginCellId;
+
+      // Size the batch locator on the region actually covered by the batch.
+      vtkBoundingBox bbox;
+      for (vtkIdType cellId = batch.BeginCellId; cellId < batch.EndCellId; ++cellId)
+      {
+        this->Input->GetCellPoints(cellId, pointIds);
+        for (vtkIdType i = 0; i < pointIds->GetNumberOfIds(); ++i)
+        {
+          this->Input->GetPoint(pointIds->GetId(i), x);
+          bbox.AddPoint(x);
+        }
+      }
+      if (!bbox.IsValid())
+      {
+        continue;
+      }
+      double bounds[6];
+      bbox.GetBounds(bounds);
+
+      batch.Points = vtkSmartPointer<vtkPoints>::New();
+      batch.Points->SetDataType(this->PointsDataType);
+      batch.Points->Allocate(numBatchCells);
+      auto locator = vtk::TakeSmartPointer(this->Locator->NewInstance());
+      locator->SetTolerance(this->Locator->GetTolerance());
+      locator->InitPointInsertion(batch.Points, bounds, numBatchCells);
+      batch.PD = vtkSmartPointer<vtkPointData>::New();
+      batch.PD->InterpolateAllocate(this->InPD, numBatchCells, numBatchCells / 2);
+
+      // Insert first the points of the batch that earlier batches inserted,
+      // in the order they were inserted, so that the cells are split into
+      // the same tetrahedra as in the earlier batches.
+      insertedPoints.clear();
+      const vtkIdType firstBatchKey = batch.BeginCellId * VTK_CELL_SIZE;
+      for (vtkIdType cellId = batch.BeginCellId; cellId < batch.EndCellId; ++cellId)
+      {
+        if (!IsClippedWithTemplates(this->Input->GetCellType(cellId)))
+        {
+          continue;
+        }
+        this->Input->GetCellPoints(cellId, pointIds);
+        for (vtkIdType i = 0; i < pointIds->GetNumberOfIds(); ++i)
+        {
+          const vtkIdType ptId = pointIds->GetId(i);
+          const vtkIdType key = this->InsertionKeys[ptId].load(std::memory_order_relaxed);
+          if (key < firstBatchKey)
+          {
+            insertedPoints.emplace_back(key, ptId);
+          }
+        }
+      }
+      std::sort(insertedPoints.begin(), insertedPoints.end());
+      insertedPoints.erase(
+        std::unique(insertedPoints.begin(), insertedPoints.end()), insertedPoints.end());
+      for (const auto& insertedPoint : insertedPoints)
+      {
+        vtkIdType id;
+        this->Input->GetPoint(insertedPoint.second, x);
+        if (locator->InsertUniquePoint(x, id))
+        {
+          batch.PD->CopyData(this->InPD, insertedPoint.second, id);
+        }
+      }
+
+      vtkIdType numCells[2] = { 0, 0 };
+      for (int i = 0; i < this->NumOutputs; ++i)
+      {
+        batch.Conn[i] = vtkSmartPointer<vtkCellArray>::New();
+        batch.Conn[i]->AllocateEstimate(numBatchCells, 4);
+        batch.Types[i].reserve(numBatchCells);
+        batch.InputCellIds[i].reserve(numBatchCells);
+      }
+
+      for (vtkIdType cellId = batch.BeginCellId; cellId < batch.EndCellId; ++cellId)
+      {
+        this->Input->GetCell(cellId, cell);
+        vtkIdList* cellIds = cell->GetPointIds();
+        const vtkIdType npts = cellIds->GetNumberOfIds();
+        vtkNonLinearCell* nonLinearCell =
+          vtkNonLinearCell::SafeDownCast(cell->GetRepresentativeCell());
+
+        // evaluate implicit cutting function
+        for (vtkIdType i = 0; i < npts; i++)
+        {
+          s = this->ClipScalars->GetComponent(cellIds->GetId(i), 0);
+          cellScalars->InsertTuple(i, &s);
+        }
+
+        // perform the clipping, the second output keeps what is clipped away
+        for (int i = 0; i < this->NumOutputs; ++i)
+        {
+          const bool insideOut = (i == 0 ? this->InsideOut : !this->InsideOut);
+          bool sameCell = false;
+          if (this->StableClipNonLinear && nonLinearCell != nullptr)
+          {
+            sameCell = nonLinearCell->StableClip(this->Value, cellScalars, locator, batch.Conn[i],
+              this->InPD, batch.PD, this->InCD, cellId, cellData, insideOut);
+          }
+          else
+          {
+            cell->Clip(this->Value, cellScalars, locator, batch.Conn[i], this->InPD, batch.PD,
+              this->InCD, cellId, cellData, insideOut);
+          }
+
+          const vtkIdType numNew = batch.Conn[i]->GetNumberOfCells() - numCells[i];
+          for (vtkIdType j = 0; j < numNew; ++j)
+          {
+            const vtkIdType newPts = batch.Conn[i]->GetCellSize(numCells[i] + j);
+            batch.Types[i].push_back(
+              static_cast<unsigned char>(GetClippedCellType(cell, newPts, sameCell)));
+            batch.InputCellIds[i].push_back(cellId);
+          }
+          numCells[i] += numNew;
+        }
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+} // anonymous namespace
+
 vtkStandardNewMacro(vtkClipDataSet);
 vtkCxxSetObjectMacro(vtkClipDataSet, ClipFunction, vtkImplicitFunction);
 
@@ -43,6 +395,7 @@ vtkClipDataSet::vtkClipDataSet(vtkImplicitFunction* cf)
 
   this->GenerateClippedOutput = 0;
   this->MergeTolerance = 0.01;
+  this->BatchSize = 10000;
 
   this->SetNumberOfOutputPorts(2);
   vtkUnstructuredGrid* output2 = vtkUnstructuredGrid::New();
@@ -156,15 +509,8 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
   vtkCellData* inCD = input->GetCellData();
   vtkCellData* outCD[2];
   vtkSmartPointer<vtkPoints> newPoints;
-  vtkSmartPointer<vtkFloatArray> cellScalars;
   vtkDataArray* clipScalars;
-  vtkPoints* cellPts;
-  vtkIdList* cellIds;
-  double s;
-  vtkIdType npts;
-  const vtkIdType* pts;
   vtkIdType i;
-  int j;
   vtkIdType estimatedSize;
   vtkSmartPointer<vtkUnsignedCharArray> types[2];
   types[0] = types[1] = nullptr;
@@ -222,13 +568,10 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
   {
     estimatedSize = 1024;
   }
-  cellScalars = vtkSmartPointer<vtkFloatArray>::New();
-  cellScalars->Allocate(VTK_CELL_SIZE);
   vtkSmartPointer<vtkCellArray> conn[2];
   conn[0] = conn[1] = nullptr;
   conn[0] = vtkSmartPointer<vtkCellArray>::New();
   conn[0]->AllocateEstimate(estimatedSize, 1);
-  conn[0]->InitTraversal();
   types[0] = vtkSmartPointer<vtkUnsignedCharArray>::New();
   types[0]->Allocate(estimatedSize, estimatedSize / 2);
   if (this->GenerateClippedOutput)
@@ -236,7 +579,6 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     numOutputs = 2;
     conn[1] = vtkSmartPointer<vtkCellArray>::New();
     conn[1]->AllocateEstimate(estimatedSize, 1);
-    conn[1]->InitTraversal();
     types[1] = vtkSmartPointer<vtkUnsignedCharArray>::New();
     types[1]->Allocate(estimatedSize, estimatedSize / 2);
   }
@@ -286,12 +628,15 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     {
       inPD->SetScalars(tmpScalars);
     }
-    double pt[3];
-    for (i = 0; i < numPts; i++)
-    {
-      input->GetPoint(i, pt);
-      tmpScalars->SetValue(i, this->ClipFunction->FunctionValue(pt));
-    }
+    vtkImplicitFunction* clipFunction = this->ClipFunction;
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      double pt[3];
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        input->GetPoint(ptId, pt);
+        tmpScalars->SetValue(ptId, clipFunction->FunctionValue(pt));
+      }
+    });
     clipScalars = tmpScalars;
   }
   else // using input scalars
@@ -322,10 +667,6 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
   //  {
   //  outPD->CopyScalarsOn();
   //  }
-  vtkDataSetAttributes* tempDSA = vtkDataSetAttributes::New();
-  tempDSA->InterpolateAllocate(inPD, 1, 2);
-  outPD->InterpolateAllocate(inPD, estimatedSize, estimatedSize / 2);
-  tempDSA->Delete();
   outCD[0] = output->GetCellData();
   outCD[0]->CopyAllocate(inCD, estimatedSize, estimatedSize / 2);
   if (this->GenerateClippedOutput)
@@ -334,106 +675,95 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     outCD[1]->CopyAllocate(inCD, estimatedSize, estimatedSize / 2);
   }
 
-  // Process all cells and clip each in turn
+  double value = 0.0;
+  if (this->UseValueAsOffset || !this->ClipFunction)
+  {
+    value = this->Value;
+  }
+
+  // Process all cells and clip each batch in turn
   //
-  bool abort = false;
-  vtkIdType updateTime = numCells / 20 + 1; // update roughly every 5%
-  vtkSmartPointer<vtkGenericCell> cell = vtkSmartPointer<vtkGenericCell>::New();
-  int num[2];
-  num[0] = num[1] = 0;
-  int numNew[2];
-  numNew[0] = numNew[1] = 0;
-  bool sameCell[2] = { false, false };
-
-  for (vtkIdType cellId = 0; cellId < numCells && !abort; cellId++)
-  {
-    if (!(cellId % updateTime))
+  const vtkIdType batchSize = static_cast<vtkIdType>(this->BatchSize);
+  std::vector<ClipBatch> batches((numCells + batchSize - 1) / batchSize);
+  for (std::size_t batchId = 0; batchId < batches.size(); ++batchId)
+  {
+    batches[batchId].BeginCellId = static_cast<vtkIdType>(batchId) * batchSize;
+    batches[batchId].EndCellId = std::min(numCells, batches[batchId].BeginCellId + batchSize);
+  }
+  std::vector<std::atomic<vtkIdType>> insertionKeys(numPts);
+  ClipBatches clipBatches(this, input, clipScalars, inPD, inCD, this->Locator, value,
+    this->InsideOut != 0, this->StableClipNonLinear, numOutputs, newPoints->GetDataType(),
+    batches, insertionKeys);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
     {
-      this->UpdateProgress(static_cast<double>(cellId) / numCells);
-      abort = this->CheckAbort();
+      insertionKeys[ptId].store(VTK_ID_MAX, std::memory_order_relaxed);
     }
+  });
+  ComputeInsertionKeys computeKeys(input, clipScalars, value, this->InsideOut != 0,
+    this->GenerateClippedOutput != 0, insertionKeys);
+  vtkSMPTools::For(0, numCells, computeKeys);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(batches.size()), clipBatches);
 
-    input->GetCell(cellId, cell);
-    cellPts = cell->GetPoints();
-    cellIds = cell->GetPointIds();
-    npts = cellPts->GetNumberOfPoints();
-    vtkNonLinearCell* nonLinearCell = vtkNonLinearCell::SafeDownCast(cell->GetRepresentativeCell());
-
-    // evaluate implicit cutting function
-    for (i = 0; i < npts; i++)
+  // Merge the batches in order. The point data layout of every batch is the
+  // same, so any of them can serve to allocate the output point data.
+  auto firstBatch = std::find_if(batches.begin(), batches.end(),
+    [](const ClipBatch& batch) { return batch.PD != nullptr; });
+  if (firstBatch != batches.end())
+  {
+    outPD->CopyAllocate(firstBatch->PD, estimatedSize, estimatedSize / 2);
+  }
+  else
+  {
+    outPD->InterpolateAllocate(inPD, estimatedSize, estimatedSize / 2);
+  }
+  std::vector<vtkIdType> pointMap;
+  std::vector<vtkIdType> cellPointIds;
+  const vtkIdType numBatches = static_cast<vtkIdType>(batches.size());
+  const vtkIdType updateTime = numBatches / 10 + 1;
+  for (vtkIdType batchId = 0; batchId < numBatches; ++batchId)
+  {
+    if (!(batchId % updateTime))
     {
-      s = clipScalars->GetComponent(cellIds->GetId(i), 0);
-      cellScalars->InsertTuple(i, &s);
+      this->UpdateProgress(0.9 + 0.1 * batchId / numBatches);
     }
-
-    double value = 0.0;
-    if (this->UseValueAsOffset || !this->ClipFunction)
+    ClipBatch& batch = batches[batchId];
+    if (!batch.Points)
     {
-      value = this->Value;
+      continue;
     }
-
-    // perform the clipping
-    for (i = 0; i < numOutputs; ++i)
+    const vtkIdType numBatchPts = batch.Points->GetNumberOfPoints();
+    pointMap.resize(numBatchPts);
+    double x[3];
+    for (vtkIdType ptId = 0; ptId < numBatchPts; ++ptId)
     {
-      if (this->StableClipNonLinear && nonLinearCell != nullptr)
+      batch.Points->GetPoint(ptId, x);
+      if (this->Locator->InsertUniquePoint(x, pointMap[ptId]))
       {
-        sameCell[i] = nonLinearCell->StableClip(value, cellScalars, this->Locator, conn[i], inPD,
-          outPD, inCD, cellId, outCD[i], this->InsideOut);
-        numNew[i] = conn[i]->GetNumberOfCells() - num[i];
-        num[i] = conn[i]->GetNumberOfCells();
-      }
-      else
-      {
-        cell->Clip(value, cellScalars, this->Locator, conn[i], inPD, outPD, inCD, cellId, outCD[i],
-          this->InsideOut);
-        numNew[i] = conn[i]->GetNumberOfCells() - num[i];
-        num[i] = conn[i]->GetNumberOfCells();
-        sameCell[i] = false;
+        outPD->CopyData(batch.PD, ptId, pointMap[ptId]);
       }
     }
 
-    auto getCellType = [](vtkGenericCell* gCell, vtkIdType nPts, bool isSameCell) {
-      if (isSameCell)
-      {
-        return static_cast<VTKCellType>(gCell->GetCellType());
-      }
-      else if (gCell->GetCellType() == VTK_POLYHEDRON)
-      {
-        return VTK_POLYHEDRON;
-      }
-      else
-      {
-        switch (gCell->GetCellDimension())
-        {
-          case 0: // points are generated--------------------------------
-            return (nPts > 1 ? VTK_POLY_VERTEX : VTK_VERTEX);
-
-          case 1: // lines are generated---------------------------------
-            return (nPts > 2 ? VTK_POLY_LINE : VTK_LINE);
-
-          case 2: // polygons are generated------------------------------
-            return (nPts == 3 ? VTK_TRIANGLE : (nPts == 4 ? VTK_QUAD : VTK_POLYGON));
-
-          case 3: // tetrahedra or wedges are generated------------------
-            return (nPts == 4 ? VTK_TETRA : VTK_WEDGE);
-
-          default:
-            vtkErrorWithObjectMacro(nullptr, "Dimension cannot be lower than 0 or higher than 3");
-            break;
-        }
-      }
-
-      return VTK_EMPTY_CELL;
-    };
-
     for (i = 0; i < numOutputs; i++)
     {
-      for (j = 0; j < numNew[i]; j++)
+      vtkIdType npts;
+      const vtkIdType* pts;
+      vtkIdType batchCellId = 0;
+      for (batch.Conn[i]->InitTraversal(); batch.Conn[i]->GetNextCell(npts, pts); ++batchCellId)
       {
-        conn[i]->GetNextCell(npts, pts);
-        types[i]->InsertNextValue(getCellType(cell, npts, sameCell[i]));
+        cellPointIds.resize(npts);
+        for (vtkIdType j = 0; j < npts; ++j)
+        {
+          cellPointIds[j] = pointMap[pts[j]];
+        }
+        vtkIdType newCellId = conn[i]->InsertNextCell(npts, cellPointIds.data());
+        types[i]->InsertNextValue(batch.Types[i][batchCellId]);
+        outCD[i]->CopyData(inCD, batch.InputCellIds[i][batchCellId], newCellId);
       }
     }
+
+    // release the batch as soon as it is merged
+    batch = ClipBatch();
   }
 
   if (this->ClipFunction)
@@ -448,6 +778,8 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
   {
     clippedOutput->SetPoints(newPoints);
     clippedOutput->SetCells(types[1], conn[1]);
+    // both outputs share their points, hence their point data
+    clippedOutput->GetPointData()->ShallowCopy(outPD);
   }
 
   this->Locator->Initialize(); // release any extra memory
@@ -658,5 +990,6 @@ void vtkClipDataSet::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "UseValueAsOffset: " << (this->UseValueAsOffset ? "On\n" : "Off\n");
 
   os << indent << "Precision of the output points: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Batch Size: " << this->BatchSize << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -41,6 +41,11 @@
  * is necessary to preserve compatibility across face neighbors. 2D cells
  * will only be triangulated if the cutting function passes through them.
  *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
  * @sa
  * vtkImplicitFunction vtkCutter vtkClipVolume vtkClipPolyData
  */
@@ -182,6 +187,20 @@ public:
   vtkGetMacro(OutputPointsPrecision, int);
   ///@}
 
+  ///@{
+  /**
+   * Specify the number of input cells in a batch, where a batch defines
+   * a subset of the input cells operated on during threaded
+   * execution. Batches are merged in order, so the output does not depend
+   * on the number of threads or on the batch size. Generally this is only used for debugging or
+   * performance studies (since batch size affects the thread workload).
+   *
+   * Default is 10000.
+   */
+  vtkSetClampMacro(BatchSize, unsigned int, 1, VTK_INT_MAX);
+  vtkGetMacro(BatchSize, unsigned int);
+  ///@}
+
   ///@{
   /**
    * Setter/Getter for stable clipping non-linear cells (default value is true)
@@ -221,6 +240,7 @@ protected:
 
   bool UseValueAsOffset;
   int OutputPointsPrecision;
+  unsigned int BatchSize;
 
   bool StableClipNonLinear = true;
 
@@ -20,11 +20,412 @@
 #include "vtkTriangleFilter.h"
 #include "vtkTriangleStrip.h"
 
-#include <memory> // For unique_ptr
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticCellLinksTemplate.h"
+
+#include <algorithm>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCurvatures);
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Gather the sorted, unique ids of the cells using point ptId. Contributions
+// are accumulated in increasing cell id order so that the result does not
+// depend on the way the links were built.
+template <typename TIds>
+void GetSortedCells(vtkIdType ncells, const TIds* cells, std::vector<vtkIdType>& sorted)
+{
+  sorted.assign(cells, cells + ncells);
+  std::sort(sorted.begin(), sorted.end());
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+}
+
+//------------------------------------------------------------------------------
+// Compute the mean curvature contribution H_e of each edge. The contribution
+// of the edge (pts[v],pts[v+1]) of the cell cellId is stored at
+// Offsets[cellId]+v. Each interior edge is only evaluated from the cell of
+// lowest id; other edges are marked invalid.
+struct MeanEdgeCurvature
+{
+  vtkCurvatures* Filter;
+  vtkPolyData* Mesh;
+  const std::vector<vtkIdType>& Offsets;
+  std::vector<double>& EdgeH;
+  std::vector<unsigned char>& EdgeValid;
+  vtkSMPThreadLocalObject<vtkIdList> Vertices;
+  vtkSMPThreadLocalObject<vtkIdList> VerticesN;
+  vtkSMPThreadLocalObject<vtkIdList> Neighbours;
+
+  MeanEdgeCurvature(vtkCurvatures* filter, vtkPolyData* mesh,
+    const std::vector<vtkIdType>& offsets, std::vector<double>& edgeH,
+    std::vector<unsigned char>& edgeValid)
+    : Filter(filter)
+    , Mesh(mesh)
+    , Offsets(offsets)
+    , EdgeH(edgeH)
+    , EdgeValid(edgeValid)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType f, vtkIdType endF)
+  {
+    vtkIdList* vertices = this->Vertices.Local();
+    vtkIdList* vertices_n = this->VerticesN.Local();
+    vtkIdList* neighbours = this->Neighbours.Local();
+    double n_f[3]; // normal of facet
+    double n_n[3]; // normal of edge
+    double t[3];   // to store the cross product of n_f n_n
+    double ore[3]; // origin of e
+    double end[3]; // end of e
+    double oth[3]; // third vertex necessary for comp of n
+    double vn0[3];
+    double vn1[3]; // vertices for computation of neighbour's n
+    double vn2[3];
+    double e[3]; // edge (oriented)
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+
+    for (; f < endF; ++f)
+    {
+      if (isFirst)
+      {
+        this->Filter->CheckAbort();
+      }
+      if (this->Filter->GetAbortOutput())
+      {
+        break;
+      }
+      this->Mesh->GetCellPoints(f, vertices);
+      const vtkIdType nv = vertices->GetNumberOfIds();
+
+      for (vtkIdType v = 0; v < nv; v++)
+      {
+        const vtkIdType edgeId = this->Offsets[f] + v;
+        this->EdgeValid[edgeId] = 0;
+
+        // get neighbour
+        const vtkIdType v_l = vertices->GetId(v);
+        const vtkIdType v_r = vertices->GetId((v + 1) % nv);
+        const vtkIdType v_o = vertices->GetId((v + 2) % nv);
+        this->Mesh->GetCellEdgeNeighbors(f, v_l, v_r, neighbours);
+
+        vtkIdType n; // n short for neighbor
+
+        // compute only if there is really ONE neighbour
+        // AND meanCurvature has not been computed yet!
+        // (ensured by n > f)
+        if (neighbours->GetNumberOfIds() == 1 && (n = neighbours->GetId(0)) > f)
+        {
+          double Hf; // temporary store
+
+          // find 3 corners of f: in order!
+          this->Mesh->GetPoint(v_l, ore);
+          this->Mesh->GetPoint(v_r, end);
+          this->Mesh->GetPoint(v_o, oth);
+          // compute normal of f
+          vtkTriangle::ComputeNormal(ore, end, oth, n_f);
+          // compute common edge
+          e[0] = end[0];
+          e[1] = end[1];
+          e[2] = end[2];
+          e[0] -= ore[0];
+          e[1] -= ore[1];
+          e[2] -= ore[2];
+          const double length = vtkMath::Normalize(e);
+          double Af = vtkTriangle::TriangleArea(ore, end, oth);
+          // find 3 corners of n: in order!
+          this->Mesh->GetCellPoints(n, vertices_n);
+          this->Mesh->GetPoint(vertices_n->GetId(0), vn0);
+          this->Mesh->GetPoint(vertices_n->GetId(1), vn1);
+          this->Mesh->GetPoint(vertices_n->GetId(2), vn2);
+          Af += double(vtkTriangle::TriangleArea(vn0, vn1, vn2));
+          // compute normal of n
+          vtkTriangle::ComputeNormal(vn0, vn1, vn2, n_n);
+          // the cosine is n_f * n_n
+          const double cs = vtkMath::Dot(n_f, n_n);
+          // the sin is (n_f x n_n) * e
+          vtkMath::Cross(n_f, n_n, t);
+          const double sn = vtkMath::Dot(t, e);
+          // signed angle in [-pi,pi]
+          if (sn != 0.0 || cs != 0.0)
+          {
+            const double angle = atan2(sn, cs);
+            Hf = length * angle;
+          }
+          else
+          {
+            Hf = 0.0;
+          }
+          // weighted Hf is added to the scalars at v_l and v_r
+          if (Af != 0.0)
+          {
+            (Hf /= Af) *= 3.0;
+          }
+          this->EdgeH[edgeId] = Hf;
+          this->EdgeValid[edgeId] = 1;
+        }
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+// Average the contributions of the edges incident to each point.
+struct MeanPointCurvature
+{
+  vtkPolyData* Mesh;
+  const std::vector<vtkIdType>& Offsets;
+  const std::vector<double>& EdgeH;
+  const std::vector<unsigned char>& EdgeValid;
+  bool Invert;
+  double* MeanCurvature;
+  vtkSMPThreadLocalObject<vtkIdList> Vertices;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> Cells;
+
+  MeanPointCurvature(vtkPolyData* mesh, const std::vector<vtkIdType>& offsets,
+    const std::vector<double>& edgeH, const std::vector<unsigned char>& edgeValid, bool invert,
+    double* meanCurvature)
+    : Mesh(mesh)
+    , Offsets(offsets)
+    , EdgeH(edgeH)
+    , EdgeValid(edgeValid)
+    , Invert(invert)
+    , MeanCurvature(meanCurvature)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    vtkIdList* vertices = this->Vertices.Local();
+    std::vector<vtkIdType>& cells = this->Cells.Local();
+    vtkIdType ncells, npts;
+    vtkIdType* cellIds;
+    const vtkIdType* pts;
+
+    for (; ptId < endPtId; ++ptId)
+    {
+      this->Mesh->GetPointCells(ptId, ncells, cellIds);
+      ::GetSortedCells(ncells, cellIds, cells);
+
+      double H = 0.0;
+      int num_neighb = 0;
+      for (vtkIdType f : cells)
+      {
+        this->Mesh->GetCellPoints(f, npts, pts, vertices);
+        for (vtkIdType v = 0; v < npts; v++)
+        {
+          const vtkIdType edgeId = this->Offsets[f] + v;
+          if (!this->EdgeValid[edgeId])
+          {
+            continue;
+          }
+          if (pts[v] == ptId)
+          {
+            H += this->EdgeH[edgeId];
+            num_neighb++;
+          }
+          if (pts[(v + 1) % npts] == ptId)
+          {
+            H += this->EdgeH[edgeId];
+            num_neighb++;
+          }
+        }
+      }
+
+      if (num_neighb > 0)
+      {
+        const double Hf = 0.5 * H / num_neighb;
+        this->MeanCurvature[ptId] = (this->Invert ? -Hf : Hf);
+      }
+      else
+      {
+        this->MeanCurvature[ptId] = 0.0;
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+// Compute the Gauss curvature of each point from the angles and areas of the
+// incident facets.
+struct GaussPointCurvature
+{
+  vtkCurvatures* Filter;
+  vtkCellArray* Facets;
+  vtkPolyData* Output;
+  vtkStaticCellLinksTemplate<vtkIdType>& Links;
+  double* GaussCurvature;
+  vtkSMPThreadLocalObject<vtkIdList> Vertices;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> Cells;
+
+  GaussPointCurvature(vtkCurvatures* filter, vtkCellArray* facets, vtkPolyData* output,
+    vtkStaticCellLinksTemplate<vtkIdType>& links, double* gaussCurvature)
+    : Filter(filter)
+    , Facets(facets)
+    , Output(output)
+    , Links(links)
+    , GaussCurvature(gaussCurvature)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    vtkIdList* vertices = this->Vertices.Local();
+    std::vector<vtkIdType>& cells = this->Cells.Local();
+    double v0[3], v1[3], v2[3], e0[3], e1[3], e2[3];
+    double alpha[3];
+    vtkIdType npts;
+    const vtkIdType* vert;
+    const double pi2 = 2.0 * vtkMath::Pi();
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    const vtkIdType checkAbortInterval = std::min((endPtId - ptId) / 10 + 1, (vtkIdType)1000);
+
+    for (const vtkIdType beginPtId = ptId; ptId < endPtId; ++ptId)
+    {
+      if ((ptId - beginPtId) % checkAbortInterval == 0)
+      {
+        if (isFirst)
+        {
+          this->Filter->CheckAbort();
+        }
+        if (this->Filter->GetAbortOutput())
+        {
+          break;
+        }
+      }
+
+      ::GetSortedCells(this->Links.GetNcells(ptId), this->Links.GetCells(ptId), cells);
+      double K = pi2;
+      double dA = 0.0;
+      for (vtkIdType f : cells)
+      {
+        this->Facets->GetCellAtId(f, npts, vert, vertices);
+        this->Output->GetPoint(vert[0], v0);
+        this->Output->GetPoint(vert[1], v1);
+        this->Output->GetPoint(vert[2], v2);
+        // edges
+        for (int i = 0; i < 3; ++i)
+        {
+          e0[i] = v1[i] - v0[i];
+          e1[i] = v2[i] - v1[i];
+          e2[i] = v0[i] - v2[i];
+        }
+
+        // angle at vert[i] is stored in alpha[(i+1)%3]
+        alpha[0] = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e1, e2);
+        alpha[1] = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e2, e0);
+        alpha[2] = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e0, e1);
+
+        // surf. area
+        const double A = double(vtkTriangle::TriangleArea(v0, v1, v2));
+        for (int i = 0; i < 3; ++i)
+        {
+          if (vert[i] == ptId)
+          {
+            dA += A;
+            K -= alpha[(i + 1) % 3];
+          }
+        }
+      }
+
+      // put curvature in vtkArray
+      if (dA > 0.0)
+      {
+        this->GaussCurvature[ptId] = 3.0 * K / dA;
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+// Compute the principal curvature k = H +/- sqrt(H^2 - K) from the Gauss and
+// mean curvatures. Points with a large computation error are counted.
+struct PrincipalCurvature
+{
+  vtkCurvatures* Filter;
+  const double* Gauss;
+  const double* Mean;
+  double* Principal;
+  double Sign;
+  vtkSMPThreadLocal<vtkIdType> NumberOfErrors;
+  vtkSMPThreadLocal<vtkIdType> FirstError;
+
+  PrincipalCurvature(vtkCurvatures* filter, const double* gauss, const double* mean,
+    double* principal, double sign)
+    : Filter(filter)
+    , Gauss(gauss)
+    , Mean(mean)
+    , Principal(principal)
+    , Sign(sign)
+  {
+  }
+
+  void Initialize()
+  {
+    this->NumberOfErrors.Local() = 0;
+    this->FirstError.Local() = VTK_ID_MAX;
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    vtkIdType& numberOfErrors = this->NumberOfErrors.Local();
+    vtkIdType& firstError = this->FirstError.Local();
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    const vtkIdType checkAbortInterval = std::min((endPtId - ptId) / 10 + 1, (vtkIdType)1000);
+
+    for (const vtkIdType beginPtId = ptId; ptId < endPtId; ++ptId)
+    {
+      if ((ptId - beginPtId) % checkAbortInterval == 0)
+      {
+        if (isFirst)
+        {
+          this->Filter->CheckAbort();
+        }
+        if (this->Filter->GetAbortOutput())
+        {
+          break;
+        }
+      }
+
+      const double k = this->Gauss[ptId];
+      const double h = this->Mean[ptId];
+      const double tmp = h * h - k;
+      if (tmp >= 0)
+      {
+        this->Principal[ptId] = h + this->Sign * sqrt(tmp);
+      }
+      else
+      {
+        this->Principal[ptId] = h;
+        if (tmp < -0.1)
+        {
+          ++numberOfErrors;
+          firstError = std::min(firstError, ptId);
+        }
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+} // anonymous namespace
+
 //-------------------------------------------------------//
 vtkCurvatures::vtkCurvatures()
 {
@@ -62,12 +463,9 @@ void vtkCurvatures::GetMeanCurvature(vtkPolyData* mesh)
     return;
   }
 
-  int numPts = polyData->GetNumberOfPoints();
+  vtkIdType numPts = polyData->GetNumberOfPoints();
 
   //     create-allocate
-  const vtkNew<vtkIdList> vertices;
-  const vtkNew<vtkIdList> vertices_n;
-  const vtkNew<vtkIdList> neighbours;
   const vtkNew<vtkDoubleArray> meanCurvature;
   meanCurvature->SetName("Mean_Curvature");
   meanCurvature->SetNumberOfComponents(1);
@@ -75,130 +473,31 @@ void vtkCurvatures::GetMeanCurvature(vtkPolyData* mesh)
   // Get the array so we can write to it directly
   double* meanCurvatureData = meanCurvature->GetPointer(0);
 
-  //     create-allocate
-  double n_f[3]; // normal of facet (could be stored for later?)
-  double n_n[3]; // normal of edge
-  double t[3];   // to store the cross product of n_f n_n
-  double ore[3]; // origin of e
-  double end[3]; // end of e
-  double oth[3]; //     third vertex necessary for comp of n
-  double vn0[3];
-  double vn1[3]; // vertices for computation of neighbour's n
-  double vn2[3];
-  double e[3]; // edge (oriented)
-
   polyData->BuildLinks();
   // data init
-  const int F = polyData->GetNumberOfCells();
-  // init, preallocate the mean curvature
-  const std::unique_ptr<int[]> num_neighb(new int[numPts]);
-  for (int v = 0; v < numPts; v++)
+  const vtkIdType F = polyData->GetNumberOfCells();
+  std::vector<vtkIdType> offsets(F + 1);
+  offsets[0] = 0;
+  for (vtkIdType f = 0; f < F; ++f)
   {
-    meanCurvatureData[v] = 0.0;
-    num_neighb[v] = 0;
+    offsets[f + 1] = offsets[f] + polyData->GetCellSize(f);
   }
 
   //     main loop
   vtkDebugMacro(<< "Main loop: loop over facets such that id > id of neighb");
   vtkDebugMacro(<< "so that every edge comes only once");
 
-  for (vtkIdType f = 0; f < F; ++f)
-  {
-    if (this->CheckAbort())
-    {
-      break;
-    }
-    polyData->GetCellPoints(f, vertices);
-    const vtkIdType nv = vertices->GetNumberOfIds();
-
-    for (vtkIdType v = 0; v < nv; v++)
-    {
-      // get neighbour
-      const vtkIdType v_l = vertices->GetId(v);
-      const vtkIdType v_r = vertices->GetId((v + 1) % nv);
-      const vtkIdType v_o = vertices->GetId((v + 2) % nv);
-      polyData->GetCellEdgeNeighbors(f, v_l, v_r, neighbours);
-
-      vtkIdType n; // n short for neighbor
-
-      // compute only if there is really ONE neighbour
-      // AND meanCurvature has not been computed yet!
-      // (ensured by n > f)
-      if (neighbours->GetNumberOfIds() == 1 && (n = neighbours->GetId(0)) > f)
-      {
-        double Hf; // temporary store
-
-        // find 3 corners of f: in order!
-        polyData->GetPoint(v_l, ore);
-        polyData->GetPoint(v_r, end);
-        polyData->GetPoint(v_o, oth);
-        // compute normal of f
-        vtkTriangle::ComputeNormal(ore, end, oth, n_f);
-        // compute common edge
-        e[0] = end[0];
-        e[1] = end[1];
-        e[2] = end[2];
-        e[0] -= ore[0];
-        e[1] -= ore[1];
-        e[2] -= ore[2];
-        const double length = vtkMath::Normalize(e);
-        double Af = vtkTriangle::TriangleArea(ore, end, oth);
-        // find 3 corners of n: in order!
-        polyData->GetCellPoints(n, vertices_n);
-        polyData->GetPoint(vertices_n->GetId(0), vn0);
-        polyData->GetPoint(vertices_n->GetId(1), vn1);
-        polyData->GetPoint(vertices_n->GetId(2), vn2);
-        Af += double(vtkTriangle::TriangleArea(vn0, vn1, vn2));
-        // compute normal of n
-        vtkTriangle::ComputeNormal(vn0, vn1, vn2, n_n);
-        // the cosine is n_f * n_n
-        const double cs = vtkMath::Dot(n_f, n_n);
-        // the sin is (n_f x n_n) * e
-        vtkMath::Cross(n_f, n_n, t);
-        const double sn = vtkMath::Dot(t, e);
-        // signed angle in [-pi,pi]
-        if (sn != 0.0 || cs != 0.0)
-        {
-          const double angle = atan2(sn, cs);
-          Hf = length * angle;
-        }
-        else
-        {
-          Hf = 0.0;
-        }
-        // add weighted Hf to scalar at v_l and v_r
-        if (Af != 0.0)
-        {
-          (Hf /= Af) *= 3.0;
-        }
-        meanCurvatureData[v_l] += Hf;
-        meanCurvatureData[v_r] += Hf;
-        num_neighb[v_l] += 1;
-        num_neighb[v_r] += 1;
-      }
-    }
-  }
+  // Evaluate the contribution of each edge, then gather the contributions
+  // of the edges incident to each point.
+  std::vector<double> edgeH(offsets[F]);
+  std::vector<unsigned char> edgeValid(offsets[F], 0);
+  MeanEdgeCurvature edgeCurvature(this, polyData, offsets, edgeH, edgeValid);
+  vtkSMPTools::For(0, F, edgeCurvature);
 
   // put curvature in vtkArray
-  for (int v = 0; v < numPts; v++)
-  {
-    if (num_neighb[v] > 0)
-    {
-      const double Hf = 0.5 * meanCurvatureData[v] / num_neighb[v];
-      if (this->InvertMeanCurvature)
-      {
-        meanCurvatureData[v] = -Hf;
-      }
-      else
-      {
-        meanCurvatureData[v] = Hf;
-      }
-    }
-    else
-    {
-      meanCurvatureData[v] = 0.0;
-    }
-  }
+  MeanPointCurvature pointCurvature(
+    polyData, offsets, edgeH, edgeValid, this->InvertMeanCurvature != 0, meanCurvatureData);
+  vtkSMPTools::For(0, numPts, pointCurvature);
 
   mesh->GetPointData()->AddArray(meanCurvature);
   mesh->GetPointData()->SetActiveScalars("Mean_Curvature");
@@ -261,80 +560,15 @@ void vtkCurvatures::GetGaussCurvature(vtkPolyData* output)
 void vtkCurvatures::ComputeGaussCurvature(
   vtkCellArray* facets, vtkPolyData* output, double* gaussCurvatureData)
 {
-  double v0[3], v1[3], v2[3], e0[3], e1[3], e2[3];
-
-  double A, alpha0, alpha1, alpha2;
-
-  vtkIdType f;
-  const vtkIdType* vert = nullptr;
-
-  // other data
   vtkIdType Nv = output->GetNumberOfPoints();
 
-  const std::unique_ptr<double[]> K(new double[Nv]);
-  const std::unique_ptr<double[]> dA(new double[Nv]);
-  double pi2 = 2.0 * vtkMath::Pi();
-  for (int k = 0; k < Nv; k++)
-  {
-    K[k] = pi2;
-    dA[k] = 0.0;
-  }
-
-  facets->InitTraversal();
-  while (facets->GetNextCell(f, vert))
-  {
-    if (this->CheckAbort())
-    {
-      break;
-    }
-    output->GetPoint(vert[0], v0);
-    output->GetPoint(vert[1], v1);
-    output->GetPoint(vert[2], v2);
-    // edges
-    e0[0] = v1[0];
-    e0[1] = v1[1];
-    e0[2] = v1[2];
-    e0[0] -= v0[0];
-    e0[1] -= v0[1];
-    e0[2] -= v0[2];
-
-    e1[0] = v2[0];
-    e1[1] = v2[1];
-    e1[2] = v2[2];
-    e1[0] -= v1[0];
-    e1[1] -= v1[1];
-    e1[2] -= v1[2];
-
-    e2[0] = v0[0];
-    e2[1] = v0[1];
-    e2[2] = v0[2];
-    e2[0] -= v2[0];
-    e2[1] -= v2[1];
-    e2[2] -= v2[2];
-
-    alpha0 = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e1, e2);
-    alpha1 = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e2, e0);
-    alpha2 = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e0, e1);
-
-    // surf. area
-    A = double(vtkTriangle::TriangleArea(v0, v1, v2));
-    // UPDATE
-    dA[vert[0]] += A;
-    dA[vert[1]] += A;
-    dA[vert[2]] += A;
-    K[vert[0]] -= alpha1;
-    K[vert[1]] -= alpha2;
-    K[vert[2]] -= alpha0;
-  }
+  // Build the facets using each point, then accumulate the contributions of
+  // these facets at each point.
+  vtkStaticCellLinksTemplate<vtkIdType> links;
+  links.ThreadedBuildLinks(Nv, facets->GetNumberOfCells(), facets);
 
-  // put curvature in vtkArray
-  for (int v = 0; v < Nv; v++)
-  {
-    if (dA[v] > 0.0)
-    {
-      gaussCurvatureData[v] = 3.0 * K[v] / dA[v];
-    }
-  }
+  GaussPointCurvature pointCurvature(this, facets, output, links, gaussCurvatureData);
+  vtkSMPTools::For(0, Nv, pointCurvature);
 }
 
 void vtkCurvatures::GetMaximumCurvature(vtkPolyData* input, vtkPolyData* output)
@@ -355,33 +589,26 @@ void vtkCurvatures::GetMaximumCurvature(vtkPolyData* input, vtkPolyData* output)
     static_cast<vtkDoubleArray*>(output->GetPointData()->GetArray("Gauss_Curvature"));
   vtkDoubleArray* mean =
     static_cast<vtkDoubleArray*>(output->GetPointData()->GetArray("Mean_Curvature"));
-  double k, h, k_max, tmp;
 
-  for (vtkIdType i = 0; i < numPts; i++)
-  {
-    if (this->CheckAbort())
-    {
-      break;
-    }
+  PrincipalCurvature principal(this, gauss->GetPointer(0), mean->GetPointer(0),
+    maximumCurvature->GetPointer(0), 1.0);
+  vtkSMPTools::For(0, numPts, principal);
 
-    k = gauss->GetComponent(i, 0);
-    h = mean->GetComponent(i, 0);
-    tmp = h * h - k;
-    if (tmp >= 0)
-    {
-      k_max = h + sqrt(tmp);
-    }
-    else
-    {
-      k_max = h;
-      if (tmp < -0.1)
-      {
-        vtkWarningMacro(
-          << "The Gaussian or mean curvature at point " << i
-          << " have a large computation error... The maximum curvature is likely off.");
-      }
-    }
-    maximumCurvature->SetComponent(i, 0, k_max);
+  vtkIdType numberOfErrors = 0;
+  vtkIdType firstError = VTK_ID_MAX;
+  for (vtkIdType threadErrors : principal.NumberOfErrors)
+  {
+    numberOfErrors += threadErrors;
+  }
+  for (vtkIdType threadFirstError : principal.FirstError)
+  {
+    firstError = std::min(firstError, threadFirstError);
+  }
+  if (numberOfErrors > 0)
+  {
+    vtkWarningMacro(<< "The Gaussian or mean curvature at " << numberOfErrors
+                    << " point(s) (first: " << firstError
+                    << ") have a large computation error... The maximum curvature is likely off.");
   }
 }
 
@@ -403,33 +630,26 @@ void vtkCurvatures::GetMinimumCurvature(vtkPolyData* input, vtkPolyData* output)
     static_cast<vtkDoubleArray*>(output->GetPointData()->GetArray("Gauss_Curvature"));
   vtkDoubleArray* mean =
     static_cast<vtkDoubleArray*>(output->GetPointData()->GetArray("Mean_Curvature"));
-  double k, h, k_min, tmp;
 
-  for (vtkIdType i = 0; i < numPts; i++)
-  {
-    if (this->CheckAbort())
-    {
-      break;
-    }
+  PrincipalCurvature principal(this, gauss->GetPointer(0), mean->GetPointer(0),
+    minimumCurvature->GetPointer(0), -1.0);
+  vtkSMPTools::For(0, numPts, principal);
 
-    k = gauss->GetComponent(i, 0);
-    h = mean->GetComponent(i, 0);
-    tmp = h * h - k;
-    if (tmp >= 0)
-    {
-      k_min = h - sqrt(tmp);
-    }
-    else
-    {
-      k_min = h;
-      if (tmp < -0.1)
-      {
-        vtkWarningMacro(
-          << "The Gaussian or mean curvature at point " << i
-          << " have a large computation error... The minimum curvature is likely off.");
-      }
-    }
-    minimumCurvature->SetComponent(i, 0, k_min);
+  vtkIdType numberOfErrors = 0;
+  vtkIdType firstError = VTK_ID_MAX;
+  for (vtkIdType threadErrors : principal.NumberOfErrors)
+  {
+    numberOfErrors += threadErrors;
+  }
+  for (vtkIdType threadFirstError : principal.FirstError)
+  {
+    firstError = std::min(firstError, threadFirstError);
+  }
+  if (numberOfErrors > 0)
+  {
+    vtkWarningMacro(<< "The Gaussian or mean curvature at " << numberOfErrors
+                    << " point(s) (first: " << firstError
+                    << ") have a large computation error... The minimum curvature is likely off.");
   }
 }
 
@@ -41,10 +41,18 @@
  *  can be set and the Curvature reported by the Mean calculation will
  * be inverted.
  *
+ * The contributions of the facets and edges are gathered at each point in
+ * parallel, using the point to cell links of the mesh.
+ *
  * For a little more information see
  * <a href="https://public.kitware.com/pipermail/vtkusers/2002-July/012198.html"
  * >Computing curvature of a surface</a>
  *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
  * @par Thanks:
  * <a href="https://en.wikipedia.org/wiki/Philip_Batchelor">Philip Batchelor</a>
  * for creating and contributing the class and Andrew Maclean for cleanups and
@@ -20,6 +20,8 @@
 #include "vtkPoints.h"
 #include "vtkPolyDataNormals.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkSortDataArray.h"
 #include "vtkTransform.h"
@@ -28,8 +30,12 @@
 #include "vtkTriangleFilter.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <list>
 #include <map>
+#include <set>
+#include <utility>
+#include <vector>
 
 //------------------------------------------------------------------------------
 // Helper typedefs and data structures.
@@ -64,6 +70,17 @@ typedef struct
 typedef std::multimap<vtkIdType, CellEdgeLineType> PointEdgeMapType;
 typedef PointEdgeMapType::iterator PointEdgeMapIteratorType;
 
+typedef std::pair<vtkOBBNode*, vtkOBBNode*> NodePairType;
+
+typedef struct
+{
+  vtkIdType CellId0;
+  vtkIdType CellId1;
+  double Pt0[3];
+  double Pt1[3];
+  double SurfaceId[2];
+} TriangleIntersectionType;
+
 //------------------------------------------------------------------------------
 // Private implementation to hide STL.
 //------------------------------------------------------------------------------
@@ -73,14 +90,22 @@ public:
   Impl();
   virtual ~Impl();
 
-  // Finds all triangle triangle intersections between two input OOBTrees
-  static int FindTriangleIntersections(
+  // Collects the pairs of intersecting leaf nodes of the two input OBBTrees
+  static int CollectNodePairs(
     vtkOBBNode* node0, vtkOBBNode* node1, vtkMatrix4x4* transform, void* arg);
 
+  // Finds all triangle triangle intersections between the collected leaf
+  // node pairs. The intersections are computed in parallel, then added to
+  // the intersection lines in the order of the OBBTree traversal.
+  void FindTriangleIntersections();
+
   // Runs the split mesh for the designated input surface
   int SplitMesh(int inputIndex, vtkPolyData* output, vtkPolyData* intersectionLines);
 
 protected:
+  // Adds a triangle triangle intersection to the intersection lines and maps
+  void AddIntersection(const TriangleIntersectionType& intersection);
+
   // Split cells into polygons created by intersection lines
   vtkCellArray* SplitCell(vtkPolyData* input, vtkIdType cellId, const vtkIdType* cellPts,
     IntersectionMapType* map, vtkPolyData* interLines, int inputIndex, int numCurrCells);
@@ -158,6 +183,13 @@ public:
   // cell, and the ID of the line.
   PointEdgeMapType* PointEdgeMap[2];
 
+  // Pairs of intersecting leaf nodes, in OBBTree traversal order.
+  std::vector<NodePairType> NodePairs;
+
+  // Point ids of the intersection lines, smallest first. Used to detect
+  // duplicate lines.
+  std::set<std::pair<vtkIdType, vtkIdType>> LineSet;
+
   // vtkPolyData to hold current splitting cell. Used to double check area
   // of small area cells
   vtkPolyData* SplittingPD;
@@ -209,246 +241,338 @@ vtkIntersectionPolyDataFilter::Impl::~Impl()
 }
 
 //------------------------------------------------------------------------------
-int vtkIntersectionPolyDataFilter::Impl ::FindTriangleIntersections(
-  vtkOBBNode* node0, vtkOBBNode* node1, vtkMatrix4x4* transform, void* arg)
+int vtkIntersectionPolyDataFilter::Impl ::CollectNodePairs(
+  vtkOBBNode* node0, vtkOBBNode* node1, vtkMatrix4x4* vtkNotUsed(transform), void* arg)
 {
   vtkIntersectionPolyDataFilter::Impl* info =
     reinterpret_cast<vtkIntersectionPolyDataFilter::Impl*>(arg);
+  info->NodePairs.emplace_back(node0, node1);
+  return 1;
+}
 
-  // Set up local structures to hold Impl array information
-  vtkPolyData* mesh0 = info->Mesh[0];
-  vtkPolyData* mesh1 = info->Mesh[1];
-  vtkOBBTree* obbTree1 = info->OBBTree1;
-  vtkCellArray* intersectionLines = info->IntersectionLines;
-  vtkIdTypeArray* intersectionSurfaceId = info->SurfaceId;
-  vtkIdTypeArray* intersectionCellIds0 = info->CellIds[0];
-  vtkIdTypeArray* intersectionCellIds1 = info->CellIds[1];
-  vtkPointLocator* pointMerger = info->PointMerger;
-  double tolerance = info->Tolerance;
-
-  // The number of cells in OBBTree
-  int numCells0 = node0->Cells->GetNumberOfIds();
-
-  for (vtkIdType id0 = 0; id0 < numCells0; id0++)
-  {
-    vtkIdType cellId0 = node0->Cells->GetId(id0);
-    int type0 = mesh0->GetCellType(cellId0);
-
-    // Make sure the cell is a triangle
-    if (type0 == VTK_TRIANGLE)
-    {
-      vtkIdType npts0;
-      const vtkIdType* triPtIds0;
-      mesh0->GetCellPoints(cellId0, npts0, triPtIds0);
-      double triPts0[3][3];
-      for (vtkIdType id = 0; id < npts0; id++)
+//------------------------------------------------------------------------------
+namespace
+{
+// Computes the triangle triangle intersections of each pair of leaf nodes.
+// The intersections of each pair are stored separately so that they can be
+// added to the output in traversal order.
+struct FindTriangleIntersectionsWorker
+{
+  vtkPolyData* Mesh0;
+  vtkPolyData* Mesh1;
+  vtkOBBTree* OBBTree1;
+  double Tolerance;
+  vtkIntersectionPolyDataFilter* Filter;
+  const std::vector<NodePairType>& NodePairs;
+  std::vector<std::vector<TriangleIntersectionType>>& Intersections;
+  vtkSMPThreadLocalObject<vtkIdList> PtIds;
+
+  FindTriangleIntersectionsWorker(vtkPolyData* mesh0, vtkPolyData* mesh1, vtkOBBTree* obbTree1,
+    double tolerance, vtkIntersectionPolyDataFilter* filter,
+    const std::vector<NodePairType>& nodePairs,
+    std::vector<std::vector<TriangleIntersectionType>>& intersections)
+    : Mesh0(mesh0)
+    , Mesh1(mesh1)
+    , OBBTree1(obbTree1)
+    , Tolerance(tolerance)
+    , Filter(filter)
+    , NodePairs(nodePairs)
+    , Intersections(intersections)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType pairId, vtkIdType endPairId)
+  {
+    vtkIdList* ptIds = this->PtIds.Local();
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    TriangleIntersectionType intersection;
+
+    for (; pairId < endPairId; ++pairId)
+    {
+      if (isFirst)
+      {
+        this->Filter->CheckAbort();
+      }
+      if (this->Filter->GetAbortOutput())
       {
-        mesh0->GetPoint(triPtIds0[id], triPts0[id]);
+        break;
       }
 
-      if (obbTree1->TriangleIntersectsNode(node1, triPts0[0], triPts0[1], triPts0[2], transform))
+      vtkOBBNode* node0 = this->NodePairs[pairId].first;
+      vtkOBBNode* node1 = this->NodePairs[pairId].second;
+      std::vector<TriangleIntersectionType>& intersections = this->Intersections[pairId];
+
+      // The number of cells in OBBTree
+      vtkIdType numCells0 = node0->Cells->GetNumberOfIds();
+      for (vtkIdType id0 = 0; id0 < numCells0; id0++)
       {
-        int numCells1 = node1->Cells->GetNumberOfIds();
+        vtkIdType cellId0 = node0->Cells->GetId(id0);
+
+        // Make sure the cell is a triangle
+        if (this->Mesh0->GetCellType(cellId0) != VTK_TRIANGLE)
+        {
+          continue;
+        }
+        vtkIdType npts0;
+        const vtkIdType* triPtIds0;
+        this->Mesh0->GetCellPoints(cellId0, npts0, triPtIds0, ptIds);
+        double triPts0[3][3];
+        for (vtkIdType id = 0; id < npts0; id++)
+        {
+          this->Mesh0->GetPoint(triPtIds0[id], triPts0[id]);
+        }
+
+        if (!this->OBBTree1->TriangleIntersectsNode(
+              node1, triPts0[0], triPts0[1], triPts0[2], nullptr))
+        {
+          continue;
+        }
+
+        vtkIdType numCells1 = node1->Cells->GetNumberOfIds();
         for (vtkIdType id1 = 0; id1 < numCells1; id1++)
         {
           vtkIdType cellId1 = node1->Cells->GetId(id1);
-          int type1 = mesh1->GetCellType(cellId1);
-          if (type1 == VTK_TRIANGLE)
+          if (this->Mesh1->GetCellType(cellId1) != VTK_TRIANGLE)
           {
-            // See if the two cells actually intersect. If they do,
-            // add an entry into the intersection maps and add an
-            // intersection line.
-            vtkIdType npts1;
-            const vtkIdType* triPtIds1;
-            mesh1->GetCellPoints(cellId1, npts1, triPtIds1);
-
-            double triPts1[3][3];
-            for (vtkIdType id = 0; id < npts1; id++)
-            {
-              mesh1->GetPoint(triPtIds1[id], triPts1[id]);
-            }
+            continue;
+          }
+          vtkIdType npts1;
+          const vtkIdType* triPtIds1;
+          this->Mesh1->GetCellPoints(cellId1, npts1, triPtIds1, ptIds);
+          double triPts1[3][3];
+          for (vtkIdType id = 0; id < npts1; id++)
+          {
+            this->Mesh1->GetPoint(triPtIds1[id], triPts1[id]);
+          }
 
-            int coplanar = 0;
-            double outpt0[3], outpt1[3];
-            double surfaceid[2];
-            int intersects = vtkIntersectionPolyDataFilter::TriangleTriangleIntersection(triPts0[0],
-              triPts0[1], triPts0[2], triPts1[0], triPts1[1], triPts1[2], coplanar, outpt0, outpt1,
-              surfaceid, tolerance);
+          // See if the two cells actually intersect.
+          int coplanar = 0;
+          int intersects = vtkIntersectionPolyDataFilter::TriangleTriangleIntersection(triPts0[0],
+            triPts0[1], triPts0[2], triPts1[0], triPts1[1], triPts1[2], coplanar,
+            intersection.Pt0, intersection.Pt1, intersection.SurfaceId, this->Tolerance);
 
-            if (coplanar)
-            {
-              // Coplanar triangle intersection is not handled.
-              // This intersection will not be included in the output. TODO
-              // vtkDebugMacro(<<"Coplanar");
-              intersects = 0;
-              continue;
-            }
+          // Coplanar triangle intersection is not handled.
+          // This intersection will not be included in the output. TODO
+          if (intersects && !coplanar)
+          {
+            intersection.CellId0 = cellId0;
+            intersection.CellId1 = cellId1;
+            intersections.push_back(intersection);
+          }
+        }
+      }
+    }
+  }
 
-            // If actual intersection, add point and cell to edge, line,
-            // and surface maps!
-            if (intersects)
-            {
-              vtkIdType lineId = intersectionLines->GetNumberOfCells();
+  void Reduce() {}
+};
+}
 
-              vtkIdType ptId0, ptId1;
-              int unique[2];
-              unique[0] = pointMerger->InsertUniquePoint(outpt0, ptId0);
-              unique[1] = pointMerger->InsertUniquePoint(outpt1, ptId1);
+//------------------------------------------------------------------------------
+void vtkIntersectionPolyDataFilter::Impl::FindTriangleIntersections()
+{
+  // Make sure the cells can be accessed from several threads.
+  for (int i = 0; i < 2; i++)
+  {
+    if (this->Mesh[i]->NeedToBuildCells())
+    {
+      this->Mesh[i]->BuildCells();
+    }
+  }
 
-              int addline = 1;
-              if (ptId0 == ptId1)
-              {
-                addline = 0;
-              }
+  std::vector<std::vector<TriangleIntersectionType>> intersections(this->NodePairs.size());
+  FindTriangleIntersectionsWorker worker(this->Mesh[0], this->Mesh[1], this->OBBTree1,
+    this->Tolerance, this->ParentFilter, this->NodePairs, intersections);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(this->NodePairs.size()), worker);
 
-              if (ptId0 == ptId1 && surfaceid[0] != surfaceid[1])
-              {
-                intersectionSurfaceId->InsertValue(ptId0, 3);
-              }
-              else
-              {
-                if (unique[0])
-                {
-                  intersectionSurfaceId->InsertValue(ptId0, surfaceid[0]);
-                }
-                else
-                {
-                  if (intersectionSurfaceId->GetValue(ptId0) != 3)
-                  {
-                    intersectionSurfaceId->InsertValue(ptId0, surfaceid[0]);
-                  }
-                }
-                if (unique[1])
-                {
-                  intersectionSurfaceId->InsertValue(ptId1, surfaceid[1]);
-                }
-                else
-                {
-                  if (intersectionSurfaceId->GetValue(ptId1) != 3)
-                  {
-                    intersectionSurfaceId->InsertValue(ptId1, surfaceid[1]);
-                  }
-                }
-              }
+  for (const auto& pairIntersections : intersections)
+  {
+    for (const auto& intersection : pairIntersections)
+    {
+      this->AddIntersection(intersection);
+    }
+  }
+}
 
-              info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
-              info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
-              info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
-              info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+//------------------------------------------------------------------------------
+void vtkIntersectionPolyDataFilter::Impl::AddIntersection(
+  const TriangleIntersectionType& intersection)
+{
+  // Set up local structures to hold Impl array information
+  vtkPolyData* mesh0 = this->Mesh[0];
+  vtkPolyData* mesh1 = this->Mesh[1];
+  vtkCellArray* intersectionLines = this->IntersectionLines;
+  vtkIdTypeArray* intersectionSurfaceId = this->SurfaceId;
+  vtkIdTypeArray* intersectionCellIds0 = this->CellIds[0];
+  vtkIdTypeArray* intersectionCellIds1 = this->CellIds[1];
+  vtkPointLocator* pointMerger = this->PointMerger;
+
+  vtkIdType cellId0 = intersection.CellId0;
+  vtkIdType cellId1 = intersection.CellId1;
+  double outpt0[3] = { intersection.Pt0[0], intersection.Pt0[1], intersection.Pt0[2] };
+  double outpt1[3] = { intersection.Pt1[0], intersection.Pt1[1], intersection.Pt1[2] };
+  const double* surfaceid = intersection.SurfaceId;
 
-              // Check to see if duplicate line. Line can only be a duplicate
-              // line if both points are not unique and they don't
-              // equal each other
-              if (!unique[0] && !unique[1] && ptId0 != ptId1)
-              {
-                vtkSmartPointer<vtkPolyData> lineTest = vtkSmartPointer<vtkPolyData>::New();
-                lineTest->SetPoints(pointMerger->GetPoints());
-                lineTest->SetLines(intersectionLines);
-                lineTest->BuildLinks();
-                int newLine = info->CheckLine(lineTest, ptId0, ptId1);
-                if (newLine == 0)
-                {
-                  addline = 0;
-                }
-              }
-              if (addline)
-              {
-                // If the line is new and does not consist of two identical
-                // points, add the line to the intersection and update
-                // mapping information
-                intersectionLines->InsertNextCell(2);
-                intersectionLines->InsertCellPoint(ptId0);
-                intersectionLines->InsertCellPoint(ptId1);
-
-                intersectionCellIds0->InsertNextValue(cellId0);
-                intersectionCellIds1->InsertNextValue(cellId1);
-
-                info->PointCellIds[0]->InsertValue(ptId0, cellId0);
-                info->PointCellIds[0]->InsertValue(ptId1, cellId0);
-                info->PointCellIds[1]->InsertValue(ptId0, cellId1);
-                info->PointCellIds[1]->InsertValue(ptId1, cellId1);
-
-                info->IntersectionMap[0]->insert(std::make_pair(cellId0, lineId));
-                info->IntersectionMap[1]->insert(std::make_pair(cellId1, lineId));
-
-                // Check which edges of cellId0 and cellId1 outpt0 and
-                // outpt1 are on, if any.
-                int isOnEdge = 0;
-                int m0p0 = 0, m0p1 = 0, m1p0 = 0, m1p1 = 0;
-                for (vtkIdType edgeId = 0; edgeId < 3; edgeId++)
-                {
-                  isOnEdge = info->AddToPointEdgeMap(
-                    0, ptId0, outpt0, mesh0, cellId0, edgeId, lineId, triPtIds0);
-                  if (isOnEdge != -1)
-                  {
-                    m0p0++;
-                  }
-                  isOnEdge = info->AddToPointEdgeMap(
-                    0, ptId1, outpt1, mesh0, cellId0, edgeId, lineId, triPtIds0);
-                  if (isOnEdge != -1)
-                  {
-                    m0p1++;
-                  }
-                  isOnEdge = info->AddToPointEdgeMap(
-                    1, ptId0, outpt0, mesh1, cellId1, edgeId, lineId, triPtIds1);
-                  if (isOnEdge != -1)
-                  {
-                    m1p0++;
-                  }
-                  isOnEdge = info->AddToPointEdgeMap(
-                    1, ptId1, outpt1, mesh1, cellId1, edgeId, lineId, triPtIds1);
-                  if (isOnEdge != -1)
-                  {
-                    m1p1++;
-                  }
-                }
-                // Special cases caught by tolerance and not from the Point
-                // Merger
-                if (m0p0 > 0 && m1p0 > 0)
-                {
-                  intersectionSurfaceId->InsertValue(ptId0, 3);
-                }
-                if (m0p1 > 0 && m1p1 > 0)
-                {
-                  intersectionSurfaceId->InsertValue(ptId1, 3);
-                }
-              }
-              // Add information about origin surface to std::maps for
-              // checks later
-              if (intersectionSurfaceId->GetValue(ptId0) == 1)
-              {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
-              }
-              else if (intersectionSurfaceId->GetValue(ptId0) == 2)
-              {
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
-              }
-              else
-              {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
-              }
-              if (intersectionSurfaceId->GetValue(ptId1) == 1)
-              {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
-              }
-              else if (intersectionSurfaceId->GetValue(ptId1) == 2)
-              {
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
-              }
-              else
-              {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
-              }
-            }
-          }
-        }
+  vtkIdType npts;
+  const vtkIdType* cellPts;
+  mesh0->GetCellPoints(cellId0, npts, cellPts);
+  const vtkIdType triPtIds0[3] = { cellPts[0], cellPts[1], cellPts[2] };
+  mesh1->GetCellPoints(cellId1, npts, cellPts);
+  const vtkIdType triPtIds1[3] = { cellPts[0], cellPts[1], cellPts[2] };
+
+  // Add point and cell to edge, line, and surface maps!
+  vtkIdType lineId = intersectionLines->GetNumberOfCells();
+
+  vtkIdType ptId0, ptId1;
+  int unique[2];
+  unique[0] = pointMerger->InsertUniquePoint(outpt0, ptId0);
+  unique[1] = pointMerger->InsertUniquePoint(outpt1, ptId1);
+
+  int addline = 1;
+  if (ptId0 == ptId1)
+  {
+    addline = 0;
+  }
+
+  if (ptId0 == ptId1 && surfaceid[0] != surfaceid[1])
+  {
+    intersectionSurfaceId->InsertValue(ptId0, 3);
+  }
+  else
+  {
+    if (unique[0])
+    {
+      intersectionSurfaceId->InsertValue(ptId0, surfaceid[0]);
+    }
+    else
+    {
+      if (intersectionSurfaceId->GetValue(ptId0) != 3)
+      {
+        intersectionSurfaceId->InsertValue(ptId0, surfaceid[0]);
+      }
+    }
+    if (unique[1])
+    {
+      intersectionSurfaceId->InsertValue(ptId1, surfaceid[1]);
+    }
+    else
+    {
+      if (intersectionSurfaceId->GetValue(ptId1) != 3)
+      {
+        intersectionSurfaceId->InsertValue(ptId1, surfaceid[1]);
       }
     }
   }
 
-  return 1;
+  this->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
+  this->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
+  this->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
+  this->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+
+  // Check to see if duplicate line. Line can only be a duplicate
+  // line if both points are not unique and they don't
+  // equal each other
+  std::pair<vtkIdType, vtkIdType> lineKey = std::minmax(ptId0, ptId1);
+  if (!unique[0] && !unique[1] && ptId0 != ptId1)
+  {
+    if (this->LineSet.find(lineKey) != this->LineSet.end())
+    {
+      addline = 0;
+    }
+  }
+  if (addline)
+  {
+    // If the line is new and does not consist of two identical
+    // points, add the line to the intersection and update
+    // mapping information
+    this->LineSet.insert(lineKey);
+    intersectionLines->InsertNextCell(2);
+    intersectionLines->InsertCellPoint(ptId0);
+    intersectionLines->InsertCellPoint(ptId1);
+
+    intersectionCellIds0->InsertNextValue(cellId0);
+    intersectionCellIds1->InsertNextValue(cellId1);
+
+    this->PointCellIds[0]->InsertValue(ptId0, cellId0);
+    this->PointCellIds[0]->InsertValue(ptId1, cellId0);
+    this->PointCellIds[1]->InsertValue(ptId0, cellId1);
+    this->PointCellIds[1]->InsertValue(ptId1, cellId1);
+
+    this->IntersectionMap[0]->insert(std::make_pair(cellId0, lineId));
+    this->IntersectionMap[1]->insert(std::make_pair(cellId1, lineId));
+
+    // Check which edges of cellId0 and cellId1 outpt0 and
+    // outpt1 are on, if any.
+    int isOnEdge = 0;
+    int m0p0 = 0, m0p1 = 0, m1p0 = 0, m1p1 = 0;
+    for (vtkIdType edgeId = 0; edgeId < 3; edgeId++)
+    {
+      isOnEdge = this->AddToPointEdgeMap(
+        0, ptId0, outpt0, mesh0, cellId0, edgeId, lineId, triPtIds0);
+      if (isOnEdge != -1)
+      {
+        m0p0++;
+      }
+      isOnEdge = this->AddToPointEdgeMap(
+        0, ptId1, outpt1, mesh0, cellId0, edgeId, lineId, triPtIds0);
+      if (isOnEdge != -1)
+      {
+        m0p1++;
+      }
+      isOnEdge = this->AddToPointEdgeMap(
+        1, ptId0, outpt0, mesh1, cellId1, edgeId, lineId, triPtIds1);
+      if (isOnEdge != -1)
+      {
+        m1p0++;
+      }
+      isOnEdge = this->AddToPointEdgeMap(
+        1, ptId1, outpt1, mesh1, cellId1, edgeId, lineId, triPtIds1);
+      if (isOnEdge != -1)
+      {
+        m1p1++;
+      }
+    }
+    // Special cases caught by tolerance and not from the Point
+    // Merger
+    if (m0p0 > 0 && m1p0 > 0)
+    {
+      intersectionSurfaceId->InsertValue(ptId0, 3);
+    }
+    if (m0p1 > 0 && m1p1 > 0)
+    {
+      intersectionSurfaceId->InsertValue(ptId1, 3);
+    }
+  }
+  // Add information about origin surface to std::maps for
+  // checks later
+  if (intersectionSurfaceId->GetValue(ptId0) == 1)
+  {
+    this->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
+  }
+  else if (intersectionSurfaceId->GetValue(ptId0) == 2)
+  {
+    this->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
+  }
+  else
+  {
+    this->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
+    this->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
+  }
+  if (intersectionSurfaceId->GetValue(ptId1) == 1)
+  {
+    this->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
+  }
+  else if (intersectionSurfaceId->GetValue(ptId1) == 2)
+  {
+    this->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+  }
+  else
+  {
+    this->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
+    this->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -2371,7 +2495,8 @@ int vtkIntersectionPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(reques
 
   // This performs the triangle intersection search
   obbTree0->IntersectWithOBBTree(
-    obbTree1, nullptr, vtkIntersectionPolyDataFilter::Impl::FindTriangleIntersections, impl);
+    obbTree1, nullptr, vtkIntersectionPolyDataFilter::Impl::CollectNodePairs, impl);
+  impl->FindTriangleIntersections();
 
   int rawLines = outputIntersection->GetNumberOfLines();
 
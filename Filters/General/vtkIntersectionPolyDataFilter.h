@@ -42,10 +42,20 @@
  * indicating if the cell has any free edges. A watertight surface will have
  * 0 everywhere for this array!
  *
+ * The pairs of intersecting leaf nodes of the OBB trees of both inputs are
+ * gathered first, and the triangles of these pairs are then tested for
+ * intersection in parallel. The intersection lines are added in the same
+ * order regardless of the number of threads.
+ *
  * @author Adam Updegrove updega2@gmail.com
  *
  * @warning This filter is not designed to perform 2D boolean operations,
  * and in fact relies on the inputs having no co-planar, overlapping cells.
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
  */
 
 #ifndef vtkIntersectionPolyDataFilter_h
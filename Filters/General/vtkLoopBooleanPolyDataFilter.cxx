@@ -22,9 +22,10 @@
 #include "vtkMergeCells.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
-#include "vtkPointLocator.h"
 #include "vtkPolyDataNormals.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticPointLocator.h"
 #include "vtkTransform.h"
 #include "vtkTransformPolyDataFilter.h"
 #include "vtkTriangle.h"
@@ -34,6 +35,7 @@
 #include <list>
 #include <sstream>
 #include <string>
+#include <vector>
 
 //------------------------------------------------------------------------------
 // Helper typedefs and data structures.
@@ -691,49 +693,50 @@ void vtkLoopBooleanPolyDataFilter::Impl::ResetCheckArrays()
 // Set the boundary arrays on the mesh
 void vtkLoopBooleanPolyDataFilter::Impl::SetBoundaryArrays()
 {
-  // Variables used in the function
-  // Point locator to find points on mesh that are the points on the boundary
+  // Point locators to find points on mesh that are the points on the boundary
   // lines
-  vtkSmartPointer<vtkPointLocator> pointLocator1 = vtkSmartPointer<vtkPointLocator>::New();
-  vtkSmartPointer<vtkPointLocator> pointLocator2 = vtkSmartPointer<vtkPointLocator>::New();
+  vtkSmartPointer<vtkStaticPointLocator> pointLocator1 =
+    vtkSmartPointer<vtkStaticPointLocator>::New();
+  vtkSmartPointer<vtkStaticPointLocator> pointLocator2 =
+    vtkSmartPointer<vtkStaticPointLocator>::New();
   pointLocator1->SetDataSet(this->Mesh[0]);
   pointLocator1->BuildLocator();
   pointLocator2->SetDataSet(this->Mesh[1]);
   pointLocator2->BuildLocator();
 
-  int numPoints = this->IntersectionLines->GetNumberOfPoints();
+  vtkIdType numPoints = this->IntersectionLines->GetNumberOfPoints();
 
-  for (vtkIdType pointId = 0; pointId < numPoints; pointId++)
-  {
+  // Find the points on each mesh in parallel
+  std::vector<vtkIdType> boundaryPts[2];
+  boundaryPts[0].resize(numPoints);
+  boundaryPts[1].resize(numPoints);
+  vtkSMPTools::For(0, numPoints, [&](vtkIdType pointId, vtkIdType endPointId) {
     double pt[3];
-    this->IntersectionLines->GetPoint(pointId, pt);
-    // Find point on mesh
-    vtkIdType bp1 = pointLocator1->FindClosestPoint(pt);
-    this->PointMapper[0][bp1] = pointId;
-    this->ReversePointMapper[0][pointId] = bp1;
-    this->BoundaryPointArray[0]->InsertValue(bp1, 1);
-    vtkSmartPointer<vtkIdList> bpCellIds1 = vtkSmartPointer<vtkIdList>::New();
-    this->Mesh[0]->GetPointCells(bp1, bpCellIds1);
-    // Set the point mapping array
-    // Assign each cell attached to this point as a boundary cell
-    for (int i = 0; i < bpCellIds1->GetNumberOfIds(); i++)
+    for (; pointId < endPointId; ++pointId)
     {
-      this->BoundaryCellArray[0]->InsertValue(bpCellIds1->GetId(i), 1);
-      this->Checked[0][bpCellIds1->GetId(i)] = 1;
+      this->IntersectionLines->GetPoint(pointId, pt);
+      boundaryPts[0][pointId] = pointLocator1->FindClosestPoint(pt);
+      boundaryPts[1][pointId] = pointLocator2->FindClosestPoint(pt);
     }
+  });
 
-    vtkIdType bp2 = pointLocator2->FindClosestPoint(pt);
-    this->PointMapper[1][bp2] = pointId;
-    this->ReversePointMapper[1][pointId] = bp2;
-    this->BoundaryPointArray[1]->InsertValue(bp2, 1);
-    vtkSmartPointer<vtkIdList> bpCellIds2 = vtkSmartPointer<vtkIdList>::New();
-    this->Mesh[1]->GetPointCells(bp2, bpCellIds2);
-    // Set the point mapping array
-    // Assign each cell attached to this point as a boundary cell
-    for (int i = 0; i < bpCellIds2->GetNumberOfIds(); i++)
+  vtkSmartPointer<vtkIdList> bpCellIds = vtkSmartPointer<vtkIdList>::New();
+  for (vtkIdType pointId = 0; pointId < numPoints; pointId++)
+  {
+    for (int j = 0; j < 2; j++)
     {
-      this->BoundaryCellArray[1]->InsertValue(bpCellIds2->GetId(i), 1);
-      this->Checked[1][bpCellIds2->GetId(i)] = 1;
+      vtkIdType bp = boundaryPts[j][pointId];
+      // Set the point mapping array
+      this->PointMapper[j][bp] = pointId;
+      this->ReversePointMapper[j][pointId] = bp;
+      this->BoundaryPointArray[j]->InsertValue(bp, 1);
+      // Assign each cell attached to this point as a boundary cell
+      this->Mesh[j]->GetPointCells(bp, bpCellIds);
+      for (vtkIdType i = 0; i < bpCellIds->GetNumberOfIds(); i++)
+      {
+        this->BoundaryCellArray[j]->InsertValue(bpCellIds->GetId(i), 1);
+        this->Checked[j][bpCellIds->GetId(i)] = 1;
+      }
     }
   }
 }
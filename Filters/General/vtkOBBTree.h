@@ -163,6 +163,13 @@ public:
   int TriangleIntersectsNode(
     vtkOBBNode* pA, double p0[3], double p1[3], double p2[3], vtkMatrix4x4* XformBtoA);
 
+  /**
+   * Return the root node of the tree, or nullptr if the tree has not been
+   * built. Together with DisjointOBBNodes(), this allows traversing the
+   * subtrees of two trees concurrently.
+   */
+  vtkOBBNode* GetRoot() { return this->Tree; }
+
   /**
    * For each intersecting leaf node pair, call function.
    * OBBTreeB is optionally transformed by XformBtoA before testing.
@@ -0,0 +1,252 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the contacts found by vtkCollisionDetectionFilter match the
+// serial vtkOBBTree::IntersectWithOBBTree() traversal and do not depend on the
+// number of threads, and that reusing the OBB trees between frames gives the
+// same contacts as rebuilding them.
+
+#include "vtkCollisionDetectionFilter.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMatrix4x4.h"
+#include "vtkNew.h"
+#include "vtkOBBTree.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSphereSource.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+void SetUpFilter(vtkCollisionDetectionFilter* collide, vtkSphereSource* sphere0,
+  vtkSphereSource* sphere1, vtkMatrix4x4* matrix1, int mode)
+{
+  vtkNew<vtkMatrix4x4> matrix0;
+  collide->SetInputConnection(0, sphere0->GetOutputPort());
+  collide->SetMatrix(0, matrix0);
+  collide->SetInputConnection(1, sphere1->GetOutputPort());
+  collide->SetMatrix(1, matrix1);
+  collide->SetBoxTolerance(0.0);
+  collide->SetCellTolerance(0.0);
+  collide->SetNumberOfCellsPerNode(2);
+  collide->SetCollisionMode(mode);
+}
+
+// Contact cells found by the serial vtkOBBTree::IntersectWithOBBTree()
+// traversal, testing the cells of each pair of leaf nodes as it visits them.
+struct SerialContacts
+{
+  vtkCollisionDetectionFilter* Filter; // for IntersectPolygonWithPolygon()
+  vtkPolyData* Inputs[2];
+  std::vector<vtkIdType> Cells[2];
+};
+
+void GetTriangle(vtkPolyData* input, vtkIdType cellId, vtkMatrix4x4* xform, double pts[9],
+  double bounds[6])
+{
+  vtkNew<vtkIdList> ptIds;
+  input->GetCellPoints(cellId, ptIds);
+  for (int i = 0; i < 3; ++i)
+  {
+    double in[4] = { 0.0, 0.0, 0.0, 1.0 };
+    double out[4];
+    input->GetPoint(ptIds->GetId(i), in);
+    xform->MultiplyPoint(in, out);
+    for (int j = 0; j < 3; ++j)
+    {
+      pts[3 * i + j] = out[j] / out[3];
+      bounds[2 * j] = (i == 0 ? pts[3 * i + j] : std::min(bounds[2 * j], pts[3 * i + j]));
+      bounds[2 * j + 1] = (i == 0 ? pts[3 * i + j] : std::max(bounds[2 * j + 1], pts[3 * i + j]));
+    }
+  }
+}
+
+int CollectContacts(vtkOBBNode* nodeA, vtkOBBNode* nodeB, vtkMatrix4x4* xform, void* arg)
+{
+  SerialContacts* contacts = static_cast<SerialContacts*>(arg);
+  vtkCollisionDetectionFilter* filter = contacts->Filter;
+  vtkNew<vtkMatrix4x4> identity;
+  double ptsA[9], ptsB[9], boundsA[6], boundsB[6], x1[3], x2[3];
+  for (vtkIdType i = 0; i < nodeA->Cells->GetNumberOfIds(); ++i)
+  {
+    const vtkIdType cellIdA = nodeA->Cells->GetId(i);
+    ::GetTriangle(contacts->Inputs[0], cellIdA, identity, ptsA, boundsA);
+    for (vtkIdType j = 0; j < nodeB->Cells->GetNumberOfIds(); ++j)
+    {
+      const vtkIdType cellIdB = nodeB->Cells->GetId(j);
+      ::GetTriangle(contacts->Inputs[1], cellIdB, xform, ptsB, boundsB);
+      if (filter->IntersectPolygonWithPolygon(
+            3, ptsA, boundsA, 3, ptsB, boundsB, filter->GetCellTolerance(), x1, x2,
+            filter->GetCollisionMode()))
+      {
+        contacts->Cells[0].push_back(cellIdA);
+        contacts->Cells[1].push_back(cellIdB);
+      }
+    }
+  }
+  return 1;
+}
+
+// Compare the contact cells of the filter with the serial traversal of OBB
+// trees built with the same parameters.
+bool MatchesSerialTraversal(vtkCollisionDetectionFilter* collide, vtkMatrix4x4* matrix)
+{
+  SerialContacts contacts;
+  contacts.Filter = collide;
+  vtkNew<vtkOBBTree> trees[2];
+  for (int i = 0; i < 2; ++i)
+  {
+    contacts.Inputs[i] = vtkPolyData::SafeDownCast(collide->GetInput(i));
+    trees[i]->SetDataSet(contacts.Inputs[i]);
+    trees[i]->AutomaticOn();
+    trees[i]->SetNumberOfCellsPerNode(collide->GetNumberOfCellsPerNode());
+    trees[i]->BuildLocator();
+    trees[i]->SetTolerance(collide->GetBoxTolerance());
+  }
+  trees[0]->IntersectWithOBBTree(trees[1], matrix, ::CollectContacts, &contacts);
+
+  for (int i = 0; i < 2; ++i)
+  {
+    vtkIdTypeArray* cells = collide->GetContactCells(i);
+    if (cells->GetNumberOfValues() != static_cast<vtkIdType>(contacts.Cells[i].size()))
+    {
+      std::cerr << collide->GetCollisionModeAsString() << ": expected "
+                << contacts.Cells[i].size() << " contacts as the serial traversal, got "
+                << cells->GetNumberOfValues() << "." << std::endl;
+      return false;
+    }
+    for (vtkIdType id = 0; id < cells->GetNumberOfValues(); ++id)
+    {
+      if (cells->GetValue(id) != contacts.Cells[i][id])
+      {
+        std::cerr << collide->GetCollisionModeAsString() << ": contact " << id << " of input "
+                  << i << " differs from the serial traversal." << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool AreIdentical(
+  vtkCollisionDetectionFilter* ref, vtkCollisionDetectionFilter* collide, const char* label)
+{
+  if (ref->GetNumberOfContacts() != collide->GetNumberOfContacts())
+  {
+    std::cerr << label << ": expected " << ref->GetNumberOfContacts() << " contacts, got "
+              << collide->GetNumberOfContacts() << "." << std::endl;
+    return false;
+  }
+  for (int i = 0; i < 2; ++i)
+  {
+    vtkIdTypeArray* refCells = ref->GetContactCells(i);
+    vtkIdTypeArray* cells = collide->GetContactCells(i);
+    for (vtkIdType id = 0; id < refCells->GetNumberOfValues(); ++id)
+    {
+      if (refCells->GetValue(id) != cells->GetValue(id))
+      {
+        std::cerr << label << ": contact " << id << " of input " << i << " differs." << std::endl;
+        return false;
+      }
+    }
+  }
+  vtkPolyData* refContacts = ref->GetContactsOutput();
+  vtkPolyData* contacts = collide->GetContactsOutput();
+  if (refContacts->GetNumberOfPoints() != contacts->GetNumberOfPoints())
+  {
+    std::cerr << label << ": the number of contact points differs." << std::endl;
+    return false;
+  }
+  double x[3], y[3];
+  for (vtkIdType ptId = 0; ptId < refContacts->GetNumberOfPoints(); ++ptId)
+  {
+    refContacts->GetPoint(ptId, x);
+    contacts->GetPoint(ptId, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      std::cerr << label << ": contact point " << ptId << " differs." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestCollisionDetectionThreading(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere0;
+  sphere0->SetRadius(0.29);
+  sphere0->SetPhiResolution(61);
+  sphere0->SetThetaResolution(61);
+
+  vtkNew<vtkSphereSource> sphere1;
+  sphere1->SetRadius(0.3);
+  sphere1->SetPhiResolution(60);
+  sphere1->SetThetaResolution(60);
+
+  vtkNew<vtkMatrix4x4> matrix1;
+  matrix1->SetElement(0, 3, 0.25);
+  matrix1->SetElement(1, 3, 0.05);
+
+  int status = EXIT_SUCCESS;
+  const int modes[] = { vtkCollisionDetectionFilter::VTK_ALL_CONTACTS,
+    vtkCollisionDetectionFilter::VTK_HALF_CONTACTS };
+  for (int mode : modes)
+  {
+    vtkNew<vtkCollisionDetectionFilter> ref;
+    ::SetUpFilter(ref, sphere0, sphere1, matrix1, mode);
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { ref->Update(); });
+    if (ref->GetNumberOfContacts() == 0)
+    {
+      std::cerr << ref->GetCollisionModeAsString() << ": no contact found." << std::endl;
+      status = EXIT_FAILURE;
+      continue;
+    }
+
+    vtkNew<vtkCollisionDetectionFilter> collide;
+    ::SetUpFilter(collide, sphere0, sphere1, matrix1, mode);
+    collide->Update();
+    if (!::AreIdentical(ref, collide, ref->GetCollisionModeAsString()) ||
+      !::MatchesSerialTraversal(collide, matrix1))
+    {
+      status = EXIT_FAILURE;
+    }
+  }
+
+  // Move the second sphere over several frames, keeping the OBB trees, and
+  // compare with a filter rebuilding them.
+  vtkNew<vtkCollisionDetectionFilter> reuse;
+  ::SetUpFilter(reuse, sphere0, sphere1, matrix1, vtkCollisionDetectionFilter::VTK_ALL_CONTACTS);
+  reuse->UseExistingSearchStructuresOn();
+  for (int frame = 0; frame < 4; ++frame)
+  {
+    matrix1->SetElement(0, 3, 0.4 - 0.1 * frame);
+    sphere1->Modified();
+    reuse->Update();
+
+    vtkNew<vtkCollisionDetectionFilter> ref;
+    ::SetUpFilter(ref, sphere0, sphere1, matrix1, vtkCollisionDetectionFilter::VTK_ALL_CONTACTS);
+    ref->Update();
+    if (!::AreIdentical(ref, reuse, "UseExistingSearchStructures"))
+    {
+      status = EXIT_FAILURE;
+    }
+  }
+
+  vtkNew<vtkCollisionDetectionFilter> first;
+  ::SetUpFilter(first, sphere0, sphere1, matrix1, vtkCollisionDetectionFilter::VTK_FIRST_CONTACT);
+  first->Update();
+  if (first->GetNumberOfContacts() != 1)
+  {
+    std::cerr << "FirstContact: expected 1 contact, got " << first->GetNumberOfContacts() << "."
+              << std::endl;
+    status = EXIT_FAILURE;
+  }
+
+  return status;
+}
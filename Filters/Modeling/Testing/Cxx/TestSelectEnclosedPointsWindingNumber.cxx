@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the winding number containment test of vtkSelectEnclosedPoints
+// against the exact answer for a sphere, then remove a few triangles of the
+// sphere and check that the points away from the holes are still classified
+// correctly. Also check that the containment method of IsInsideSurface() can
+// be changed after Initialize().
+
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkFastWindingNumber.h"
+#include "vtkIdList.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSelectEnclosedPoints.h"
+#include "vtkSphereSource.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+const double Radius = 0.5;
+
+// Random points in [-0.6, 0.6]^3 away from the sphere.
+void RandomPoints(vtkPoints* points, vtkIdType numPts, double margin)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1177);
+  while (points->GetNumberOfPoints() < numPts)
+  {
+    double x[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      x[i] = random->GetNextRangeValue(-0.6, 0.6);
+    }
+    const double r = std::sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]);
+    if (std::abs(r - ::Radius) > margin)
+    {
+      points->InsertNextPoint(x);
+    }
+  }
+}
+
+bool IsInsideSphere(const double x[3])
+{
+  return x[0] * x[0] + x[1] * x[1] + x[2] * x[2] < ::Radius * ::Radius;
+}
+
+// Count the points misclassified by vtkSelectEnclosedPoints, ignoring the
+// points close to the z axis (and thus to the holes) if skipHoles is set.
+vtkIdType CountErrors(vtkPolyData* cloud, vtkPolyData* surface, int method, bool skipHoles)
+{
+  vtkNew<vtkSelectEnclosedPoints> select;
+  select->SetInputData(cloud);
+  select->SetSurfaceData(surface);
+  select->SetContainmentMethod(method);
+  select->Update();
+  vtkDataArray* selected =
+    vtkDataSet::SafeDownCast(select->GetOutput())->GetPointData()->GetArray("SelectedPoints");
+
+  vtkIdType numErrors = 0;
+  for (vtkIdType ptId = 0; ptId < cloud->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3];
+    cloud->GetPoint(ptId, x);
+    if (skipHoles && x[0] * x[0] + x[1] * x[1] < 0.2 * 0.2)
+    {
+      continue;
+    }
+    if ((selected->GetTuple1(ptId) != 0.0) != ::IsInsideSphere(x))
+    {
+      ++numErrors;
+    }
+  }
+  return numErrors;
+}
+}
+
+int TestSelectEnclosedPointsWindingNumber(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetRadius(::Radius);
+  sphere->SetThetaResolution(60);
+  sphere->SetPhiResolution(60);
+  sphere->Update();
+  vtkPolyData* surface = sphere->GetOutput();
+
+  vtkNew<vtkPoints> points;
+  ::RandomPoints(points, 5000, 0.01);
+  vtkNew<vtkPolyData> cloud;
+  cloud->SetPoints(points);
+
+  bool success = true;
+
+  // Closed surface: both methods must give the exact answer.
+  vtkIdType numErrors = ::CountErrors(cloud, surface, vtkSelectEnclosedPoints::RAY_CASTING, false);
+  if (numErrors != 0)
+  {
+    std::cerr << "Ray casting: " << numErrors << " misclassified points." << std::endl;
+    success = false;
+  }
+  numErrors = ::CountErrors(cloud, surface, vtkSelectEnclosedPoints::WINDING_NUMBER, false);
+  if (numErrors != 0)
+  {
+    std::cerr << "Winding number: " << numErrors << " misclassified points." << std::endl;
+    success = false;
+  }
+
+  // The approximation must be close to the exact winding number, which is 0
+  // or 1 away from the surface.
+  vtkNew<vtkFastWindingNumber> windingNumber;
+  windingNumber->SetSurface(surface);
+  vtkNew<vtkDoubleArray> approximate;
+  windingNumber->Evaluate(points->GetData(), approximate);
+  windingNumber->SetAccuracy(VTK_DOUBLE_MAX);
+  vtkNew<vtkDoubleArray> exact;
+  windingNumber->Evaluate(points->GetData(), exact);
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    const double w = exact->GetValue(ptId);
+    if (std::abs(w - approximate->GetValue(ptId)) > 0.1 ||
+      std::abs(w - (::IsInsideSphere(points->GetPoint(ptId)) ? 1.0 : 0.0)) > 1e-2)
+    {
+      std::cerr << "Point " << ptId << ": winding number " << approximate->GetValue(ptId)
+                << ", exact " << w << "." << std::endl;
+      success = false;
+      break;
+    }
+  }
+
+  // The containment method may change after Initialize().
+  vtkNew<vtkSelectEnclosedPoints> backdoor;
+  backdoor->Initialize(surface);
+  backdoor->SetContainmentMethod(vtkSelectEnclosedPoints::WINDING_NUMBER);
+  double center[3] = { 0.0, 0.0, 0.0 };
+  if (!backdoor->IsInsideSurface(center))
+  {
+    std::cerr << "Winding number after Initialize(): the center is outside." << std::endl;
+    success = false;
+  }
+  backdoor->SetContainmentMethod(vtkSelectEnclosedPoints::RAY_CASTING);
+  if (!backdoor->IsInsideSurface(center))
+  {
+    std::cerr << "Ray casting after Initialize(): the center is outside." << std::endl;
+    success = false;
+  }
+  backdoor->Complete();
+
+  // Open the sphere at both poles by removing the triangles close to the z
+  // axis.
+  vtkNew<vtkPolyData> openSurface;
+  openSurface->DeepCopy(surface);
+  openSurface->BuildLinks();
+  vtkNew<vtkIdList> cellPts;
+  for (vtkIdType cellId = 0; cellId < openSurface->GetNumberOfCells(); ++cellId)
+  {
+    openSurface->GetCellPoints(cellId, cellPts);
+    bool nearAxis = true;
+    for (vtkIdType i = 0; i < cellPts->GetNumberOfIds(); ++i)
+    {
+      const double* x = openSurface->GetPoint(cellPts->GetId(i));
+      nearAxis &= (x[0] * x[0] + x[1] * x[1] < 0.1 * 0.1);
+    }
+    if (nearAxis)
+    {
+      openSurface->DeleteCell(cellId);
+    }
+  }
+  openSurface->RemoveDeletedCells();
+  if (vtkSelectEnclosedPoints::IsSurfaceClosed(openSurface))
+  {
+    std::cerr << "The surface should not be closed." << std::endl;
+    success = false;
+  }
+  numErrors = ::CountErrors(cloud, openSurface, vtkSelectEnclosedPoints::WINDING_NUMBER, true);
+  if (numErrors != 0)
+  {
+    std::cerr << "Winding number, open surface: " << numErrors << " misclassified points."
+              << std::endl;
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -23,6 +23,8 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
@@ -30,6 +32,10 @@
 #include "vtkTrivialProducer.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCollisionDetectionFilter);
 
@@ -54,6 +60,7 @@ vtkCollisionDetectionFilter::vtkCollisionDetectionFilter()
   this->GenerateScalars = 0;
   this->CollisionMode = VTK_ALL_CONTACTS;
   this->Opacity = 1.0;
+  this->UseExistingSearchStructures = 0;
 }
 
 // Destroy any allocated memory.
@@ -405,6 +412,235 @@ static int ComputeCollisions(
   return 1;
 }
 
+namespace
+{
+// Pair of intersecting leaf nodes found by the broad phase.
+using vtkOBBLeafPair = std::pair<vtkOBBNode*, vtkOBBNode*>;
+
+// Minimum number of node pairs expanded serially from the roots of the trees
+// before the subtrees are traversed concurrently.
+constexpr std::size_t vtkCollisionMinNodePairs = 1024;
+
+// Append the pairs of children of a pair of intersecting nodes, where at
+// least one of the nodes is not a leaf, to pairs. The pairs are appended in
+// the order vtkOBBTree::IntersectWithOBBTree() pushes them on its stack,
+// that is in the reverse order they are visited.
+void PushChildPairs(vtkOBBNode* nodeA, vtkOBBNode* nodeB, std::vector<vtkOBBLeafPair>& pairs)
+{
+  if (nodeA->Kids == nullptr)
+  {
+    pairs.emplace_back(nodeA, nodeB->Kids[0]);
+    pairs.emplace_back(nodeA, nodeB->Kids[1]);
+  }
+  else if (nodeB->Kids == nullptr)
+  {
+    pairs.emplace_back(nodeA->Kids[0], nodeB);
+    pairs.emplace_back(nodeA->Kids[1], nodeB);
+  }
+  else
+  {
+    pairs.emplace_back(nodeA->Kids[0], nodeB->Kids[0]);
+    pairs.emplace_back(nodeA->Kids[1], nodeB->Kids[0]);
+    pairs.emplace_back(nodeA->Kids[0], nodeB->Kids[1]);
+    pairs.emplace_back(nodeA->Kids[1], nodeB->Kids[1]);
+  }
+}
+
+// Broad phase: gather the pairs of intersecting leaf nodes of treeA and treeB
+// (transformed by matrix), in the order vtkOBBTree::IntersectWithOBBTree()
+// visits them. The node pairs closest to the roots are expanded serially, in
+// visiting order, until there are enough of them to keep the threads busy.
+// The subtrees of these pairs are then traversed concurrently, and their leaf
+// pairs are concatenated in order, so the result does not depend on the
+// number of threads.
+void GatherLeafPairs(vtkOBBTree* treeA, vtkOBBTree* treeB, vtkMatrix4x4* matrix,
+  std::vector<vtkOBBLeafPair>& leafPairs)
+{
+  if (treeA->GetRoot() == nullptr || treeB->GetRoot() == nullptr)
+  {
+    return;
+  }
+  std::vector<vtkOBBLeafPair> nodePairs;
+  nodePairs.emplace_back(treeA->GetRoot(), treeB->GetRoot());
+
+  std::vector<vtkOBBLeafPair> nextPairs, childPairs;
+  bool expanded = true;
+  while (expanded && nodePairs.size() < vtkCollisionMinNodePairs)
+  {
+    expanded = false;
+    nextPairs.clear();
+    for (const auto& pair : nodePairs)
+    {
+      if (treeA->DisjointOBBNodes(pair.first, pair.second, matrix))
+      {
+        continue;
+      }
+      if (pair.first->Kids == nullptr && pair.second->Kids == nullptr)
+      {
+        nextPairs.emplace_back(pair);
+        continue;
+      }
+      childPairs.clear();
+      ::PushChildPairs(pair.first, pair.second, childPairs);
+      nextPairs.insert(nextPairs.end(), childPairs.rbegin(), childPairs.rend());
+      expanded = true;
+    }
+    nodePairs.swap(nextPairs);
+  }
+
+  // Traverse the subtrees of the node pairs concurrently, depth first.
+  std::vector<std::vector<vtkOBBLeafPair>> subtreeLeafPairs(nodePairs.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(nodePairs.size()), [&](vtkIdType id, vtkIdType endId) {
+    std::vector<vtkOBBLeafPair> stack;
+    for (; id < endId; ++id)
+    {
+      stack.emplace_back(nodePairs[id]);
+      while (!stack.empty())
+      {
+        const vtkOBBLeafPair pair = stack.back();
+        stack.pop_back();
+        if (treeA->DisjointOBBNodes(pair.first, pair.second, matrix))
+        {
+          continue;
+        }
+        if (pair.first->Kids == nullptr && pair.second->Kids == nullptr)
+        {
+          subtreeLeafPairs[id].emplace_back(pair);
+        }
+        else
+        {
+          ::PushChildPairs(pair.first, pair.second, stack);
+        }
+      }
+    }
+  });
+
+  for (const auto& pairs : subtreeLeafPairs)
+  {
+    leafPairs.insert(leafPairs.end(), pairs.begin(), pairs.end());
+  }
+}
+
+// A contact between two cells, in the coordinate system of input 0.
+struct vtkCollisionContact
+{
+  vtkIdType CellIdA;
+  vtkIdType CellIdB;
+  double X1[4];
+  double X2[4];
+};
+
+// Narrow phase: test the cells of each pair of intersecting leaf nodes for
+// intersection. The contacts of each pair are stored separately so that they
+// can be merged in traversal order.
+struct vtkCollisionNarrowPhase
+{
+  vtkCollisionDetectionFilter* Filter;
+  vtkPolyData* InputA;
+  vtkPolyData* InputB;
+  const std::vector<double>& PointsA;
+  const std::vector<double>& PointsB; // transformed into input 0 space
+  const std::vector<vtkOBBLeafPair>& LeafPairs;
+  std::vector<std::vector<vtkCollisionContact>>& Contacts;
+  double Tolerance;
+  int CollisionMode;
+  vtkSMPThreadLocalObject<vtkIdList> IdsA;
+  vtkSMPThreadLocalObject<vtkIdList> IdsB;
+
+  vtkCollisionNarrowPhase(vtkCollisionDetectionFilter* filter, vtkPolyData* inputA,
+    vtkPolyData* inputB, const std::vector<double>& pointsA, const std::vector<double>& pointsB,
+    const std::vector<vtkOBBLeafPair>& leafPairs,
+    std::vector<std::vector<vtkCollisionContact>>& contacts)
+    : Filter(filter)
+    , InputA(inputA)
+    , InputB(inputB)
+    , PointsA(pointsA)
+    , PointsB(pointsB)
+    , LeafPairs(leafPairs)
+    , Contacts(contacts)
+    , Tolerance(static_cast<float>(filter->GetCellTolerance()))
+    , CollisionMode(filter->GetCollisionMode())
+  {
+  }
+
+  static void GetTriangle(
+    vtkPolyData* input, const double* points, vtkIdType cellId, vtkIdList* ids, double pts[9])
+  {
+    vtkIdType npts;
+    const vtkIdType* ptIds;
+    input->GetCellPoints(cellId, npts, ptIds, ids);
+    for (int j = 0; j < 3; j++)
+    {
+      std::copy_n(points + 3 * ptIds[j], 3, pts + 3 * j);
+    }
+  }
+
+  static void ComputeBounds(const double pts[9], double bounds[6])
+  {
+    bounds[0] = bounds[2] = bounds[4] = VTK_DOUBLE_MAX;
+    bounds[1] = bounds[3] = bounds[5] = VTK_DOUBLE_MIN;
+    for (int v = 0; v < 9; v += 3)
+    {
+      for (int k = 0; k < 3; k++)
+      {
+        bounds[2 * k] = std::min(bounds[2 * k], pts[v + k]);
+        bounds[2 * k + 1] = std::max(bounds[2 * k + 1], pts[v + k]);
+      }
+    }
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType pairId, vtkIdType endPairId)
+  {
+    vtkIdList* idsA = this->IdsA.Local();
+    vtkIdList* idsB = this->IdsB.Local();
+    double ptsA[9], ptsB[9];
+    double boundsA[6], boundsB[6];
+    vtkCollisionContact contact;
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+
+    for (; pairId < endPairId; ++pairId)
+    {
+      if (isFirst)
+      {
+        this->Filter->CheckAbort();
+      }
+      if (this->Filter->GetAbortOutput())
+      {
+        break;
+      }
+
+      vtkIdList* cellsA = this->LeafPairs[pairId].first->Cells;
+      vtkIdList* cellsB = this->LeafPairs[pairId].second->Cells;
+      std::vector<vtkCollisionContact>& contacts = this->Contacts[pairId];
+
+      for (vtkIdType i = 0; i < cellsA->GetNumberOfIds(); i++)
+      {
+        contact.CellIdA = cellsA->GetId(i);
+        GetTriangle(this->InputA, this->PointsA.data(), contact.CellIdA, idsA, ptsA);
+        ComputeBounds(ptsA, boundsA);
+
+        for (vtkIdType m = 0; m < cellsB->GetNumberOfIds(); m++)
+        {
+          contact.CellIdB = cellsB->GetId(m);
+          GetTriangle(this->InputB, this->PointsB.data(), contact.CellIdB, idsB, ptsB);
+          ComputeBounds(ptsB, boundsB);
+
+          if (this->Filter->IntersectPolygonWithPolygon(3, ptsA, boundsA, 3, ptsB, boundsB,
+                this->Tolerance, contact.X1, contact.X2, this->CollisionMode))
+          {
+            contacts.push_back(contact);
+          }
+        }
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+} // anonymous namespace
+
 // Description:
 // Perform a collision detection
 int vtkCollisionDetectionFilter::RequestData(vtkInformation* vtkNotUsed(request),
@@ -486,6 +722,8 @@ int vtkCollisionDetectionFilter::RequestData(vtkInformation* vtkNotUsed(request)
   this->InvokeEvent(vtkCommand::StartEvent, nullptr);
 
   // rebuild the obb trees... they do their own mtime checking with input data
+  Tree0->SetUseExistingSearchStructure(this->UseExistingSearchStructures);
+  Tree1->SetUseExistingSearchStructure(this->UseExistingSearchStructures);
   Tree0->SetDataSet(input[0]);
   Tree0->AutomaticOn();
   Tree0->SetNumberOfCellsPerNode(this->NumberOfCellsPerNode);
@@ -501,7 +739,16 @@ int vtkCollisionDetectionFilter::RequestData(vtkInformation* vtkNotUsed(request)
   Tree1->SetTolerance(this->BoxTolerance);
 
   // Do the collision detection...
-  int boxTests = Tree0->IntersectWithOBBTree(Tree1, matrix, ComputeCollisions, this);
+  int boxTests;
+  if (this->CollisionMode == VTK_FIRST_CONTACT)
+  {
+    // Stop at the first contact found by the traversal.
+    boxTests = Tree0->IntersectWithOBBTree(Tree1, matrix, ComputeCollisions, this);
+  }
+  else
+  {
+    boxTests = this->ComputeAllCollisions(input[0], input[1], matrix);
+  }
 
   matrix->Delete();
   tmpMatrix->Delete();
@@ -586,6 +833,104 @@ int vtkCollisionDetectionFilter::RequestData(vtkInformation* vtkNotUsed(request)
   return 1;
 }
 
+//------------------------------------------------------------------------------
+int vtkCollisionDetectionFilter::ComputeAllCollisions(
+  vtkPolyData* inputA, vtkPolyData* inputB, vtkMatrix4x4* matrix)
+{
+  // Broad phase: gather the pairs of intersecting leaf nodes.
+  std::vector<vtkOBBLeafPair> leafPairs;
+  ::GatherLeafPairs(this->Tree0, this->Tree1, matrix, leafPairs);
+  const int boxTests = static_cast<int>(leafPairs.size());
+  if (leafPairs.empty())
+  {
+    return boxTests;
+  }
+
+  // Gather the points of both inputs, transforming the points of the second
+  // input into the space of the first one.
+  vtkPoints* inPtsA = inputA->GetPoints();
+  vtkPoints* inPtsB = inputB->GetPoints();
+  std::vector<double> pointsA(3 * inPtsA->GetNumberOfPoints());
+  std::vector<double> pointsB(3 * inPtsB->GetNumberOfPoints());
+  vtkSMPTools::For(0, inPtsA->GetNumberOfPoints(), [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      inPtsA->GetPoint(ptId, pointsA.data() + 3 * ptId);
+    }
+  });
+  vtkSMPTools::For(0, inPtsB->GetNumberOfPoints(), [&](vtkIdType ptId, vtkIdType endPtId) {
+    double in[4], out[4];
+    in[3] = 1.0;
+    for (; ptId < endPtId; ++ptId)
+    {
+      inPtsB->GetPoint(ptId, in);
+      matrix->MultiplyPoint(in, out);
+      pointsB[3 * ptId] = out[0] / out[3];
+      pointsB[3 * ptId + 1] = out[1] / out[3];
+      pointsB[3 * ptId + 2] = out[2] / out[3];
+    }
+  });
+
+  // Make sure the cells can be accessed from several threads.
+  if (inputA->NeedToBuildCells())
+  {
+    inputA->BuildCells();
+  }
+  if (inputB->NeedToBuildCells())
+  {
+    inputB->BuildCells();
+  }
+
+  // Narrow phase: intersect the cells of each leaf node pair.
+  std::vector<std::vector<vtkCollisionContact>> contacts(leafPairs.size());
+  vtkCollisionNarrowPhase narrowPhase(
+    this, inputA, inputB, pointsA, pointsB, leafPairs, contacts);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(leafPairs.size()), narrowPhase);
+
+  // Merge the contacts in traversal order.
+  vtkIdTypeArray* contactcells0 = this->GetContactCells(0);
+  vtkIdTypeArray* contactcells1 = this->GetContactCells(1);
+  vtkPolyData* contactsOutput = this->GetOutput(2);
+  vtkPoints* contactpoints = contactsOutput->GetPoints();
+  vtkCellArray* cells = (this->CollisionMode == VTK_ALL_CONTACTS ? contactsOutput->GetLines()
+                                                                  : contactsOutput->GetVerts());
+  vtkMatrix4x4* matrix0 = this->GetMatrix(0);
+  vtkIdType cellPtIds[2];
+  double xnew[4];
+  for (auto& pairContacts : contacts)
+  {
+    for (auto& contact : pairContacts)
+    {
+      contactcells0->InsertNextValue(contact.CellIdA);
+      contactcells1->InsertNextValue(contact.CellIdB);
+      // transform x back to "world space"
+      contact.X1[3] = contact.X2[3] = 1.0;
+      matrix0->MultiplyPoint(contact.X1, xnew);
+      xnew[0] = xnew[0] / xnew[3];
+      xnew[1] = xnew[1] / xnew[3];
+      xnew[2] = xnew[2] / xnew[3];
+      cellPtIds[0] = contactpoints->InsertNextPoint(xnew);
+      if (this->CollisionMode == VTK_ALL_CONTACTS)
+      {
+        matrix0->MultiplyPoint(contact.X2, xnew);
+        xnew[0] = xnew[0] / xnew[3];
+        xnew[1] = xnew[1] / xnew[3];
+        xnew[2] = xnew[2] / xnew[3];
+        cellPtIds[1] = contactpoints->InsertNextPoint(xnew);
+        // insert a new line
+        cells->InsertNextCell(2, cellPtIds);
+      }
+      else
+      {
+        // insert a new vert
+        cells->InsertNextCell(1, cellPtIds);
+      }
+    }
+  }
+
+  return boxTests;
+}
+
 // Method intersects two polygons. You must supply the number of points and
 // point coordinates (npts, *pts) and the bounding box (bounds) of the two
 // polygons. Also supply a tolerance squared for controlling
@@ -761,6 +1106,8 @@ void vtkCollisionDetectionFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Number of cells per Node: " << this->GetNumberOfCellsPerNode() << "\n";
   os << indent << "GenerateScalars: " << (this->GetGenerateScalars() ? "On" : "Off") << "\n";
   os << indent << "Collision Mode: " << this->GetCollisionModeAsString() << "\n";
+  os << indent << "Use Existing Search Structures: "
+     << (this->UseExistingSearchStructures ? "On" : "Off") << "\n";
   os << indent << "Opacity: " << this->GetOpacity() << "\n";
   os << indent << "InputData 0: " << this->GetInput(0) << "\n";
   os << indent << "InputData 1: " << this->GetInput(1) << "\n";
@@ -16,6 +16,15 @@
  *  This class can be used to clip one polydata surface with another,
  *  using the Contacts output as a loop set in vtkSelectPolyData
  *
+ *  The OBB trees are kept between executions, so moving the surfaces with
+ *  SetTransform() or SetMatrix() does not rebuild them. In AllContacts and
+ *  HalfContacts modes, the pairs of intersecting leaf nodes are gathered
+ *  first by traversing pairs of subtrees concurrently, then the cells of
+ *  these pairs are tested for intersection in parallel using vtkSMPTools.
+ *  The contacts are reported in the same order as a serial traversal. In
+ *  FirstContact mode, the traversal stops at the first contact and is
+ *  performed serially.
+ *
  * @authors Goodwin Lawlor, Bill Lorensen
  */
 
@@ -24,6 +33,11 @@
  * @warning
  * Currently only triangles are processed. Use vtkTriangleFilter to
  * convert any strips or polygons to triangles.
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
  */
 ///@}
 
@@ -222,6 +236,20 @@ public:
   vtkGetMacro(Opacity, float);
   ///@}
 
+  ///@{
+  /*
+   * When on, the OBB trees built during a previous execution are reused even
+   * if the inputs have been modified since. This is useful when the inputs
+   * are regenerated at each frame but keep the same cells, and only move
+   * rigidly: the motion must then be given with SetTransform() or SetMatrix().
+   * When off (the default), the trees are rebuilt whenever an input is
+   * modified.
+   */
+  vtkSetMacro(UseExistingSearchStructures, vtkTypeBool);
+  vtkGetMacro(UseExistingSearchStructures, vtkTypeBool);
+  vtkBooleanMacro(UseExistingSearchStructures, vtkTypeBool);
+  ///@}
+
   ///@{
   /*
    * Return the MTime also considering the transform.
@@ -235,6 +263,12 @@ protected:
 
   // Usual data generation method
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  // Find all the contacts (AllContacts and HalfContacts modes) between the
+  // cells of both inputs. The matrix transforms input 1 into input 0 space.
+  // Returns the number of box tests.
+  int ComputeAllCollisions(vtkPolyData* inputA, vtkPolyData* inputB, vtkMatrix4x4* matrix);
+
   vtkOBBTree* Tree0;
   vtkOBBTree* Tree1;
 
@@ -253,6 +287,8 @@ protected:
 
   int CollisionMode;
 
+  vtkTypeBool UseExistingSearchStructures;
+
 private:
   vtkCollisionDetectionFilter(const vtkCollisionDetectionFilter&) = delete;
   void operator=(const vtkCollisionDetectionFilter&) = delete;
@@ -0,0 +1,427 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkFastWindingNumber.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkGarbageCollector.h"
+#include "vtkMath.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkFastWindingNumber);
+vtkCxxSetObjectMacro(vtkFastWindingNumber, Surface, vtkPolyData);
+
+//------------------------------------------------------------------------------
+// The tree is a binary tree over the triangles of the surface, split at the
+// median of the triangle centroids along the longest axis of their bounding
+// box. Each node keeps the area weighted center of its triangles, the radius
+// of the sphere centered there enclosing them, and the sum of their area
+// weighted normals. The triangles are stored in tree order so that each node
+// covers a contiguous range.
+struct vtkFastWindingNumber::vtkInternals
+{
+  struct Node
+  {
+    double Center[3];
+    double Radius;
+    double Dipole[3];
+    vtkIdType Start;
+    vtkIdType End;
+    vtkIdType Children[2];
+  };
+
+  // Since the tree is split at the median, its depth is at most the number
+  // of bits of vtkIdType, and a depth first traversal never holds more
+  // nodes than that on its stack.
+  static constexpr int MaxStackSize = 2 * 8 * sizeof(vtkIdType);
+
+  std::vector<Node> Nodes;
+  std::vector<double> Triangles; // 9 coordinates per triangle, in tree order
+
+  // Used during the build only
+  std::vector<double> AreaNormals;
+  std::vector<double> Centroids;
+  std::vector<vtkIdType> Order;
+
+  void Clear()
+  {
+    this->Nodes.clear();
+    this->Nodes.shrink_to_fit();
+    this->Triangles.clear();
+    this->Triangles.shrink_to_fit();
+  }
+
+  vtkIdType GetNumberOfTriangles() const
+  {
+    return static_cast<vtkIdType>(this->Triangles.size() / 9);
+  }
+
+  // Gather the point ids of the triangles of the polygons and strips.
+  static void Triangulate(vtkPolyData* surface, std::vector<vtkIdType>& triangles)
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    auto polys = vtk::TakeSmartPointer(surface->GetPolys()->NewIterator());
+    for (polys->GoToFirstCell(); !polys->IsDoneWithTraversal(); polys->GoToNextCell())
+    {
+      polys->GetCurrentCell(npts, pts);
+      for (vtkIdType i = 1; i < npts - 1; ++i)
+      {
+        triangles.push_back(pts[0]);
+        triangles.push_back(pts[i]);
+        triangles.push_back(pts[i + 1]);
+      }
+    }
+    auto strips = vtk::TakeSmartPointer(surface->GetStrips()->NewIterator());
+    for (strips->GoToFirstCell(); !strips->IsDoneWithTraversal(); strips->GoToNextCell())
+    {
+      strips->GetCurrentCell(npts, pts);
+      for (vtkIdType i = 0; i < npts - 2; ++i)
+      {
+        // Every other triangle of a strip is flipped to keep the orientation
+        triangles.push_back(pts[i]);
+        triangles.push_back(pts[(i % 2) ? i + 2 : i + 1]);
+        triangles.push_back(pts[(i % 2) ? i + 1 : i + 2]);
+      }
+    }
+  }
+
+  // Compute the data of the node covering the triangles [start, end) of
+  // Order.
+  void InitializeNode(Node& node, vtkIdType start, vtkIdType end) const
+  {
+    node.Start = start;
+    node.End = end;
+    node.Children[0] = node.Children[1] = -1;
+
+    double area = 0.0;
+    double center[3] = { 0.0, 0.0, 0.0 };
+    double dipole[3] = { 0.0, 0.0, 0.0 };
+    for (vtkIdType i = start; i < end; ++i)
+    {
+      const vtkIdType triId = this->Order[i];
+      const double* n = this->AreaNormals.data() + 3 * triId;
+      const double* c = this->Centroids.data() + 3 * triId;
+      const double a = vtkMath::Norm(n);
+      for (int j = 0; j < 3; ++j)
+      {
+        dipole[j] += n[j];
+        center[j] += a * c[j];
+      }
+      area += a;
+    }
+    if (area > 0.0)
+    {
+      for (int j = 0; j < 3; ++j)
+      {
+        center[j] /= area;
+      }
+    }
+    else
+    {
+      // Degenerate triangles only, use their mean centroid
+      center[0] = center[1] = center[2] = 0.0;
+      for (vtkIdType i = start; i < end; ++i)
+      {
+        const double* c = this->Centroids.data() + 3 * this->Order[i];
+        for (int j = 0; j < 3; ++j)
+        {
+          center[j] += c[j] / (end - start);
+        }
+      }
+    }
+
+    double radius2 = 0.0;
+    for (vtkIdType i = start; i < end; ++i)
+    {
+      const double* tri = this->Triangles.data() + 9 * this->Order[i];
+      for (int k = 0; k < 3; ++k)
+      {
+        radius2 = std::max(radius2, vtkMath::Distance2BetweenPoints(center, tri + 3 * k));
+      }
+    }
+
+    std::copy(center, center + 3, node.Center);
+    std::copy(dipole, dipole + 3, node.Dipole);
+    node.Radius = std::sqrt(radius2);
+  }
+
+  // Build the subtree covering the triangles [start, end) of Order, return
+  // the index of its root.
+  vtkIdType BuildNode(vtkIdType start, vtkIdType end, vtkIdType leafSize)
+  {
+    Node node;
+    this->InitializeNode(node, start, end);
+    const vtkIdType nodeId = static_cast<vtkIdType>(this->Nodes.size());
+    this->Nodes.push_back(node);
+    if (end - start <= leafSize)
+    {
+      return nodeId;
+    }
+
+    // Split along the longest axis of the bounding box of the centroids
+    double bounds[6] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN,
+      VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+    for (vtkIdType i = start; i < end; ++i)
+    {
+      const double* c = this->Centroids.data() + 3 * this->Order[i];
+      for (int j = 0; j < 3; ++j)
+      {
+        bounds[2 * j] = std::min(bounds[2 * j], c[j]);
+        bounds[2 * j + 1] = std::max(bounds[2 * j + 1], c[j]);
+      }
+    }
+    int axis = 0;
+    for (int j = 1; j < 3; ++j)
+    {
+      if (bounds[2 * j + 1] - bounds[2 * j] > bounds[2 * axis + 1] - bounds[2 * axis])
+      {
+        axis = j;
+      }
+    }
+
+    const vtkIdType mid = start + (end - start) / 2;
+    const double* centroids = this->Centroids.data();
+    std::nth_element(this->Order.begin() + start, this->Order.begin() + mid,
+      this->Order.begin() + end, [centroids, axis](vtkIdType a, vtkIdType b) {
+        return centroids[3 * a + axis] < centroids[3 * b + axis];
+      });
+
+    const vtkIdType left = this->BuildNode(start, mid, leafSize);
+    const vtkIdType right = this->BuildNode(mid, end, leafSize);
+    this->Nodes[nodeId].Children[0] = left;
+    this->Nodes[nodeId].Children[1] = right;
+    return nodeId;
+  }
+
+  // Signed solid angle of a triangle seen from x (Van Oosterom and Strackee).
+  static double SolidAngle(const double* tri, const double x[3])
+  {
+    double a[3], b[3], c[3];
+    for (int j = 0; j < 3; ++j)
+    {
+      a[j] = tri[j] - x[j];
+      b[j] = tri[3 + j] - x[j];
+      c[j] = tri[6 + j] - x[j];
+    }
+    const double la = vtkMath::Norm(a);
+    const double lb = vtkMath::Norm(b);
+    const double lc = vtkMath::Norm(c);
+    const double det = vtkMath::Determinant3x3(a, b, c);
+    const double denom =
+      la * lb * lc + vtkMath::Dot(a, b) * lc + vtkMath::Dot(b, c) * la + vtkMath::Dot(c, a) * lb;
+    return 2.0 * std::atan2(det, denom);
+  }
+
+  double Evaluate(const double x[3], double accuracy) const
+  {
+    if (this->Nodes.empty())
+    {
+      return 0.0;
+    }
+
+    double solidAngle = 0.0;
+    vtkIdType stack[MaxStackSize];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0)
+    {
+      const Node& node = this->Nodes[stack[--stackSize]];
+      double d[3] = { node.Center[0] - x[0], node.Center[1] - x[1], node.Center[2] - x[2] };
+      const double dist = vtkMath::Norm(d);
+      if (dist > accuracy * node.Radius)
+      {
+        // Far field, approximate the node by its dipole
+        solidAngle += vtkMath::Dot(d, node.Dipole) / (dist * dist * dist);
+      }
+      else if (node.Children[0] < 0)
+      {
+        for (vtkIdType triId = node.Start; triId < node.End; ++triId)
+        {
+          solidAngle += SolidAngle(this->Triangles.data() + 9 * triId, x);
+        }
+      }
+      else
+      {
+        stack[stackSize++] = node.Children[0];
+        stack[stackSize++] = node.Children[1];
+      }
+    }
+    return solidAngle / (4.0 * vtkMath::Pi());
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkFastWindingNumber::vtkFastWindingNumber()
+  : Internals(new vtkInternals)
+{
+  this->Surface = nullptr;
+  this->Accuracy = 2.0;
+  this->NumberOfTrianglesPerLeaf = 8;
+}
+
+//------------------------------------------------------------------------------
+vtkFastWindingNumber::~vtkFastWindingNumber()
+{
+  this->SetSurface(nullptr);
+}
+
+//------------------------------------------------------------------------------
+void vtkFastWindingNumber::BuildTree()
+{
+  if (!this->Surface)
+  {
+    vtkErrorMacro("No surface to build the tree from");
+    this->FreeTree();
+    return;
+  }
+  if (this->BuildTime > this->MTime && this->BuildTime > this->Surface->GetMTime())
+  {
+    return;
+  }
+
+  vtkInternals* internals = this->Internals.get();
+  internals->Clear();
+  vtkPoints* points = this->Surface->GetPoints();
+  std::vector<vtkIdType> ptIds;
+  if (points)
+  {
+    vtkInternals::Triangulate(this->Surface, ptIds);
+  }
+  const vtkIdType numTris = static_cast<vtkIdType>(ptIds.size() / 3);
+  if (numTris == 0)
+  {
+    this->BuildTime.Modified();
+    return;
+  }
+
+  // Gather the coordinates, area weighted normals and centroids of the
+  // triangles. Make sure the points are ready for threaded access.
+  internals->Triangles.resize(9 * numTris);
+  internals->AreaNormals.resize(3 * numTris);
+  internals->Centroids.resize(3 * numTris);
+  internals->Order.resize(numTris);
+  double x[3];
+  points->GetPoint(0, x);
+  vtkSMPTools::For(0, numTris, [&](vtkIdType triId, vtkIdType endTriId) {
+    for (; triId < endTriId; ++triId)
+    {
+      double* tri = internals->Triangles.data() + 9 * triId;
+      points->GetPoint(ptIds[3 * triId], tri);
+      points->GetPoint(ptIds[3 * triId + 1], tri + 3);
+      points->GetPoint(ptIds[3 * triId + 2], tri + 6);
+      double e1[3], e2[3];
+      vtkMath::Subtract(tri + 3, tri, e1);
+      vtkMath::Subtract(tri + 6, tri, e2);
+      double* n = internals->AreaNormals.data() + 3 * triId;
+      vtkMath::Cross(e1, e2, n);
+      double* c = internals->Centroids.data() + 3 * triId;
+      for (int j = 0; j < 3; ++j)
+      {
+        n[j] *= 0.5;
+        c[j] = (tri[j] + tri[3 + j] + tri[6 + j]) / 3.0;
+      }
+      internals->Order[triId] = triId;
+    }
+  });
+
+  internals->Nodes.reserve(4 * numTris / this->NumberOfTrianglesPerLeaf + 1);
+  internals->BuildNode(0, numTris, this->NumberOfTrianglesPerLeaf);
+
+  // Store the triangles in tree order
+  std::vector<double> triangles(9 * numTris);
+  vtkSMPTools::For(0, numTris, [&](vtkIdType i, vtkIdType end) {
+    for (; i < end; ++i)
+    {
+      const double* tri = internals->Triangles.data() + 9 * internals->Order[i];
+      std::copy(tri, tri + 9, triangles.data() + 9 * i);
+    }
+  });
+  internals->Triangles.swap(triangles);
+
+  internals->AreaNormals = std::vector<double>();
+  internals->Centroids = std::vector<double>();
+  internals->Order = std::vector<vtkIdType>();
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkFastWindingNumber::FreeTree()
+{
+  this->Internals->Clear();
+  this->BuildTime = vtkTimeStamp();
+}
+
+//------------------------------------------------------------------------------
+double vtkFastWindingNumber::Evaluate(const double x[3])
+{
+  return this->Internals->Evaluate(x, this->Accuracy);
+}
+
+//------------------------------------------------------------------------------
+void vtkFastWindingNumber::Evaluate(vtkDataArray* points, vtkDoubleArray* windingNumbers)
+{
+  if (!points || !windingNumbers || points->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro("Expecting 3-component points and an output array");
+    return;
+  }
+  this->BuildTree();
+
+  const vtkIdType numPts = points->GetNumberOfTuples();
+  windingNumbers->SetNumberOfComponents(1);
+  windingNumbers->SetNumberOfTuples(numPts);
+  const vtkInternals* internals = this->Internals.get();
+  const double accuracy = this->Accuracy;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double x[3];
+    for (; ptId < endPtId; ++ptId)
+    {
+      points->GetTuple(ptId, x);
+      windingNumbers->SetValue(ptId, internals->Evaluate(x, accuracy));
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+int vtkFastWindingNumber::IsInside(const double x[3])
+{
+  return std::abs(this->Evaluate(x)) >= 0.5 ? 1 : 0;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkFastWindingNumber::GetNumberOfTriangles()
+{
+  return this->Internals->GetNumberOfTriangles();
+}
+
+//------------------------------------------------------------------------------
+void vtkFastWindingNumber::ReportReferences(vtkGarbageCollector* collector)
+{
+  this->Superclass::ReportReferences(collector);
+  vtkGarbageCollectorReport(collector, this->Surface, "Surface");
+}
+
+//------------------------------------------------------------------------------
+void vtkFastWindingNumber::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Surface: " << this->Surface << "\n";
+  os << indent << "Accuracy: " << this->Accuracy << "\n";
+  os << indent << "Number Of Triangles Per Leaf: " << this->NumberOfTrianglesPerLeaf << "\n";
+  os << indent << "Number Of Triangles: " << this->Internals->GetNumberOfTriangles() << "\n";
+  os << indent << "Number Of Nodes: " << this->Internals->Nodes.size() << "\n";
+}
+VTK_ABI_NAMESPACE_END
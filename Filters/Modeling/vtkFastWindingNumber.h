@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkFastWindingNumber
+ * @brief   evaluate the generalized winding number of a polygonal surface
+ *
+ * vtkFastWindingNumber computes the generalized winding number of a surface
+ * at query points, i.e., the signed solid angle subtended by the surface
+ * divided by 4*pi. The winding number is 1 inside and 0 outside of a closed,
+ * outward oriented surface (-1 inside if the surface is oriented inward).
+ * Unlike ray casting, it degrades gracefully when the surface has small
+ * holes, cracks or overlapping polygons: it then varies smoothly around the
+ * defects, so that thresholding its absolute value at 0.5 remains a robust
+ * inside/outside test.
+ *
+ * The evaluation follows the hierarchical (Barnes-Hut) approach described in
+ * "Fast Winding Numbers for Soups and Clouds" by G. Barill, N. Dickson,
+ * R. Schmidt, D.I.W. Levin and A. Jacobson (ACM SIGGRAPH 2018). A tree is
+ * built once over the triangles of the surface, and each node stores the sum
+ * of the area weighted normals of its triangles. When a query point is far
+ * from a node with respect to the node size (see Accuracy), the contribution
+ * of the node is approximated by this dipole; otherwise the children of the
+ * node are visited, and the triangles of the leaves are evaluated exactly.
+ * The cost of a query is thus logarithmic in the number of triangles.
+ *
+ * Polygons and triangle strips are triangulated on the fly (polygons as
+ * fans); vertices and lines are ignored.
+ *
+ * @warning
+ * Once BuildTree() has been called, Evaluate() is thread safe. The batched
+ * Evaluate() method, as well as the preprocessing of the triangles, have been
+ * threaded with vtkSMPTools. Using TBB or other non-sequential type (set in
+ * the CMake variable VTK_SMP_IMPLEMENTATION_TYPE) may improve performance
+ * significantly.
+ *
+ * @sa
+ * vtkSelectEnclosedPoints vtkExtractEnclosedPoints
+ */
+
+#ifndef vtkFastWindingNumber_h
+#define vtkFastWindingNumber_h
+
+#include "vtkFiltersModelingModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+class vtkDoubleArray;
+class vtkPolyData;
+
+class VTKFILTERSMODELING_EXPORT vtkFastWindingNumber : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, type information, and printing.
+   */
+  static vtkFastWindingNumber* New();
+  vtkTypeMacro(vtkFastWindingNumber, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Specify the surface whose winding number is evaluated.
+   */
+  virtual void SetSurface(vtkPolyData*);
+  vtkGetObjectMacro(Surface, vtkPolyData);
+  ///@}
+
+  ///@{
+  /**
+   * Control the accuracy of the approximation. The contribution of a node of
+   * the tree is approximated by its dipole when the distance from the query
+   * point to the center of the node is larger than Accuracy times the radius
+   * of the node. Larger values are more accurate but slower. With the
+   * default value of 2, the error is typically a few hundredths, which is
+   * more than enough for inside/outside tests.
+   */
+  vtkSetClampMacro(Accuracy, double, 1.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(Accuracy, double);
+  ///@}
+
+  ///@{
+  /**
+   * Specify the maximum number of triangles in the leaves of the tree
+   * (default 8).
+   */
+  vtkSetClampMacro(NumberOfTrianglesPerLeaf, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfTrianglesPerLeaf, int);
+  ///@}
+
+  /**
+   * Build the tree over the triangles of the surface. The tree is only
+   * rebuilt if this object or the surface has been modified since the last
+   * build.
+   */
+  void BuildTree();
+
+  /**
+   * Release the memory used by the tree.
+   */
+  void FreeTree();
+
+  /**
+   * Return the generalized winding number of the surface at x. BuildTree()
+   * must have been called first. This method is thread safe.
+   */
+  double Evaluate(const double x[3]);
+
+  /**
+   * Evaluate the winding number at each point of a 3-component array, in
+   * parallel, and store the results in windingNumbers, which is resized to
+   * one value per point. The tree is built if needed.
+   */
+  void Evaluate(vtkDataArray* points, vtkDoubleArray* windingNumbers);
+
+  /**
+   * Convenience method returning 1 if |w(x)| >= 0.5, i.e., if x is inside
+   * the surface whatever its orientation, 0 otherwise. This method is thread
+   * safe once BuildTree() has been called.
+   */
+  int IsInside(const double x[3]);
+
+  /**
+   * Return the number of triangles of the tree.
+   */
+  vtkIdType GetNumberOfTriangles();
+
+  bool UsesGarbageCollector() const override { return true; }
+
+protected:
+  vtkFastWindingNumber();
+  ~vtkFastWindingNumber() override;
+
+  vtkPolyData* Surface;
+  double Accuracy;
+  int NumberOfTrianglesPerLeaf;
+  vtkTimeStamp BuildTime;
+
+  void ReportReferences(vtkGarbageCollector*) override;
+
+private:
+  vtkFastWindingNumber(const vtkFastWindingNumber&) = delete;
+  void operator=(const vtkFastWindingNumber&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
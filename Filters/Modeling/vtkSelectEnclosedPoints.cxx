@@ -5,6 +5,7 @@
 #include "vtkCellData.h"
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
+#include "vtkFastWindingNumber.h"
 #include "vtkFeatureEdges.h"
 #include "vtkGarbageCollector.h"
 #include "vtkGenericCell.h"
@@ -23,6 +24,8 @@
 #include "vtkStaticCellLocator.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkSelectEnclosedPoints);
 
@@ -136,6 +139,71 @@ struct SelectInOutCheck
   }
 }; // SelectInOutCheck
 
+//------------------------------------------------------------------------------
+// The threaded core of the algorithm when using the winding number.
+struct SelectWindingNumberCheck
+{
+  vtkDataSet* DataSet;
+  double Bounds[6];
+  vtkFastWindingNumber* WindingNumber;
+  unsigned char* Hits;
+  vtkTypeBool InsideOut;
+  vtkSelectEnclosedPoints* Filter;
+
+  SelectWindingNumberCheck(vtkDataSet* ds, double bds[6], vtkFastWindingNumber* wn,
+    unsigned char* hits, vtkSelectEnclosedPoints* filter)
+    : DataSet(ds)
+    , WindingNumber(wn)
+    , Hits(hits)
+    , InsideOut(filter->GetInsideOut())
+    , Filter(filter)
+  {
+    std::copy(bds, bds + 6, this->Bounds);
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    double x[3];
+    unsigned char* hits = this->Hits + ptId;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+
+    for (; ptId < endPtId; ++ptId)
+    {
+      if (isFirst)
+      {
+        this->Filter->CheckAbort();
+      }
+      if (this->Filter->GetAbortOutput())
+      {
+        break;
+      }
+      this->DataSet->GetPoint(ptId, x);
+
+      if (vtkSelectEnclosedPoints::IsInsideSurface(x, this->Bounds, this->WindingNumber))
+      {
+        *hits++ = (this->InsideOut ? 0 : 1);
+      }
+      else
+      {
+        *hits++ = (this->InsideOut ? 1 : 0);
+      }
+    }
+  }
+
+  static void Execute(vtkIdType numPts, vtkDataSet* ds, double bds[6], vtkFastWindingNumber* wn,
+    unsigned char* hits, vtkSelectEnclosedPoints* sel)
+  {
+    // Make sure the input is ready for threaded access
+    if (numPts > 0)
+    {
+      double x[3];
+      ds->GetPoint(0, x);
+    }
+    SelectWindingNumberCheck inOut(ds, bds, wn, hits, sel);
+    vtkSMPTools::For(0, numPts, inOut);
+  }
+}; // SelectWindingNumberCheck
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -147,11 +215,15 @@ vtkSelectEnclosedPoints::vtkSelectEnclosedPoints()
   this->CheckSurface = false;
   this->InsideOut = 0;
   this->Tolerance = 0.0001;
+  this->ContainmentMethod = vtkSelectEnclosedPoints::RAY_CASTING;
+  this->WindingNumberAccuracy = 2.0;
 
   this->InsideOutsideArray = nullptr;
+  this->Surface = nullptr;
 
   // These are needed to support backward compatibility
   this->CellLocator = vtkStaticCellLocator::New();
+  this->WindingNumber = vtkFastWindingNumber::New();
   this->CellIds = vtkIdList::New();
   this->Cell = vtkGenericCell::New();
 }
@@ -171,6 +243,13 @@ vtkSelectEnclosedPoints::~vtkSelectEnclosedPoints()
     loc->Delete();
   }
 
+  if (this->WindingNumber)
+  {
+    vtkFastWindingNumber* wn = this->WindingNumber;
+    this->WindingNumber = nullptr;
+    wn->Delete();
+  }
+
   this->CellIds->Delete();
   this->Cell->Delete();
 }
@@ -214,8 +293,16 @@ int vtkSelectEnclosedPoints::RequestData(vtkInformation* vtkNotUsed(request),
   unsigned char* hitsPtr = static_cast<unsigned char*>(hits->GetVoidPointer(0));
 
   // Process the points in parallel
-  SelectInOutCheck::Execute(
-    numPts, input, surface, this->Bounds, this->Tolerance, this->CellLocator, hitsPtr, this);
+  if (this->ContainmentMethod == vtkSelectEnclosedPoints::WINDING_NUMBER)
+  {
+    SelectWindingNumberCheck::Execute(
+      numPts, input, this->Bounds, this->WindingNumber, hitsPtr, this);
+  }
+  else
+  {
+    SelectInOutCheck::Execute(
+      numPts, input, surface, this->Bounds, this->Tolerance, this->CellLocator, hitsPtr, this);
+  }
 
   // Copy all the input geometry and data to the output.
   output->CopyStructure(input);
@@ -268,14 +355,28 @@ void vtkSelectEnclosedPoints::Initialize(vtkPolyData* surface)
   {
     this->CellLocator = vtkStaticCellLocator::New();
   }
+  if (!this->WindingNumber)
+  {
+    this->WindingNumber = vtkFastWindingNumber::New();
+  }
 
   this->Surface = surface;
   surface->GetBounds(this->Bounds);
   this->Length = surface->GetLength();
 
-  // Set up structures for acceleration ray casting
-  this->CellLocator->SetDataSet(surface);
-  this->CellLocator->BuildLocator();
+  if (this->ContainmentMethod == vtkSelectEnclosedPoints::WINDING_NUMBER)
+  {
+    // Set up the tree used to evaluate the winding number
+    this->WindingNumber->SetSurface(surface);
+    this->WindingNumber->SetAccuracy(this->WindingNumberAccuracy);
+    this->WindingNumber->BuildTree();
+  }
+  else
+  {
+    // Set up structures for acceleration ray casting
+    this->CellLocator->SetDataSet(surface);
+    this->CellLocator->BuildLocator();
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -306,6 +407,28 @@ int vtkSelectEnclosedPoints::IsInsideSurface(double x, double y, double z)
 // safe due to the use of the data member CellIds and Cell.
 int vtkSelectEnclosedPoints::IsInsideSurface(double x[3])
 {
+  if (!this->Surface)
+  {
+    vtkErrorMacro("Initialize() must be called before IsInsideSurface()");
+    return 0;
+  }
+
+  // The containment method may have changed since Initialize(), so the
+  // search structure of the current method is set up on demand. Nothing is
+  // rebuilt if it is up to date.
+  if (this->ContainmentMethod == vtkSelectEnclosedPoints::WINDING_NUMBER)
+  {
+    this->WindingNumber->SetSurface(this->Surface);
+    this->WindingNumber->SetAccuracy(this->WindingNumberAccuracy);
+    this->WindingNumber->BuildTree();
+    return vtkSelectEnclosedPoints::IsInsideSurface(x, this->Bounds, this->WindingNumber);
+  }
+  if (this->CellLocator->GetDataSet() != this->Surface)
+  {
+    this->CellLocator->SetDataSet(this->Surface);
+    this->CellLocator->BuildLocator();
+  }
+
   vtkIntersectionCounter counter(this->Tolerance, this->Length);
 
   return vtkSelectEnclosedPoints::IsInsideSurface(x, this->Surface, this->Bounds, this->Length,
@@ -433,6 +556,23 @@ int vtkSelectEnclosedPoints::IsInsideSurface(double x[3], vtkPolyData* surface,
 #undef VTK_MAX_ITER
 #undef VTK_VOTE_THRESHOLD
 
+//------------------------------------------------------------------------------
+// The generalized winding number is 1 (or -1 for an inward oriented surface)
+// inside a closed surface and 0 outside. Around holes it varies smoothly
+// between these values, hence the threshold at 0.5.
+int vtkSelectEnclosedPoints::IsInsideSurface(
+  double x[3], double bds[6], vtkFastWindingNumber* windingNumber)
+{
+  // do a quick inside bounds check against the surface bounds
+  if (x[0] < bds[0] || x[0] > bds[1] || x[1] < bds[2] || x[1] > bds[3] || x[2] < bds[4] ||
+    x[2] > bds[5])
+  {
+    return 0;
+  }
+
+  return windingNumber->IsInside(x);
+}
+
 //------------------------------------------------------------------------------
 // Specify the second enclosing surface input via a connection
 void vtkSelectEnclosedPoints::SetSurfaceConnection(vtkAlgorithmOutput* algOutput)
@@ -486,6 +626,7 @@ int vtkSelectEnclosedPoints::FillInputPortInformation(int port, vtkInformation*
 void vtkSelectEnclosedPoints::Complete()
 {
   this->CellLocator->FreeSearchStructure();
+  this->WindingNumber->FreeTree();
 }
 
 //------------------------------------------------------------------------------
@@ -495,6 +636,7 @@ void vtkSelectEnclosedPoints::ReportReferences(vtkGarbageCollector* collector)
   // These filters share our input and are therefore involved in a
   // reference loop.
   vtkGarbageCollectorReport(collector, this->CellLocator, "CellLocator");
+  vtkGarbageCollectorReport(collector, this->WindingNumber, "WindingNumber");
 }
 
 //------------------------------------------------------------------------------
@@ -507,5 +649,11 @@ void vtkSelectEnclosedPoints::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Inside Out: " << (this->InsideOut ? "On\n" : "Off\n");
 
   os << indent << "Tolerance: " << this->Tolerance << "\n";
+
+  os << indent << "Containment Method: "
+     << (this->ContainmentMethod == vtkSelectEnclosedPoints::WINDING_NUMBER ? "Winding Number\n"
+                                                                            : "Ray Casting\n");
+
+  os << indent << "Winding Number Accuracy: " << this->WindingNumberAccuracy << "\n";
 }
 VTK_ABI_NAMESPACE_END
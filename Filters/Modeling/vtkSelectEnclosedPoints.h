@@ -13,11 +13,20 @@
  * After running the filter, it is possible to query it as to whether a point
  * is inside/outside by invoking the IsInside(ptId) method.
  *
+ * Two containment methods are available. By default, random rays are cast
+ * from each point and their intersections with the surface are counted.
+ * Alternatively, the generalized winding number of the surface can be
+ * evaluated at each point with vtkFastWindingNumber: this is usually faster
+ * for large numbers of points, does not depend on random numbers, and gives
+ * sensible results for surfaces that are not quite closed (small holes,
+ * cracks, overlapping polygons), where ray casting fails.
+ *
  * @warning
- * The filter assumes that the surface is closed and manifold. A boolean flag
- * can be set to force the filter to first check whether this is true. If false,
- * all points will be marked outside. Note that if this check is not performed
- * and the surface is not closed, the results are undefined.
+ * With ray casting, the filter assumes that the surface is closed and
+ * manifold. A boolean flag can be set to force the filter to first check
+ * whether this is true. If false, all points will be marked outside. Note
+ * that if this check is not performed and the surface is not closed, the
+ * results are undefined.
  *
  * @warning
  * This filter produces and output data array, but does not modify the input
@@ -31,7 +40,7 @@
  * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
  *
  * @sa
- * vtkMaskPoints vtkExtractEnclosedPoints
+ * vtkMaskPoints vtkExtractEnclosedPoints vtkFastWindingNumber
  */
 
 #ifndef vtkSelectEnclosedPoints_h
@@ -44,6 +53,7 @@
 VTK_ABI_NAMESPACE_BEGIN
 class vtkUnsignedCharArray;
 class vtkAbstractCellLocator;
+class vtkFastWindingNumber;
 class vtkStaticCellLocator;
 class vtkIdList;
 class vtkGenericCell;
@@ -104,6 +114,42 @@ public:
   vtkGetMacro(CheckSurface, vtkTypeBool);
   ///@}
 
+  /**
+   * Methods used to determine whether a point is inside the surface.
+   */
+  enum ContainmentMethods
+  {
+    RAY_CASTING = 0,
+    WINDING_NUMBER = 1
+  };
+
+  ///@{
+  /**
+   * Specify how to determine whether a point is inside the surface. With
+   * RAY_CASTING (the default), random rays are cast from the point and
+   * their intersections with the surface are counted. With WINDING_NUMBER,
+   * the point is inside if the absolute value of the generalized winding
+   * number of the surface at the point is at least 0.5 (see
+   * vtkFastWindingNumber). The winding number does not depend on the
+   * orientation of the surface, as long as it is consistent, and is robust
+   * to surfaces that are not quite closed.
+   */
+  vtkSetClampMacro(ContainmentMethod, int, RAY_CASTING, WINDING_NUMBER);
+  vtkGetMacro(ContainmentMethod, int);
+  void SetContainmentMethodToRayCasting() { this->SetContainmentMethod(RAY_CASTING); }
+  void SetContainmentMethodToWindingNumber() { this->SetContainmentMethod(WINDING_NUMBER); }
+  ///@}
+
+  ///@{
+  /**
+   * Specify the accuracy of the winding number approximation when
+   * ContainmentMethod is WINDING_NUMBER (see
+   * vtkFastWindingNumber::SetAccuracy()). Default is 2.
+   */
+  vtkSetClampMacro(WindingNumberAccuracy, double, 1.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(WindingNumberAccuracy, double);
+  ///@}
+
   /**
    * Query an input point id as to whether it is inside or outside. Note that
    * the result requires that the filter execute first.
@@ -124,7 +170,9 @@ public:
    * This is a backdoor that can be used to test many points for containment.
    * First initialize the instance, then repeated calls to IsInsideSurface()
    * can be used without rebuilding the search structures. The Complete()
-   * method releases memory.
+   * method releases memory. If the ContainmentMethod is changed after
+   * Initialize(), the search structure it needs is built by the next call to
+   * IsInsideSurface().
    */
   void Initialize(vtkPolyData* surface);
   int IsInsideSurface(double x[3]);
@@ -146,6 +194,14 @@ public:
     double tol, vtkAbstractCellLocator* locator, vtkIdList* cellIds, vtkGenericCell* genCell,
     vtkIntersectionCounter& counter, vtkRandomPool* poole = nullptr, vtkIdType seqIdx = 0);
 
+  /**
+   * A static method for determining whether a point is inside a surface
+   * using its generalized winding number. The user must provide an input
+   * point x, the bounds of the enclosing surface, and a vtkFastWindingNumber
+   * whose tree has been built over the surface. This method is thread safe.
+   */
+  static int IsInsideSurface(double x[3], double bds[6], vtkFastWindingNumber* windingNumber);
+
   /**
    * A static method for determining whether a surface is closed. Provide as input
    * a vtkPolyData. The method returns >0 is the surface is closed and manifold.
@@ -159,11 +215,14 @@ protected:
   vtkTypeBool CheckSurface;
   vtkTypeBool InsideOut;
   double Tolerance;
+  int ContainmentMethod;
+  double WindingNumberAccuracy;
 
   vtkUnsignedCharArray* InsideOutsideArray;
 
   // Internal structures for accelerating the intersection test
   vtkStaticCellLocator* CellLocator;
+  vtkFastWindingNumber* WindingNumber;
   vtkIdList* CellIds;
   vtkGenericCell* Cell;
   vtkPolyData* Surface;
@@ -7,6 +7,7 @@
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
+#include "vtkFastWindingNumber.h"
 #include "vtkFeatureEdges.h"
 #include "vtkGarbageCollector.h"
 #include "vtkGenericCell.h"
@@ -120,6 +121,54 @@ struct ExtractInOutCheck
   void Reduce() {}
 }; // ExtractInOutCheck
 
+//------------------------------------------------------------------------------
+// The threaded core of the algorithm when using the winding number.
+template <typename ArrayT>
+struct ExtractWindingNumberCheck
+{
+  ArrayT* Points;
+  double Bounds[6];
+  vtkFastWindingNumber* WindingNumber;
+  vtkIdType* PointMap;
+
+  ExtractWindingNumberCheck(ArrayT* pts, double bds[6], vtkFastWindingNumber* wn, vtkIdType* map)
+    : Points(pts)
+    , WindingNumber(wn)
+    , PointMap(map)
+  {
+    std::copy(bds, bds + 6, this->Bounds);
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    double x[3];
+    const auto points = vtk::DataArrayTupleRange(this->Points);
+    vtkIdType* map = this->PointMap + ptId;
+
+    for (; ptId < endPtId; ++ptId)
+    {
+      const auto pt = points[ptId];
+
+      x[0] = static_cast<double>(pt[0]);
+      x[1] = static_cast<double>(pt[1]);
+      x[2] = static_cast<double>(pt[2]);
+
+      *map++ =
+        (vtkSelectEnclosedPoints::IsInsideSurface(x, this->Bounds, this->WindingNumber) ? 1 : -1);
+    }
+  }
+}; // ExtractWindingNumberCheck
+
+struct ExtractWindingNumberLauncher
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* pts, double bds[6], vtkFastWindingNumber* wn, vtkIdType* hits)
+  {
+    ExtractWindingNumberCheck<ArrayT> inOut(pts, bds, wn, hits);
+    vtkSMPTools::For(0, pts->GetNumberOfTuples(), inOut);
+  }
+};
+
 struct ExtractLauncher
 {
   template <typename ArrayT>
@@ -141,6 +190,8 @@ vtkExtractEnclosedPoints::vtkExtractEnclosedPoints()
 
   this->CheckSurface = false;
   this->Tolerance = 0.001;
+  this->ContainmentMethod = vtkSelectEnclosedPoints::RAY_CASTING;
+  this->WindingNumberAccuracy = 2.0;
 }
 
 //------------------------------------------------------------------------------
@@ -181,23 +232,42 @@ int vtkExtractEnclosedPoints::RequestData(
 // the enclosing surface.
 int vtkExtractEnclosedPoints::FilterPoints(vtkPointSet* input)
 {
-  // Initialize search structures
-  vtkStaticCellLocator* locator = vtkStaticCellLocator::New();
-
   vtkPolyData* surface = this->Surface;
   double bds[6];
   surface->GetBounds(bds);
 
+  using vtkArrayDispatch::Reals;
+  using Dispatcher = vtkArrayDispatch::DispatchByValueType<Reals>;
+  vtkDataArray* ptArray = input->GetPoints()->GetData();
+
+  if (this->ContainmentMethod == vtkSelectEnclosedPoints::WINDING_NUMBER)
+  {
+    // Build the tree used to evaluate the winding number
+    vtkFastWindingNumber* windingNumber = vtkFastWindingNumber::New();
+    windingNumber->SetSurface(surface);
+    windingNumber->SetAccuracy(this->WindingNumberAccuracy);
+    windingNumber->BuildTree();
+
+    ExtractWindingNumberLauncher worker;
+    if (!Dispatcher::Execute(ptArray, worker, bds, windingNumber, this->PointMap))
+    { // fallback for other arrays:
+      worker(ptArray, bds, windingNumber, this->PointMap);
+    }
+
+    windingNumber->Delete();
+    return 1;
+  }
+
+  // Initialize search structures
+  vtkStaticCellLocator* locator = vtkStaticCellLocator::New();
+
   // Set up structures for acceleration ray casting
   locator->SetDataSet(surface);
   locator->BuildLocator();
 
   // Loop over all input points determining inside/outside
   // Use fast path for float/double points:
-  using vtkArrayDispatch::Reals;
-  using Dispatcher = vtkArrayDispatch::DispatchByValueType<Reals>;
   ExtractLauncher worker;
-  vtkDataArray* ptArray = input->GetPoints()->GetData();
   if (!Dispatcher::Execute(ptArray, worker, surface, bds, this->Tolerance, locator, this->PointMap))
   { // fallback for other arrays:
     worker(ptArray, surface, bds, this->Tolerance, locator, this->PointMap);
@@ -265,5 +335,11 @@ void vtkExtractEnclosedPoints::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Check Surface: " << (this->CheckSurface ? "On\n" : "Off\n");
 
   os << indent << "Tolerance: " << this->Tolerance << "\n";
+
+  os << indent << "Containment Method: "
+     << (this->ContainmentMethod == vtkSelectEnclosedPoints::WINDING_NUMBER ? "Winding Number\n"
+                                                                            : "Ray Casting\n");
+
+  os << indent << "Winding Number Accuracy: " << this->WindingNumberAccuracy << "\n";
 }
 VTK_ABI_NAMESPACE_END
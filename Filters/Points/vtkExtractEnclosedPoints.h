@@ -13,11 +13,17 @@
  * available for generating an in/out mask, and also extracting points
  * outside of the enclosing surface.
  *
+ * As with vtkSelectEnclosedPoints, containment can be determined either by
+ * ray casting (the default) or by evaluating the generalized winding number
+ * of the surface (see vtkFastWindingNumber), which is robust to surfaces that
+ * are not quite closed.
+ *
  * @warning
- * The filter assumes that the surface is closed and manifold. A boolean flag
- * can be set to force the filter to first check whether this is true. If false,
- * all points will be marked outside. Note that if this check is not performed
- * and the surface is not closed, the results are undefined.
+ * With ray casting, the filter assumes that the surface is closed and
+ * manifold. A boolean flag can be set to force the filter to first check
+ * whether this is true. If false, all points will be marked outside. Note
+ * that if this check is not performed and the surface is not closed, the
+ * results are undefined.
  *
  * @warning
  * This class has been threaded with vtkSMPTools. Using TBB or other
@@ -35,7 +41,7 @@
  * its methods to vtkSelectEnclosedPoints.
  *
  * @sa
- * vtkSelectEnclosedPoints vtkExtractPoints
+ * vtkSelectEnclosedPoints vtkExtractPoints vtkFastWindingNumber
  */
 
 #ifndef vtkExtractEnclosedPoints_h
@@ -43,6 +49,7 @@
 
 #include "vtkFiltersPointsModule.h" // For export macro
 #include "vtkPointCloudFilter.h"
+#include "vtkSelectEnclosedPoints.h" // For ContainmentMethods
 
 VTK_ABI_NAMESPACE_BEGIN
 class VTKFILTERSPOINTS_EXPORT vtkExtractEnclosedPoints : public vtkPointCloudFilter
@@ -94,12 +101,44 @@ public:
   vtkGetMacro(Tolerance, double);
   ///@}
 
+  ///@{
+  /**
+   * Specify how to determine whether a point is inside the surface, either
+   * vtkSelectEnclosedPoints::RAY_CASTING (the default) or
+   * vtkSelectEnclosedPoints::WINDING_NUMBER. See vtkSelectEnclosedPoints for
+   * details.
+   */
+  vtkSetClampMacro(ContainmentMethod, int, vtkSelectEnclosedPoints::RAY_CASTING,
+    vtkSelectEnclosedPoints::WINDING_NUMBER);
+  vtkGetMacro(ContainmentMethod, int);
+  void SetContainmentMethodToRayCasting()
+  {
+    this->SetContainmentMethod(vtkSelectEnclosedPoints::RAY_CASTING);
+  }
+  void SetContainmentMethodToWindingNumber()
+  {
+    this->SetContainmentMethod(vtkSelectEnclosedPoints::WINDING_NUMBER);
+  }
+  ///@}
+
+  ///@{
+  /**
+   * Specify the accuracy of the winding number approximation when
+   * ContainmentMethod is WINDING_NUMBER (see
+   * vtkFastWindingNumber::SetAccuracy()). Default is 2.
+   */
+  vtkSetClampMacro(WindingNumberAccuracy, double, 1.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(WindingNumberAccuracy, double);
+  ///@}
+
 protected:
   vtkExtractEnclosedPoints();
   ~vtkExtractEnclosedPoints() override;
 
   vtkTypeBool CheckSurface;
   double Tolerance;
+  int ContainmentMethod;
+  double WindingNumberAccuracy;
 
   // Internal structures for managing the intersection testing
   vtkPolyData* Surface;
@@ -30,7 +30,8 @@
 //****************************************************************************
 namespace
 {
-void EncodeAndWrite(const vtkSmartPointer<vtkImageData>& image, const std::string& fileName)
+void EncodeAndWrite(
+  const vtkSmartPointer<vtkImageData>& image, const std::string& fileName, bool parallelEncoding)
 {
   vtkLogF(TRACE, "encoding: %s", fileName.c_str());
   assert(image != nullptr);
@@ -55,6 +56,7 @@ void EncodeAndWrite(const vtkSmartPointer<vtkImageData>& image, const std::strin
     vtkNew<vtkPNGWriter> writer;
     writer->SetFileName(fileName.c_str());
     writer->SetInputData(image);
+    writer->SetParallelEncoding(parallelEncoding);
     writer->Write();
   }
 
@@ -63,6 +65,8 @@ void EncodeAndWrite(const vtkSmartPointer<vtkImageData>& image, const std::strin
     vtkNew<vtkJPEGWriter> writer;
     writer->SetFileName(fileName.c_str());
     writer->SetInputData(image);
+    writer->SetProgressive(!parallelEncoding);
+    writer->SetParallelEncoding(parallelEncoding);
     writer->Write();
   }
 
@@ -135,9 +139,13 @@ public:
     this->Queue.reset(nullptr);
   }
 
-  void SpawnWorkers(vtkTypeUInt32 numberOfThreads)
+  void SpawnWorkers(vtkTypeUInt32 numberOfThreads, bool parallelEncoding)
   {
-    this->Queue.reset(new TaskQueueType(::EncodeAndWrite,
+    auto encodeAndWrite = [parallelEncoding](
+                            vtkSmartPointer<vtkImageData> image, std::string fileName) {
+      ::EncodeAndWrite(image, fileName, parallelEncoding);
+    };
+    this->Queue.reset(new TaskQueueType(encodeAndWrite,
       /*strict_ordering=*/true,
       /*buffer_size=*/-1,
       /*max_concurrent_tasks=*/static_cast<int>(numberOfThreads)));
@@ -155,6 +163,7 @@ vtkThreadedImageWriter::vtkThreadedImageWriter()
   : Internals(new vtkInternals())
 {
   this->MaxThreads = MAX_NUMBER_OF_THREADS_IN_POOL;
+  this->ParallelEncoding = false;
 }
 
 //------------------------------------------------------------------------------
@@ -182,7 +191,7 @@ void vtkThreadedImageWriter::Initialize()
   // Make sure we don't keep adding new threads
   // this->Internals->TerminateAllWorkers();
   // Register new worker threads
-  this->Internals->SpawnWorkers(this->MaxThreads);
+  this->Internals->SpawnWorkers(this->MaxThreads, this->ParallelEncoding);
 }
 
 //------------------------------------------------------------------------------
@@ -208,6 +217,8 @@ void vtkThreadedImageWriter::EncodeAndWrite(vtkImageData* image, const char* fil
 void vtkThreadedImageWriter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "MaxThreads: " << this->MaxThreads << "\n";
+  os << indent << "ParallelEncoding: " << (this->ParallelEncoding ? "On" : "Off") << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -52,6 +52,20 @@ public:
   void SetMaxThreads(vtkTypeUInt32);
   vtkGetMacro(MaxThreads, vtkTypeUInt32);
 
+  ///@{
+  /**
+   * Encode the PNG and JPEG images with their ParallelEncoding option on, so
+   * that the bands of rows of each image are encoded concurrently. This helps
+   * when fewer images are queued than there are threads, e.g. for large
+   * images written one at a time. JPEG images are then written as baseline
+   * instead of progressive. Initialize() need to be called after any change.
+   * Default is off.
+   */
+  vtkSetMacro(ParallelEncoding, bool);
+  vtkGetMacro(ParallelEncoding, bool);
+  vtkBooleanMacro(ParallelEncoding, bool);
+  ///@}
+
   /**
    * This method will wait for any running thread to terminate.
    */
@@ -68,6 +82,7 @@ private:
   class vtkInternals;
   vtkInternals* Internals;
   vtkTypeUInt32 MaxThreads;
+  bool ParallelEncoding;
 };
 
 VTK_ABI_NAMESPACE_END
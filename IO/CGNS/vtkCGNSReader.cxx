@@ -513,6 +513,15 @@ public:
 
   static std::string GenerateMeshKey(const char* baseName, const char* zoneName);
 
+  /**
+   * Find the cached points of a zone, provided they were read from the given
+   * GridCoordinates_t node, or insert them.
+   */
+  vtkSmartPointer<vtkPoints> FindMeshPoints(
+    const std::string& keyMesh, const std::string& gridCoordName);
+  void InsertMeshPoints(
+    const std::string& keyMesh, const std::string& gridCoordName, vtkPoints* points);
+
   static void AddZoneNameAsFieldData(
     const std::string& baseName, const std::string& zoneName, vtkFieldData* fieldData);
 
@@ -521,6 +530,8 @@ public:
 
   CGNSRead::vtkCGNSMetaData* Internal;               // Metadata
   CGNSRead::vtkCGNSCache<vtkPoints> MeshPointsCache; // Cache for the mesh points
+  std::map<std::string, std::string>
+    MeshPointsGridNames; // GridCoordinates_t node of the cached mesh points
   CGNSRead::vtkCGNSCache<vtkUnstructuredGrid>
     ConnectivitiesCache; // Cache for the mesh connectivities
 };
@@ -656,6 +667,28 @@ std::string vtkCGNSReader::vtkPrivate::GenerateMeshKey(const char* baseName, con
   return query.str();
 }
 
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkPoints> vtkCGNSReader::vtkPrivate::FindMeshPoints(
+  const std::string& keyMesh, const std::string& gridCoordName)
+{
+  auto iter = this->MeshPointsGridNames.find(keyMesh);
+  if (iter == this->MeshPointsGridNames.end() || iter->second != gridCoordName)
+  {
+    return nullptr;
+  }
+  return this->MeshPointsCache.Find(keyMesh);
+}
+
+//------------------------------------------------------------------------------
+void vtkCGNSReader::vtkPrivate::InsertMeshPoints(
+  const std::string& keyMesh, const std::string& gridCoordName, vtkPoints* points)
+{
+  // A single entry per zone is kept, so that deforming meshes do not
+  // accumulate the points of every timestep.
+  this->MeshPointsCache.Insert(keyMesh, points);
+  this->MeshPointsGridNames[keyMesh] = gridCoordName;
+}
+
 //------------------------------------------------------------------------------
 void vtkCGNSReader::vtkPrivate::AddZoneNameAsFieldData(
   const std::string& baseName, const std::string& zoneName, vtkFieldData* fieldData)
@@ -1843,9 +1876,10 @@ vtkSmartPointer<vtkDataObject> vtkCGNSReader::vtkPrivate::readCurvilinearZone(in
     return vtkSmartPointer<vtkDataObject>();
   }
 
-  // If it is not a deforming mesh, gridCoordName keep the standard name
-  // Only Volume mesh points, not subset are cached
-  bool caching = (gridCoordName == "GridCoordinates" && voi == nullptr && self->CacheMesh);
+  // Only Volume mesh points, not subset are cached. Points are reused as long
+  // as the zone refers to the same GridCoordinates_t node, i.e. for static
+  // meshes and for the timesteps of a deforming mesh that share their grid.
+  bool caching = (voi == nullptr && self->CacheMesh);
   if (caching)
   {
     // Try to get from cache
@@ -1854,7 +1888,7 @@ vtkSmartPointer<vtkDataObject> vtkCGNSReader::vtkPrivate::readCurvilinearZone(in
     // build a key /baseName/zoneName
     keyMesh = vtkPrivate::GenerateMeshKey(baseName, zoneName);
 
-    points = self->Internals->MeshPointsCache.Find(keyMesh);
+    points = self->Internals->FindMeshPoints(keyMesh, gridCoordName);
     if (points.Get() != nullptr)
     {
       // check storage data type
@@ -1959,7 +1993,7 @@ vtkSmartPointer<vtkDataObject> vtkCGNSReader::vtkPrivate::readCurvilinearZone(in
     // Add points to cache
     if (caching)
     {
-      self->Internals->MeshPointsCache.Insert(keyMesh, points);
+      self->Internals->InsertMeshPoints(keyMesh, gridCoordName, points);
     }
   }
 
@@ -2186,9 +2220,10 @@ int vtkCGNSReader::GetUnstructuredZone(
   const char* baseName = this->Internals->Internal->GetBase(base).name;
   const char* zoneName = this->Internals->Internal->GetBase(base).zones[zone].name;
 
-  // If it is not a deforming mesh, gridCoordName keep the standard name
-  // Only Volume mesh points, not subset are cached
-  bool caching = (gridCoordName == "GridCoordinates" && this->CacheMesh);
+  // Points are reused as long as the zone refers to the same GridCoordinates_t
+  // node, i.e. for static meshes and for the timesteps of a deforming mesh that
+  // share their grid.
+  bool caching = this->CacheMesh;
 
   if (caching)
   {
@@ -2196,7 +2231,7 @@ int vtkCGNSReader::GetUnstructuredZone(
     // build a key /baseName/zoneName
     keyMesh = vtkPrivate::GenerateMeshKey(baseName, zoneName);
 
-    points = this->Internals->MeshPointsCache.Find(keyMesh);
+    points = this->Internals->FindMeshPoints(keyMesh, gridCoordName);
     if (points.Get() != nullptr)
     {
       // check storage data type
@@ -2242,7 +2277,7 @@ int vtkCGNSReader::GetUnstructuredZone(
     // Add points to cache
     if (caching)
     {
-      this->Internals->MeshPointsCache.Insert(keyMesh, points);
+      this->Internals->InsertMeshPoints(keyMesh, gridCoordName, points);
     }
   }
 
@@ -2694,10 +2729,8 @@ int vtkCGNSReader::GetUnstructuredZone(
             srcStride, memStart, memEnd, memStride, memDim, localConnectivity);
 
           // Add -1 on indices due to indexing from 1
-          for (vtkIdType icell = 0; icell < elementSize * npe; ++icell)
-          {
-            localConnectivity[icell] = localConnectivity[icell] - 1;
-          }
+          vtkSMPTools::Transform(localConnectivity, localConnectivity + elementSize * npe,
+            localConnectivity, [](vtkIdType ptId) { return ptId - 1; });
 
           if (reOrderElements)
           {
@@ -6,8 +6,8 @@
 
 #include "cgio_helpers.h"
 #include "vtkCellType.h"
-#include "vtkIdTypeArray.h"
 #include "vtkMultiProcessStream.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 
@@ -667,9 +667,6 @@ void CGNS2VTKorder(vtkIdType size, const int* cells_types, vtkIdType* elements)
 void ReorderMonoCellPointsCGNS2VTK(
   vtkIdType size, int cell_type, vtkIdType numPointsPerCell, vtkIdType* elements)
 {
-  vtkNew<vtkIdTypeArray> tempArray;
-  tempArray->SetNumberOfTuples(numPointsPerCell);
-
   const int* translator;
   translator = getTranslator(cell_type);
   if (translator == nullptr)
@@ -677,19 +674,19 @@ void ReorderMonoCellPointsCGNS2VTK(
     return;
   }
 
-  vtkIdType pos = 0;
-  for (vtkIdType icell = 0; icell < size; ++icell)
-  {
-    for (vtkIdType ip = 0; ip < numPointsPerCell; ++ip)
-    {
-      tempArray->SetValue(ip, elements[translator[ip] + pos]);
-    }
-    for (vtkIdType ip = 0; ip < numPointsPerCell; ++ip)
+  // All the cells have the same number of points: reorder them concurrently.
+  vtkSMPTools::For(0, size, [&](vtkIdType begin, vtkIdType end) {
+    std::vector<vtkIdType> tmp(numPointsPerCell);
+    for (vtkIdType icell = begin; icell < end; ++icell)
     {
-      elements[pos + ip] = tempArray->GetValue(ip);
+      vtkIdType* cellPoints = elements + icell * numPointsPerCell;
+      for (vtkIdType ip = 0; ip < numPointsPerCell; ++ip)
+      {
+        tmp[ip] = cellPoints[translator[ip]];
+      }
+      std::copy(tmp.begin(), tmp.end(), cellPoints);
     }
-    pos += numPointsPerCell;
-  }
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,64 @@
+#!/usr/bin/env python
+from vtkmodules.vtkCommonCore import vtkIdList
+from vtkmodules.vtkCommonExecutionModel import vtkCompositeDataPipeline
+from vtkmodules.vtkIOEnSight import vtkGenericEnSightReader
+from vtkmodules.util.misc import vtkGetDataRoot
+VTK_DATA_ROOT = vtkGetDataRoot()
+
+# Make sure all algorithms use the composite data pipeline
+cdp = vtkCompositeDataPipeline()
+
+def read(parallel, cache=False):
+    reader = vtkGenericEnSightReader()
+    reader.SetDefaultExecutivePrototype(cdp)
+    reader.SetCaseFileName(VTK_DATA_ROOT + "/Data/EnSight/elements-bin.case")
+    reader.ReadAllVariablesOn()
+    reader.SetParallelDecoding(parallel)
+    reader.SetCacheStaticGeometry(cache)
+    reader.Update()
+    return reader
+
+def same_parts(output0, output1):
+    assert output0.GetNumberOfBlocks() == output1.GetNumberOfBlocks()
+    ids0 = vtkIdList()
+    ids1 = vtkIdList()
+    for blockNo in range(output0.GetNumberOfBlocks()):
+        part0 = output0.GetBlock(blockNo)
+        part1 = output1.GetBlock(blockNo)
+        if part0 is None:
+            assert part1 is None
+            continue
+        assert part0.GetNumberOfPoints() == part1.GetNumberOfPoints()
+        for pointId in range(part0.GetNumberOfPoints()):
+            assert part0.GetPoint(pointId) == part1.GetPoint(pointId)
+        assert part0.GetNumberOfCells() == part1.GetNumberOfCells()
+        for cellId in range(part0.GetNumberOfCells()):
+            assert part0.GetCellType(cellId) == part1.GetCellType(cellId)
+            part0.GetCellPoints(cellId, ids0)
+            part1.GetCellPoints(cellId, ids1)
+            assert [ids0.GetId(i) for i in range(ids0.GetNumberOfIds())] == \
+                [ids1.GetId(i) for i in range(ids1.GetNumberOfIds())]
+        assert part0.GetPointData().GetNumberOfArrays() == part1.GetPointData().GetNumberOfArrays()
+        assert part0.GetCellData().GetNumberOfArrays() == part1.GetCellData().GetNumberOfArrays()
+
+# Decoding the element sections concurrently gives the same parts.
+serial = read(False)
+parallel = read(True)
+same_parts(serial.GetOutput(), parallel.GetOutput())
+
+# Reading the same geometry step again reuses the cached parts.
+def part_points(output):
+    return [output.GetBlock(blockNo).GetPoints() if output.GetBlock(blockNo) else None
+            for blockNo in range(output.GetNumberOfBlocks())]
+
+cached = read(True, True)
+points = part_points(cached.GetOutput())
+cached.GetReader().Modified()
+cached.Modified()
+cached.Update()
+same_parts(serial.GetOutput(), cached.GetOutput())
+assert part_points(cached.GetOutput()) == points
+
+# Leaks without these lines
+for reader in (serial, parallel, cached):
+    reader.SetDefaultExecutivePrototype(None)
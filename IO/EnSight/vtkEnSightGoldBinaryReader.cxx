@@ -3,17 +3,22 @@
 #include "vtkEnSightGoldBinaryReader.h"
 
 #include "vtkByteSwap.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCharArray.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtksys/Encoding.hxx"
 #include "vtksys/FStream.hxx"
@@ -205,6 +210,126 @@ public:
 // This is half the precision of an int.
 #define MAXIMUM_PART_ID 65536
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Cells of an unstructured part, decoded concurrently one element section after
+// the other into preallocated arrays, and handed over to the output at once.
+class PartCells
+{
+public:
+  PartCells() { this->Reset(); }
+
+  vtkIdType GetNumberOfCells() { return this->Types->GetNumberOfValues(); }
+
+  // Append a section of elements of numPointsPerCell points each. nodeIdList
+  // lists their 1-based point ids, and pointMap, if any, the position of each
+  // point of an element in the VTK cell. The ids of the new cells are appended
+  // to cellIds.
+  void AppendFixedSize(int cellType, int numPointsPerCell, int numElements, const int* nodeIdList,
+    const unsigned char* pointMap, vtkUnstructuredGrid* output, vtkIdList* cellIds)
+  {
+    if (numElements <= 0)
+    {
+      return;
+    }
+    const vtkIdType firstCell = this->GetNumberOfCells();
+    const vtkIdType firstPoint = this->Connectivity->GetNumberOfValues();
+    const vtkIdType firstCellId = output->GetNumberOfCells() + firstCell;
+    unsigned char* types = this->Types->WritePointer(firstCell, numElements);
+    vtkIdType* offsets = this->Offsets->WritePointer(firstCell + 1, numElements);
+    vtkIdType* connectivity = this->Connectivity->WritePointer(
+      firstPoint, static_cast<vtkIdType>(numElements) * numPointsPerCell);
+    vtkIdType* ids = cellIds->WritePointer(cellIds->GetNumberOfIds(), numElements);
+
+    vtkSMPTools::For(0, numElements, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        const int* elementNodes = nodeIdList + cc * numPointsPerCell;
+        vtkIdType* cellPoints = connectivity + cc * numPointsPerCell;
+        for (int j = 0; j < numPointsPerCell; ++j)
+        {
+          cellPoints[pointMap ? pointMap[j] : j] = elementNodes[j] - 1;
+        }
+        types[cc] = static_cast<unsigned char>(cellType);
+        offsets[cc] = firstPoint + (cc + 1) * numPointsPerCell;
+        ids[cc] = firstCellId + cc;
+      }
+    });
+  }
+
+  // Append a section of polygons, whose number of points are listed in
+  // numNodesPerElement.
+  void AppendPolygons(int numElements, const int* numNodesPerElement, const int* nodeIdList,
+    vtkUnstructuredGrid* output, vtkIdList* cellIds)
+  {
+    if (numElements <= 0)
+    {
+      return;
+    }
+    const vtkIdType firstCell = this->GetNumberOfCells();
+    const vtkIdType firstPoint = this->Connectivity->GetNumberOfValues();
+    const vtkIdType firstCellId = output->GetNumberOfCells() + firstCell;
+    unsigned char* types = this->Types->WritePointer(firstCell, numElements);
+    vtkIdType* offsets = this->Offsets->WritePointer(firstCell + 1, numElements);
+    vtkIdType* ids = cellIds->WritePointer(cellIds->GetNumberOfIds(), numElements);
+
+    vtkIdType offset = firstPoint;
+    for (int cc = 0; cc < numElements; ++cc)
+    {
+      offset += numNodesPerElement[cc];
+      offsets[cc] = offset;
+    }
+    std::fill(types, types + numElements, static_cast<unsigned char>(VTK_POLYGON));
+    std::iota(ids, ids + numElements, firstCellId);
+
+    vtkIdType* connectivity = this->Connectivity->WritePointer(firstPoint, offset - firstPoint);
+    vtkSMPTools::Transform(nodeIdList, nodeIdList + (offset - firstPoint), connectivity,
+      [](int nodeId) { return static_cast<vtkIdType>(nodeId) - 1; });
+  }
+
+  // Hand the cells over to the output, after the cells it already has.
+  void Flush(vtkUnstructuredGrid* output)
+  {
+    if (this->GetNumberOfCells() == 0)
+    {
+      return;
+    }
+    if (output->GetNumberOfCells() == 0)
+    {
+      vtkNew<vtkCellArray> cells;
+      cells->SetData(this->Offsets, this->Connectivity);
+      output->SetCells(this->Types, cells);
+    }
+    else
+    {
+      // Some cells, e.g. polyhedra, were inserted one at a time before these.
+      const vtkIdType* offsets = this->Offsets->GetPointer(0);
+      const vtkIdType* connectivity = this->Connectivity->GetPointer(0);
+      for (vtkIdType cc = 0; cc < this->GetNumberOfCells(); ++cc)
+      {
+        output->InsertNextCell(
+          this->Types->GetValue(cc), offsets[cc + 1] - offsets[cc], connectivity + offsets[cc]);
+      }
+    }
+    this->Reset();
+  }
+
+private:
+  void Reset()
+  {
+    this->Offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+    this->Offsets->InsertNextValue(0);
+    this->Connectivity = vtkSmartPointer<vtkIdTypeArray>::New();
+    this->Types = vtkSmartPointer<vtkUnsignedCharArray>::New();
+  }
+
+  vtkSmartPointer<vtkIdTypeArray> Offsets;
+  vtkSmartPointer<vtkIdTypeArray> Connectivity;
+  vtkSmartPointer<vtkUnsignedCharArray> Types;
+};
+}
+
 //------------------------------------------------------------------------------
 vtkEnSightGoldBinaryReader::vtkEnSightGoldBinaryReader()
 {
@@ -1912,6 +2037,7 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
   }
 
   output->Allocate(1000);
+  ::PartCells partCells;
 
   while (lineRead && strncmp(line, "part", 4) != 0)
   {
@@ -1945,9 +2071,25 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       this->ReadFloatArray(yCoords, numPts);
       this->ReadFloatArray(zCoords, numPts);
 
-      for (i = 0; i < numPts; i++)
+      if (this->ParallelDecoding)
+      {
+        points->SetNumberOfPoints(numPts);
+        float* xyz = vtkArrayDownCast<vtkFloatArray>(points->GetData())->GetPointer(0);
+        vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType cc = begin; cc < end; ++cc)
+          {
+            xyz[3 * cc] = xCoords[cc];
+            xyz[3 * cc + 1] = yCoords[cc];
+            xyz[3 * cc + 2] = zCoords[cc];
+          }
+        });
+      }
+      else
       {
-        points->InsertNextPoint(xCoords[i], yCoords[i], zCoords[i]);
+        for (i = 0; i < numPts; i++)
+        {
+          points->InsertNextPoint(xCoords[i], yCoords[i], zCoords[i]);
+        }
       }
 
       output->SetPoints(points);
@@ -1976,12 +2118,20 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       nodeIdList = new int[numElements];
       this->ReadIntArray(nodeIdList, numElements);
 
-      vtkIdType nodeIds;
-      for (i = 0; i < numElements; i++)
+      if (this->ParallelDecoding)
       {
-        nodeIds = nodeIdList[i] - 1;
-        cellId = output->InsertNextCell(VTK_VERTEX, 1, &nodeIds);
-        this->GetCellIds(idx, vtkEnSightReader::POINT)->InsertNextId(cellId);
+        partCells.AppendFixedSize(VTK_VERTEX, 1, numElements, nodeIdList, nullptr, output,
+          this->GetCellIds(idx, vtkEnSightReader::POINT));
+      }
+      else
+      {
+        vtkIdType nodeIds;
+        for (i = 0; i < numElements; i++)
+        {
+          nodeIds = nodeIdList[i] - 1;
+          cellId = output->InsertNextCell(VTK_VERTEX, 1, &nodeIds);
+          this->GetCellIds(idx, vtkEnSightReader::POINT)->InsertNextId(cellId);
+        }
       }
 
       delete[] nodeIdList;
@@ -2025,15 +2175,23 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       nodeIdList = new int[numElements * 2];
       this->ReadIntArray(nodeIdList, numElements * 2);
 
-      vtkIdType nodeIds[2];
-      for (i = 0; i < numElements; i++)
+      if (this->ParallelDecoding)
       {
-        for (j = 0; j < 2; j++)
+        partCells.AppendFixedSize(VTK_LINE, 2, numElements, nodeIdList, nullptr, output,
+          this->GetCellIds(idx, vtkEnSightReader::BAR2));
+      }
+      else
+      {
+        vtkIdType nodeIds[2];
+        for (i = 0; i < numElements; i++)
         {
-          nodeIds[j] = nodeIdList[2 * i + j] - 1;
+          for (j = 0; j < 2; j++)
+          {
+            nodeIds[j] = nodeIdList[2 * i + j] - 1;
+          }
+          cellId = output->InsertNextCell(VTK_LINE, 2, nodeIds);
+          this->GetCellIds(idx, vtkEnSightReader::BAR2)->InsertNextId(cellId);
         }
-        cellId = output->InsertNextCell(VTK_LINE, 2, nodeIds);
-        this->GetCellIds(idx, vtkEnSightReader::BAR2)->InsertNextId(cellId);
       }
 
       delete[] nodeIdList;
@@ -2078,15 +2236,24 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       nodeIdList = new int[numElements * 3];
       this->ReadIntArray(nodeIdList, numElements * 3);
 
-      vtkIdType nodeIds[3];
-      for (i = 0; i < numElements; i++)
+      if (this->ParallelDecoding)
+      {
+        const unsigned char bar3Map[3] = { 0, 2, 1 };
+        partCells.AppendFixedSize(VTK_QUADRATIC_EDGE, 3, numElements, nodeIdList, bar3Map, output,
+          this->GetCellIds(idx, vtkEnSightReader::BAR3));
+      }
+      else
       {
-        nodeIds[0] = nodeIdList[3 * i] - 1;
-        nodeIds[1] = nodeIdList[3 * i + 2] - 1;
-        nodeIds[2] = nodeIdList[3 * i + 1] - 1;
+        vtkIdType nodeIds[3];
+        for (i = 0; i < numElements; i++)
+        {
+          nodeIds[0] = nodeIdList[3 * i] - 1;
+          nodeIds[1] = nodeIdList[3 * i + 2] - 1;
+          nodeIds[2] = nodeIdList[3 * i + 1] - 1;
 
-        cellId = output->InsertNextCell(VTK_QUADRATIC_EDGE, 3, nodeIds);
-        this->GetCellIds(idx, vtkEnSightReader::BAR3)->InsertNextId(cellId);
+          cellId = output->InsertNextCell(VTK_QUADRATIC_EDGE, 3, nodeIds);
+          this->GetCellIds(idx, vtkEnSightReader::BAR3)->InsertNextId(cellId);
+        }
       }
 
       delete[] nodeIdList;
@@ -2142,18 +2309,26 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       nodeIdList = new int[numNodes];
       this->ReadIntArray(nodeIdList, numNodes);
 
-      for (i = 0; i < numElements; i++)
+      if (this->ParallelDecoding)
       {
-        vtkIdType* nodeIds = new vtkIdType[numNodesPerElement[i]];
-        for (j = 0; j < numNodesPerElement[i]; j++)
+        partCells.AppendPolygons(
+          numElements, numNodesPerElement, nodeIdList, output, this->GetCellIds(idx, cellType));
+      }
+      else
+      {
+        for (i = 0; i < numElements; i++)
         {
-          nodeIds[j] = nodeIdList[nodeCount] - 1;
-          nodeCount++;
-        }
-        cellId = output->InsertNextCell(VTK_POLYGON, numNodesPerElement[i], nodeIds);
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
+          vtkIdType* nodeIds = new vtkIdType[numNodesPerElement[i]];
+          for (j = 0; j < numNodesPerElement[i]; j++)
+          {
+            nodeIds[j] = nodeIdList[nodeCount] - 1;
+            nodeCount++;
+          }
+          cellId = output->InsertNextCell(VTK_POLYGON, numNodesPerElement[i], nodeIds);
+          this->GetCellIds(idx, cellType)->InsertNextId(cellId);
 
-        delete[] nodeIds;
+          delete[] nodeIds;
+        }
       }
 
       delete[] nodeIdList;
@@ -2227,26 +2402,36 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->ReadIntArray(nodeIdList, numElements * 3);
       }
 
-      vtkIdType nodeIds[6];
-      for (i = 0; i < numElements; i++)
+      if (this->ParallelDecoding)
+      {
+        const bool quadratic = cellType == vtkEnSightReader::TRIA6;
+        partCells.AppendFixedSize(quadratic ? VTK_QUADRATIC_TRIANGLE : VTK_TRIANGLE,
+          quadratic ? 6 : 3, numElements, nodeIdList, nullptr, output,
+          this->GetCellIds(idx, cellType));
+      }
+      else
       {
-        if (cellType == vtkEnSightReader::TRIA6)
+        vtkIdType nodeIds[6];
+        for (i = 0; i < numElements; i++)
         {
-          for (j = 0; j < 6; j++)
+          if (cellType == vtkEnSightReader::TRIA6)
           {
-            nodeIds[j] = nodeIdList[6 * i + j] - 1;
+            for (j = 0; j < 6; j++)
+            {
+              nodeIds[j] = nodeIdList[6 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_QUADRATIC_TRIANGLE, 6, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_TRIANGLE, 6, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 3; j++)
+          else
           {
-            nodeIds[j] = nodeIdList[3 * i + j] - 1;
+            for (j = 0; j < 3; j++)
+            {
+              nodeIds[j] = nodeIdList[3 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_TRIANGLE, 3, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_TRIANGLE, 3, nodeIds);
+          this->GetCellIds(idx, cellType)->InsertNextId(cellId);
         }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
       }
 
       delete[] nodeIdList;
@@ -2325,26 +2510,35 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->ReadIntArray(nodeIdList, numElements * 4);
       }
 
-      vtkIdType nodeIds[8];
-      for (i = 0; i < numElements; i++)
+      if (this->ParallelDecoding)
       {
-        if (cellType == vtkEnSightReader::QUAD8)
+        const bool quadratic = cellType == vtkEnSightReader::QUAD8;
+        partCells.AppendFixedSize(quadratic ? VTK_QUADRATIC_QUAD : VTK_QUAD, quadratic ? 8 : 4,
+          numElements, nodeIdList, nullptr, output, this->GetCellIds(idx, cellType));
+      }
+      else
+      {
+        vtkIdType nodeIds[8];
+        for (i = 0; i < numElements; i++)
         {
-          for (j = 0; j < 8; j++)
+          if (cellType == vtkEnSightReader::QUAD8)
           {
-            nodeIds[j] = nodeIdList[8 * i + j] - 1;
+            for (j = 0; j < 8; j++)
+            {
+              nodeIds[j] = nodeIdList[8 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_QUADRATIC_QUAD, 8, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_QUAD, 8, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 4; j++)
+          else
           {
-            nodeIds[j] = nodeIdList[4 * i + j] - 1;
+            for (j = 0; j < 4; j++)
+            {
+              nodeIds[j] = nodeIdList[4 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_QUAD, 4, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_QUAD, 4, nodeIds);
+          this->GetCellIds(idx, cellType)->InsertNextId(cellId);
         }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
       }
 
       delete[] nodeIdList;
@@ -2473,6 +2667,8 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       vtkNew<vtkCellArray> faces; // cell array describing a vtkPolyhedron
       // yyy end
 
+      // Polyhedra are inserted one at a time, after the cells decoded so far.
+      partCells.Flush(output);
       for (i = 0; i < numElements; i++)
       {
         elementNodeCount = 0;
@@ -2565,26 +2761,35 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->ReadIntArray(nodeIdList, numElements * 4);
       }
 
-      vtkIdType nodeIds[10];
-      for (i = 0; i < numElements; i++)
+      if (this->ParallelDecoding)
       {
-        if (cellType == vtkEnSightReader::TETRA10)
+        const bool quadratic = cellType == vtkEnSightReader::TETRA10;
+        partCells.AppendFixedSize(quadratic ? VTK_QUADRATIC_TETRA : VTK_TETRA, quadratic ? 10 : 4,
+          numElements, nodeIdList, nullptr, output, this->GetCellIds(idx, cellType));
+      }
+      else
+      {
+        vtkIdType nodeIds[10];
+        for (i = 0; i < numElements; i++)
         {
-          for (j = 0; j < 10; j++)
+          if (cellType == vtkEnSightReader::TETRA10)
           {
-            nodeIds[j] = nodeIdList[10 * i + j] - 1;
+            for (j = 0; j < 10; j++)
+            {
+              nodeIds[j] = nodeIdList[10 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_QUADRATIC_TETRA, 10, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_TETRA, 10, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 4; j++)
+          else
           {
-            nodeIds[j] = nodeIdList[4 * i + j] - 1;
+            for (j = 0; j < 4; j++)
+            {
+              nodeIds[j] = nodeIdList[4 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_TETRA, 4, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_TETRA, 4, nodeIds);
+          this->GetCellIds(idx, cellType)->InsertNextId(cellId);
         }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
       }
 
       delete[] nodeIdList;
@@ -2664,26 +2869,36 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->ReadIntArray(nodeIdList, numElements * 5);
       }
 
-      vtkIdType nodeIds[13];
-      for (i = 0; i < numElements; i++)
+      if (this->ParallelDecoding)
+      {
+        const bool quadratic = cellType == vtkEnSightReader::PYRAMID13;
+        partCells.AppendFixedSize(quadratic ? VTK_QUADRATIC_PYRAMID : VTK_PYRAMID,
+          quadratic ? 13 : 5, numElements, nodeIdList, nullptr, output,
+          this->GetCellIds(idx, cellType));
+      }
+      else
       {
-        if (cellType == vtkEnSightReader::PYRAMID13)
+        vtkIdType nodeIds[13];
+        for (i = 0; i < numElements; i++)
         {
-          for (j = 0; j < 13; j++)
+          if (cellType == vtkEnSightReader::PYRAMID13)
           {
-            nodeIds[j] = nodeIdList[13 * i + j] - 1;
+            for (j = 0; j < 13; j++)
+            {
+              nodeIds[j] = nodeIdList[13 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_QUADRATIC_PYRAMID, 13, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_PYRAMID, 13, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 5; j++)
+          else
           {
-            nodeIds[j] = nodeIdList[5 * i + j] - 1;
+            for (j = 0; j < 5; j++)
+            {
+              nodeIds[j] = nodeIdList[5 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_PYRAMID, 5, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_PYRAMID, 5, nodeIds);
+          this->GetCellIds(idx, cellType)->InsertNextId(cellId);
         }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
       }
 
       delete[] nodeIdList;
@@ -2762,26 +2977,36 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
         this->ReadIntArray(nodeIdList, numElements * 8);
       }
 
-      vtkIdType nodeIds[20];
-      for (i = 0; i < numElements; i++)
+      if (this->ParallelDecoding)
       {
-        if (cellType == vtkEnSightReader::HEXA20)
+        const bool quadratic = cellType == vtkEnSightReader::HEXA20;
+        partCells.AppendFixedSize(quadratic ? VTK_QUADRATIC_HEXAHEDRON : VTK_HEXAHEDRON,
+          quadratic ? 20 : 8, numElements, nodeIdList, nullptr, output,
+          this->GetCellIds(idx, cellType));
+      }
+      else
+      {
+        vtkIdType nodeIds[20];
+        for (i = 0; i < numElements; i++)
         {
-          for (j = 0; j < 20; j++)
+          if (cellType == vtkEnSightReader::HEXA20)
           {
-            nodeIds[j] = nodeIdList[20 * i + j] - 1;
+            for (j = 0; j < 20; j++)
+            {
+              nodeIds[j] = nodeIdList[20 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_QUADRATIC_HEXAHEDRON, 20, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_HEXAHEDRON, 20, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 8; j++)
+          else
           {
-            nodeIds[j] = nodeIdList[8 * i + j] - 1;
+            for (j = 0; j < 8; j++)
+            {
+              nodeIds[j] = nodeIdList[8 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_HEXAHEDRON, 8, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_HEXAHEDRON, 8, nodeIds);
+          this->GetCellIds(idx, cellType)->InsertNextId(cellId);
         }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
       }
 
       delete[] nodeIdList;
@@ -2863,26 +3088,36 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       const unsigned char penta6Map[6] = { 0, 2, 1, 3, 5, 4 };
       const unsigned char penta15Map[15] = { 0, 2, 1, 3, 5, 4, 8, 7, 6, 11, 10, 9, 12, 14, 13 };
 
-      vtkIdType nodeIds[15];
-      for (i = 0; i < numElements; i++)
+      if (this->ParallelDecoding)
       {
-        if (cellType == vtkEnSightReader::PENTA15)
+        const bool quadratic = cellType == vtkEnSightReader::PENTA15;
+        partCells.AppendFixedSize(quadratic ? VTK_QUADRATIC_WEDGE : VTK_WEDGE, quadratic ? 15 : 6,
+          numElements, nodeIdList, quadratic ? penta15Map : penta6Map, output,
+          this->GetCellIds(idx, cellType));
+      }
+      else
+      {
+        vtkIdType nodeIds[15];
+        for (i = 0; i < numElements; i++)
         {
-          for (j = 0; j < 15; j++)
+          if (cellType == vtkEnSightReader::PENTA15)
           {
-            nodeIds[penta15Map[j]] = nodeIdList[15 * i + j] - 1;
+            for (j = 0; j < 15; j++)
+            {
+              nodeIds[penta15Map[j]] = nodeIdList[15 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_QUADRATIC_WEDGE, 15, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_QUADRATIC_WEDGE, 15, nodeIds);
-        }
-        else
-        {
-          for (j = 0; j < 6; j++)
+          else
           {
-            nodeIds[penta6Map[j]] = nodeIdList[6 * i + j] - 1;
+            for (j = 0; j < 6; j++)
+            {
+              nodeIds[penta6Map[j]] = nodeIdList[6 * i + j] - 1;
+            }
+            cellId = output->InsertNextCell(VTK_WEDGE, 6, nodeIds);
           }
-          cellId = output->InsertNextCell(VTK_WEDGE, 6, nodeIds);
+          this->GetCellIds(idx, cellType)->InsertNextId(cellId);
         }
-        this->GetCellIds(idx, cellType)->InsertNextId(cellId);
       }
 
       delete[] nodeIdList;
@@ -2926,12 +3161,14 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
     }
     else if (strncmp(line, "END TIME STEP", 13) == 0)
     {
+      partCells.Flush(output);
       return 1;
     }
     else if (this->IS && this->IS->fail())
     {
       // May want consistency check here?
       // vtkWarningMacro("EOF on geometry file");
+      partCells.Flush(output);
       return 1;
     }
     else
@@ -2947,6 +3184,7 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
     }
     lineRead = this->ReadLine(line);
   }
+  partCells.Flush(output);
   this->ApplyRigidBodyTransforms(partId, name, output);
 
   return lineRead;
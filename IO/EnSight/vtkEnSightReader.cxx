@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkEnSightReader.h"
 
+#include "vtkCompositeDataSet.h"
 #include "vtkDataArrayCollection.h"
 #include "vtkDoubleArray.h"
 #include "vtkIdList.h"
@@ -33,6 +34,32 @@ class vtkEnSightReaderCellIdsType : public vtkEnSightReaderCellIdsTypeBase
 {
 };
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Shallow copy the parts of source, and their names, into target.
+void CopyParts(vtkMultiBlockDataSet* source, vtkMultiBlockDataSet* target)
+{
+  for (unsigned int blockNo = 0; blockNo < source->GetNumberOfBlocks(); ++blockNo)
+  {
+    vtkDataObject* part = source->GetBlock(blockNo);
+    if (!part)
+    {
+      continue;
+    }
+    auto copy = vtk::TakeSmartPointer(part->NewInstance());
+    copy->ShallowCopy(part);
+    target->SetBlock(blockNo, copy);
+    if (source->HasMetaData(blockNo) &&
+      source->GetMetaData(blockNo)->Has(vtkCompositeDataSet::NAME()))
+    {
+      target->GetMetaData(blockNo)->Set(vtkCompositeDataSet::NAME(),
+        source->GetMetaData(blockNo)->Get(vtkCompositeDataSet::NAME()));
+    }
+  }
+}
+}
+
 //------------------------------------------------------------------------------
 vtkEnSightReader::vtkEnSightReader()
 {
@@ -159,6 +186,7 @@ vtkEnSightReader::~vtkEnSightReader()
 void vtkEnSightReader::ClearForNewCaseFileName()
 {
   this->UnstructuredPartIds->Reset();
+  this->GeometryCache = nullptr;
   vtkGenericEnSightReader::ClearForNewCaseFileName();
 }
 
@@ -287,11 +315,34 @@ int vtkEnSightReader::RequestData(vtkInformation* vtkNotUsed(request),
       }
     }
 
-    if (!this->ReadGeometryFile(fileName, timeStepInFile, output))
+    const bool cacheGeometry = this->CacheStaticGeometry && this->RigidBodyTransforms.empty();
+    if (cacheGeometry && this->GeometryCache && this->GeometryCacheFileName == fileName &&
+      this->GeometryCacheTimeStepInFile == timeStepInFile)
     {
-      vtkErrorMacro("error reading geometry file");
-      delete[] fileName;
-      return 0;
+      // The cell ids of the parts, by element type, are still those of the
+      // cached geometry.
+      ::CopyParts(this->GeometryCache, output);
+      this->NumberOfGeometryParts = this->GeometryCacheNumberOfGeometryParts;
+      this->NumberOfNewOutputs = this->GeometryCacheNumberOfNewOutputs;
+    }
+    else
+    {
+      this->GeometryCache = nullptr;
+      if (!this->ReadGeometryFile(fileName, timeStepInFile, output))
+      {
+        vtkErrorMacro("error reading geometry file");
+        delete[] fileName;
+        return 0;
+      }
+      if (cacheGeometry)
+      {
+        this->GeometryCache = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+        ::CopyParts(output, this->GeometryCache);
+        this->GeometryCacheFileName = fileName;
+        this->GeometryCacheTimeStepInFile = timeStepInFile;
+        this->GeometryCacheNumberOfGeometryParts = this->NumberOfGeometryParts;
+        this->GeometryCacheNumberOfNewOutputs = this->NumberOfNewOutputs;
+      }
     }
 
     delete[] fileName;
@@ -13,6 +13,7 @@
 #include "vtkSmartPointer.h"    // for vtkSmartPointer
 
 #include <map>    // for std::map
+#include <string> // for std::string
 #include <vector> // for std::vector
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -434,6 +435,14 @@ protected:
   bool UseEulerTimeSteps;
   vtkSmartPointer<vtkDoubleArray> EulerTimeSteps;
 
+  // Parts read from the geometry file, reused by the next time steps that read
+  // the same step of the same geometry file when CacheStaticGeometry is on.
+  vtkSmartPointer<vtkMultiBlockDataSet> GeometryCache;
+  std::string GeometryCacheFileName;
+  int GeometryCacheTimeStepInFile = 0;
+  int GeometryCacheNumberOfGeometryParts = 0;
+  int GeometryCacheNumberOfNewOutputs = 0;
+
 private:
   vtkEnSightReader(const vtkEnSightReader&) = delete;
   void operator=(const vtkEnSightReader&) = delete;
@@ -863,6 +863,8 @@ int vtkGenericEnSightReader::RequestInformation(
   this->Reader->SetByteOrder(this->ByteOrder);
   this->Reader->RequestInformation(request, inputVector, outputVector);
   this->Reader->SetParticleCoordinatesByIndex(this->ParticleCoordinatesByIndex);
+  this->Reader->SetParallelDecoding(this->ParallelDecoding);
+  this->Reader->SetCacheStaticGeometry(this->CacheStaticGeometry);
 
   this->SetTimeSets(this->Reader->GetTimeSets());
   if (!this->TimeValueInitialized)
@@ -1424,6 +1426,8 @@ void vtkGenericEnSightReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "ReadAllVariables: " << this->ReadAllVariables << endl;
   os << indent << "ByteOrder: " << this->ByteOrder << endl;
   os << indent << "ParticleCoordinatesByIndex: " << this->ParticleCoordinatesByIndex << endl;
+  os << indent << "ParallelDecoding: " << this->ParallelDecoding << endl;
+  os << indent << "CacheStaticGeometry: " << this->CacheStaticGeometry << endl;
   os << indent << "CellDataArraySelection: " << this->CellDataArraySelection << endl;
   os << indent << "PointDataArraySelection: " << this->PointDataArraySelection << endl;
   os << indent
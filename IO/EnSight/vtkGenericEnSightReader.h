@@ -283,6 +283,31 @@ public:
   vtkSetMacro(ApplyTetrahedralize, bool);
   ///@}
 
+  ///@{
+  /**
+   * Get/set whether the element sections of the unstructured parts of EnSight
+   * Gold binary geometry files are decoded concurrently, with vtkSMPTools, into
+   * preallocated cell arrays instead of inserting the cells one at a time.
+   * Default is false.
+   */
+  vtkGetMacro(ParallelDecoding, bool);
+  vtkSetMacro(ParallelDecoding, bool);
+  vtkBooleanMacro(ParallelDecoding, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Get/set whether the geometry is kept across time steps that read the same
+   * step of the same geometry file, e.g. when the case file declares the model
+   * without a time set. The parts are then only read once and their points and
+   * cells are shared by the outputs of these time steps. This is not done when
+   * rigid body transforms are applied to the parts. Default is false.
+   */
+  vtkGetMacro(CacheStaticGeometry, bool);
+  vtkSetMacro(CacheStaticGeometry, bool);
+  vtkBooleanMacro(CacheStaticGeometry, bool);
+  ///@}
+
 protected:
   vtkGenericEnSightReader();
   ~vtkGenericEnSightReader() override;
@@ -454,6 +479,8 @@ protected:
   TranslationTableType* TranslationTable;
 
   bool ApplyTetrahedralize = false;
+  bool ParallelDecoding = false;
+  bool CacheStaticGeometry = false;
 
 private:
   vtkGenericEnSightReader(const vtkGenericEnSightReader&) = delete;
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// .NAME Test of CacheMesh for vtkExodusIIReader
+// .SECTION Description
+// Read several time steps with and without CacheMesh, and check that they
+// read the same points and arrays, and that the cached mesh is shared by the
+// outputs of the time steps when no displacements are applied.
+
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDataObjectTreeRange.h"
+#include "vtkExecutive.h"
+#include "vtkExodusIIReader.h"
+#include "vtkInformation.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <vector>
+
+namespace
+{
+std::vector<vtkUnstructuredGrid*> GetBlocks(vtkExodusIIReader* reader)
+{
+  std::vector<vtkUnstructuredGrid*> blocks;
+  for (vtkDataObject* block : vtk::Range(reader->GetOutput(),
+         vtk::DataObjectTreeOptions::TraverseSubTree | vtk::DataObjectTreeOptions::SkipEmptyNodes |
+           vtk::DataObjectTreeOptions::VisitOnlyLeaves))
+  {
+    blocks.push_back(vtkUnstructuredGrid::SafeDownCast(block));
+  }
+  return blocks;
+}
+
+bool SameValues(vtkDataArray* array0, vtkDataArray* array1)
+{
+  if (!array0 || !array1 || array0->GetNumberOfValues() != array1->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < array0->GetNumberOfValues(); ++i)
+  {
+    if (array0->GetVariantValue(i) != array1->GetVariantValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SameAttributes(vtkDataSetAttributes* attributes0, vtkDataSetAttributes* attributes1)
+{
+  if (attributes0->GetNumberOfArrays() != attributes1->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < attributes0->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* array0 = attributes0->GetArray(i);
+    if (array0 && !::SameValues(array0, attributes1->GetArray(array0->GetName())))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestTimeSteps(bool applyDisplacements, char* fileName)
+{
+  vtkNew<vtkExodusIIReader> reference;
+  vtkNew<vtkExodusIIReader> reader;
+  reader->CacheMeshOn();
+  for (vtkExodusIIReader* r : { reference.GetPointer(), reader.GetPointer() })
+  {
+    r->SetFileName(fileName);
+    r->SetApplyDisplacements(applyDisplacements);
+    r->UpdateInformation();
+    r->SetAllArrayStatus(vtkExodusIIReader::NODAL, 1);
+    r->SetAllArrayStatus(vtkExodusIIReader::ELEM_BLOCK, 1);
+  }
+
+  vtkInformation* outInfo = reader->GetExecutive()->GetOutputInformation(0);
+  const double* times = outInfo->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  const int numberOfTimeSteps = outInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  std::vector<vtkPoints*> firstPoints;
+  for (int step = 0; step < numberOfTimeSteps; step += 10)
+  {
+    reference->UpdateTimeStep(times[step]);
+    reader->UpdateTimeStep(times[step]);
+    if (reader->GetOutput()->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP()) !=
+      times[step])
+    {
+      std::cerr << "Error: unexpected time of time step " << step << "." << std::endl;
+      return false;
+    }
+    std::vector<vtkUnstructuredGrid*> referenceBlocks = ::GetBlocks(reference);
+    std::vector<vtkUnstructuredGrid*> blocks = ::GetBlocks(reader);
+    if (blocks.empty() || blocks.size() != referenceBlocks.size())
+    {
+      std::cerr << "Error: unexpected number of blocks at time step " << step << "." << std::endl;
+      return false;
+    }
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+      if (blocks[i]->GetNumberOfCells() != referenceBlocks[i]->GetNumberOfCells() ||
+        !::SameValues(
+          blocks[i]->GetPoints()->GetData(), referenceBlocks[i]->GetPoints()->GetData()) ||
+        !::SameAttributes(blocks[i]->GetPointData(), referenceBlocks[i]->GetPointData()) ||
+        !::SameAttributes(blocks[i]->GetCellData(), referenceBlocks[i]->GetCellData()))
+      {
+        std::cerr << "Error: block " << i << " differs from the reference at time step " << step
+                  << "." << std::endl;
+        return false;
+      }
+      if (step == 0)
+      {
+        firstPoints.push_back(blocks[i]->GetPoints());
+      }
+      else if ((blocks[i]->GetPoints() == firstPoints[i]) == applyDisplacements)
+      {
+        std::cerr << "Error: the points of block " << i << " are "
+                  << (applyDisplacements ? "reused" : "not reused") << " at time step " << step
+                  << "." << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestExodusCacheMesh(int argc, char* argv[])
+{
+  char* fileName = vtkTestUtilities::ExpandDataFileName(argc, argv, "Data/can.ex2");
+  if (!fileName)
+  {
+    std::cerr << "Could not obtain filename for test data." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  bool success = ::TestTimeSteps(false, fileName);
+  success &= ::TestTimeSteps(true, fileName);
+  delete[] fileName;
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
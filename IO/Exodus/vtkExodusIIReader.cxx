@@ -8,6 +8,8 @@
 #include "vtkCellData.h"
 #include "vtkCellType.h"
 #include "vtkCharArray.h"
+#include "vtkDataObjectMeshCache.h"
+#include "vtkDataObjectTreeRange.h"
 #include "vtkDoubleArray.h"
 #include "vtkExodusIIReaderParser.h"
 #include "vtkFloatArray.h"
@@ -25,6 +27,7 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkSortDataArray.h"
 #include "vtkStdString.h"
@@ -539,11 +542,7 @@ int vtkExodusIIReaderPrivate::AssembleOutputPoints(
   if (this->SqueezePoints)
   {
     pts->SetNumberOfPoints(bsinfop->NextSqueezePoint);
-    std::map<vtkIdType, vtkIdType>::iterator it;
-    for (it = bsinfop->PointMap.begin(); it != bsinfop->PointMap.end(); ++it)
-    {
-      pts->SetPoint(it->second, arr->GetTuple(it->first));
-    }
+    this->SqueezedPointCopies.push_back({ arr, pts->GetData(), bsinfop });
   }
   else
   {
@@ -1369,17 +1368,7 @@ void vtkExodusIIReaderPrivate::AddPointArray(
     dest->SetName(src->GetName());
     dest->SetNumberOfComponents(src->GetNumberOfComponents());
     dest->SetNumberOfTuples(bsinfop->NextSqueezePoint);
-    std::map<vtkIdType, vtkIdType>::iterator it, itEnd;
-    //
-    // I moved the end condition of the loop out of the for(;;) loop.
-    //   Assuming it doesn't change within the loop itself!
-    //   The reason is that the code was making the call every loop.
-    //
-    itEnd = bsinfop->PointMap.end();
-    for (it = bsinfop->PointMap.begin(); it != itEnd; ++it)
-    {
-      pd->CopyTuple(src, dest, it->first, it->second);
-    }
+    this->SqueezedPointCopies.push_back({ src, dest, bsinfop });
     pd->AddArray(dest);
     dest->FastDelete();
   }
@@ -1389,6 +1378,50 @@ void vtkExodusIIReaderPrivate::AddPointArray(
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkExodusIIReaderPrivate::CopySqueezedPointTuples()
+{
+  // The file ids of the points of each block or set, in their output order,
+  // and the offsets of the copies in the range of all the tuples to copy.
+  std::map<BlockSetInfoType*, std::vector<vtkIdType>> fileIds;
+  std::vector<const std::vector<vtkIdType>*> copyFileIds;
+  std::vector<vtkIdType> offsets(1, 0);
+  for (const SqueezedPointCopy& copy : this->SqueezedPointCopies)
+  {
+    std::vector<vtkIdType>& ids = fileIds[copy.BlockSet];
+    if (ids.empty())
+    {
+      ids.resize(copy.BlockSet->NextSqueezePoint);
+      for (const auto& fileToOutput : copy.BlockSet->PointMap)
+      {
+        ids[fileToOutput.second] = fileToOutput.first;
+      }
+    }
+    copyFileIds.push_back(&ids);
+    offsets.push_back(offsets.back() + static_cast<vtkIdType>(ids.size()));
+  }
+
+  vtkSMPTools::For(0, offsets.back(), [&](vtkIdType begin, vtkIdType end) {
+    size_t copyIdx = std::upper_bound(offsets.begin(), offsets.end(), begin) - offsets.begin() - 1;
+    for (vtkIdType i = begin; i < end; ++copyIdx)
+    {
+      vtkDataArray* src = this->SqueezedPointCopies[copyIdx].Source;
+      vtkDataArray* dest = this->SqueezedPointCopies[copyIdx].Destination;
+      const std::vector<vtkIdType>& ids = *copyFileIds[copyIdx];
+      const int numComps = std::min(src->GetNumberOfComponents(), dest->GetNumberOfComponents());
+      for (const vtkIdType last = std::min(end, offsets[copyIdx + 1]); i < last; ++i)
+      {
+        const vtkIdType outputId = i - offsets[copyIdx];
+        for (int c = 0; c < numComps; ++c)
+        {
+          dest->SetComponent(outputId, c, src->GetComponent(ids[outputId], c));
+        }
+      }
+    }
+  });
+  this->SqueezedPointCopies.clear();
+}
+
 //------------------------------------------------------------------------------
 void vtkExodusIIReaderPrivate::InsertSetNodeCopies(
   vtkIdTypeArray* refs, int otyp, int obj, SetInfoType* sinfo)
@@ -3710,6 +3743,7 @@ void vtkExodusIIReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "IgnoreFileTime: " << this->GetIgnoreFileTime() << "\n";
   os << indent << "SILUpdateStamp: " << this->SILUpdateStamp << "\n";
   os << indent << "UseLegacyBlockNames: " << this->UseLegacyBlockNames << "\n";
+  os << indent << "CacheMesh: " << this->CacheMesh << "\n";
   if (this->Metadata)
   {
     os << indent << "Metadata:\n";
@@ -4482,7 +4516,8 @@ int vtkExodusIIReaderPrivate::RequestInformation()
   return 0;
 }
 
-int vtkExodusIIReaderPrivate::RequestData(vtkIdType timeStep, vtkMultiBlockDataSet* output)
+int vtkExodusIIReaderPrivate::RequestData(
+  vtkIdType timeStep, vtkMultiBlockDataSet* output, bool assembleMesh)
 {
   // The work done here depends on several conditions:
   // - Has connectivity changed (i.e., has block/set status changed)?
@@ -4573,7 +4608,10 @@ int vtkExodusIIReaderPrivate::RequestData(vtkIdType timeStep, vtkMultiBlockDataS
 
         // Now prepare points.
         // These shouldn't change unless the connectivity has changed.
-        this->AssembleOutputPoints(timeStep, bsinfop, ug);
+        if (assembleMesh)
+        {
+          this->AssembleOutputPoints(timeStep, bsinfop, ug);
+        }
 
         // Then, add the desired arrays from cache (or disk)
         // Point and cell arrays are handled differently because they
@@ -4609,6 +4647,9 @@ int vtkExodusIIReaderPrivate::RequestData(vtkIdType timeStep, vtkMultiBlockDataS
     }
   }
 
+  // The squeezed point arrays of all the blocks and sets are read, copy them.
+  this->CopySqueezedPointTuples();
+
   this->CloseFile();
 
   return 0;
@@ -5327,6 +5368,9 @@ vtkExodusIIReader::vtkExodusIIReader()
   this->DisplayType = 0;
   this->SILUpdateStamp = -1;
   this->UseLegacyBlockNames = false;
+  this->CacheMesh = 0;
+  this->MeshCache = vtkDataObjectMeshCache::New();
+  this->MeshCache->SetConsumer(this);
   this->SetNumberOfInputPorts(0);
 }
 
@@ -5336,6 +5380,7 @@ vtkExodusIIReader::~vtkExodusIIReader()
   this->SetFileName(nullptr);
 
   this->SetMetadata(nullptr);
+  this->MeshCache->Delete();
   // this->SetExodusModel( 0 );
 }
 
@@ -5588,8 +5633,71 @@ int vtkExodusIIReader::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
+  // The mesh can be reused when the points do not move, and when the reader
+  // was not modified since the mesh was cached: otherwise blocks, sets or
+  // points may have been added or removed.
+  bool staticMesh = this->CacheMesh &&
+    !(this->Metadata->ApplyDisplacements &&
+      this->Metadata->FindDisplacementVectors(this->TimeStep));
+  if (!staticMesh)
+  {
+    this->MeshCache->InvalidateCache();
+  }
+  else
+  {
+    vtkDataObjectMeshCache::Status status = this->MeshCache->GetStatus();
+    if (status.CacheDefined && status.ConsumerUnmodified)
+    {
+      vtkNew<vtkMultiBlockDataSet> arrays;
+      this->Metadata->RequestData(this->TimeStep, arrays, /*assembleMesh=*/false);
+      this->MeshCache->CopyCacheToDataObject(output);
+
+      // Both have the same structure, pass the new arrays to the cached mesh.
+      auto options = vtk::DataObjectTreeOptions::TraverseSubTree |
+        vtk::DataObjectTreeOptions::SkipEmptyNodes | vtk::DataObjectTreeOptions::VisitOnlyLeaves;
+      auto arraysRange = vtk::Range(arrays.GetPointer(), options);
+      auto outputRange = vtk::Range(output, options);
+      auto arraysBlock = arraysRange.begin();
+      for (auto outputBlock = outputRange.begin();
+           outputBlock != outputRange.end() && arraysBlock != arraysRange.end();
+           ++outputBlock, ++arraysBlock)
+      {
+        vtkDataSet* source = vtkDataSet::SafeDownCast(*arraysBlock);
+        vtkDataSet* dest = vtkDataSet::SafeDownCast(*outputBlock);
+        if (source && dest)
+        {
+          dest->GetPointData()->ShallowCopy(source->GetPointData());
+          dest->GetCellData()->ShallowCopy(source->GetCellData());
+          dest->GetFieldData()->ShallowCopy(source->GetFieldData());
+        }
+      }
+      return 1;
+    }
+  }
+
   this->Metadata->RequestData(this->TimeStep, output);
 
+  if (staticMesh)
+  {
+    // Only cache the mesh, without the arrays and the time of this time step.
+    vtkNew<vtkMultiBlockDataSet> mesh;
+    mesh->ShallowCopy(output);
+    mesh->GetInformation()->Remove(vtkDataObject::DATA_TIME_STEP());
+    for (vtkDataObject* block : vtk::Range(mesh.GetPointer(),
+           vtk::DataObjectTreeOptions::TraverseSubTree |
+             vtk::DataObjectTreeOptions::SkipEmptyNodes |
+             vtk::DataObjectTreeOptions::VisitOnlyLeaves))
+    {
+      if (vtkDataSet* dataSet = vtkDataSet::SafeDownCast(block))
+      {
+        dataSet->GetPointData()->Initialize();
+        dataSet->GetCellData()->Initialize();
+        dataSet->GetFieldData()->Initialize();
+      }
+    }
+    this->MeshCache->UpdateCache(mesh);
+  }
+
   return 1;
 }
 
@@ -17,6 +17,14 @@
  * arrays to load with the methods "SetPointResultArrayStatus" and
  * "SetElementResultArrayStatus".  The reader DOES NOT respond to piece requests
  *
+ * When CacheMesh is on and the points do not move over time, i.e. there are
+ * no displacements to apply, the mesh read for a time step is kept in a
+ * vtkDataObjectMeshCache. Reading another time step then only reads the
+ * arrays, and the output blocks share the points and cells of the previous
+ * output, so that their mesh MTime does not change.
+ *
+ * The point arrays of the blocks and sets are squeezed (see SqueezePoints)
+ * concurrently with vtkSMPTools, once they have been read from the file.
  */
 
 #ifndef vtkExodusIIReader_h
@@ -27,6 +35,7 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkDataArray;
+class vtkDataObjectMeshCache;
 class vtkDataSet;
 class vtkExodusIICache;
 class vtkExodusIIReaderPrivate;
@@ -794,6 +803,17 @@ public:
   bool GetSqueezePoints();
   ///@}
 
+  ///@{
+  /**
+   * Reuse the mesh of the previous time step when only the arrays change,
+   * i.e. when no displacements are applied to the points and the reader
+   * was not modified since. Default is off.
+   */
+  vtkSetMacro(CacheMesh, vtkTypeBool);
+  vtkGetMacro(CacheMesh, vtkTypeBool);
+  vtkBooleanMacro(CacheMesh, vtkTypeBool);
+  ///@}
+
   virtual void Dump();
 
   /**
@@ -904,6 +924,9 @@ private:
   int ModeShapesRange[2];
 
   bool UseLegacyBlockNames;
+
+  vtkTypeBool CacheMesh;
+  vtkDataObjectMeshCache* MeshCache;
 };
 
 VTK_ABI_NAMESPACE_END
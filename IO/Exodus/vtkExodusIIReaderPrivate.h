@@ -9,6 +9,7 @@
 #include "vtkExodusIICache.h"  // for vtkExodusIICacheKey
 #include "vtkExodusIIReader.h" // for vtkExodusIIReader
 #include "vtkObject.h"
+#include "vtkSmartPointer.h"            // for vtkSmartPointer
 #include "vtkStdString.h"               // for vtkStdString
 #include "vtksys/RegularExpression.hxx" // for vtksys::RegularExpression
 
@@ -49,8 +50,12 @@ public:
   /// Returns the SIL. This valid only after BuildSIL() has been called.
   vtkMutableDirectedGraph* GetSIL() { return this->SIL; }
 
-  /// Read requested data and store in unstructured grid.
-  int RequestData(vtkIdType timeStep, vtkMultiBlockDataSet* output);
+  /** Read requested data and store in unstructured grid.
+   * When \a assembleMesh is false, the blocks and sets of the output only
+   * hold their arrays: their points are not read, as when the mesh of a
+   * previous time step is reused.
+   */
+  int RequestData(vtkIdType timeStep, vtkMultiBlockDataSet* output, bool assembleMesh = true);
 
   /** Description:
    * Prepare a data set with the proper structure and arrays but no cells.
@@ -615,6 +620,13 @@ protected:
   /// Add a point array to an output grid's point data, squeezing if necessary
   void AddPointArray(vtkDataArray* src, BlockSetInfoType* bsinfop, vtkUnstructuredGrid* output);
 
+  /** Copy the tuples of the squeezed point arrays queued by AddPointArray()
+   * and AssembleOutputPoints(). The copies of all the blocks and sets are
+   * done concurrently once their arrays have been read, since the file
+   * itself cannot be read from several threads.
+   */
+  void CopySqueezedPointTuples();
+
   /// Insert cells referenced by a node set.
   void InsertSetNodeCopies(vtkIdTypeArray* refs, int otyp, int obj, SetInfoType* sinfo);
 
@@ -837,6 +849,15 @@ protected:
    */
   int SqueezePoints;
 
+  /// A squeezed point array, whose tuples are copied by CopySqueezedPointTuples().
+  struct SqueezedPointCopy
+  {
+    vtkSmartPointer<vtkDataArray> Source;
+    vtkSmartPointer<vtkDataArray> Destination;
+    BlockSetInfoType* BlockSet;
+  };
+  std::vector<SqueezedPointCopy> SqueezedPointCopies;
+
   /** Pointer to owning reader... this is not registered in order to avoid
    * circular references.
    */
@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Read the fields of a time step one file after the other and concurrently,
+// and check that both give the same arrays.
+
+#include "vtkOpenFOAMReader.h"
+
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkFieldData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include "vtkTestUtilities.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace
+{
+vtkSmartPointer<vtkUnstructuredGrid> ReadInternalMesh(const std::string& fileName, bool parallel)
+{
+  vtkNew<vtkOpenFOAMReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->CreateCellToPointOn();
+  reader->SetParallelFieldReading(parallel);
+  reader->UpdateInformation();
+  reader->SetTimeValue(2.5);
+  reader->Update();
+
+  auto internalMesh = vtkUnstructuredGrid::SafeDownCast(reader->GetOutput()->GetBlock(0));
+  if (!internalMesh)
+  {
+    return nullptr;
+  }
+  auto copy = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  copy->ShallowCopy(internalMesh);
+  return copy;
+}
+
+bool SameArrays(vtkFieldData* fields0, vtkFieldData* fields1, const char* what)
+{
+  if (fields0->GetNumberOfArrays() == 0 ||
+    fields0->GetNumberOfArrays() != fields1->GetNumberOfArrays())
+  {
+    std::cerr << "Error: unexpected number of " << what << " arrays." << std::endl;
+    return false;
+  }
+  for (int arrayI = 0; arrayI < fields0->GetNumberOfArrays(); ++arrayI)
+  {
+    vtkDataArray* array0 = fields0->GetArray(arrayI);
+    vtkDataArray* array1 = fields1->GetArray(array0->GetName());
+    if (!array1 || array0->GetDataType() != array1->GetDataType() ||
+      array0->GetDataSize() != array1->GetDataSize() ||
+      memcmp(array0->GetVoidPointer(0), array1->GetVoidPointer(0),
+        array0->GetDataSize() * array0->GetDataTypeSize()) != 0)
+    {
+      std::cerr << "Error: " << what << " array " << array0->GetName() << " differs."
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestOpenFOAMReaderParallelFields(int argc, char* argv[])
+{
+  char* fileNameC =
+    vtkTestUtilities::ExpandDataFileName(argc, argv, "Data/OpenFOAM/cavity/cavity.foam");
+  const std::string fileName(fileNameC);
+  delete[] fileNameC;
+
+  auto serial = ::ReadInternalMesh(fileName, false);
+  auto parallel = ::ReadInternalMesh(fileName, true);
+  if (!serial || !parallel)
+  {
+    std::cerr << "Error: missing internal mesh." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  bool success = ::SameArrays(serial->GetCellData(), parallel->GetCellData(), "cell");
+  success &= ::SameArrays(serial->GetPointData(), parallel->GetPointData(), "point");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
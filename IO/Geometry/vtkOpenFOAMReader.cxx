@@ -197,6 +197,7 @@
 #include "vtkTypeTraits.h"
 #include "vtkTypeUInt8Array.h"
 #include "vtkUnstructuredGrid.h"
+#include "vtkValueFromString.h"
 #include "vtkVertex.h"
 #include "vtkWedge.h"
 
@@ -1257,9 +1258,24 @@ private:
   // Convert OpenFOAM dimension array to string
   std::string ConstructDimensions(const vtkFoamDict& dict) const;
 
+  // A field file and the dictionary read from it
+  struct vtkFoamFieldFile
+  {
+    std::unique_ptr<vtkFoamIOobject> IO;
+    std::unique_ptr<vtkFoamDict> Dict;
+    bool Valid = false;
+  };
+
+  // Field files of the current time step read ahead, by name
+  std::map<std::string, vtkFoamFieldFile> ReadAheadFieldFiles;
+
   // read and create cell/point fields
   bool ReadFieldFile(vtkFoamIOobject& io, vtkFoamDict& dict, const std::string& varName,
     const vtkDataArraySelection* selection);
+  void ReadFieldFilesAhead(
+    const std::vector<std::pair<std::string, const vtkDataArraySelection*>>& fields);
+  vtkFoamFieldFile TakeFieldFile(
+    const std::string& varName, const vtkDataArraySelection* selection);
   vtkSmartPointer<vtkFloatArray> FillField(vtkFoamEntry& entry, vtkIdType nElements,
     const vtkFoamIOobject& io, vtkFoamTypes::dataType fieldDataType);
   void GetVolFieldAtTimeStep(const std::string& varName, bool isInternalField = false);
@@ -2547,7 +2563,11 @@ public:
           return true;
         }
         buf[charI] = '\0';
-        token = strtod(buf, nullptr);
+        {
+          double value = 0.0;
+          vtkValueFromString(buf, buf + charI, value);
+          token = value;
+        }
         this->PutBack(c);
         break;
       case ';':
@@ -2924,9 +2944,9 @@ vtkTypeInt64 vtkFoamFile::ReadIntegerValue()
   return negNum ? -num : num;
 }
 
-// extremely simplified high-performing string to floating point
-// conversion code based on
-// ParaView3/VTK/Utilities/vtksqlite/vtk_sqlite3.c
+// specialized for reading a floating point value.
+// the characters of the number are converted with fast_float, through
+// vtkValueFromString, instead of the standard strtod() for speed reason.
 double vtkFoamFile::ReadDoubleValue()
 {
   // skip prepending invalid chars
@@ -2967,85 +2987,55 @@ double vtkFoamFile::ReadDoubleValue()
     this->ThrowUnexpectedNondigitException(c);
   }
 
-  double num = 0;
+  // gather the integer, decimal and exponent parts, then convert them with
+  // correct rounding
+  constexpr int MAXLEN = 128;
+  char buf[MAXLEN];
+  int charI = 0;
+  const auto append = [&](int ch) {
+    if (charI == MAXLEN)
+    {
+      this->ThrowStackTrace("Number too long");
+    }
+    buf[charI++] = static_cast<char>(ch);
+  };
+  if (negNum)
+  {
+    append('-');
+  }
 
   // read integer part (before '.')
-  if (c != '.')
+  while (isdigit(c))
   {
-    num = c - '0';
-    while (isdigit(c = this->Getc()))
-    {
-      num = num * 10.0 + (c - '0');
-    }
+    append(c);
+    c = this->Getc();
   }
 
   // read decimal part (after '.')
   if (c == '.')
   {
-    double divisor = 1.0;
-
+    append(c);
     while (isdigit(c = this->Getc()))
     {
-      num = num * 10.0 + (c - '0');
-      divisor *= 10.0;
+      append(c);
     }
-    num /= divisor;
   }
 
   // read exponent part
   if (c == 'E' || c == 'e')
   {
-    int esign = 1;
-    int eval = 0;
-    double scale = 1.0;
-
+    append(c);
     c = this->Getc();
-    if (c == '-')
-    {
-      esign = -1;
-      c = this->Getc();
-    }
-    else if (c == '+')
+    if (c == '-' || c == '+')
     {
+      append(c);
       c = this->Getc();
     }
-
     while (isdigit(c))
     {
-      eval = eval * 10 + (c - '0');
+      append(c);
       c = this->Getc();
     }
-
-    // fast exponent multiplication!
-    while (eval >= 64)
-    {
-      scale *= 1.0e+64;
-      eval -= 64;
-    }
-    while (eval >= 16)
-    {
-      scale *= 1.0e+16;
-      eval -= 16;
-    }
-    while (eval >= 4)
-    {
-      scale *= 1.0e+4;
-      eval -= 4;
-    }
-    while (eval >= 1)
-    {
-      scale *= 1.0e+1;
-      eval -= 1;
-    }
-
-    if (esign < 0)
-    {
-      num /= scale;
-    }
-    else
-    {
-      num *= scale;
-    }
   }
 
   if (c == EOF)
@@ -3054,7 +3044,12 @@ double vtkFoamFile::ReadDoubleValue()
   }
   this->PutBack(c);
 
-  return negNum ? -num : num;
+  double num = 0.0;
+  if (vtkValueFromString(buf, buf + charI, num) == 0)
+  {
+    this->ThrowStackTrace("Expected a number, found " + std::string(buf, charI));
+  }
+  return num;
 }
 
 void vtkFoamFile::ThrowStackTrace(const std::string& msg)
@@ -8750,6 +8745,64 @@ bool vtkOpenFOAMReaderPrivate::ReadFieldFile(vtkFoamIOobject& io, vtkFoamDict& d
   return true;
 }
 
+//------------------------------------------------------------------------------
+// Read field files concurrently, to be converted one after the other. Files
+// that cannot be read are left to TakeFieldFile, which reports the errors.
+void vtkOpenFOAMReaderPrivate::ReadFieldFilesAhead(
+  const std::vector<std::pair<std::string, const vtkDataArraySelection*>>& fields)
+{
+  const std::string timeRegionPath(this->CurrentTimeRegionPath() + "/");
+  std::vector<vtkFoamFieldFile> fieldFiles(fields.size());
+
+  const vtkIdType nFields = static_cast<vtkIdType>(fields.size());
+  vtkSMPTools::For(0, nFields, 1, [&](vtkIdType first, vtkIdType last) {
+    for (vtkIdType fieldi = first; fieldi < last; ++fieldi)
+    {
+      auto& fieldFile = fieldFiles[fieldi];
+      const vtkDataArraySelection* selection = fields[fieldi].second;
+      fieldFile.IO.reset(new vtkFoamIOobject(this->CasePath, this->Parent));
+      fieldFile.Dict.reset(new vtkFoamDict);
+      auto& io = *fieldFile.IO;
+      fieldFile.Valid = io.Open(timeRegionPath + fields[fieldi].first) &&
+        (!selection->ArrayExists(io.GetObjectName().c_str()) ||
+          selection->ArrayIsEnabled(io.GetObjectName().c_str())) &&
+        fieldFile.Dict->Read(io) && fieldFile.Dict->GetType() == vtkFoamToken::DICTIONARY;
+      if (!fieldFile.Valid)
+      {
+        fieldFile = vtkFoamFieldFile();
+      }
+    }
+  });
+
+  for (std::size_t fieldi = 0; fieldi < fields.size(); ++fieldi)
+  {
+    this->ReadAheadFieldFiles[fields[fieldi].first] = std::move(fieldFiles[fieldi]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Take the field file read ahead, or read it now
+vtkOpenFOAMReaderPrivate::vtkFoamFieldFile vtkOpenFOAMReaderPrivate::TakeFieldFile(
+  const std::string& varName, const vtkDataArraySelection* selection)
+{
+  vtkFoamFieldFile fieldFile;
+  auto iter = this->ReadAheadFieldFiles.find(varName);
+  if (iter != this->ReadAheadFieldFiles.end())
+  {
+    fieldFile = std::move(iter->second);
+    this->ReadAheadFieldFiles.erase(iter);
+    if (fieldFile.Valid)
+    {
+      return fieldFile;
+    }
+  }
+
+  fieldFile.IO.reset(new vtkFoamIOobject(this->CasePath, this->Parent));
+  fieldFile.Dict.reset(new vtkFoamDict);
+  fieldFile.Valid = this->ReadFieldFile(*fieldFile.IO, *fieldFile.Dict, varName, selection);
+  return fieldFile;
+}
+
 //------------------------------------------------------------------------------
 vtkSmartPointer<vtkFloatArray> vtkOpenFOAMReaderPrivate::FillField(vtkFoamEntry& entry,
   vtkIdType nElements, const vtkFoamIOobject& io, vtkFoamTypes::dataType fieldDataType)
@@ -9004,12 +9057,13 @@ void vtkOpenFOAMReaderPrivate::GetVolFieldAtTimeStep(
   const auto& patches = this->BoundaryDict;
   const bool faceOwner64Bit = ::Is64BitArray(this->FaceOwner);
 
-  vtkFoamIOobject io(this->CasePath, this->Parent);
-  vtkFoamDict dict;
-  if (!this->ReadFieldFile(io, dict, varName, this->Parent->CellDataArraySelection))
+  vtkFoamFieldFile fieldFile = this->TakeFieldFile(varName, this->Parent->CellDataArraySelection);
+  if (!fieldFile.Valid)
   {
     return;
   }
+  vtkFoamIOobject& io = *fieldFile.IO;
+  vtkFoamDict& dict = *fieldFile.Dict;
 
   // For internal field (eg, volScalarField::Internal)
   const bool hasColons = (io.GetClassName().find("::Internal") != std::string::npos);
@@ -9508,12 +9562,13 @@ void vtkOpenFOAMReaderPrivate::GetPointFieldAtTimeStep(const std::string& varNam
   // Boundary information
   const auto& patches = this->BoundaryDict;
 
-  vtkFoamIOobject io(this->CasePath, this->Parent);
-  vtkFoamDict dict;
-  if (!this->ReadFieldFile(io, dict, varName, this->Parent->PointDataArraySelection))
+  vtkFoamFieldFile fieldFile = this->TakeFieldFile(varName, this->Parent->PointDataArraySelection);
+  if (!fieldFile.Valid)
   {
     return;
   }
+  vtkFoamIOobject& io = *fieldFile.IO;
+  vtkFoamDict& dict = *fieldFile.Dict;
 
   if (io.GetClassName().compare(0, 5, "point") != 0)
   {
@@ -9732,12 +9787,13 @@ void vtkOpenFOAMReaderPrivate::GetAreaFieldAtTimeStep(const std::string& varName
     return;
   }
 
-  vtkFoamIOobject io(this->CasePath, this->Parent);
-  vtkFoamDict dict;
-  if (!this->ReadFieldFile(io, dict, varName, this->Parent->CellDataArraySelection))
+  vtkFoamFieldFile fieldFile = this->TakeFieldFile(varName, this->Parent->CellDataArraySelection);
+  if (!fieldFile.Valid)
   {
     return;
   }
+  vtkFoamIOobject& io = *fieldFile.IO;
+  vtkFoamDict& dict = *fieldFile.Dict;
 
   if (io.GetClassName().compare(0, 4, "area") != 0)
   {
@@ -10866,6 +10922,24 @@ int vtkOpenFOAMReaderPrivate::RequestData(vtkMultiBlockDataSet* output)
     }
 
     // read field data variables into Internal/Boundary meshes
+    if (this->Parent->ParallelFieldReading)
+    {
+      std::vector<std::pair<std::string, const vtkDataArraySelection*>> fields;
+      const auto addFields = [&fields](vtkStringArray* files, vtkDataArraySelection* selection) {
+        for (vtkIdType i = 0; i < files->GetNumberOfValues(); ++i)
+        {
+          fields.emplace_back(files->GetValue(i), selection);
+        }
+      };
+      addFields(this->VolFieldFiles, this->Parent->CellDataArraySelection);
+      addFields(this->DimFieldFiles, this->Parent->CellDataArraySelection);
+      addFields(this->PointFieldFiles, this->Parent->PointDataArraySelection);
+#if VTK_FOAMFILE_FINITE_AREA
+      addFields(this->AreaFieldFiles, this->Parent->CellDataArraySelection);
+#endif
+      this->ReadFieldFilesAhead(fields);
+    }
+
     vtkIdType nFieldsRead = 0;
     vtkIdType nFieldsToRead = (this->VolFieldFiles->GetNumberOfValues() +
       this->DimFieldFiles->GetNumberOfValues() + this->PointFieldFiles->GetNumberOfValues());
@@ -10896,6 +10970,7 @@ int vtkOpenFOAMReaderPrivate::RequestData(vtkMultiBlockDataSet* output)
       this->Parent->UpdateProgress(0.5 + (0.5 * ++nFieldsRead) / nFieldsToRead);
     }
 #endif
+    this->ReadAheadFieldFiles.clear();
   }
 
   // Read lagrangian mesh and fields
@@ -11029,6 +11104,9 @@ vtkOpenFOAMReader::vtkOpenFOAMReader()
   // For caching mesh
   this->CacheMesh = 1;
 
+  // For reading the field files of a time step concurrently
+  this->ParallelFieldReading = 0;
+
   // For decomposing polyhedra
   this->DecomposePolyhedra = 0;
   this->DecomposePolyhedraOld = 0;
@@ -11151,6 +11229,7 @@ void vtkOpenFOAMReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "CreateCellToPoint: " << this->CreateCellToPoint << endl;
   os << indent << "SizeAverageCellToPoint: " << this->SizeAverageCellToPoint << std::endl;
   os << indent << "CacheMesh: " << this->CacheMesh << endl;
+  os << indent << "ParallelFieldReading: " << this->ParallelFieldReading << endl;
   os << indent << "ReadZones: " << this->ReadZones << endl;
   os << indent << "AddDimensionsToArrayNames: " << this->AddDimensionsToArrayNames << endl;
 
@@ -252,6 +252,17 @@ public:
   vtkBooleanMacro(CacheMesh, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether the field files of a time step are read concurrently
+   * before being converted, at the cost of holding all of them in memory at
+   * once. Default is false.
+   */
+  vtkSetMacro(ParallelFieldReading, vtkTypeBool);
+  vtkGetMacro(ParallelFieldReading, vtkTypeBool);
+  vtkBooleanMacro(ParallelFieldReading, vtkTypeBool);
+  ///@}
+
   // Option for reading old binary lagrangian/positions format
   ///@{
   /**
@@ -363,6 +374,9 @@ protected:
   // for caching mesh
   vtkTypeBool CacheMesh;
 
+  // for reading field files concurrently
+  vtkTypeBool ParallelFieldReading;
+
   // for decomposing polyhedra on-the-fly
   vtkTypeBool DecomposePolyhedra;
 
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDataObject.h"
+#include "vtkHDFReader.h"
+#include "vtkNew.h"
+#include "vtkTestUtilities.h"
+#include "vtkTesting.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// This test reads temporal image data, unstructured grid and poly data files
+// with and without reading time steps ahead, and checks that the outputs match
+// when playing the time steps forward, backward and jumping between them.
+namespace
+{
+bool TestPrefetch(const std::string& fileName, bool useCache, int numberOfPieces)
+{
+  vtkNew<vtkHDFReader> expected;
+  vtkNew<vtkHDFReader> reader;
+  for (vtkHDFReader* r : { expected.Get(), reader.Get() })
+  {
+    r->SetFileName(fileName.c_str());
+    r->SetMergeParts(!useCache);
+  }
+  reader->SetUseCache(useCache);
+  reader->SetPrefetchTimeSteps(2);
+  expected->UpdateInformation();
+
+  const int numberOfSteps = static_cast<int>(expected->GetNumberOfSteps());
+  std::vector<int> steps;
+  for (int step = 0; step < numberOfSteps; ++step)
+  {
+    steps.emplace_back(step);
+  }
+  for (int step = numberOfSteps - 1; step >= 0; step -= 2)
+  {
+    steps.emplace_back(step);
+  }
+  steps.emplace_back(numberOfSteps / 2);
+  steps.emplace_back(numberOfSteps / 2 + 1);
+
+  for (int step : steps)
+  {
+    for (vtkHDFReader* r : { expected.Get(), reader.Get() })
+    {
+      r->SetStep(step);
+      r->UpdatePiece(numberOfPieces - 1, numberOfPieces, 0);
+    }
+    if (!vtkTestUtilities::CompareDataObjects(
+          expected->GetOutputDataObject(0), reader->GetOutputDataObject(0)))
+    {
+      std::cerr << "Step " << step << " of " << fileName << " read with " << numberOfPieces
+                << " piece(s) and UseCache " << useCache << " does not match." << std::endl;
+      return false;
+    }
+    // Leave some time to the read-ahead
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return true;
+}
+}
+
+int TestHDFReaderPrefetch(int argc, char* argv[])
+{
+  vtkNew<vtkTesting> testUtils;
+  testUtils->AddArguments(argc, argv);
+  std::string dataRoot = testUtils->GetDataRoot();
+
+  bool success = true;
+  for (const char* file : { "transient_wavelet.hdf", "transient_sphere.hdf",
+         "test_transient_poly_data.hdf" })
+  {
+    const std::string fileName = dataRoot + "/Data/" + file;
+    success &= ::TestPrefetch(fileName, false, 1);
+    success &= ::TestPrefetch(fileName, true, 1);
+    success &= ::TestPrefetch(fileName, false, 2);
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
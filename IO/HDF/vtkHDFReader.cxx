@@ -35,12 +35,16 @@
 #include <vtksys/SystemTools.hxx>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cctype>
+#include <chrono>
 #include <functional>
 #include <locale>
+#include <mutex>
 #include <numeric>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #include "vtkPointData.h"
@@ -79,6 +83,141 @@ std::vector<hsize_t> ReduceDimension(int* updateExtent, int* wholeExtent)
   return v;
 }
 
+//----------------------------------------------------------------------------
+/*
+ * Hyperslab of the file holding the array 'name' of an image for the update
+ * extent and the time step 'step'.
+ */
+template <typename ImplT>
+std::vector<hsize_t> GetImageFileExtent(ImplT* impl, int* updateExtent, int* wholeExtent,
+  bool hasTemporalData, vtkIdType step, int attributeType, const std::string& name)
+{
+  const hsize_t pointModifier = (attributeType == vtkDataObject::POINT) ? 1 : 0;
+  std::vector<hsize_t> fileExtent = ::ReduceDimension(updateExtent, wholeExtent);
+  std::vector<int> extentBuffer(fileExtent.size(), 0);
+  std::copy(updateExtent, updateExtent + extentBuffer.size(), extentBuffer.begin());
+  if (hasTemporalData)
+  {
+    vtkIdType offset = impl->GetArrayOffset(step, attributeType, name);
+    if (offset >= 0)
+    {
+      extentBuffer.emplace_back(offset);
+      extentBuffer.emplace_back(offset);
+    }
+    else
+    {
+      extentBuffer.emplace_back(step);
+      extentBuffer.emplace_back(step);
+    }
+    fileExtent.resize(extentBuffer.size(), 0);
+  }
+  // Create the memory space, reverse axis order for VTK fortran order,
+  // because VTK stores 2D/3D arrays in memory along columns (fortran order) rather
+  // than along rows (C order)
+  for (std::size_t iDim = 0; iDim < fileExtent.size() / 2; ++iDim)
+  {
+    std::size_t rIDim = (fileExtent.size() / 2) - 1 - iDim;
+    // if an extent value is negative it won't go into an hsize_t
+    if (extentBuffer[rIDim * 2] < 0)
+    {
+      extentBuffer[rIDim * 2 + 1] -= extentBuffer[rIDim * 2];
+      extentBuffer[rIDim * 2] = 0;
+    }
+    fileExtent[iDim * 2] = extentBuffer[rIDim * 2];
+    fileExtent[iDim * 2 + 1] = extentBuffer[rIDim * 2 + 1] + pointModifier;
+  }
+  if (hasTemporalData && !pointModifier)
+  {
+    // Add one to the extent for the time dimension if needed
+    fileExtent[1] += 1;
+  }
+  return fileExtent;
+}
+
+//----------------------------------------------------------------------------
+/*
+ * Hyperslabs of the file holding the point and cell data arrays 'names' of the
+ * pieces of an unstructured grid or a poly data read for the temporal step 'step',
+ * keyed on attribute type and name. Mirrors the offsets computed by vtkHDFReader::Read.
+ */
+template <typename ImplT>
+bool GetPieceFileExtents(ImplT* impl, vtkIdType step, int piece, int numberOfPieces,
+  const std::array<std::vector<std::string>, 2>& names,
+  std::map<std::pair<int, std::string>, std::vector<std::vector<hsize_t>>>& fileExtents)
+{
+  const bool isPolyData = impl->GetDataSetType() == VTK_POLY_DATA;
+  int filePieceCount = impl->GetNumberOfPieces(step);
+  vtkHDFUtilities::TemporalGeometryOffsets geoOffs(impl, step);
+  if (filePieceCount < 0 || !geoOffs.Success || geoOffs.CellOffsets.empty())
+  {
+    return false;
+  }
+  std::vector<vtkIdType> numberOfPoints =
+    impl->GetMetadata("NumberOfPoints", filePieceCount, geoOffs.PartOffset);
+  std::vector<vtkIdType> numberOfCells;
+  if (isPolyData)
+  {
+    numberOfCells.resize(filePieceCount, 0);
+    for (const auto& topo : vtkHDFUtilities::POLY_DATA_TOPOS)
+    {
+      std::vector<vtkIdType> topoCells = impl->GetMetadata(
+        (topo + "/NumberOfCells").c_str(), filePieceCount, geoOffs.PartOffset);
+      if (topoCells.size() != numberOfCells.size())
+      {
+        return false;
+      }
+      std::transform(numberOfCells.begin(), numberOfCells.end(), topoCells.begin(),
+        numberOfCells.begin(), std::plus<vtkIdType>());
+    }
+  }
+  else
+  {
+    numberOfCells = impl->GetMetadata("NumberOfCells", filePieceCount, geoOffs.PartOffset);
+  }
+  if (numberOfPoints.size() != static_cast<std::size_t>(filePieceCount) ||
+    numberOfCells.size() != static_cast<std::size_t>(filePieceCount))
+  {
+    return false;
+  }
+
+  const vtkIdType startingOffsets[2] = { geoOffs.PointOffset,
+    isPolyData ? std::accumulate(geoOffs.CellOffsets.begin(), geoOffs.CellOffsets.end(),
+                   static_cast<vtkIdType>(0))
+               : geoOffs.CellOffsets[0] };
+  const std::vector<vtkIdType>* numberOf[2] = { &numberOfPoints, &numberOfCells };
+  for (int attributeType = 0; attributeType < vtkDataObject::FIELD; ++attributeType)
+  {
+    for (const std::string& name : names[attributeType])
+    {
+      vtkIdType offset = startingOffsets[attributeType];
+      vtkIdType buff = impl->GetArrayOffset(step, attributeType, name);
+      if (buff >= 0)
+      {
+        offset = buff;
+      }
+      auto& extents = fileExtents[std::make_pair(attributeType, name)];
+      const std::vector<vtkIdType>& sizes = *numberOf[attributeType];
+      for (int filePiece = piece; filePiece < filePieceCount; filePiece += numberOfPieces)
+      {
+        hsize_t start = std::accumulate(sizes.data(), &sizes[filePiece], offset);
+        extents.emplace_back(std::vector<hsize_t>{ start, start + sizes[filePiece] });
+      }
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+/*
+ * HDF5 calls of all the readers, including the ones reading ahead on
+ * background threads, are serialized with this mutex.
+ */
+std::recursive_timed_mutex& GetHDF5Mutex()
+{
+  static std::recursive_timed_mutex mutex;
+  return mutex;
+}
+
 //----------------------------------------------------------------------------
 template <typename ImplT, typename CacheT>
 vtkSmartPointer<vtkDataArray> ReadFromFileOrCache(ImplT* impl, std::shared_ptr<CacheT> cache,
@@ -269,8 +408,8 @@ struct vtkHDFReader::DataCache
   {
     std::vector<vtkIdType> buff(offset.size());
     std::copy(offset.begin(), offset.end(), buff.begin());
-    this->Map.emplace(KeyT{ attribute, name },
-      ValueT{ std::move(buff), static_cast<vtkSmartPointer<vtkAbstractArray>>(array) });
+    this->Map[KeyT{ attribute, name }] =
+      ValueT{ std::move(buff), static_cast<vtkSmartPointer<vtkAbstractArray>>(array) };
     this->HasBeenUpdated = true;
   }
 
@@ -289,8 +428,8 @@ struct vtkHDFReader::DataCache
   {
     auto key = KeyT{ attribute, name };
     std::vector<vtkIdType> buff{ static_cast<vtkIdType>(offset), static_cast<vtkIdType>(size) };
-    this->Map.emplace(
-      key, ValueT{ std::move(buff), static_cast<vtkSmartPointer<vtkAbstractArray>>(array) });
+    this->Map[key] =
+      ValueT{ std::move(buff), static_cast<vtkSmartPointer<vtkAbstractArray>>(array) };
     this->HasBeenUpdated = true;
   }
 
@@ -321,9 +460,118 @@ private:
   std::map<KeyT, ValueT> Map;
 };
 
+//----------------------------------------------------------------------------
+/*
+ * Reads ahead the point and cell data arrays of the time steps following the
+ * current one on a background thread. What the thread needs from the reader is
+ * copied before it starts, and the reader does not use the implementation
+ * until it has stopped the thread.
+ */
+struct vtkHDFReader::Prefetcher
+{
+  using FileExtentsT = std::map<std::pair<int, std::string>, std::vector<std::vector<hsize_t>>>;
+
+  std::thread Thread;
+  std::atomic<bool> Interrupt{ false };
+
+  vtkHDFReader::Implementation* Impl = nullptr;
+  int DataSetType = -1;
+  vtkIdType CurrentStep = 0;
+  std::vector<vtkIdType> Steps;
+  bool UseCache = false;
+  std::array<std::vector<std::string>, 2> ArrayNames;
+  std::array<int, 6> UpdateExtent;
+  std::array<int, 6> WholeExtent;
+  int Piece = 0;
+  int NumberOfPieces = 1;
+  unsigned long MemoryLimit = 0;
+
+  bool GetFileExtents(vtkIdType step, FileExtentsT& fileExtents)
+  {
+    if (this->DataSetType != VTK_IMAGE_DATA)
+    {
+      return ::GetPieceFileExtents(
+        this->Impl, step, this->Piece, this->NumberOfPieces, this->ArrayNames, fileExtents);
+    }
+    for (int attributeType = 0; attributeType < vtkDataObject::FIELD; ++attributeType)
+    {
+      for (const std::string& name : this->ArrayNames[attributeType])
+      {
+        fileExtents[std::make_pair(attributeType, name)].emplace_back(
+          ::GetImageFileExtent(this->Impl, this->UpdateExtent.data(), this->WholeExtent.data(),
+            true, step, attributeType, name));
+      }
+    }
+    return true;
+  }
+
+  bool Lock(std::unique_lock<std::recursive_timed_mutex>& lock)
+  {
+    // Do not wait for a reader executing on the thread that stops this one
+    while (!lock.try_lock_for(std::chrono::milliseconds(10)))
+    {
+      if (this->Interrupt)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void Run()
+  {
+    std::unique_lock<std::recursive_timed_mutex> lock(::GetHDF5Mutex(), std::defer_lock);
+    // Arrays that do not change from the current step are in the data cache
+    FileExtentsT currentFileExtents;
+    if (this->UseCache)
+    {
+      if (!this->Lock(lock) || !this->GetFileExtents(this->CurrentStep, currentFileExtents))
+      {
+        return;
+      }
+      lock.unlock();
+    }
+    for (vtkIdType step : this->Steps)
+    {
+      FileExtentsT fileExtents;
+      if (!this->Lock(lock) || !this->GetFileExtents(step, fileExtents))
+      {
+        return;
+      }
+      lock.unlock();
+      for (auto& request : fileExtents)
+      {
+        std::vector<std::vector<hsize_t>>& extents = request.second;
+        auto current = currentFileExtents.find(request.first);
+        if (current != currentFileExtents.end())
+        {
+          const std::vector<std::vector<hsize_t>>& cached = current->second;
+          extents.erase(std::remove_if(extents.begin(), extents.end(),
+                          [&](const std::vector<hsize_t>& extent) {
+                            return std::find(cached.begin(), cached.end(), extent) != cached.end();
+                          }),
+            extents.end());
+        }
+        if (!this->Lock(lock))
+        {
+          return;
+        }
+        bool read = this->Impl->PrefetchArray(request.first.first, request.first.second.c_str(),
+          step, extents, this->MemoryLimit, this->Interrupt);
+        lock.unlock();
+        if (!read)
+        {
+          return;
+        }
+      }
+    }
+  }
+};
+
 //----------------------------------------------------------------------------
 vtkHDFReader::vtkHDFReader()
   : Cache(std::make_shared<DataCache>())
+  , Prefetch(new Prefetcher())
 {
   this->FileName = nullptr;
   // Setup the selection callback to modify this object when an array
@@ -354,7 +602,11 @@ vtkHDFReader::vtkHDFReader()
 //----------------------------------------------------------------------------
 vtkHDFReader::~vtkHDFReader()
 {
-  delete this->Impl;
+  this->StopPrefetch();
+  {
+    std::lock_guard<std::recursive_timed_mutex> lock(::GetHDF5Mutex());
+    delete this->Impl;
+  }
   this->SetFileName(nullptr);
   for (int i = 0; i < vtkHDFUtilities::GetNumberOfAttributeTypes(); ++i)
   {
@@ -378,6 +630,8 @@ void vtkHDFReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Step: " << this->Step << "\n";
   os << indent << "TimeValue: " << this->TimeValue << "\n";
   os << indent << "TimeRange: " << this->TimeRange[0] << " - " << this->TimeRange[1] << "\n";
+  os << indent << "PrefetchTimeSteps: " << this->PrefetchTimeSteps << "\n";
+  os << indent << "PrefetchMemoryLimit: " << this->PrefetchMemoryLimit << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -432,6 +686,8 @@ int vtkHDFReader::CanReadFile(const char* name)
     vtkErrorMacro("File does not exist: " << name);
     return 0;
   }
+  this->StopPrefetch();
+  std::lock_guard<std::recursive_timed_mutex> lock(::GetHDF5Mutex());
   if (!this->Impl->Open(name))
   {
     return 0;
@@ -506,6 +762,8 @@ int vtkHDFReader::RequestDataObject(vtkInformation*, vtkInformationVector** vtkN
     return 0;
   }
 
+  this->StopPrefetch();
+  std::lock_guard<std::recursive_timed_mutex> lock(::GetHDF5Mutex());
   if (!this->Impl->Open(this->FileName))
   {
     return 0;
@@ -592,6 +850,8 @@ int vtkHDFReader::RequestInformation(vtkInformation* vtkNotUsed(request),
     vtkErrorMacro("Requires valid input file name");
     return 0;
   }
+  this->StopPrefetch();
+  std::lock_guard<std::recursive_timed_mutex> lock(::GetHDF5Mutex());
   // Ensures a new file is open. This happen for vtkFileSeriesReader
   // which does not call RequestDataObject for every time step.
   if (!this->Impl->Open(this->FileName))
@@ -732,52 +992,14 @@ int vtkHDFReader::Read(vtkInformation* outInfo, vtkImageData* data)
   // in the same order as vtkDataObject::AttributeTypes: POINT, CELL
   for (int attributeType = 0; attributeType < vtkDataObject::FIELD; ++attributeType)
   {
-    const hsize_t pointModifier = (attributeType == vtkDataObject::POINT) ? 1 : 0;
     std::vector<std::string> names = this->Impl->GetArrayNames(attributeType);
     for (const std::string& name : names)
     {
       if (this->DataArraySelection[attributeType]->ArrayIsEnabled(name.c_str()))
       {
         vtkSmartPointer<vtkDataArray> array;
-        std::vector<hsize_t> fileExtent = ::ReduceDimension(updateExtent.data(), this->WholeExtent);
-        std::vector<int> extentBuffer(fileExtent.size(), 0);
-        std::copy(
-          updateExtent.begin(), updateExtent.begin() + extentBuffer.size(), extentBuffer.begin());
-        if (this->GetHasTemporalData())
-        {
-          vtkIdType offset = this->Impl->GetArrayOffset(this->Step, attributeType, name);
-          if (offset >= 0)
-          {
-            extentBuffer.emplace_back(offset);
-            extentBuffer.emplace_back(offset);
-          }
-          else
-          {
-            extentBuffer.emplace_back(this->Step);
-            extentBuffer.emplace_back(this->Step);
-          }
-          fileExtent.resize(extentBuffer.size(), 0);
-        }
-        // Create the memory space, reverse axis order for VTK fortran order,
-        // because VTK stores 2D/3D arrays in memory along columns (fortran order) rather
-        // than along rows (C order)
-        for (std::size_t iDim = 0; iDim < fileExtent.size() / 2; ++iDim)
-        {
-          std::size_t rIDim = (fileExtent.size() / 2) - 1 - iDim;
-          // if an extent value is negative it won't go into an hsize_t
-          if (extentBuffer[rIDim * 2] < 0)
-          {
-            extentBuffer[rIDim * 2 + 1] -= extentBuffer[rIDim * 2];
-            extentBuffer[rIDim * 2] = 0;
-          }
-          fileExtent[iDim * 2] = extentBuffer[rIDim * 2];
-          fileExtent[iDim * 2 + 1] = extentBuffer[rIDim * 2 + 1] + pointModifier;
-        }
-        if (this->GetHasTemporalData() && !pointModifier)
-        {
-          // Add one to the extent for the time dimension if needed
-          fileExtent[1] += 1;
-        }
+        std::vector<hsize_t> fileExtent = ::GetImageFileExtent(this->Impl, updateExtent.data(),
+          this->WholeExtent, this->GetHasTemporalData(), this->Step, attributeType, name);
         if (this->UseCache && this->Cache->CheckExistsAndEqual(attributeType, name, fileExtent))
         {
           array = vtkDataArray::SafeDownCast(this->Cache->Get(attributeType, name));
@@ -1590,6 +1812,8 @@ int vtkHDFReader::Read(vtkInformation* vtkNotUsed(outInfo), vtkOverlappingAMR* d
 int vtkHDFReader::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
 {
+  this->StopPrefetch();
+  std::lock_guard<std::recursive_timed_mutex> lock(::GetHDF5Mutex());
   this->MeshGeometryChangedFromPreviousTimeStep = false;
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
   int ok = 1;
@@ -1676,7 +1900,73 @@ int vtkHDFReader::RequestData(vtkInformation* vtkNotUsed(request),
     vtkErrorMacro("HDF dataset type unknown: " << dataSetType);
     return 0;
   }
-  return ok && this->AddFieldArrays(output);
+  ok = ok && this->AddFieldArrays(output);
+  if (ok &&
+    (dataSetType == VTK_IMAGE_DATA || dataSetType == VTK_UNSTRUCTURED_GRID ||
+      dataSetType == VTK_POLY_DATA))
+  {
+    this->StartPrefetch(outInfo);
+  }
+  return ok;
+}
+
+//----------------------------------------------------------------------------
+void vtkHDFReader::StartPrefetch(vtkInformation* outInfo)
+{
+  const vtkIdType lastStep =
+    std::min<vtkIdType>(this->Step + this->PrefetchTimeSteps, this->NumberOfSteps - 1);
+  this->Impl->ReleasePrefetchedArrays(this->Step + 1, lastStep);
+  if (!this->GetHasTemporalData() || lastStep <= this->Step)
+  {
+    return;
+  }
+
+  Prefetcher& prefetch = *this->Prefetch;
+  prefetch.Impl = this->Impl;
+  prefetch.DataSetType = this->Impl->GetDataSetType();
+  prefetch.CurrentStep = this->Step;
+  prefetch.Steps.resize(lastStep - this->Step);
+  std::iota(prefetch.Steps.begin(), prefetch.Steps.end(), this->Step + 1);
+  prefetch.UseCache = this->UseCache;
+  for (int attributeType = 0; attributeType < vtkDataObject::FIELD; ++attributeType)
+  {
+    prefetch.ArrayNames[attributeType].clear();
+    for (const std::string& name : this->Impl->GetArrayNames(attributeType))
+    {
+      if (this->DataArraySelection[attributeType]->ArrayIsEnabled(name.c_str()))
+      {
+        prefetch.ArrayNames[attributeType].emplace_back(name);
+      }
+    }
+  }
+  if (prefetch.DataSetType == VTK_IMAGE_DATA)
+  {
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), prefetch.UpdateExtent.data());
+    std::copy(this->WholeExtent, this->WholeExtent + 6, prefetch.WholeExtent.begin());
+  }
+  else
+  {
+    prefetch.Piece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+    prefetch.NumberOfPieces =
+      outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES());
+    if (prefetch.NumberOfPieces <= 0)
+    {
+      return;
+    }
+  }
+  prefetch.MemoryLimit = this->PrefetchMemoryLimit;
+  prefetch.Interrupt = false;
+  prefetch.Thread = std::thread([&prefetch]() { prefetch.Run(); });
+}
+
+//----------------------------------------------------------------------------
+void vtkHDFReader::StopPrefetch()
+{
+  if (this->Prefetch->Thread.joinable())
+  {
+    this->Prefetch->Interrupt = true;
+    this->Prefetch->Thread.join();
+  }
 }
 
 //----------------------------------------------------------------------------
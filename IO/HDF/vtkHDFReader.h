@@ -168,6 +168,34 @@ public:
   vtkBooleanMacro(MergeParts, bool);
   ///@}
 
+  ///@{
+  /**
+   * Number of time steps following the one just read that are read ahead on a
+   * background thread (default is 0, no read-ahead).
+   *
+   * For temporal image data, unstructured grids and poly data, the selected
+   * point and cell data arrays of the next PrefetchTimeSteps time steps are read
+   * while the pipeline is idle, so that playing time steps forward does not wait
+   * on the file. The read-ahead is interrupted as soon as the reader executes
+   * again, and the arrays already read are used when their time step is requested.
+   *
+   * @note HDF5 calls of all vtkHDFReader instances are serialized. Unless the HDF5
+   * library is built thread safe, other HDF5 users must not run while a reader
+   * reads ahead.
+   */
+  vtkGetMacro(PrefetchTimeSteps, int);
+  vtkSetClampMacro(PrefetchTimeSteps, int, 0, VTK_INT_MAX);
+  ///@}
+
+  ///@{
+  /**
+   * Upper bound, in KiB, of the memory used by the arrays read ahead
+   * (default is 512 MiB). Reading ahead stops when it is exceeded.
+   */
+  vtkGetMacro(PrefetchMemoryLimit, unsigned long);
+  vtkSetMacro(PrefetchMemoryLimit, unsigned long);
+  ///@}
+
   vtkSetMacro(MaximumLevelsToReadByDefaultForAMR, unsigned int);
   vtkGetMacro(MaximumLevelsToReadByDefaultForAMR, unsigned int);
 
@@ -303,6 +331,9 @@ protected:
   struct DataCache;
   std::shared_ptr<DataCache> Cache;
 
+  int PrefetchTimeSteps = 0;
+  unsigned long PrefetchMemoryLimit = 512 * 1024;
+
 private:
   vtkHDFReader(const vtkHDFReader&) = delete;
   void operator=(const vtkHDFReader&) = delete;
@@ -349,6 +380,19 @@ private:
    */
   void CleanOriginalIds(vtkPartitionedDataSet* output);
 
+  ///@{
+  /**
+   * Start reading ahead the time steps following the current one, for the
+   * request in 'outInfo', or interrupt and wait for the read-ahead in progress.
+   * The reader must stop the read-ahead before using the file.
+   */
+  void StartPrefetch(vtkInformation* outInfo);
+  void StopPrefetch();
+  ///@}
+
+  struct Prefetcher;
+  std::unique_ptr<Prefetcher> Prefetch;
+
   bool MeshGeometryChangedFromPreviousTimeStep = true;
 
   vtkNew<vtkDataObjectMeshCache> MeshCache;
@@ -191,6 +191,10 @@ bool vtkHDFReader::Implementation::OpenGroupAsVTKGroup(const std::string& groupP
 //------------------------------------------------------------------------------
 bool vtkHDFReader::Implementation::RetrieveHDFInformation(const std::string& rootName)
 {
+  // arrays read ahead belong to the previous root
+  this->PrefetchedArrays.clear();
+  this->PrefetchedMemorySize = 0;
+
   // turn off error logging and save error function
   H5E_auto_t f;
   void* client_data;
@@ -436,6 +440,8 @@ int vtkHDFReader::Implementation::GetNumberOfPieces(vtkIdType step)
 //------------------------------------------------------------------------------
 void vtkHDFReader::Implementation::Close()
 {
+  this->PrefetchedArrays.clear();
+  this->PrefetchedMemorySize = 0;
   this->DataSetType = -1;
   this->NumberOfPieces = 0;
   std::fill(this->Version.begin(), this->Version.end(), 0);
@@ -822,6 +828,18 @@ hid_t vtkHDFReader::Implementation::OpenDataSet(
 vtkDataArray* vtkHDFReader::Implementation::NewArray(
   int attributeType, const char* name, const std::vector<hsize_t>& fileExtent)
 {
+  if (!this->PrefetchedArrays.empty())
+  {
+    auto it = this->PrefetchedArrays.find(std::make_tuple(attributeType, name, fileExtent));
+    if (it != this->PrefetchedArrays.end())
+    {
+      vtkDataArray* array = it->second.Array;
+      array->Register(nullptr);
+      this->PrefetchedMemorySize -= it->second.Size;
+      this->PrefetchedArrays.erase(it);
+      return array;
+    }
+  }
   return NewArrayForGroup(this->AttributeDataGroup[attributeType], name, fileExtent);
 }
 
@@ -830,7 +848,77 @@ vtkDataArray* vtkHDFReader::Implementation::NewArray(
   int attributeType, const char* name, hsize_t offset, hsize_t size)
 {
   std::vector<hsize_t> fileExtent = { offset, offset + size };
-  return NewArrayForGroup(this->AttributeDataGroup[attributeType], name, fileExtent);
+  return this->NewArray(attributeType, name, fileExtent);
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFReader::Implementation::PrefetchArray(int attributeType, const char* name,
+  vtkIdType step, const std::vector<std::vector<hsize_t>>& fileExtents,
+  unsigned long memoryLimit, const std::atomic<bool>& interrupt)
+{
+  std::vector<hsize_t> dims;
+  vtkHDF::ScopedH5DHandle dataset;
+  vtkHDF::ScopedH5THandle nativeType;
+  for (const std::vector<hsize_t>& fileExtent : fileExtents)
+  {
+    if (interrupt || this->PrefetchedMemorySize > memoryLimit)
+    {
+      return false;
+    }
+    auto key = std::make_tuple(attributeType, std::string(name), fileExtent);
+    if (this->PrefetchedArrays.find(key) != this->PrefetchedArrays.end())
+    {
+      continue;
+    }
+    if (dataset < 0)
+    {
+      hid_t tempNativeType = H5I_INVALID_HID;
+      dataset =
+        this->OpenDataSet(this->AttributeDataGroup[attributeType], name, &tempNativeType, dims);
+      nativeType = tempNativeType;
+      if (dataset < 0)
+      {
+        return false;
+      }
+    }
+    // A wrong guess of the next requests must not end up in an HDF error
+    bool inside = dims.size() >= (fileExtent.size() >> 1);
+    for (std::size_t i = 0; inside && i < (fileExtent.size() >> 1); ++i)
+    {
+      inside = fileExtent[2 * i] <= fileExtent[2 * i + 1] && fileExtent[2 * i + 1] <= dims[i];
+    }
+    if (!inside)
+    {
+      continue;
+    }
+    vtkSmartPointer<vtkDataArray> array =
+      vtk::TakeSmartPointer(this->NewArrayForGroup(dataset, nativeType, dims, fileExtent));
+    if (!array)
+    {
+      return false;
+    }
+    unsigned long size = array->GetActualMemorySize();
+    this->PrefetchedArrays.emplace(std::move(key), PrefetchedArray{ step, size, array });
+    this->PrefetchedMemorySize += size;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkHDFReader::Implementation::ReleasePrefetchedArrays(vtkIdType firstStep, vtkIdType lastStep)
+{
+  for (auto it = this->PrefetchedArrays.begin(); it != this->PrefetchedArrays.end();)
+  {
+    if (it->second.Step < firstStep || it->second.Step > lastStep)
+    {
+      this->PrefetchedMemorySize -= it->second.Size;
+      it = this->PrefetchedArrays.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -11,10 +11,13 @@
 
 #include "vtkHDFReader.h"
 #include "vtkHDFUtilities.h"
+#include "vtkSmartPointer.h"
 #include "vtk_hdf5.h"
 #include <array>
+#include <atomic>
 #include <map>
 #include <string>
+#include <tuple>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -84,6 +87,7 @@ public:
    * or CellData groups depending on the 'attributeType' parameter.
    * There are two versions: a first one that reads from a 3D array using a fileExtent,
    * and a second one that reads from a linear array using an offset and size.
+   * Arrays read ahead by PrefetchArray are returned without reading the file.
    * The array has to be deleted by the user.
    */
   vtkDataArray* NewArray(
@@ -103,6 +107,28 @@ public:
   vtkDataArray* NewMetadataArray(const char* name, hsize_t offset, hsize_t size);
   std::vector<vtkIdType> GetMetadata(const char* name, hsize_t size, hsize_t offset = 0);
   ///@}
+
+  /**
+   * Reads ahead the hyperslabs 'fileExtents' of the array 'name' of the PointData
+   * or CellData group for the time step 'step', so that NewArray later returns them
+   * without reading the file. The HDF dataset is opened once for all the hyperslabs,
+   * hyperslabs already read ahead or out of the dataset are skipped.
+   * Returns false when 'interrupt' is set, on error, or once the arrays read ahead
+   * use more than 'memoryLimit' KiB.
+   */
+  bool PrefetchArray(int attributeType, const char* name, vtkIdType step,
+    const std::vector<std::vector<hsize_t>>& fileExtents, unsigned long memoryLimit,
+    const std::atomic<bool>& interrupt);
+
+  /**
+   * Releases the arrays read ahead for time steps outside of [firstStep, lastStep].
+   */
+  void ReleasePrefetchedArrays(vtkIdType firstStep, vtkIdType lastStep);
+
+  /**
+   * Returns the memory used by the arrays read ahead, in KiB.
+   */
+  unsigned long GetPrefetchedMemorySize() { return this->PrefetchedMemorySize; }
   /**
    * Returns the dimensions of a HDF dataset.
    */
@@ -280,6 +306,19 @@ private:
     const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents);
   std::map<TypeDescription, ArrayReader> TypeReaderMap;
 
+  /**
+   * Arrays read ahead by PrefetchArray, keyed on attribute type, name and
+   * hyperslab in the file.
+   */
+  struct PrefetchedArray
+  {
+    vtkIdType Step;
+    unsigned long Size;
+    vtkSmartPointer<vtkDataArray> Array;
+  };
+  std::map<std::tuple<int, std::string, std::vector<hsize_t>>, PrefetchedArray> PrefetchedArrays;
+  unsigned long PrefetchedMemorySize = 0;
+
   bool ReadDataSetType();
 
   ///@{
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * Reads the first and the last timesteps of an exodus restart series, which
+ * are in different files, with StaticMesh on and checks that the mesh of the
+ * first file is reused for the second one.
+ */
+#include <vtkCellArray.h>
+#include <vtkDataArray.h>
+#include <vtkIOSSReader.h>
+#include <vtkInformation.h>
+#include <vtkLogger.h>
+#include <vtkNew.h>
+#include <vtkPartitionedDataSet.h>
+#include <vtkPartitionedDataSetCollection.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+#include <vtkTestUtilities.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <cstring>
+
+namespace
+{
+vtkUnstructuredGrid* GetFirstBlock(vtkIOSSReader* reader)
+{
+  auto pdc = vtkPartitionedDataSetCollection::SafeDownCast(reader->GetOutputDataObject(0));
+  auto pd = pdc ? pdc->GetPartitionedDataSet(0) : nullptr;
+  return (pd && pd->GetNumberOfPartitions() > 0)
+    ? vtkUnstructuredGrid::SafeDownCast(pd->GetPartition(0))
+    : nullptr;
+}
+
+bool SameValues(vtkDataArray* array0, vtkDataArray* array1)
+{
+  return array0 && array1 && array0->GetDataType() == array1->GetDataType() &&
+    array0->GetDataSize() == array1->GetDataSize() &&
+    memcmp(array0->GetVoidPointer(0), array1->GetVoidPointer(0),
+      array0->GetDataSize() * array0->GetDataTypeSize()) == 0;
+}
+}
+
+int TestIOSSExodusStaticMesh(int argc, char* argv[])
+{
+  char* fileNameC =
+    vtkTestUtilities::ExpandDataFileName(argc, argv, "Data/Exodus/ExRestarts/blow.ex-timeseries");
+  const std::string fname(fileNameC);
+  delete[] fileNameC;
+
+  vtkNew<vtkIOSSReader> reader;
+  reader->SetFileName(fname.c_str());
+  reader->ApplyDisplacementsOff();
+  reader->StaticMeshOn();
+  reader->UpdateInformation();
+
+  vtkInformation* outInfo = reader->GetOutputInformation(0);
+  const int numberOfTimes = outInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  if (numberOfTimes < 2)
+  {
+    vtkLogF(ERROR, "Expected several timesteps, got %d.", numberOfTimes);
+    return EXIT_FAILURE;
+  }
+  const double* times = outInfo->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+
+  reader->UpdateTimeStep(times[0]);
+  auto first = ::GetFirstBlock(reader);
+  if (!first)
+  {
+    vtkLogF(ERROR, "Missing block at the first timestep.");
+    return EXIT_FAILURE;
+  }
+  vtkSmartPointer<vtkPoints> firstPoints = first->GetPoints();
+  vtkSmartPointer<vtkCellArray> firstCells = first->GetCells();
+
+  reader->UpdateTimeStep(times[numberOfTimes - 1]);
+  auto last = ::GetFirstBlock(reader);
+  if (!last || last->GetPoints() != firstPoints || last->GetCells() != firstCells)
+  {
+    vtkLogF(ERROR, "The mesh of the first file was not reused for the last timestep.");
+    return EXIT_FAILURE;
+  }
+
+  // The mesh and the fields match those read without reusing the mesh.
+  vtkNew<vtkIOSSReader> reference;
+  reference->SetFileName(fname.c_str());
+  reference->ApplyDisplacementsOff();
+  reference->UpdateInformation();
+  reference->UpdateTimeStep(times[numberOfTimes - 1]);
+  auto expected = ::GetFirstBlock(reference);
+  if (!expected || expected->GetPoints() == firstPoints ||
+    !::SameValues(expected->GetPoints()->GetData(), last->GetPoints()->GetData()) ||
+    expected->GetNumberOfCells() != last->GetNumberOfCells() ||
+    !::SameValues(expected->GetPointData()->GetArray("THICKNESS"),
+      last->GetPointData()->GetArray("THICKNESS")))
+  {
+    vtkLogF(ERROR, "The last timestep differs from the one read without StaticMesh.");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -65,6 +65,7 @@ vtkIOSSReader::vtkIOSSReader()
   , Internals(new vtkIOSSReaderInternal(this))
   , Controller(nullptr)
   , Caching(false)
+  , StaticMesh(false)
   , MergeExodusEntityBlocks(false)
   , ElementAndSideIds(true)
   , GenerateFileId(false)
@@ -167,6 +168,17 @@ void vtkIOSSReader::SetCaching(bool val)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkIOSSReader::SetStaticMesh(bool val)
+{
+  if (this->StaticMesh != val)
+  {
+    this->Internals->ClearStaticMeshes();
+    this->StaticMesh = val;
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkIOSSReader::SetMergeExodusEntityBlocks(bool val)
 {
@@ -350,7 +362,8 @@ int vtkIOSSReader::ReadMesh(
     internals.ReleaseRegions();
     if (!this->GetCaching())
     {
-      internals.ClearCache();
+      // the static meshes are kept: they are what the next files reuse.
+      internals.ClearCache(/*keepStaticMeshes=*/true);
     }
   }
 
@@ -918,6 +931,8 @@ const char* vtkIOSSReader::GetSelector(int index) const
 void vtkIOSSReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "Caching: " << this->Caching << endl;
+  os << indent << "StaticMesh: " << this->StaticMesh << endl;
   os << indent << "GenerateFileId: " << this->GenerateFileId << endl;
   os << indent << "ScanForRelatedFiles: " << this->ScanForRelatedFiles << endl;
   os << indent << "FileRange: " << this->FileRange[0] << ", " << this->FileRange[1] << endl;
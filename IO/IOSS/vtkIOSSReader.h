@@ -275,6 +275,25 @@ public:
   vtkBooleanMacro(Caching, bool);
   ///@}
 
+  ///@{
+  /**
+   * When this flag is on, the mesh of a block is assumed not to change across
+   * the files of a restart series. When a new file is opened, e.g. when the
+   * requested timestep is in the next restart file, blocks whose number of
+   * nodes and elements match those of the previous file reuse its points and
+   * cells instead of reading them again, so that consecutive outputs share
+   * their mesh. Within a single file, the mesh is always reused.
+   *
+   * Only enable this flag for restart series whose mesh is known to be static:
+   * meshes are compared by their sizes only, not by their coordinates.
+   *
+   * This flag is false/off by default.
+   */
+  void SetStaticMesh(bool value);
+  vtkGetMacro(StaticMesh, bool);
+  vtkBooleanMacro(StaticMesh, bool);
+  ///@}
+
   ///@{
   /**
    * When this flag is on, blocks/sets of exodus like types will be merged.
@@ -671,6 +690,7 @@ private:
 
   vtkMultiProcessController* Controller;
   bool Caching;
+  bool StaticMesh;
   bool MergeExodusEntityBlocks;
   bool ElementAndSideIds;
   bool GenerateFileId;
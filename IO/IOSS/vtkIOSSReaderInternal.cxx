@@ -27,6 +27,7 @@
 #include "vtkPartitionedDataSetCollection.h"
 #include "vtkPointData.h"
 #include "vtkRemoveUnusedPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStringArray.h"
 #include "vtkStructuredGrid.h"
@@ -1500,12 +1501,40 @@ bool vtkIOSSReaderInternal::GetMesh(vtkUnstructuredGrid* dataset, const std::str
     return true;
   }
 
+  // in static mesh mode, reuse the mesh read from a previous file of the
+  // restart series if the sizes reported by the database have not changed.
+  const bool staticMesh = this->IOSSReader->GetStaticMesh() &&
+    group_entity->property_exists("entity_count") && region->get_node_blocks().size() == 1;
+  const auto staticMeshKey =
+    std::make_tuple(static_cast<int>(vtk_entity_type), blockname, handle.second);
+  vtkTypeInt64 numberOfNodes = -1;
+  vtkTypeInt64 numberOfElements = -1;
+  if (staticMesh)
+  {
+    numberOfNodes = region->get_node_blocks().front()->get_property("entity_count").get_int();
+    numberOfElements = group_entity->get_property("entity_count").get_int();
+    auto iter = this->StaticMeshes.find(staticMeshKey);
+    if (iter != this->StaticMeshes.end() && iter->second.NumberOfNodes == numberOfNodes &&
+      iter->second.NumberOfElements == numberOfElements)
+    {
+      if (iter->second.OriginalPointIds)
+      {
+        cache.Insert(group_entity, "__vtk_mesh_original_pt_ids__", iter->second.OriginalPointIds);
+      }
+      cache.Insert(group_entity, cacheKey, iter->second.Mesh);
+      dataset->CopyStructure(iter->second.Mesh);
+      return true;
+    }
+  }
+
   if (!this->GetTopology(dataset, blockname, vtk_entity_type, handle) ||
     !this->GetGeometry(dataset, "nodeblock_1", handle))
   {
     return false;
   }
 
+  vtkSmartPointer<vtkUnstructuredGrid> mesh;
+  vtkSmartPointer<vtkIdTypeArray> originalPointIds;
   if (remove_unused_points)
   {
     // let's prune unused points.
@@ -1515,25 +1544,30 @@ bool vtkIOSSReaderInternal::GetMesh(vtkUnstructuredGrid* dataset, const std::str
     pruner->Update();
 
     auto pruned = pruner->GetOutput();
-    // cache original pt ids;  this is used in `GetNodeFields`.
-    if (auto originalIds = pruned->GetPointData()->GetArray("__vtk_mesh_original_pt_ids__"))
+    auto originalIds = pruned->GetPointData()->GetArray("__vtk_mesh_original_pt_ids__");
+    originalPointIds = vtkIdTypeArray::SafeDownCast(originalIds);
+    if (!originalPointIds)
     {
-      cache.Insert(group_entity, "__vtk_mesh_original_pt_ids__", originalIds);
-      // cache mesh
-      dataset->CopyStructure(pruned);
-      cache.Insert(group_entity, cacheKey, pruned);
-      return true;
+      return false;
     }
-
-    return false;
+    // cache original pt ids;  this is used in `GetNodeFields`.
+    cache.Insert(group_entity, "__vtk_mesh_original_pt_ids__", originalPointIds);
+    // cache mesh
+    dataset->CopyStructure(pruned);
+    mesh = pruned;
   }
   else
   {
-    vtkNew<vtkUnstructuredGrid> clone;
-    clone->CopyStructure(dataset);
-    cache.Insert(group_entity, cacheKey, clone);
-    return true;
+    mesh = vtkSmartPointer<vtkUnstructuredGrid>::New();
+    mesh->CopyStructure(dataset);
+  }
+  cache.Insert(group_entity, cacheKey, mesh);
+  if (staticMesh)
+  {
+    this->StaticMeshes[staticMeshKey] =
+      StaticMeshType{ mesh, originalPointIds, numberOfNodes, numberOfElements };
   }
+  return true;
 }
 
 bool vtkIOSSReaderInternal::GetMesh(vtkStructuredGrid* grid, const std::string& blockname,
@@ -2171,17 +2205,20 @@ bool vtkIOSSReaderInternal::ApplyDisplacements(vtkPointSet* grid, Ioss::Region*
     vtkNew<vtkPoints> xformedPts;
     xformedPts->SetDataType(pts->GetDataType());
     xformedPts->SetNumberOfPoints(pts->GetNumberOfPoints());
-    vtkVector3d coords{ 0.0 }, displ{ 0.0 };
-    for (vtkIdType cc = 0; cc < numPts; ++cc)
-    {
-      pts->GetPoint(cc, coords.GetData());
-      array->GetTuple(cc, displ.GetData());
-      for (int i = 0; i < 3; ++i)
+    const double magnitude = this->DisplacementMagnitude;
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      vtkVector3d coords{ 0.0 }, displ{ 0.0 };
+      for (vtkIdType cc = begin; cc < end; ++cc)
       {
-        displ[i] *= this->DisplacementMagnitude;
+        pts->GetPoint(cc, coords.GetData());
+        array->GetTuple(cc, displ.GetData());
+        for (int i = 0; i < 3; ++i)
+        {
+          displ[i] *= magnitude;
+        }
+        xformedPts->SetPoint(cc, (coords + displ).GetData());
       }
-      xformedPts->SetPoint(cc, (coords + displ).GetData());
-    }
+    });
 
     grid->SetPoints(xformedPts);
     cache.Insert(group_entity, xformPtsCacheKey, xformedPts);
@@ -32,6 +32,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <tuple>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -100,6 +101,19 @@ private:
 
   vtkIOSSUtilities::Cache Cache;
 
+  // Meshes of the blocks read from the previous files of a restart series,
+  // reused by `GetMesh` in static mesh mode. Unlike `Cache`, which is keyed by
+  // Ioss entities, they outlive the regions and are keyed by entity type, block
+  // name and file id.
+  struct StaticMeshType
+  {
+    vtkSmartPointer<vtkUnstructuredGrid> Mesh;
+    vtkSmartPointer<vtkIdTypeArray> OriginalPointIds;
+    vtkTypeInt64 NumberOfNodes;
+    vtkTypeInt64 NumberOfElements;
+  };
+  std::map<std::tuple<int, std::string, int>, StaticMeshType> StaticMeshes;
+
   vtkIOSSUtilities::DatabaseFormatType Format = vtkIOSSUtilities::DatabaseFormatType::UNKNOWN;
   vtkIOSSReader* IOSSReader = nullptr;
 
@@ -130,7 +144,15 @@ public:
   /**
    * Cache related API.
    */
-  void ClearCache() { this->Cache.Clear(); }
+  void ClearCache(bool keepStaticMeshes = false)
+  {
+    this->Cache.Clear();
+    if (!keepStaticMeshes)
+    {
+      this->StaticMeshes.clear();
+    }
+  }
+  void ClearStaticMeshes() { this->StaticMeshes.clear(); }
   void ResetCacheAccessCounts() { this->Cache.ResetAccessCounts(); }
   void ClearCacheUnused() { this->Cache.ClearUnused(); }
   ///@}
@@ -324,6 +346,7 @@ public:
   void Reset()
   {
     this->Cache.Clear();
+    this->StaticMeshes.clear();
     this->RegionMap.clear();
     this->DatabaseNames.clear();
     this->IOSSReader->RemoveAllSelections();
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// .NAME Test of ParallelSliceReading for the PNG and JPEG readers
+// .SECTION Description
+// Write a stack of slices, read it back one slice at a time and concurrently,
+// and check that both read the same scalars, for the whole extent and for a
+// subset of the slices.
+
+#include "vtkTestUtilities.h"
+
+#include <vtkDataArray.h>
+#include <vtkImageCast.h>
+#include <vtkImageData.h>
+#include <vtkImageMandelbrotSource.h>
+#include <vtkImageReader2.h>
+#include <vtkImageWriter.h>
+#include <vtkJPEGReader.h>
+#include <vtkJPEGWriter.h>
+#include <vtkNew.h>
+#include <vtkPNGReader.h>
+#include <vtkPNGWriter.h>
+#include <vtkPointData.h>
+#include <vtkSmartPointer.h>
+
+#include <cstring>
+#include <string>
+
+namespace
+{
+const int WholeExtent[6] = { 0, 63, 0, 47, 0, 15 };
+
+vtkSmartPointer<vtkImageData> ReadSlices(
+  vtkImageReader2* reader, const std::string& prefix, bool parallel, const int* updateExtent)
+{
+  reader->SetFilePrefix(prefix.c_str());
+  reader->SetFilePattern("%s.%d");
+  reader->SetDataExtent(const_cast<int*>(WholeExtent));
+  reader->SetParallelSliceReading(parallel);
+  if (updateExtent)
+  {
+    reader->UpdateExtent(updateExtent);
+  }
+  else
+  {
+    reader->Update();
+  }
+  auto output = vtkSmartPointer<vtkImageData>::New();
+  output->DeepCopy(reader->GetOutput());
+  return output;
+}
+
+bool SameScalars(vtkImageData* image0, vtkImageData* image1, const char* what)
+{
+  vtkDataArray* scalars0 = image0->GetPointData()->GetScalars();
+  vtkDataArray* scalars1 = image1->GetPointData()->GetScalars();
+  int* extent0 = image0->GetExtent();
+  int* extent1 = image1->GetExtent();
+  if (!scalars0 || !scalars1 || scalars0->GetDataSize() != scalars1->GetDataSize() ||
+    scalars0->GetDataType() != scalars1->GetDataType() || extent0[4] != extent1[4] ||
+    extent0[5] != extent1[5] ||
+    memcmp(scalars0->GetVoidPointer(0), scalars1->GetVoidPointer(0),
+      scalars0->GetDataSize() * scalars0->GetDataTypeSize()) != 0)
+  {
+    std::cerr << "Error: " << what << " differ." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestReader(vtkImageWriter* writer, vtkImageReader2* reader, vtkImageData* source,
+  const std::string& prefix, bool lossless)
+{
+  writer->SetInputData(source);
+  writer->SetFilePrefix(prefix.c_str());
+  writer->SetFilePattern("%s.%d");
+  writer->SetFileDimensionality(2);
+  writer->Write();
+
+  auto serial = ::ReadSlices(reader, prefix, false, nullptr);
+  auto parallel = ::ReadSlices(reader, prefix, true, nullptr);
+  bool success = ::SameScalars(serial, parallel, "serial and parallel slices");
+  if (lossless)
+  {
+    success &= ::SameScalars(source, parallel, "written and read slices");
+  }
+
+  // Only the requested slices are read.
+  const int subExtent[6] = { 0, 63, 0, 47, 5, 9 };
+  auto serialSubset = ::ReadSlices(reader, prefix, false, subExtent);
+  auto parallelSubset = ::ReadSlices(reader, prefix, true, subExtent);
+  success &= ::SameScalars(serialSubset, parallelSubset, "serial and parallel sub-extents");
+  int* extent = parallelSubset->GetExtent();
+  if (extent[4] != subExtent[4] || extent[5] != subExtent[5])
+  {
+    std::cerr << "Error: unexpected sub-extent " << extent[4] << ", " << extent[5] << std::endl;
+    success = false;
+  }
+  return success;
+}
+}
+
+int TestImageReader2ParallelSlices(int argc, char* argv[])
+{
+  const char* tdir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string tempDir = tdir;
+  delete[] tdir;
+  if (tempDir.empty())
+  {
+    std::cout << "Could not determine temporary directory.\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkImageMandelbrotSource> mandelbrot;
+  mandelbrot->SetWholeExtent(const_cast<int*>(WholeExtent));
+  mandelbrot->SetMaximumNumberOfIterations(200);
+
+  bool success = true;
+
+  vtkNew<vtkImageCast> castToShort;
+  castToShort->SetInputConnection(mandelbrot->GetOutputPort());
+  castToShort->SetOutputScalarTypeToUnsignedShort();
+  castToShort->Update();
+  vtkNew<vtkPNGWriter> pngWriter;
+  vtkNew<vtkPNGReader> pngReader;
+  success &= ::TestReader(
+    pngWriter, pngReader, castToShort->GetOutput(), tempDir + "/ParallelSlices_png", true);
+
+  vtkNew<vtkImageCast> castToChar;
+  castToChar->SetInputConnection(mandelbrot->GetOutputPort());
+  castToChar->SetOutputScalarTypeToUnsignedChar();
+  castToChar->Update();
+  vtkNew<vtkJPEGWriter> jpegWriter;
+  vtkNew<vtkJPEGReader> jpegReader;
+  success &= ::TestReader(
+    jpegWriter, jpegReader, castToChar->GetOutput(), tempDir + "/ParallelSlices_jpg", false);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// .NAME Test of ParallelEncoding for the PNG and JPEG writers
+// .SECTION Description
+// Write images large enough to be split into several bands of rows, with and
+// without ParallelEncoding, to files and to memory, and check that they are
+// read back as the image written, exactly for PNG and within the loss of the
+// compression for JPEG.
+
+#include "vtkTestUtilities.h"
+
+#include <vtkDataArray.h>
+#include <vtkImageCast.h>
+#include <vtkImageData.h>
+#include <vtkImageMandelbrotSource.h>
+#include <vtkImageReader2.h>
+#include <vtkImageWriter.h>
+#include <vtkJPEGReader.h>
+#include <vtkJPEGWriter.h>
+#include <vtkNew.h>
+#include <vtkPNGReader.h>
+#include <vtkPNGWriter.h>
+#include <vtkPointData.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace
+{
+vtkSmartPointer<vtkImageData> MakeImage(int type, int numberOfComponents)
+{
+  vtkNew<vtkImageMandelbrotSource> mandelbrot;
+  mandelbrot->SetWholeExtent(0, 1023, 0, 767, 0, 0);
+  mandelbrot->SetMaximumNumberOfIterations(255);
+  vtkNew<vtkImageCast> cast;
+  cast->SetInputConnection(mandelbrot->GetOutputPort());
+  cast->SetOutputScalarType(type);
+  cast->Update();
+
+  auto image = vtkSmartPointer<vtkImageData>::New();
+  image->SetExtent(cast->GetOutput()->GetExtent());
+  image->AllocateScalars(type, numberOfComponents);
+  vtkDataArray* in = cast->GetOutput()->GetPointData()->GetScalars();
+  vtkDataArray* out = image->GetPointData()->GetScalars();
+  for (vtkIdType i = 0; i < in->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < numberOfComponents; ++c)
+    {
+      out->SetComponent(i, c, std::fmod(in->GetComponent(i, 0) * (c + 1), 256.0));
+    }
+  }
+  return image;
+}
+
+// Return the largest difference between the scalars of both images, or -1 if
+// their extents or their scalars do not match.
+double GetMaximumDifference(vtkImageData* image0, vtkImageData* image1)
+{
+  int* extent0 = image0->GetExtent();
+  int* extent1 = image1->GetExtent();
+  vtkDataArray* scalars0 = image0->GetPointData()->GetScalars();
+  vtkDataArray* scalars1 = image1->GetPointData()->GetScalars();
+  for (int i = 0; i < 6; ++i)
+  {
+    if (extent0[i] != extent1[i])
+    {
+      return -1;
+    }
+  }
+  if (!scalars0 || !scalars1 || scalars0->GetDataType() != scalars1->GetDataType() ||
+    scalars0->GetNumberOfComponents() != scalars1->GetNumberOfComponents())
+  {
+    return -1;
+  }
+  double difference = 0;
+  for (vtkIdType i = 0; i < scalars0->GetNumberOfValues(); ++i)
+  {
+    difference = std::max(difference,
+      std::abs(scalars0->GetVariantValue(i).ToDouble() - scalars1->GetVariantValue(i).ToDouble()));
+  }
+  return difference;
+}
+
+vtkSmartPointer<vtkImageData> Read(vtkImageReader2* reader, const std::string& fileName)
+{
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  auto output = vtkSmartPointer<vtkImageData>::New();
+  output->DeepCopy(reader->GetOutput());
+  return output;
+}
+
+vtkSmartPointer<vtkImageData> Read(vtkImageReader2* reader, vtkUnsignedCharArray* buffer)
+{
+  reader->SetFileName(nullptr);
+  reader->SetMemoryBuffer(buffer->GetPointer(0));
+  reader->SetMemoryBufferLength(buffer->GetNumberOfValues());
+  reader->Update();
+  auto output = vtkSmartPointer<vtkImageData>::New();
+  output->DeepCopy(reader->GetOutput());
+  reader->SetMemoryBuffer(nullptr);
+  return output;
+}
+
+bool Check(double difference, double tolerance, const std::string& what)
+{
+  if (difference < 0 || difference > tolerance)
+  {
+    std::cerr << "Error: " << what << " differ by " << difference << "." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestPNG(vtkImageData* image, const std::string& prefix)
+{
+  vtkNew<vtkPNGWriter> writer;
+  writer->SetInputData(image);
+  writer->SetFileName((prefix + "_serial.png").c_str());
+  writer->Write();
+  writer->ParallelEncodingOn();
+  writer->SetFileName((prefix + "_parallel.png").c_str());
+  writer->Write();
+  writer->WriteToMemoryOn();
+  writer->Write();
+
+  vtkNew<vtkPNGReader> reader;
+  auto serial = ::Read(reader, prefix + "_serial.png");
+  auto parallel = ::Read(reader, prefix + "_parallel.png");
+  auto memory = ::Read(reader, writer->GetResult());
+  bool success = ::Check(::GetMaximumDifference(image, serial), 0, prefix + " serial PNG");
+  success &= ::Check(::GetMaximumDifference(image, parallel), 0, prefix + " parallel PNG");
+  success &= ::Check(::GetMaximumDifference(image, memory), 0, prefix + " in-memory PNG");
+  return success;
+}
+
+bool TestJPEG(vtkImageData* image, const std::string& prefix)
+{
+  vtkNew<vtkJPEGWriter> writer;
+  writer->SetInputData(image);
+  writer->ProgressiveOff();
+  writer->SetFileName((prefix + "_serial.jpg").c_str());
+  writer->Write();
+  writer->ParallelEncodingOn();
+  writer->SetFileName((prefix + "_parallel.jpg").c_str());
+  writer->Write();
+  writer->WriteToMemoryOn();
+  writer->Write();
+
+  // The bands are encoded with the same tables, so that the restart markers
+  // are the only difference with the serial encoding, which is lossless.
+  vtkNew<vtkJPEGReader> reader;
+  auto serial = ::Read(reader, prefix + "_serial.jpg");
+  auto parallel = ::Read(reader, prefix + "_parallel.jpg");
+  auto memory = ::Read(reader, writer->GetResult());
+  bool success =
+    ::Check(::GetMaximumDifference(serial, parallel), 0, prefix + " serial and parallel JPEG");
+  success &=
+    ::Check(::GetMaximumDifference(serial, memory), 0, prefix + " serial and in-memory JPEG");
+  return success;
+}
+}
+
+int TestImageWriterParallelEncoding(int argc, char* argv[])
+{
+  const char* tdir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string tempDir = tdir;
+  delete[] tdir;
+  if (tempDir.empty())
+  {
+    std::cout << "Could not determine temporary directory.\n";
+    return EXIT_FAILURE;
+  }
+  const std::string prefix = tempDir + "/TestImageWriterParallelEncoding";
+
+  bool success = ::TestPNG(::MakeImage(VTK_UNSIGNED_CHAR, 3), prefix + "_rgb");
+  success &= ::TestPNG(::MakeImage(VTK_UNSIGNED_SHORT, 1), prefix + "_short");
+  success &= ::TestPNG(::MakeImage(VTK_UNSIGNED_CHAR, 4), prefix + "_rgba");
+  success &= ::TestJPEG(::MakeImage(VTK_UNSIGNED_CHAR, 3), prefix + "_rgb");
+  success &= ::TestJPEG(::MakeImage(VTK_UNSIGNED_CHAR, 1), prefix + "_gray");
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// .NAME Test of sub-extent requests for vtkTIFFReader
+// .SECTION Description
+// Read a tiled image and compressed multi-page images made of strips, both
+// whole and by sub-extents that do not align with the tiles or strips, and
+// check that the sub-extents match the whole image. The deflate compression
+// is decoded by the RGBA interface of libtiff, the others directly.
+
+#include "vtkTestUtilities.h"
+
+#include <vtkImageCast.h>
+#include <vtkImageData.h>
+#include <vtkImageMandelbrotSource.h>
+#include <vtkNew.h>
+#include <vtkSmartPointer.h>
+#include <vtkTIFFReader.h>
+#include <vtkTIFFWriter.h>
+
+#include <cstring>
+#include <string>
+
+namespace
+{
+vtkSmartPointer<vtkImageData> Read(const std::string& fileName, const int* updateExtent)
+{
+  vtkNew<vtkTIFFReader> reader;
+  reader->SetFileName(fileName.c_str());
+  if (updateExtent)
+  {
+    reader->UpdateExtent(updateExtent);
+  }
+  else
+  {
+    reader->Update();
+  }
+  auto output = vtkSmartPointer<vtkImageData>::New();
+  output->DeepCopy(reader->GetOutput());
+  return output;
+}
+
+// Compare the voxels of the sub-extent of image1 with the same voxels of image0.
+bool SameVoxels(vtkImageData* image0, vtkImageData* image1, const char* what)
+{
+  int* extent = image1->GetExtent();
+  const int numberOfComponents = image1->GetNumberOfScalarComponents();
+  if (image0->GetScalarType() != image1->GetScalarType() ||
+    image0->GetNumberOfScalarComponents() != numberOfComponents)
+  {
+    std::cerr << "Error: " << what << " have different scalars." << std::endl;
+    return false;
+  }
+  const size_t rowSize =
+    (extent[1] - extent[0] + 1) * numberOfComponents * image1->GetScalarSize();
+  for (int k = extent[4]; k <= extent[5]; ++k)
+  {
+    for (int j = extent[2]; j <= extent[3]; ++j)
+    {
+      if (memcmp(image0->GetScalarPointer(extent[0], j, k),
+            image1->GetScalarPointer(extent[0], j, k), rowSize) != 0)
+      {
+        std::cerr << "Error: " << what << " differ in row " << j << " of slice " << k << "."
+                  << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool TestSubExtents(const std::string& fileName)
+{
+  auto whole = ::Read(fileName, nullptr);
+  bool success = true;
+
+  int* wholeExtent = whole->GetExtent();
+  const int subExtents[][6] = {
+    // A single voxel, a single row, a single column.
+    { 7, 7, 9, 9, wholeExtent[4], wholeExtent[4] },
+    { wholeExtent[0], wholeExtent[1], 33, 33, wholeExtent[5], wholeExtent[5] },
+    { 45, 45, wholeExtent[2], wholeExtent[3], wholeExtent[4], wholeExtent[5] },
+    // Blocks of voxels crossing the tiles or the strips.
+    { 3, wholeExtent[1] - 5, 17, wholeExtent[3] - 2, wholeExtent[4], wholeExtent[5] },
+    { 31, 52, 30, 70, wholeExtent[5], wholeExtent[5] },
+  };
+  for (const int* subExtent : subExtents)
+  {
+    auto piece = ::Read(fileName, subExtent);
+    success &= ::SameVoxels(whole, piece, "sub-extent and whole image");
+  }
+  return success;
+}
+}
+
+int TestTIFFReaderSubExtent(int argc, char* argv[])
+{
+  const char* tdir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string tempDir = tdir;
+  delete[] tdir;
+  if (tempDir.empty())
+  {
+    std::cout << "Could not determine temporary directory.\n";
+    return EXIT_FAILURE;
+  }
+
+  // Tiled RGB image, whose width and height are not multiples of the tiles.
+  char* tiledFileName =
+    vtkTestUtilities::ExpandDataFileName(argc, argv, "Data/libtiff/gourds_tiled_200x300.tif");
+  bool success = ::TestSubExtents(tiledFileName);
+  delete[] tiledFileName;
+
+  // Compressed multi-page images whose strips do not divide their height.
+  vtkNew<vtkImageMandelbrotSource> mandelbrot;
+  mandelbrot->SetWholeExtent(0, 99, 0, 99, 0, 2);
+  mandelbrot->SetMaximumNumberOfIterations(200);
+  vtkNew<vtkImageCast> cast;
+  cast->SetInputConnection(mandelbrot->GetOutputPort());
+  cast->SetOutputScalarTypeToUnsignedShort();
+  vtkNew<vtkTIFFWriter> writer;
+  writer->SetInputConnection(cast->GetOutputPort());
+
+  const std::string packBitsFileName = tempDir + "/TestTIFFReaderSubExtentPackBits.tif";
+  writer->SetFileName(packBitsFileName.c_str());
+  writer->SetCompressionToPackBits();
+  writer->Write();
+  success &= ::TestSubExtents(packBitsFileName);
+
+  const std::string deflateFileName = tempDir + "/TestTIFFReaderSubExtentDeflate.tif";
+  writer->SetFileName(deflateFileName.c_str());
+  writer->SetCompressionToDeflate();
+  writer->Write();
+  success &= ::TestSubExtents(deflateFileName);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -11,6 +11,7 @@
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 
@@ -18,7 +19,10 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#include <atomic>
 #include <ios>
+#include <string>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageReader2);
@@ -62,6 +66,8 @@ vtkImageReader2::vtkImageReader2()
   this->FileNameSliceOffset = 0;
   this->FileNameSliceSpacing = 1;
 
+  this->ParallelSliceReading = 0;
+
   // Left over from short reader
   this->SwapBytes = 0;
   this->FileLowerLeft = 0;
@@ -391,6 +397,8 @@ void vtkImageReader2::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Swap Bytes: " << (this->SwapBytes ? "On\n" : "Off\n");
 
+  os << indent << "ParallelSliceReading: " << (this->ParallelSliceReading ? "On\n" : "Off\n");
+
   os << indent << "DataIncrements: (" << this->DataIncrements[0];
   for (idx = 1; idx < 4; ++idx)
   {
@@ -542,6 +550,73 @@ void vtkImageReader2::CloseFile()
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkImageReader2::ReadSlices(
+  const int extent[6], const std::function<bool(int, const char*)>& readSlice)
+{
+  const int numberOfSlices = extent[5] - extent[4] + 1;
+  if (numberOfSlices < 1)
+  {
+    return true;
+  }
+
+  if (!this->ParallelSliceReading || numberOfSlices == 1 || this->MemoryBuffer)
+  {
+    for (int slice = extent[4]; slice <= extent[5]; ++slice)
+    {
+      if (this->CheckAbort())
+      {
+        return false;
+      }
+      this->ComputeInternalFileName(slice);
+      if (!readSlice(slice, this->InternalFileName))
+      {
+        return false;
+      }
+      this->UpdateProgress((slice - extent[4] + 1.0) / numberOfSlices);
+    }
+    return true;
+  }
+
+  // ComputeInternalFileName() may be overridden and modifies the reader:
+  // compute all the file names before reading.
+  std::vector<std::string> fileNames(numberOfSlices);
+  for (int slice = extent[4]; slice <= extent[5]; ++slice)
+  {
+    this->ComputeInternalFileName(slice);
+    if (this->InternalFileName)
+    {
+      fileNames[slice - extent[4]] = this->InternalFileName;
+    }
+  }
+
+  // One slice per grain: decoding a slice is expensive enough, and aborting
+  // skips the slices that are not yet started.
+  std::atomic<bool> failed(false);
+  std::atomic<int> slicesRead(0);
+  vtkSMPTools::CancellationScope cancellation(this->AbortExecute);
+  vtkSMPTools::For(extent[4], extent[5] + 1, 1, [&](vtkIdType begin, vtkIdType end) {
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    for (vtkIdType slice = begin; slice < end && !failed; ++slice)
+    {
+      if (!readSlice(static_cast<int>(slice), fileNames[slice - extent[4]].c_str()))
+      {
+        failed = true;
+      }
+      const int count = ++slicesRead;
+      if (isFirst)
+      {
+        this->UpdateProgress(static_cast<double>(count) / numberOfSlices);
+        if (this->CheckAbort())
+        {
+          failed = true;
+        }
+      }
+    }
+  });
+  return !failed && !this->CheckAbort();
+}
+
 //------------------------------------------------------------------------------
 int vtkImageReader2::OpenFile()
 {
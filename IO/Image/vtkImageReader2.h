@@ -32,6 +32,8 @@
 #include "vtkIOImageModule.h" // For export macro
 #include "vtkImageAlgorithm.h"
 
+#include <functional> // For std::function
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkStringArray;
 
@@ -252,6 +254,20 @@ public:
   vtkSetMacro(FileLowerLeft, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether the slices stored in separate files (see FileNames,
+   * FilePattern and FilePrefix) are read concurrently with vtkSMPTools,
+   * each slice being decoded directly into the output scalars. Only the
+   * slices of the update extent are read. This is supported by the readers
+   * that decode their files independently, i.e., vtkPNGReader and
+   * vtkJPEGReader; the other readers ignore it. Default is off.
+   */
+  vtkSetMacro(ParallelSliceReading, vtkTypeBool);
+  vtkGetMacro(ParallelSliceReading, vtkTypeBool);
+  vtkBooleanMacro(ParallelSliceReading, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Set/Get the internal file name
@@ -318,12 +334,28 @@ protected:
   int FileNameSliceOffset;
   int FileNameSliceSpacing;
 
+  vtkTypeBool ParallelSliceReading;
+
   int RequestInformation(vtkInformation* request, vtkInformationVector** inputVector,
     vtkInformationVector* outputVector) override;
   virtual void ExecuteInformation();
   void ExecuteDataWithInformation(vtkDataObject* data, vtkInformation* outInfo) override;
   virtual void ComputeDataIncrements();
 
+#if !defined(__WRAP__)
+  /**
+   * Read the slices of the extent, one file per slice, with readSlice(),
+   * which is given the index of the slice and the name of its file, and
+   * returns false if the slice cannot be read. The file names are computed
+   * with ComputeInternalFileName(). If ParallelSliceReading is on, the slices
+   * are read concurrently: readSlice() must then only write the memory of its
+   * slice. The progress is updated and the abort flag is checked as slices
+   * complete. Return false if a slice could not be read or if the reading was
+   * aborted, in which case the remaining slices are skipped.
+   */
+  bool ReadSlices(const int extent[6], const std::function<bool(int, const char*)>& readSlice);
+#endif
+
 private:
   vtkImageReader2(const vtkImageReader2&) = delete;
   void operator=(const vtkImageReader2&) = delete;
@@ -217,7 +217,8 @@ void vtkJPEGReader::ExecuteInformation()
 }
 
 template <class OT>
-int vtkJPEGReaderUpdate2(vtkJPEGReader* self, OT* outPtr, int* outExt, vtkIdType* outInc, long)
+int vtkJPEGReaderUpdate2(
+  vtkJPEGReader* self, const char* fileName, OT* outPtr, int* outExt, vtkIdType* outInc, long)
 {
   // certain variables must be stored here for longjmp
   struct vtk_jpeg_error_mgr jerr;
@@ -226,7 +227,7 @@ int vtkJPEGReaderUpdate2(vtkJPEGReader* self, OT* outPtr, int* outExt, vtkIdType
 
   if (!self->GetMemoryBuffer())
   {
-    jerr.fp = vtksys::SystemTools::Fopen(self->GetInternalFileName(), "rb");
+    jerr.fp = vtksys::SystemTools::Fopen(fileName, "rb");
     if (!jerr.fp)
     {
       return 1;
@@ -331,30 +332,23 @@ void vtkJPEGReader::InternalUpdate(vtkImageData* data, OT* outPtr)
 {
   vtkIdType outIncr[3];
   int outExtent[6];
-  OT* outPtr2;
 
   data->GetExtent(outExtent);
   data->GetIncrements(outIncr);
 
   long pixSize = data->GetNumberOfScalarComponents() * sizeof(OT);
 
-  outPtr2 = outPtr;
-  int idx2;
-  for (idx2 = outExtent[4]; idx2 <= outExtent[5]; ++idx2)
-  {
-    this->ComputeInternalFileName(idx2);
+  this->ReadSlices(outExtent, [&](int slice, const char* fileName) {
     // read in a JPEG file
-    if (vtkJPEGReaderUpdate2(this, outPtr2, outExtent, outIncr, pixSize) != 0)
+    OT* outPtr2 = outPtr + (slice - outExtent[4]) * outIncr[2];
+    if (vtkJPEGReaderUpdate2(this, fileName, outPtr2, outExtent, outIncr, pixSize) != 0)
     {
-      const char* fn = this->GetInternalFileName();
-      vtkErrorMacro("libjpeg could not read file: " << fn);
+      vtkErrorMacro("libjpeg could not read file: " << (fileName ? fileName : ""));
       this->ErrorCode = 2;
-      return;
+      return false;
     }
-
-    this->UpdateProgress((idx2 - outExtent[4]) / (outExtent[5] - outExtent[4] + 1.0));
-    outPtr2 += outIncr[2];
-  }
+    return true;
+  });
 }
 
 //------------------------------------------------------------------------------
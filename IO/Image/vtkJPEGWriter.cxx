@@ -6,10 +6,16 @@
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
 #include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+
 extern "C"
 {
 #include "vtk_jpeg.h"
@@ -28,6 +34,7 @@ vtkJPEGWriter::vtkJPEGWriter()
 
   this->Quality = 95;
   this->Progressive = 1;
+  this->ParallelEncoding = 0;
   this->Result = nullptr;
   this->TempFP = nullptr;
 }
@@ -201,6 +208,129 @@ void VTK_JPEG_ERROR_EXIT(j_common_ptr cinfo)
   VTK_JPEG_ERROR_PTR jpegErr = reinterpret_cast<VTK_JPEG_ERROR_PTR>(cinfo->err);
   longjmp(jpegErr->setjmp_buffer, 1);
 }
+
+// Height of the bands of rows encoded concurrently: a multiple of the height
+// of the MCUs, 16 rows with the default chroma subsampling.
+constexpr unsigned int JPEGBandRowsMultiple = 16;
+constexpr unsigned int JPEGMinimumBandRows = 64;
+
+//------------------------------------------------------------------------------
+// Encode rows into a baseline JPEG stream with a restart marker after each
+// row of MCUs. The entropy-coded segments between restart markers do not
+// depend on each other, which allows to merge the streams of several bands.
+bool EncodeJPEGBand(JSAMPROW* rows, unsigned int width, unsigned int height, int components,
+  J_COLOR_SPACE colorSpace, int quality, std::vector<unsigned char>& out)
+{
+  struct jpeg_compress_struct cinfo;
+  struct VTK_JPEG_ERROR_MANAGER jerr;
+  struct
+  {
+    unsigned char* Data;
+    unsigned long Size;
+  } buffer = { nullptr, 0 };
+
+  cinfo.err = jpeg_std_error(&jerr.pub);
+  jerr.pub.error_exit = VTK_JPEG_ERROR_EXIT;
+  if (setjmp(jerr.setjmp_buffer))
+  {
+    jpeg_destroy_compress(&cinfo);
+    free(buffer.Data);
+    return false;
+  }
+  jpeg_create_compress(&cinfo);
+  jpeg_mem_dest(&cinfo, &buffer.Data, &buffer.Size);
+  cinfo.image_width = width;
+  cinfo.image_height = height;
+  cinfo.input_components = components;
+  cinfo.in_color_space = colorSpace;
+  jpeg_set_defaults(&cinfo);
+  jpeg_set_quality(&cinfo, quality, TRUE);
+  cinfo.restart_in_rows = 1;
+  jpeg_start_compress(&cinfo, TRUE);
+  jpeg_write_scanlines(&cinfo, rows, height);
+  jpeg_finish_compress(&cinfo);
+  jpeg_destroy_compress(&cinfo);
+
+  out.assign(buffer.Data, buffer.Data + buffer.Size);
+  free(buffer.Data);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Return the offset of the entropy-coded data of a JPEG stream, after the
+// SOS segment, or 0 if the stream is not as expected. sof receives the offset
+// of the frame header, and restart whether the stream has restart markers.
+size_t GetJPEGScanOffset(const std::vector<unsigned char>& stream, size_t& sof, bool& restart)
+{
+  size_t pos = 2;
+  while (pos + 4 <= stream.size() && stream[pos] == 0xFF)
+  {
+    const unsigned char marker = stream[pos + 1];
+    const size_t length = (stream[pos + 2] << 8) | stream[pos + 3];
+    if (marker == 0xC0 || marker == 0xC1)
+    {
+      sof = pos;
+    }
+    else if (marker == 0xDD)
+    {
+      restart = true;
+    }
+    pos += 2 + length;
+    if (marker == 0xDA)
+    {
+      return pos <= stream.size() ? pos : 0;
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Merge the JPEG streams of consecutive bands, encoded by EncodeJPEGBand()
+// with the same parameters, into the stream of the whole image: the headers
+// of the first band, with the height of the image, followed by the
+// entropy-coded data of all the bands. The restart markers are numbered
+// modulo 8 over the whole image, and a restart marker separates the bands.
+bool MergeJPEGBands(const std::vector<std::vector<unsigned char>>& bands, unsigned int height,
+  std::vector<unsigned char>& out)
+{
+  unsigned int restartCount = 0;
+  for (size_t band = 0; band < bands.size(); ++band)
+  {
+    const std::vector<unsigned char>& stream = bands[band];
+    size_t sof = 0;
+    bool restart = false;
+    const size_t scan = GetJPEGScanOffset(stream, sof, restart);
+    if (!scan || !sof || !restart || stream.size() < scan + 2 ||
+      stream[stream.size() - 2] != 0xFF || stream[stream.size() - 1] != 0xD9)
+    {
+      return false;
+    }
+    if (band == 0)
+    {
+      out.assign(stream.begin(), stream.begin() + scan);
+      out[sof + 5] = static_cast<unsigned char>(height >> 8);
+      out[sof + 6] = static_cast<unsigned char>(height & 0xFF);
+    }
+    else
+    {
+      out.push_back(0xFF);
+      out.push_back(static_cast<unsigned char>(0xD0 + (restartCount++ & 7)));
+    }
+    const size_t end = stream.size() - 2;
+    for (size_t i = scan; i < end; ++i)
+    {
+      out.push_back(stream[i]);
+      if (stream[i] == 0xFF && i + 1 < end && stream[i + 1] >= 0xD0 && stream[i + 1] <= 0xD7)
+      {
+        out.push_back(static_cast<unsigned char>(0xD0 + (restartCount++ & 7)));
+        ++i;
+      }
+    }
+  }
+  out.push_back(0xFF);
+  out.push_back(0xD9);
+  return true;
+}
 }
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -229,6 +359,12 @@ void vtkJPEGWriter::WriteSlice(vtkImageData* data, int* uExtent)
     return;
   }
 
+  // Encode bands of rows concurrently, progressive JPEG cannot be split
+  if (this->ParallelEncoding && !this->Progressive && this->WriteSliceInBands(data, uExtent))
+  {
+    return;
+  }
+
   // overriding jpeg_error_mgr so we don't exit when an error happens
 
   // Create the jpeg compression object and error handler
@@ -346,12 +482,102 @@ void vtkJPEGWriter::WriteSlice(vtkImageData* data, int* uExtent)
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkJPEGWriter::WriteSliceInBands(vtkImageData* data, int* uExtent)
+{
+  const unsigned int width = uExtent[1] - uExtent[0] + 1;
+  const unsigned int height = uExtent[3] - uExtent[2] + 1;
+  const unsigned int numberOfThreads =
+    static_cast<unsigned int>(std::max(1, vtkSMPTools::GetEstimatedNumberOfThreads()));
+  unsigned int bandRows = std::max((height + numberOfThreads - 1) / numberOfThreads,
+    JPEGMinimumBandRows);
+  bandRows = (bandRows + JPEGBandRowsMultiple - 1) / JPEGBandRowsMultiple * JPEGBandRowsMultiple;
+  const unsigned int numberOfBands = (height + bandRows - 1) / bandRows;
+  if (numberOfBands < 2)
+  {
+    return false;
+  }
+
+  const int components = data->GetNumberOfScalarComponents();
+  J_COLOR_SPACE colorSpace = JCS_UNKNOWN;
+  if (components == 1)
+  {
+    colorSpace = JCS_GRAYSCALE;
+  }
+  else if (components == 3)
+  {
+    colorSpace = JCS_RGB;
+  }
+
+  // in jpeg, the first row is the top row of the image
+  std::vector<JSAMPROW> rows(height);
+  unsigned char* outPtr =
+    static_cast<unsigned char*>(data->GetScalarPointer(uExtent[0], uExtent[2], uExtent[4]));
+  const vtkIdType rowInc = data->GetIncrements()[1];
+  for (unsigned int ui = 0; ui < height; ui++)
+  {
+    rows[height - ui - 1] = outPtr;
+    outPtr += rowInc;
+  }
+
+  std::vector<std::vector<unsigned char>> bands(numberOfBands);
+  std::atomic<bool> failed(false);
+  const int quality = this->Quality;
+  vtkSMPTools::For(0, numberOfBands, 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType band = begin; band < end; ++band)
+    {
+      const unsigned int firstRow = static_cast<unsigned int>(band) * bandRows;
+      const unsigned int rowCount = std::min(bandRows, height - firstRow);
+      if (!EncodeJPEGBand(rows.data() + firstRow, width, rowCount, components, colorSpace,
+            quality, bands[band]))
+      {
+        failed = true;
+      }
+    }
+  });
+  std::vector<unsigned char> stream;
+  if (failed || !MergeJPEGBands(bands, height, stream))
+  {
+    return false;
+  }
+
+  if (this->WriteToMemory)
+  {
+    vtkUnsignedCharArray* uc = this->GetResult();
+    if (!uc || uc->GetReferenceCount() > 1)
+    {
+      uc = vtkUnsignedCharArray::New();
+      this->SetResult(uc);
+      uc->Delete();
+    }
+    uc->SetNumberOfTuples(static_cast<vtkIdType>(stream.size()));
+    std::copy(stream.begin(), stream.end(), uc->GetPointer(0));
+    return true;
+  }
+
+  FILE* fp = vtksys::SystemTools::Fopen(this->InternalFileName, "wb");
+  if (!fp)
+  {
+    vtkErrorMacro("Unable to open file " << this->InternalFileName);
+    this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+    return true;
+  }
+  if (fwrite(stream.data(), 1, stream.size(), fp) != stream.size() || fflush(fp) == EOF)
+  {
+    this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
+  }
+  fclose(fp);
+  return true;
+}
+
+//------------------------------------------------------------------------------
 void vtkJPEGWriter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "Quality: " << this->Quality << "\n";
   os << indent << "Progressive: " << (this->Progressive ? "On" : "Off") << "\n";
+  os << indent << "ParallelEncoding: " << (this->ParallelEncoding ? "On" : "Off") << "\n";
   os << indent << "Result: " << this->Result << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -8,6 +8,11 @@
  * unsigned char. It relies on the IJG's libjpeg.  Thanks to IJG for
  * supplying a public jpeg IO library.
  *
+ * With ParallelEncoding on and Progressive off, large images are split into
+ * bands of rows which are encoded concurrently with vtkSMPTools. The bands
+ * are separated by restart markers, so that they are merged into a single
+ * baseline JPEG stream.
+ *
  * @sa
  * vtkJPEGReader
  */
@@ -51,6 +56,17 @@ public:
   vtkBooleanMacro(Progressive, vtkTypeUBool);
   ///@}
 
+  ///@{
+  /**
+   * Encode bands of rows of each image concurrently. This requires
+   * Progressive to be off, and adds a restart marker after each row of MCUs.
+   * Default is off.
+   */
+  vtkSetMacro(ParallelEncoding, vtkTypeUBool);
+  vtkGetMacro(ParallelEncoding, vtkTypeUBool);
+  vtkBooleanMacro(ParallelEncoding, vtkTypeUBool);
+  ///@}
+
   ///@{
   /**
    * Write the image to memory (a vtkUnsignedCharArray)
@@ -75,9 +91,16 @@ protected:
 
   void WriteSlice(vtkImageData* data, int* uExtent);
 
+  /**
+   * Write the slice with its bands of rows encoded concurrently. Return false
+   * if the slice is too small to be split or cannot be encoded.
+   */
+  bool WriteSliceInBands(vtkImageData* data, int* uExtent);
+
 private:
   int Quality;
   vtkTypeUBool Progressive;
+  vtkTypeUBool ParallelEncoding;
   vtkUnsignedCharArray* Result;
   FILE* TempFP;
 
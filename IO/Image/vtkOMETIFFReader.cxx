@@ -181,6 +181,8 @@ vtkStandardNewMacro(vtkOMETIFFReader);
 //------------------------------------------------------------------------------
 vtkOMETIFFReader::vtkOMETIFFReader()
   : OMEInternals(new vtkOMETIFFReader::vtkOMEInternals())
+  , PyramidLevel(0)
+  , NumberOfPyramidLevels(0)
 {
 }
 
@@ -195,6 +197,8 @@ vtkOMETIFFReader::~vtkOMETIFFReader()
 void vtkOMETIFFReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "PyramidLevel: " << this->PyramidLevel << endl;
+  os << indent << "NumberOfPyramidLevels: " << this->NumberOfPyramidLevels << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -221,13 +225,21 @@ int vtkOMETIFFReader::CanReadFile(const char* fname)
 //------------------------------------------------------------------------------
 void vtkOMETIFFReader::ExecuteInformation()
 {
-  this->Superclass::ExecuteInformation();
   auto& internals = (*this->InternalImage);
+  internals.PyramidLevel = this->PyramidLevel;
+  this->Superclass::ExecuteInformation();
+  this->NumberOfPyramidLevels = internals.NumberOfPyramidLevels;
   if (!internals.Image || !internals.IsOpen)
   {
     return;
   }
 
+  // The OME header is in the first page of the full resolution image.
+  if (internals.PyramidLevel > 0)
+  {
+    TIFFSetDirectory(internals.Image, 0);
+  }
+
   auto& omeinternals = (*this->OMEInternals);
   omeinternals.IsValid = false;
 
@@ -265,11 +277,25 @@ void vtkOMETIFFReader::ExecuteInformation()
   omeinternals.PhysicalSizeUnit[1] = pixelsXML.attribute("PhysicalSizeYUnit").as_string();
   omeinternals.PhysicalSizeUnit[2] = pixelsXML.attribute("PhysicalSizeZUnit").as_string();
 
+  // The sizes of the header are the sizes of the full resolution image: the
+  // pixels of a reduced resolution level are larger.
+  const int levelSizeX = this->DataExtent[1] - this->DataExtent[0] + 1;
+  const int levelSizeY = this->DataExtent[3] - this->DataExtent[2] + 1;
   if (!this->GetSpacingSpecifiedFlag())
   {
     this->DataSpacing[0] = omeinternals.PhysicalSize[0];
     this->DataSpacing[1] = omeinternals.PhysicalSize[1];
     this->DataSpacing[2] = omeinternals.PhysicalSize[2];
+    if (internals.PyramidLevel > 0 && levelSizeX > 0 && levelSizeY > 0)
+    {
+      this->DataSpacing[0] *= static_cast<double>(omeinternals.SizeX) / levelSizeX;
+      this->DataSpacing[1] *= static_cast<double>(omeinternals.SizeY) / levelSizeY;
+    }
+  }
+  if (internals.PyramidLevel > 0)
+  {
+    omeinternals.SizeX = levelSizeX;
+    omeinternals.SizeY = levelSizeY;
   }
 
   assert(omeinternals.SizeX == (this->DataExtent[1] - this->DataExtent[0] + 1) &&
@@ -23,6 +23,12 @@
  * up into channels, timesteps, and z-planes. The parts are then cached
  * internally so that subsequent timestep requests can be served without
  * re-reading the file.
+ *
+ * Pyramidal OME-TIFF files store reduced resolution versions of each plane in
+ * the SubIFDs of the plane. The level to read is selected with
+ * SetPyramidLevel(): only the pages of this level are decoded, and the spacing
+ * is scaled so that the level covers the same physical extent as the full
+ * resolution image.
  */
 
 #ifndef vtkOMETIFFReader_h
@@ -44,6 +50,22 @@ public:
   const char* GetDescriptiveName() override { return "OME TIFF"; }
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the resolution level to read, 0 being the full resolution image.
+   * Levels greater than the number of levels of the file are clamped to the
+   * coarsest level. Default is 0.
+   */
+  vtkSetClampMacro(PyramidLevel, int, 0, VTK_INT_MAX);
+  vtkGetMacro(PyramidLevel, int);
+  ///@}
+
+  /**
+   * Return the number of resolution levels of the file, including the full
+   * resolution image. Valid after UpdateInformation().
+   */
+  vtkGetMacro(NumberOfPyramidLevels, int);
+
 protected:
   vtkOMETIFFReader();
   ~vtkOMETIFFReader() override;
@@ -59,6 +81,8 @@ private:
 
   class vtkOMEInternals;
   vtkOMEInternals* OMEInternals;
+  int PyramidLevel;
+  int NumberOfPyramidLevels;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -363,7 +363,8 @@ void vtkPNGReader::ExecuteInformation()
 
 //------------------------------------------------------------------------------
 template <class OT>
-void vtkPNGReader::vtkPNGReaderUpdate2(OT* outPtr, int* outExt, vtkIdType* outInc, long pixSize)
+void vtkPNGReader::vtkPNGReaderUpdate2(const char* fileName, OT* outPtr, int* outExt,
+  vtkIdType* outInc, long pixSize, bool readTextChunks)
 {
   vtkPNGReader::vtkInternals* impl = this->Internals;
   unsigned int ui;
@@ -384,10 +385,10 @@ void vtkPNGReader::vtkPNGReaderUpdate2(OT* outPtr, int* outExt, vtkIdType* outIn
   else
   {
     // Attempt to open the file and read the header
-    fp = vtksys::SystemTools::Fopen(this->InternalFileName, "rb");
+    fp = vtksys::SystemTools::Fopen(fileName, "rb");
     if (!fp)
     {
-      vtkErrorMacro("Unable to open file " << this->InternalFileName);
+      vtkErrorMacro("Unable to open file " << fileName);
       return;
     }
     if (!impl->CheckFileHeader(fp))
@@ -422,7 +423,10 @@ void vtkPNGReader::vtkPNGReaderUpdate2(OT* outPtr, int* outExt, vtkIdType* outIn
   png_get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth, &color_type, &interlace_type,
     &compression_type, &filter_method);
 
-  impl->ReadTextChunks(png_ptr, info_ptr);
+  if (readTextChunks)
+  {
+    impl->ReadTextChunks(png_ptr, info_ptr);
+  }
 
   // set-up the transformations
   // convert palettes to RGB
@@ -495,23 +499,20 @@ void vtkPNGReader::vtkPNGReaderUpdate(vtkImageData* data, OT* outPtr)
 {
   vtkIdType outIncr[3];
   int outExtent[6];
-  OT* outPtr2;
 
   data->GetExtent(outExtent);
   data->GetIncrements(outIncr);
 
   long pixSize = data->GetNumberOfScalarComponents() * sizeof(OT);
 
-  outPtr2 = outPtr;
-  int idx2;
-  for (idx2 = outExtent[4]; idx2 <= outExtent[5]; ++idx2)
-  {
-    this->ComputeInternalFileName(idx2);
-    // read in a PNG file
-    this->vtkPNGReaderUpdate2(outPtr2, outExtent, outIncr, pixSize);
-    this->UpdateProgress((idx2 - outExtent[4]) / (outExtent[5] - outExtent[4] + 1.0));
-    outPtr2 += outIncr[2];
-  }
+  this->ReadSlices(outExtent, [&](int slice, const char* fileName) {
+    // read in a PNG file. The text chunks are those of the last slice, which
+    // is the only one that reads them when the slices are read concurrently.
+    OT* outPtr2 = outPtr + (slice - outExtent[4]) * outIncr[2];
+    this->vtkPNGReaderUpdate2(
+      fileName, outPtr2, outExtent, outIncr, pixSize, slice == outExtent[5]);
+    return true;
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -97,7 +97,8 @@ protected:
   template <class OT>
   void vtkPNGReaderUpdate(vtkImageData* data, OT* outPtr);
   template <class OT>
-  void vtkPNGReaderUpdate2(OT* outPtr, int* outExt, vtkIdType* outInc, long pixSize);
+  void vtkPNGReaderUpdate2(const char* fileName, OT* outPtr, int* outExt, vtkIdType* outInc,
+    long pixSize, bool readTextChunks);
 
 private:
   vtkPNGReader(const vtkPNGReader&) = delete;
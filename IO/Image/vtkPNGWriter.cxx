@@ -7,11 +7,16 @@
 #include "vtkErrorCode.h"
 #include "vtkImageData.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtk_png.h"
+#include "vtk_zlib.h"
 #include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -41,6 +46,7 @@ vtkPNGWriter::vtkPNGWriter()
   this->FileLowerLeft = 1;
   this->FileDimensionality = 2;
   this->CompressionLevel = 5;
+  this->ParallelEncoding = 0;
   this->Result = nullptr;
   this->TempFP = nullptr;
   this->Internals = new vtkInternals();
@@ -193,6 +199,253 @@ extern "C"
 
 static constexpr unsigned int VTK_MAXIMUM_UNCOMPRESSED_TEXT_SIZE = 10000;
 
+namespace
+{
+// Size of the window of the deflate streams of PNG files.
+constexpr size_t PNGWindowSize = 32768;
+// Bands smaller than this are not worth deflating separately.
+constexpr size_t PNGMinimumBandSize = 262144;
+// Largest IDAT chunk written.
+constexpr size_t PNGMaximumChunkSize = 1048576;
+
+//------------------------------------------------------------------------------
+// Copy a row, with its 16 bit samples in the big endian order of PNG files.
+void GetPNGRow(const png_byte* row, size_t rowBytes, bool swapBytes, png_byte* out)
+{
+  if (!swapBytes)
+  {
+    std::copy(row, row + rowBytes, out);
+    return;
+  }
+  for (size_t i = 0; i < rowBytes; i += 2)
+  {
+    out[i] = row[i + 1];
+    out[i + 1] = row[i];
+  }
+}
+
+//------------------------------------------------------------------------------
+png_byte PaethPredictor(int a, int b, int c)
+{
+  const int pa = std::abs(b - c);
+  const int pb = std::abs(a - c);
+  const int pc = std::abs(a + b - 2 * c);
+  return static_cast<png_byte>(pa <= pb && pa <= pc ? a : (pb <= pc ? b : c));
+}
+
+//------------------------------------------------------------------------------
+// Filter a row with the filter whose output has the smallest sum of absolute
+// values, the heuristic of libpng. out receives the filter type followed by
+// the filtered row. candidates holds 4 filtered rows.
+void FilterPNGRow(const png_byte* prior, const png_byte* row, size_t rowBytes, size_t bpp,
+  png_byte* out, png_byte* candidates)
+{
+  const size_t filteredBytes = rowBytes + 1;
+  auto weight = [](png_byte value) { return value < 128 ? value : 256 - value; };
+  size_t bestSum = 0;
+  for (size_t i = 0; i < rowBytes; ++i)
+  {
+    bestSum += weight(row[i]);
+  }
+  const png_byte* best = nullptr;
+  for (int filter = PNG_FILTER_VALUE_SUB; filter <= PNG_FILTER_VALUE_PAETH; ++filter)
+  {
+    png_byte* candidate = candidates + (filter - 1) * filteredBytes;
+    candidate[0] = static_cast<png_byte>(filter);
+    size_t sum = 0;
+    for (size_t i = 0; i < rowBytes; ++i)
+    {
+      const int a = i >= bpp ? row[i - bpp] : 0;
+      const int b = prior[i];
+      const int c = i >= bpp ? prior[i - bpp] : 0;
+      int predictor = 0;
+      switch (filter)
+      {
+        case PNG_FILTER_VALUE_SUB:
+          predictor = a;
+          break;
+        case PNG_FILTER_VALUE_UP:
+          predictor = b;
+          break;
+        case PNG_FILTER_VALUE_AVG:
+          predictor = (a + b) / 2;
+          break;
+        default:
+          predictor = PaethPredictor(a, b, c);
+          break;
+      }
+      const png_byte value = static_cast<png_byte>(row[i] - predictor);
+      candidate[i + 1] = value;
+      sum += weight(value);
+    }
+    if (sum < bestSum)
+    {
+      bestSum = sum;
+      best = candidate;
+    }
+  }
+  if (best)
+  {
+    std::copy(best, best + filteredBytes, out);
+  }
+  else
+  {
+    out[0] = PNG_FILTER_VALUE_NONE;
+    std::copy(row, row + rowBytes, out + 1);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Filter and deflate the rows [begin, end) of an image into a raw deflate
+// stream ending on a byte boundary, so that the streams of consecutive bands
+// can be concatenated: the band ends with a sync flush, or with the final
+// block for the last band. The dictionary is primed with the end of the
+// previous band, so that the bands compress almost as well as a single
+// stream. out starts with reserve bytes left for the caller.
+bool DeflatePNGBand(const std::vector<png_byte*>& rows, size_t rowBytes, size_t bpp,
+  bool swapBytes, int level, size_t begin, size_t end, size_t reserve,
+  std::vector<unsigned char>& out, uLong& adler)
+{
+  const size_t filteredBytes = rowBytes + 1;
+  std::vector<png_byte> prior(rowBytes, 0);
+  std::vector<png_byte> current(rowBytes);
+  std::vector<png_byte> filtered(filteredBytes);
+  std::vector<png_byte> candidates(4 * filteredBytes);
+  std::vector<png_byte> dictionary;
+
+  z_stream stream{};
+  if (deflateInit2(&stream, level, Z_DEFLATED, -15, 8, Z_FILTERED) != Z_OK)
+  {
+    return false;
+  }
+  out.resize(reserve + deflateBound(&stream, static_cast<uLong>((end - begin) * filteredBytes)));
+  size_t produced = reserve;
+  auto deflateInput = [&](int flush) {
+    int status;
+    do
+    {
+      if (produced == out.size())
+      {
+        out.resize(out.size() + out.size() / 2);
+      }
+      stream.next_out = out.data() + produced;
+      stream.avail_out = static_cast<uInt>(out.size() - produced);
+      status = deflate(&stream, flush);
+      produced = out.size() - stream.avail_out;
+    } while (status == Z_OK &&
+      (stream.avail_in > 0 || stream.avail_out == 0 || flush == Z_FINISH));
+    return status == Z_OK || status == Z_BUF_ERROR || status == Z_STREAM_END;
+  };
+
+  // The rows preceding the band are filtered again for the dictionary.
+  const size_t dictionaryRows =
+    std::min(begin, (PNGWindowSize + filteredBytes - 1) / filteredBytes);
+  const size_t first = begin - dictionaryRows;
+  if (first > 0)
+  {
+    GetPNGRow(rows[first - 1], rowBytes, swapBytes, prior.data());
+  }
+  adler = adler32(0L, Z_NULL, 0);
+  bool success = true;
+  for (size_t row = first; row < end && success; ++row)
+  {
+    GetPNGRow(rows[row], rowBytes, swapBytes, current.data());
+    FilterPNGRow(prior.data(), current.data(), rowBytes, bpp, filtered.data(), candidates.data());
+    std::swap(prior, current);
+    if (row < begin)
+    {
+      dictionary.insert(dictionary.end(), filtered.begin(), filtered.end());
+      continue;
+    }
+    if (row == begin && !dictionary.empty())
+    {
+      const size_t size = std::min(dictionary.size(), PNGWindowSize);
+      deflateSetDictionary(
+        &stream, dictionary.data() + dictionary.size() - size, static_cast<uInt>(size));
+    }
+    adler = adler32(adler, filtered.data(), static_cast<uInt>(filteredBytes));
+    stream.next_in = filtered.data();
+    stream.avail_in = static_cast<uInt>(filteredBytes);
+    success = deflateInput(Z_NO_FLUSH);
+  }
+  success = success && deflateInput(end == rows.size() ? Z_FINISH : Z_SYNC_FLUSH);
+  deflateEnd(&stream);
+  out.resize(produced);
+  return success;
+}
+
+//------------------------------------------------------------------------------
+// Write the IDAT chunks of an image made of bands of rows filtered and
+// deflated concurrently. Return false if the image is too small to be split,
+// or if it cannot be encoded, in which case nothing is written.
+bool WritePNGBands(png_structp png_ptr, const std::vector<png_byte*>& rows, size_t rowBytes,
+  size_t bpp, bool swapBytes, int level)
+{
+  const size_t height = rows.size();
+  const size_t numberOfThreads =
+    static_cast<size_t>(std::max(1, vtkSMPTools::GetEstimatedNumberOfThreads()));
+  const size_t minimumRows = std::max<size_t>(1, PNGMinimumBandSize / (rowBytes + 1));
+  const size_t bandRows = std::max((height + numberOfThreads - 1) / numberOfThreads, minimumRows);
+  const size_t numberOfBands = (height + bandRows - 1) / bandRows;
+  if (numberOfBands < 2)
+  {
+    return false;
+  }
+
+  // Band 0 starts with the 2 bytes of the zlib header.
+  std::vector<std::vector<unsigned char>> bands(numberOfBands);
+  std::vector<uLong> adlers(numberOfBands);
+  std::atomic<bool> failed(false);
+  const vtkIdType bandCount = static_cast<vtkIdType>(numberOfBands);
+  vtkSMPTools::For(0, bandCount, 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType band = begin; band < end; ++band)
+    {
+      const size_t firstRow = band * bandRows;
+      const size_t lastRow = std::min(firstRow + bandRows, height);
+      if (!DeflatePNGBand(rows, rowBytes, bpp, swapBytes, level, firstRow, lastRow,
+            band == 0 ? 2 : 0, bands[band], adlers[band]))
+      {
+        failed = true;
+      }
+    }
+  });
+  if (failed)
+  {
+    return false;
+  }
+
+  // zlib header: deflate with a 32K window, and the compression level.
+  const int flags = level < 2 ? 0 : (level < 6 ? 1 : (level == 6 ? 2 : 3));
+  const unsigned int header = (0x78 << 8) | (flags << 6);
+  bands[0][0] = 0x78;
+  bands[0][1] = static_cast<unsigned char>((flags << 6) + 31 - header % 31);
+
+  // zlib trailer: the Adler-32 checksum of the filtered rows.
+  uLong adler = adlers[0];
+  for (size_t band = 1; band < numberOfBands; ++band)
+  {
+    const size_t bandRowsInBand = std::min((band + 1) * bandRows, height) - band * bandRows;
+    const size_t bandBytes = bandRowsInBand * (rowBytes + 1);
+    adler = adler32_combine(adler, adlers[band], static_cast<z_off_t>(bandBytes));
+  }
+  std::vector<unsigned char>& last = bands.back();
+  for (int shift = 24; shift >= 0; shift -= 8)
+  {
+    last.push_back(static_cast<unsigned char>((adler >> shift) & 0xff));
+  }
+
+  for (const auto& band : bands)
+  {
+    for (size_t offset = 0; offset < band.size(); offset += PNGMaximumChunkSize)
+    {
+      png_write_chunk(png_ptr, reinterpret_cast<png_const_bytep>("IDAT"), band.data() + offset,
+        std::min(PNGMaximumChunkSize, band.size() - offset));
+    }
+  }
+  return true;
+}
+}
+
 void vtkPNGWriter::WriteSlice(vtkImageData* data, int* uExtent)
 {
   vtkInternals* impl = this->Internals;
@@ -337,9 +590,27 @@ void vtkPNGWriter::WriteSlice(vtkImageData* data, int* uExtent)
     row_pointers[offset] = (png_byte*)outPtr;
     outPtr = (unsigned char*)outPtr + rowInc;
   }
-  png_write_image(png_ptr, row_pointers.data());
+
+  // The image data of the parallel encoding are written as raw IDAT chunks:
+  // libpng only writes the other chunks, and the IEND chunk is written here.
+  const size_t bpp = static_cast<size_t>(data->GetNumberOfScalarComponents()) * bit_depth / 8;
+#ifdef VTK_WORDS_BIGENDIAN
+  const bool swapBytes = false;
+#else
+  const bool swapBytes = bit_depth > 8;
+#endif
+  if (this->ParallelEncoding &&
+    WritePNGBands(png_ptr, row_pointers, width * bpp, bpp, swapBytes, this->CompressionLevel))
+  {
+    png_write_chunk(png_ptr, reinterpret_cast<png_const_bytep>("IEND"), nullptr, 0);
+    png_write_flush(png_ptr);
+  }
+  else
+  {
+    png_write_image(png_ptr, row_pointers.data());
+    png_write_end(png_ptr, info_ptr);
+  }
   row_pointers.clear();
-  png_write_end(png_ptr, info_ptr);
 
   png_destroy_write_struct(&png_ptr, &info_ptr);
 
@@ -363,6 +634,7 @@ void vtkPNGWriter::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "Result: " << this->Result << "\n";
+  os << indent << "ParallelEncoding: " << (this->ParallelEncoding ? "On" : "Off") << "\n";
 }
 
 void vtkPNGWriter::AddText(const char* key, const char* value)
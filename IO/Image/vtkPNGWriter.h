@@ -7,6 +7,11 @@
  * vtkPNGWriter writes PNG files. It supports 1 to 4 component data of
  * unsigned char or unsigned short
  *
+ * With ParallelEncoding on, large images are split into bands of rows which
+ * are filtered and deflated concurrently with vtkSMPTools, then merged into a
+ * single zlib stream. The file is a standard PNG file, a few bytes larger
+ * than with the serial encoding.
+ *
  * @sa
  * vtkPNGReader
  */
@@ -45,6 +50,16 @@ public:
   vtkGetMacro(CompressionLevel, int);
   ///@}
 
+  ///@{
+  /**
+   * Encode bands of rows of each image concurrently. Images smaller than a
+   * few hundred kilobytes are always encoded serially. Default is off.
+   */
+  vtkSetMacro(ParallelEncoding, vtkTypeUBool);
+  vtkGetMacro(ParallelEncoding, vtkTypeUBool);
+  vtkBooleanMacro(ParallelEncoding, vtkTypeUBool);
+  ///@}
+
   ///@{
   /**
    * Write the image to memory (a vtkUnsignedCharArray)
@@ -99,6 +114,7 @@ protected:
 
   void WriteSlice(vtkImageData* data, int* uExtent);
   int CompressionLevel;
+  vtkTypeUBool ParallelEncoding;
   vtkUnsignedCharArray* Result;
   FILE* TempFP;
   class vtkInternals;
@@ -8,123 +8,15 @@
 #include "vtkImageData.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtksys/SystemTools.hxx"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <string>
 
 VTK_ABI_NAMESPACE_BEGIN
-namespace
-{
-struct FlipTrue
-{
-};
-struct FlipFalse
-{
-};
-
-int GetFileRow(int row, int height, FlipTrue)
-{
-  return height - row - 1;
-}
-
-int GetFileRow(int row, int, FlipFalse)
-{
-  return row;
-}
-
-// This is inverse of GetFileRow(), which is same as calling GetFileRow()
-// again.
-template <class Flip>
-int GetImageRow(int file_row, int height, Flip flip)
-{
-  return GetFileRow(file_row, height, flip);
-}
-
-bool SupportsRandomAccess(TIFF* image)
-{
-  unsigned int rowsPerStrip;
-  unsigned short compression;
-  TIFFGetFieldDefaulted(image, TIFFTAG_COMPRESSION, &compression);
-  TIFFGetFieldDefaulted(image, TIFFTAG_ROWSPERSTRIP, &rowsPerStrip);
-  return (compression == COMPRESSION_NONE || rowsPerStrip == 1);
-}
-
-bool PurgeInitialScanLinesIfNeeded(int fileStartRow, TIFF* image)
-{
-  if (fileStartRow == 0 || SupportsRandomAccess(image))
-  {
-    return true;
-  }
-
-  // File doesn't support random access and we want to start at a non-0 row. We
-  // read (and discard) initial scanlines.
-  unsigned int isize = TIFFScanlineSize(image);
-  tdata_t buf = _TIFFmalloc(isize);
-  for (int i = 0; i < fileStartRow; ++i)
-  {
-    if (TIFFReadScanline(image, buf, i, 0) <= 0)
-    {
-      _TIFFfree(buf);
-      return false;
-    }
-  }
-  _TIFFfree(buf);
-  return true;
-}
-
-// Simple scan line copy of a slice in a volume with tightly packed memory.
-template <typename T, typename Flip>
-bool ReadTemplatedImage(T* out, Flip flip, int startCol, int endCol, int startRow, int endRow,
-  int yIncrements, unsigned int height, TIFF* image)
-{
-  int fileStartRow = GetFileRow(startRow, height, flip);
-  int fileEndRow = GetFileRow(endRow, height, flip);
-  int minFileRow = std::min(fileStartRow, fileEndRow);
-  int maxFileRow = std::max(fileStartRow, fileEndRow);
-
-  if (!PurgeInitialScanLinesIfNeeded(minFileRow, image))
-  {
-    return false;
-  }
-
-  unsigned int isize = TIFFScanlineSize(image);
-  size_t scanLineSize = endCol - startCol + 1;
-  if (scanLineSize * sizeof(T) == isize)
-  {
-    // We can copy straight into the image data output.
-    for (int fi = minFileRow; fi <= maxFileRow; ++fi)
-    {
-      int i = GetImageRow(fi, height, flip);
-      T* tmp = out + (i - startRow) * yIncrements;
-      if (TIFFReadScanline(image, tmp, fi, 0) <= 0)
-      {
-        return false;
-      }
-    }
-  }
-  else
-  {
-    // Copy into a buffer of the appropriate size, then subset into the output.
-    tdata_t buf = _TIFFmalloc(isize);
-    for (int fi = minFileRow; fi <= maxFileRow; ++fi)
-    {
-      int i = GetImageRow(fi, height, flip);
-      T* tmp = out + (i - startRow) * yIncrements;
-      if (TIFFReadScanline(image, buf, fi, 0) <= 0)
-      {
-        _TIFFfree(buf);
-        return false;
-      }
-      memcpy(tmp, static_cast<T*>(buf) + startCol, sizeof(T) * scanLineSize);
-    }
-    _TIFFfree(buf);
-  }
-  return true;
-}
-}
-
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkTIFFReader);
 extern "C"
@@ -152,6 +44,7 @@ bool vtkTIFFReader::vtkTIFFReaderInternal::Open(const char* filename)
     this->Clean();
     return false;
   }
+  this->FileName = filename;
   if (!this->Initialize())
   {
     this->Clean();
@@ -170,6 +63,16 @@ void vtkTIFFReader::vtkTIFFReaderInternal::Clean()
     TIFFClose(this->Image);
     this->Image = nullptr;
   }
+  for (ThreadImage& threadImage : this->ThreadImages)
+  {
+    if (threadImage.Image)
+    {
+      TIFFClose(threadImage.Image);
+      threadImage.Image = nullptr;
+    }
+    threadImage.Buffer = std::vector<unsigned char>();
+  }
+  this->FileName.clear();
   this->Width = 0;
   this->Height = 0;
   this->SamplesPerPixel = 0;
@@ -191,6 +94,7 @@ void vtkTIFFReader::vtkTIFFReaderInternal::Clean()
   this->SubFiles = 0;
   this->SampleFormat = 1;
   this->ResolutionUnit = 1; // none
+  this->NumberOfPyramidLevels = 0;
   this->IsOpen = false;
 }
 
@@ -198,6 +102,7 @@ void vtkTIFFReader::vtkTIFFReaderInternal::Clean()
 vtkTIFFReader::vtkTIFFReaderInternal::vtkTIFFReaderInternal()
 {
   this->Image = nullptr;
+  this->PyramidLevel = 0;
   // Note that this suppresses all error/warning output from libtiff!
   TIFFSetErrorHandler(&vtkTIFFReaderInternalErrorHandler);
   TIFFSetWarningHandler(&vtkTIFFReaderInternalErrorHandler);
@@ -314,11 +219,91 @@ bool vtkTIFFReader::vtkTIFFReaderInternal::Initialize()
     {
       this->TileDepth = 0;
     }
+
+    // The reduced resolution images of a pyramid are stored in the sub-IFDs
+    // of each page. The levels share the description of the full resolution
+    // image, except for their size and tiling.
+    uint16_t numberOfSubIFDs = 0;
+    toff_t* subIFDs = nullptr;
+    this->NumberOfPyramidLevels = 1;
+    if (TIFFGetField(this->Image, TIFFTAG_SUBIFD, &numberOfSubIFDs, &subIFDs))
+    {
+      this->NumberOfPyramidLevels += numberOfSubIFDs;
+    }
+    this->PyramidLevel = std::min(this->PyramidLevel, this->NumberOfPyramidLevels - 1);
+    if (this->PyramidLevel > 0)
+    {
+      if (!this->SetPyramidLevelDirectory() ||
+        !TIFFGetField(this->Image, TIFFTAG_IMAGEWIDTH, &this->Width) ||
+        !TIFFGetField(this->Image, TIFFTAG_IMAGELENGTH, &this->Height))
+      {
+        return false;
+      }
+      if (this->NumberOfTiles > 0 && TIFFIsTiled(this->Image))
+      {
+        this->NumberOfTiles = TIFFNumberOfTiles(this->Image);
+        TIFFGetField(this->Image, TIFFTAG_TILEWIDTH, &this->TileWidth);
+        TIFFGetField(this->Image, TIFFTAG_TILELENGTH, &this->TileHeight);
+        this->TileRows = this->Height / this->TileHeight;
+        this->TileColumns = this->Width / this->TileWidth;
+      }
+      TIFFGetFieldDefaulted(this->Image, TIFFTAG_COMPRESSION, &this->Compression);
+    }
   }
 
   return true;
 }
 
+//------------------------------------------------------------------------------
+bool vtkTIFFReader::vtkTIFFReaderInternal::SetPyramidLevelDirectory()
+{
+  if (this->PyramidLevel <= 0)
+  {
+    return true;
+  }
+  uint16_t numberOfSubIFDs = 0;
+  toff_t* subIFDs = nullptr;
+  if (!TIFFGetField(this->Image, TIFFTAG_SUBIFD, &numberOfSubIFDs, &subIFDs) ||
+    this->PyramidLevel > numberOfSubIFDs)
+  {
+    return false;
+  }
+  // Copy the offset: subIFDs is owned by the directory being left.
+  const toff_t offset = subIFDs[this->PyramidLevel - 1];
+  return TIFFSetSubDirectory(this->Image, offset) != 0;
+}
+
+//------------------------------------------------------------------------------
+TIFF* vtkTIFFReader::vtkTIFFReaderInternal::GetThreadImage(uint64_t directory)
+{
+  ThreadImage& threadImage = this->ThreadImages.Local();
+  if (!threadImage.Image)
+  {
+    threadImage.Image = TIFFOpen(this->FileName.c_str(), "r");
+    if (!threadImage.Image)
+    {
+      return nullptr;
+    }
+  }
+  if (TIFFCurrentDirOffset(threadImage.Image) != directory &&
+    !TIFFSetSubDirectory(threadImage.Image, directory))
+  {
+    return nullptr;
+  }
+  return threadImage.Image;
+}
+
+//------------------------------------------------------------------------------
+unsigned char* vtkTIFFReader::vtkTIFFReaderInternal::GetThreadBuffer(size_t size)
+{
+  std::vector<unsigned char>& buffer = this->ThreadImages.Local().Buffer;
+  if (buffer.size() < size)
+  {
+    buffer.resize(size);
+  }
+  return buffer.data();
+}
+
 //------------------------------------------------------------------------------
 bool vtkTIFFReader::vtkTIFFReaderInternal::CanRead()
 {
@@ -596,18 +581,8 @@ void vtkTIFFReader::Process(OT* outPtr, int outExtent[6], vtkIdType outIncr[3])
     return;
   }
 
-  // tiled image
-  if (this->InternalImage->NumberOfTiles > 0)
-  {
-    this->ReadTiles(outPtr);
-    // close the TIFF file
-    this->InternalImage->Clean();
-    return;
-  }
-
-  // The input tiff dataset is neither multiple pages and nor
-  // tiled. Hence close the image and start reading each TIFF
-  // file
+  // The input tiff dataset does not have multiple pages. Hence close
+  // the image and start reading each TIFF file
   this->InternalImage->Clean();
 
   OT* outPtr2 = outPtr;
@@ -793,11 +768,19 @@ void vtkTIFFReader::ReadVolume(T* buffer)
   int outDims[3];
   vtkStructuredData::GetDimensionsFromExtent(this->OutputExtent, outDims);
 
+  // The pages of a reduced resolution level are reached through the pages
+  // of the full resolution image, which are then set explicitly.
+  const bool pyramid = this->InternalImage->PyramidLevel > 0;
+
   // counter for slices (not every page is a slice)
   int slice = 0;
   for (unsigned int page = 0; page < npages; ++page)
   {
     this->UpdateProgress(static_cast<double>(page + 1) / npages);
+    if (pyramid)
+    {
+      TIFFSetDirectory(this->InternalImage->Image, static_cast<tdir_t>(page));
+    }
     if (this->InternalImage->SubFiles > 0)
     {
       long subfiletype = 6;
@@ -805,7 +788,10 @@ void vtkTIFFReader::ReadVolume(T* buffer)
       {
         if (subfiletype != 0)
         {
-          TIFFReadDirectory(this->InternalImage->Image);
+          if (!pyramid)
+          {
+            TIFFReadDirectory(this->InternalImage->Image);
+          }
           continue;
         }
       }
@@ -826,6 +812,12 @@ void vtkTIFFReader::ReadVolume(T* buffer)
         this->ReadTwoSamplesPerPixelImage(volume, width, height);
         break;
       }
+      else if (!this->InternalImage->SetPyramidLevelDirectory())
+      {
+        vtkErrorMacro("Cannot read pyramid level " << this->InternalImage->PyramidLevel
+                                                   << " of page " << page << ".");
+        return;
+      }
       else
       {
         this->ReadImageInternal(buffer +
@@ -835,123 +827,11 @@ void vtkTIFFReader::ReadVolume(T* buffer)
 
     // advance to next slice
     slice++;
-    TIFFReadDirectory(this->InternalImage->Image);
-  }
-}
-
-/** Read a tiled tiff */
-void vtkTIFFReader::ReadTiles(void* buffer)
-{
-  unsigned char* volume = reinterpret_cast<unsigned char*>(buffer);
-  unsigned char* tile = new unsigned char[TIFFTileSize(this->InternalImage->Image)];
-
-  const unsigned int width = this->InternalImage->Width;
-  const unsigned int height = this->InternalImage->Height;
-  const unsigned int tileWidth = this->InternalImage->TileWidth;
-  const unsigned int tileHeight = this->InternalImage->TileHeight;
-  const unsigned int pixelSize = this->InternalImage->SamplesPerPixel;
-  const bool rowMultiple = height % tileHeight == 0;
-  const bool colMultiple = width % tileWidth == 0;
-  const bool flip = this->InternalImage->Orientation != ORIENTATION_TOPLEFT;
-
-  for (unsigned int slice = 0; slice < this->InternalImage->NumberOfPages; ++slice)
-  {
-    for (unsigned int row = 0; row < (rowMultiple ? height : height - tileHeight);
-         row += tileHeight)
-    {
-      const unsigned int r = flip ? height - row - tileHeight : row;
-      for (unsigned int col = 0; col < (colMultiple ? width : width - tileWidth); col += tileWidth)
-      {
-        if (TIFFReadTile(this->InternalImage->Image, tile, col, r, slice, 0) < 0)
-        {
-          vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
-          delete[] tile;
-          return;
-        }
-        // Currently not using tile depth
-        unsigned int zz = 0;
-        for (unsigned int yy = 0; yy < tileHeight; ++yy)
-        {
-          const unsigned int y = flip ? tileHeight + height % tileHeight - yy - 1 : yy;
-          memcpy(volume + (((slice + zz) * height + row + y) * width + col) * pixelSize,
-            tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tileWidth * pixelSize);
-        }
-      }
-    }
-  }
-  // Fill the boundaries
-  if (!colMultiple)
-  {
-    const unsigned int lenx = width % tileWidth;
-    const unsigned int col = width - lenx;
-    const unsigned int tilexWidth = lenx;
-    for (unsigned int row = 0; row < (rowMultiple ? height : height - tileHeight);
-         row += tileHeight)
-    {
-      const unsigned int r = flip ? height - row - tileHeight - 1 : row;
-      if (TIFFReadTile(this->InternalImage->Image, tile, col, r, 0, 0) < 0)
-      {
-        vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
-        delete[] tile;
-        return;
-      }
-      const unsigned int zz = 0;
-      for (unsigned int yy = 0; yy < tileHeight; ++yy)
-      {
-        const unsigned int y = flip ? tileHeight + height % tileHeight - yy - 1 : yy;
-        memcpy(volume + (((0 + zz) * height + row + y) * width + col) * pixelSize,
-          tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tilexWidth * pixelSize);
-      }
-    }
-  }
-  if (!rowMultiple)
-  {
-    const unsigned int leny = height % tileHeight;
-    const unsigned int row = height - leny;
-    const unsigned int r = flip ? 0 : row;
-    for (unsigned int col = 0; col < (colMultiple ? width : width - tileWidth); col += tileWidth)
-    {
-      if (TIFFReadTile(this->InternalImage->Image, tile, col, row, 0, 0) < 0)
-      {
-        vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
-        delete[] tile;
-        return;
-      }
-      const unsigned int zz = 0;
-      for (unsigned int yy = 0; yy < leny; ++yy)
-      {
-        const unsigned int y = flip ? leny - yy - 1 : yy;
-        memcpy(volume + (((0 + zz) * height + r + y) * width + col) * pixelSize,
-          tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tileWidth * pixelSize);
-      }
-    }
-  }
-  if (!colMultiple && !rowMultiple)
-  {
-    const unsigned int lenx = width % tileWidth;
-    const unsigned int col = width - lenx;
-
-    const unsigned int leny = height % tileHeight;
-    const unsigned int row = height - leny;
-    const unsigned int tilexWidth = lenx;
-
-    const unsigned int r = flip ? 0 : row;
-    if (TIFFReadTile(this->InternalImage->Image, tile, col, row, 0, 0) < 0)
-    {
-      vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
-      delete[] tile;
-      return;
-    }
-    const unsigned int zz = 0;
-    unsigned int y;
-    for (unsigned int yy = 0; yy < leny; ++yy)
+    if (!pyramid)
     {
-      y = flip ? leny - yy - 1 : yy;
-      memcpy(volume + (((0 + zz) * height + r + y) * width + col) * pixelSize,
-        tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tilexWidth * pixelSize);
+      TIFFReadDirectory(this->InternalImage->Image);
     }
   }
-  delete[] tile;
 }
 
 /** To Support Zeiss images that contains only 2 samples per pixel but are actually
@@ -1099,192 +979,214 @@ void vtkTIFFReader::ReadTwoSamplesPerPixelImage(void* out, unsigned int width, u
   _TIFFfree(buf);
 }
 
+//------------------------------------------------------------------------------
 template <typename T>
-void vtkTIFFReader::ReadGenericImage(T* out, unsigned int, unsigned int height)
+void vtkTIFFReader::ReadImageInternal(T* outPtr)
 {
-  // Fast path for simple images
-  unsigned int format = this->GetFormat();
-  if (this->InternalImage->PlanarConfig == PLANARCONFIG_CONTIG && this->OutputIncrements[0] == 1 &&
-    (format == vtkTIFFReader::GRAYSCALE &&
-      this->InternalImage->Photometrics == PHOTOMETRIC_MINISBLACK &&
-      this->InternalImage->SamplesPerPixel == 1))
+  if (this->InternalImage->CanRead())
   {
-    if (this->InternalImage->Orientation == ORIENTATION_TOPLEFT)
-    {
-      FlipFalse flip;
-      if (!ReadTemplatedImage(out, flip, this->OutputExtent[0], this->OutputExtent[1],
-            this->OutputExtent[2], this->OutputExtent[3], this->OutputIncrements[1], height,
-            this->InternalImage->Image))
-      {
-        vtkErrorMacro(<< "Problem reading slice of volume in TIFF file.");
-      }
-    }
-    else
+    switch (this->GetFormat())
     {
-      FlipTrue flip;
-      if (!ReadTemplatedImage(out, flip, this->OutputExtent[0], this->OutputExtent[1],
-            this->OutputExtent[2], this->OutputExtent[3], this->OutputIncrements[1], height,
-            this->InternalImage->Image))
-      {
-        vtkErrorMacro(<< "Problem reading slice of volume in TIFF file.");
-      }
+      case vtkTIFFReader::GRAYSCALE:
+      case vtkTIFFReader::RGB:
+      case vtkTIFFReader::PALETTE_RGB:
+      case vtkTIFFReader::PALETTE_GRAYSCALE:
+        break;
+      default:
+        return;
     }
-    return;
   }
-
-  unsigned int isize = TIFFScanlineSize(this->InternalImage->Image);
-
-  if (this->InternalImage->PlanarConfig != PLANARCONFIG_CONTIG)
+  if (!this->ReadBlocks(outPtr))
   {
-    vtkErrorMacro(<< "This reader can only do PLANARCONFIG_CONTIG");
-    return;
+    vtkErrorMacro(<< "Problem reading the image in TIFF file " << this->InternalImage->FileName);
   }
+}
 
-  tdata_t buf = _TIFFmalloc(isize);
-
-  T* image;
-  if (this->InternalImage->PlanarConfig == PLANARCONFIG_CONTIG)
+//------------------------------------------------------------------------------
+// Read the tiles or the strips of the current directory intersecting the
+// output extent. The blocks are independent: they are decoded concurrently,
+// each thread with its own handle on the file, straight into the output.
+template <typename T>
+bool vtkTIFFReader::ReadBlocks(T* outPtr)
+{
+  vtkTIFFReaderInternal* internals = this->InternalImage;
+  TIFF* image = internals->Image;
+  const int width = static_cast<int>(internals->Width);
+  const int height = static_cast<int>(internals->Height);
+  const bool tiled = TIFFIsTiled(image) != 0;
+  const bool canRead = internals->CanRead();
+  const unsigned int format =
+    canRead ? this->GetFormat() : static_cast<unsigned int>(vtkTIFFReader::OTHER);
+  const bool flip = internals->Orientation != ORIENTATION_TOPLEFT;
+  const int samplesPerPixel = internals->SamplesPerPixel;
+
+  // Strips are blocks spanning the width of the image.
+  uint32_t blockWidth = width;
+  uint32_t blockHeight = height;
+  if (tiled)
   {
-    int fileRow = 0;
-    for (int row = this->OutputExtent[2]; row <= this->OutputExtent[3]; ++row)
-    {
-      // Flip from lower left origin to upper left if necessary.
-      if (this->InternalImage->Orientation == ORIENTATION_TOPLEFT)
-      {
-        fileRow = row;
-      }
-      else
-      {
-        fileRow = height - row - 1;
-      }
-      if (TIFFReadScanline(this->InternalImage->Image, buf, fileRow, 0) <= 0)
-      {
-        vtkErrorMacro(<< "Problem reading the row: " << fileRow);
-        break;
-      }
-      image = out + (row - this->OutputExtent[2]) * this->OutputIncrements[1];
-
-      // Copy the pixels into the output buffer
-      unsigned int cc = this->OutputExtent[0] * this->InternalImage->SamplesPerPixel;
-      for (int ix = this->OutputExtent[0]; ix <= this->OutputExtent[1]; ++ix)
-      {
-        this->EvaluateImageAt(image, static_cast<T*>(buf) + cc);
-        image += this->OutputIncrements[0];
-        cc += this->InternalImage->SamplesPerPixel;
-      }
-    }
+    TIFFGetField(image, TIFFTAG_TILEWIDTH, &blockWidth);
+    TIFFGetField(image, TIFFTAG_TILELENGTH, &blockHeight);
+  }
+  else
+  {
+    TIFFGetFieldDefaulted(image, TIFFTAG_ROWSPERSTRIP, &blockHeight);
+    blockHeight = std::min(blockHeight, static_cast<uint32_t>(height));
+  }
+  if (blockWidth == 0 || blockHeight == 0)
+  {
+    return false;
+  }
+  const int bw = static_cast<int>(blockWidth);
+  const int bh = static_cast<int>(blockHeight);
+
+  // TIFFReadRGBATile() and TIFFReadRGBAStrip() apply the orientation of the
+  // file: their rows are bottom-up when the file rows are top-down, and their
+  // columns are mirrored when the file columns are right to left.
+  uint16_t fileOrientation = ORIENTATION_TOPLEFT;
+  if (!canRead)
+  {
+    TIFFGetField(image, TIFFTAG_ORIENTATION, &fileOrientation);
   }
-  else if (this->InternalImage->PlanarConfig == PLANARCONFIG_SEPARATE)
+  const bool rasterBottomUp = !canRead &&
+    (fileOrientation == ORIENTATION_TOPLEFT || fileOrientation == ORIENTATION_TOPRIGHT ||
+      fileOrientation == ORIENTATION_LEFTTOP || fileOrientation == ORIENTATION_RIGHTTOP);
+  const bool mirror = !canRead &&
+    (fileOrientation == ORIENTATION_TOPRIGHT || fileOrientation == ORIENTATION_BOTRIGHT ||
+      fileOrientation == ORIENTATION_RIGHTTOP || fileOrientation == ORIENTATION_RIGHTBOT);
+  // The rows of the output are flipped from the file rows when the origin is
+  // not the top left corner.
+  const bool flipRows = canRead ? flip : flip == rasterBottomUp;
+
+  // Rows and columns of the file covered by the output extent, and the
+  // blocks they intersect.
+  const int* ext = this->OutputExtent;
+  const vtkIdType* inc = this->OutputIncrements;
+  if (ext[0] > ext[1] || ext[2] > ext[3])
   {
-    int fileRow = 0;
-    unsigned long nsamples;
-    TIFFGetField(this->InternalImage->Image, TIFFTAG_SAMPLESPERPIXEL, &nsamples);
-    for (unsigned long s = 0; s < nsamples; ++s)
+    return true;
+  }
+  const int firstColumn = mirror ? width - 1 - ext[1] : ext[0];
+  const int lastColumn = mirror ? width - 1 - ext[0] : ext[1];
+  const int firstRow = flipRows ? height - 1 - ext[3] : ext[2];
+  const int lastRow = flipRows ? height - 1 - ext[2] : ext[3];
+  if (firstColumn < 0 || lastColumn >= width || firstRow < 0 || lastRow >= height)
+  {
+    return false;
+  }
+  const int firstBlockColumn = firstColumn / bw;
+  const int firstBlockRow = firstRow / bh;
+  const vtkIdType numberOfBlockColumns = lastColumn / bw - firstBlockColumn + 1;
+  const vtkIdType numberOfBlocks = numberOfBlockColumns * (lastRow / bh - firstBlockRow + 1);
+
+  // Samples are copied as is when no conversion is needed, otherwise pixel
+  // per pixel with EvaluateImageAt().
+  const bool copySamples = canRead && inc[0] == samplesPerPixel &&
+    ((format == vtkTIFFReader::GRAYSCALE && samplesPerPixel == 1 &&
+       internals->Photometrics == PHOTOMETRIC_MINISBLACK) ||
+      (format == vtkTIFFReader::RGB && samplesPerPixel == 3));
+
+  // Look up the color map once, so that the threads only read it.
+  if (format == vtkTIFFReader::PALETTE_RGB ||
+    (format == vtkTIFFReader::PALETTE_GRAYSCALE && !this->IgnoreColorMap))
+  {
+    unsigned short red, green, blue;
+    this->GetColor(0, &red, &green, &blue);
+  }
+
+  const uint64_t directory = TIFFCurrentDirOffset(image);
+  const size_t blockSize = canRead
+    ? static_cast<size_t>(tiled ? TIFFTileSize(image) : TIFFStripSize(image))
+    : static_cast<size_t>(bw) * bh * sizeof(uint32_t);
+  std::atomic<bool> failed(false);
+  vtkSMPTools::For(0, numberOfBlocks, [&](vtkIdType begin, vtkIdType end) {
+    TIFF* threadImage = internals->GetThreadImage(directory);
+    unsigned char* buffer = internals->GetThreadBuffer(blockSize);
+    if (!threadImage)
     {
-      for (int row = this->OutputExtent[2]; row <= this->OutputExtent[3]; ++row)
+      failed = true;
+      return;
+    }
+    for (vtkIdType block = begin; block < end && !failed; ++block)
+    {
+      const int x0 = static_cast<int>(firstBlockColumn + block % numberOfBlockColumns) * bw;
+      const int y0 = static_cast<int>(firstBlockRow + block / numberOfBlockColumns) * bh;
+      const int colBegin = std::max(x0, firstColumn);
+      const int colEnd = std::min(x0 + bw - 1, lastColumn);
+      const int rowBegin = std::max(y0, firstRow);
+      const int rowEnd = std::min(y0 + bh - 1, lastRow);
+
+      if (!canRead)
       {
-        if (this->InternalImage->Orientation == ORIENTATION_TOPLEFT)
-        {
-          fileRow = row;
-        }
-        else
-        {
-          fileRow = height - row - 1;
-        }
-        if (TIFFReadScanline(this->InternalImage->Image, buf, fileRow, s) <= 0)
+        // Let libtiff convert the block to RGBA. The blocks at the right and
+        // bottom of the image may be partial: libtiff moves the pixels of
+        // partial tiles to the bottom of the raster.
+        uint32_t* raster = reinterpret_cast<uint32_t*>(buffer);
+        if (!(tiled ? TIFFReadRGBATile(threadImage, x0, y0, raster)
+                    : TIFFReadRGBAStrip(threadImage, y0, raster)))
         {
-          vtkErrorMacro(<< "Problem reading the row: " << fileRow);
+          failed = true;
           break;
         }
-
-        image = out + (row - this->OutputExtent[2]) * this->OutputIncrements[1];
-        unsigned int cc = this->OutputExtent[0] * this->InternalImage->SamplesPerPixel;
-        for (int ix = this->OutputExtent[0]; ix <= this->OutputExtent[1]; ++ix)
+        const int readColumns = std::min(bw, width - x0);
+        const int readRows = std::min(bh, height - y0);
+        const int rasterRowOffset = tiled ? bh - readRows : 0;
+        for (int row = rowBegin; row <= rowEnd; ++row)
         {
-          this->EvaluateImageAt(image, static_cast<T*>(buf) + cc);
-          image += this->OutputIncrements[0];
-          cc += this->InternalImage->SamplesPerPixel;
+          const int rasterRow =
+            rasterRowOffset + (rasterBottomUp ? readRows - 1 - (row - y0) : row - y0);
+          const int outRow = flipRows ? height - 1 - row : row;
+          T* outRowPtr = outPtr + (outRow - ext[2]) * inc[1];
+          for (int col = colBegin; col <= colEnd; ++col)
+          {
+            const uint32_t pixel = raster[static_cast<vtkIdType>(rasterRow) * bw +
+              (mirror ? readColumns - 1 - (col - x0) : col - x0)];
+            T* out = outRowPtr + ((mirror ? width - 1 - col : col) - ext[0]) * inc[0];
+            out[0] = static_cast<T>(TIFFGetR(pixel));
+            out[1] = static_cast<T>(TIFFGetG(pixel));
+            out[2] = static_cast<T>(TIFFGetB(pixel));
+            out[3] = static_cast<T>(TIFFGetA(pixel));
+          }
         }
+        continue;
       }
-    }
-  }
-  _TIFFfree(buf);
-
-  // release color map ptrs, if any. since color map changes with each IFD,
-  // to avoid reading obsolete ptrs in `ReadVolume`, we just clear these
-  // references. The overhead to doing that is minimal. The next invocation to
-  // `ReadGenericImage` may have to fetch these points again. Note, these are
-  // just pointers to memory internally allocated by libtiff and hence we are
-  // not actually deep-copying the color map.
-  this->ColorRed = this->ColorBlue = this->ColorGreen = nullptr;
-  this->TotalColors = -1;
-}
-
-//------------------------------------------------------------------------------
-template <typename T>
-void vtkTIFFReader::ReadImageInternal(T* outPtr)
-{
-  int width = this->InternalImage->Width;
-  int height = this->InternalImage->Height;
-
-  if (!this->InternalImage->CanRead())
-  {
-    // Why do we read the image for the ! CanRead case?
-    uint32_t* tempImage = reinterpret_cast<uint32_t*>(outPtr);
 
-    if (this->OutputExtent[0] != 0 || this->OutputExtent[1] != width - 1 ||
-      this->OutputExtent[2] != 0 || this->OutputExtent[3] != height - 1)
-    {
-      tempImage = new uint32_t[width * height];
-    }
-    // This should really be fixed to read only the rows necessary.
-    if (!TIFFReadRGBAImage(this->InternalImage->Image, width, height, tempImage, 0))
-    {
-      vtkErrorMacro("Problem reading RGB image");
-      if (tempImage != reinterpret_cast<uint32_t*>(outPtr))
+      const tmsize_t read = tiled
+        ? TIFFReadEncodedTile(threadImage, TIFFComputeTile(threadImage, x0, y0, 0, 0), buffer,
+            static_cast<tmsize_t>(blockSize))
+        : TIFFReadEncodedStrip(threadImage, TIFFComputeStrip(threadImage, y0, 0), buffer,
+            static_cast<tmsize_t>(blockSize));
+      if (read < 0)
       {
-        delete[] tempImage;
+        failed = true;
+        break;
       }
-      return;
-    }
-    const bool flip = this->InternalImage->Orientation != ORIENTATION_TOPLEFT;
-    T* fimage = outPtr;
-    for (int yy = 0; yy < height; ++yy)
-    {
-      uint32_t* ssimage = flip ? (tempImage + yy * width) : (tempImage + (height - yy - 1) * width);
-      for (int xx = 0; xx < width; ++xx)
+      for (int row = rowBegin; row <= rowEnd; ++row)
       {
-        if (xx >= this->OutputExtent[0] && xx <= this->OutputExtent[1] &&
-          yy >= this->OutputExtent[2] && yy <= this->OutputExtent[3])
+        T* in = reinterpret_cast<T*>(buffer) +
+          (static_cast<vtkIdType>(row - y0) * bw + (colBegin - x0)) * samplesPerPixel;
+        const int outRow = flipRows ? height - 1 - row : row;
+        T* out = outPtr + (outRow - ext[2]) * inc[1] + (colBegin - ext[0]) * inc[0];
+        if (copySamples)
         {
-          *(fimage) = static_cast<T>(TIFFGetR(*ssimage));     // Red
-          *(fimage + 1) = static_cast<T>(TIFFGetG(*ssimage)); // Green
-          *(fimage + 2) = static_cast<T>(TIFFGetB(*ssimage)); // Blue
-          *(fimage + 3) = static_cast<T>(TIFFGetA(*ssimage)); // Alpha
-          fimage += 4;
+          std::copy(in, in + (colEnd - colBegin + 1) * samplesPerPixel, out);
+          continue;
+        }
+        for (int col = colBegin; col <= colEnd; ++col)
+        {
+          this->EvaluateImageAt(out, in);
+          out += inc[0];
+          in += samplesPerPixel;
         }
-        ++ssimage;
       }
     }
+  });
 
-    if (tempImage != reinterpret_cast<uint32_t*>(outPtr))
-    {
-      delete[] tempImage;
-    }
-    return;
-  }
-
-  switch (this->GetFormat())
-  {
-    case vtkTIFFReader::GRAYSCALE:
-    case vtkTIFFReader::RGB:
-    case vtkTIFFReader::PALETTE_RGB:
-    case vtkTIFFReader::PALETTE_GRAYSCALE:
-      this->ReadGenericImage(outPtr, width, height);
-      break;
-    default:
-      return;
-  }
+  // The color map changes with each directory: release it, as ReadVolume()
+  // moves to the next page. These are pointers to memory owned by libtiff.
+  this->ColorRed = this->ColorBlue = this->ColorGreen = nullptr;
+  this->TotalColors = -1;
+  return !failed;
 }
 
 //------------------------------------------------------------------------------
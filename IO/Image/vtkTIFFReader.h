@@ -149,15 +149,11 @@ private:
   void ReadVolume(T* buffer);
 
   /**
-   * Reads 3D data from tiled tiff
-   */
-  void ReadTiles(void* buffer);
-
-  /**
-   * Reads a generic image.
+   * Reads the tiles or strips of the current page intersecting the output
+   * extent, concurrently. Returns false if a block cannot be decoded.
    */
   template <typename T>
-  void ReadGenericImage(T* out, unsigned int width, unsigned int height);
+  bool ReadBlocks(T* out);
 
   /**
    * Dispatch template to determine pixel type and decide on reader actions.
@@ -9,6 +9,11 @@
 #ifndef vtkTIFFReaderInternal_h
 #define vtkTIFFReaderInternal_h
 
+#include "vtkSMPThreadLocal.h"
+
+#include <string>
+#include <vector>
+
 extern "C"
 {
 #include "vtk_tiff.h"
@@ -19,13 +24,31 @@ class vtkTIFFReader::vtkTIFFReaderInternal
 {
 public:
   vtkTIFFReaderInternal();
-  ~vtkTIFFReaderInternal() = default;
+  ~vtkTIFFReaderInternal() { this->Clean(); }
 
   bool Initialize();
   void Clean();
   bool CanRead();
   bool Open(VTK_FILEPATH const char* filename);
+
+  /**
+   * Move from the current page to the sub-IFD holding its PyramidLevel.
+   */
+  bool SetPyramidLevelDirectory();
+
+  /**
+   * Return the handle on the file of the calling thread, set to the
+   * directory at the given offset, or nullptr if it cannot be opened.
+   */
+  TIFF* GetThreadImage(uint64_t directory);
+
+  /**
+   * Return a buffer of the given size, owned by the calling thread.
+   */
+  unsigned char* GetThreadBuffer(size_t size);
+
   TIFF* Image;
+  std::string FileName;
   bool IsOpen;
   unsigned int Width;
   unsigned int Height;
@@ -49,9 +72,22 @@ public:
   float XResolution;
   float YResolution;
   short SampleFormat;
+  // Level 0 is the full resolution image, level i > 0 is stored in the
+  // sub-IFD i - 1 of each page. PyramidLevel is kept by Clean().
+  int PyramidLevel;
+  int NumberOfPyramidLevels;
   static void ErrorHandler(const char* module, const char* fmt, va_list ap);
 
 private:
+  // Tiles and strips are decoded concurrently, each thread with its own
+  // handle on the file.
+  struct ThreadImage
+  {
+    TIFF* Image = nullptr;
+    std::vector<unsigned char> Buffer;
+  };
+  vtkSMPThreadLocal<ThreadImage> ThreadImages;
+
   vtkTIFFReaderInternal(const vtkTIFFReaderInternal&) = delete;
   void operator=(const vtkTIFFReaderInternal&) = delete;
 };
@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <vtkAbstractArray.h>
+#include <vtkDelimitedTextReader.h>
+#include <vtkNew.h>
+#include <vtkSmartPointer.h>
+#include <vtkTable.h>
+#include <vtkVariant.h>
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// This test reads the same delimited text with and without
+// ParallelNumericParsing and checks that the tables match, both for numeric
+// text, spanning several parallel chunks, and for text that needs the regular
+// parser.
+namespace
+{
+vtkSmartPointer<vtkTable> Read(const std::string& text, bool parallel, vtkIdType maxRecords,
+  bool haveHeaders, bool mergeConsecutiveDelimiters)
+{
+  vtkNew<vtkDelimitedTextReader> reader;
+  reader->SetReadFromInputString(true);
+  reader->SetInputString(text);
+  reader->SetHaveHeaders(haveHeaders);
+  reader->SetMergeConsecutiveDelimiters(mergeConsecutiveDelimiters);
+  reader->SetDetectNumericColumns(true);
+  reader->SetDefaultIntegerValue(-1);
+  reader->SetDefaultDoubleValue(-0.5);
+  reader->SetMaxRecords(maxRecords);
+  reader->SetParallelNumericParsing(parallel);
+  reader->Update();
+  return reader->GetOutput();
+}
+
+bool SameTables(vtkTable* expected, vtkTable* table, const char* what)
+{
+  if (table->GetNumberOfColumns() != expected->GetNumberOfColumns() ||
+    table->GetNumberOfRows() != expected->GetNumberOfRows())
+  {
+    std::cerr << what << ": expected " << expected->GetNumberOfColumns() << " columns and "
+              << expected->GetNumberOfRows() << " rows, got " << table->GetNumberOfColumns()
+              << " and " << table->GetNumberOfRows() << "." << std::endl;
+    return false;
+  }
+  for (vtkIdType column = 0; column < table->GetNumberOfColumns(); ++column)
+  {
+    vtkAbstractArray* expectedArray = expected->GetColumn(column);
+    vtkAbstractArray* array = table->GetColumn(column);
+    if (std::string(array->GetName()) != expectedArray->GetName() ||
+      array->GetDataType() != expectedArray->GetDataType())
+    {
+      std::cerr << what << ": column " << column << " is " << array->GetName() << " of type "
+                << array->GetDataTypeAsString() << ", expected " << expectedArray->GetName()
+                << " of type " << expectedArray->GetDataTypeAsString() << "." << std::endl;
+      return false;
+    }
+    for (vtkIdType row = 0; row < table->GetNumberOfRows(); ++row)
+    {
+      if (array->GetVariantValue(row) != expectedArray->GetVariantValue(row))
+      {
+        std::cerr << what << ": column " << column << " differs at row " << row << ": "
+                  << array->GetVariantValue(row) << " instead of "
+                  << expectedArray->GetVariantValue(row) << "." << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool TestText(const std::string& text, const char* what, vtkIdType maxRecords = 0,
+  bool haveHeaders = true, bool mergeConsecutiveDelimiters = false)
+{
+  auto expected = ::Read(text, false, maxRecords, haveHeaders, mergeConsecutiveDelimiters);
+  auto table = ::Read(text, true, maxRecords, haveHeaders, mergeConsecutiveDelimiters);
+  return ::SameTables(expected, table, what);
+}
+}
+
+int TestDelimitedTextReaderParallelNumeric(int, char*[])
+{
+  // Integers, doubles with exponents, empty fields, blank lines and CRLF.
+  std::ostringstream numeric;
+  numeric << "index,integer,real,sparse,large\r\n";
+  for (int i = 0; i < 100000; ++i)
+  {
+    numeric << i << "," << (i % 37) - 18 << "," << std::sin(i) * 1e3 << ",";
+    if (i % 5 != 0)
+    {
+      numeric << i / 3;
+    }
+    numeric << ", " << 1e-7 * i << " \r\n";
+    if (i % 1000 == 0)
+    {
+      numeric << "\r\n";
+    }
+  }
+  const std::string numericText = numeric.str();
+
+  bool success = ::TestText(numericText, "numeric columns");
+  success &= ::TestText(numericText, "first records", 12345);
+  success &= ::TestText("1;;2;3\n4;5;;6\n7;8;9;10", "no headers", 0, false, true);
+
+  // Strings and quoted fields fall back to the regular parser.
+  success &= ::TestText(numericText + "100000,1,2,abc,3\r\n", "string column");
+  success &= ::TestText(numericText + "\"100000\",1,2,3,4\r\n", "quoted field");
+  success &= ::TestText("a,b\n1,2\n3\n", "missing field");
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -5,15 +5,20 @@
 #include "vtkDelimitedTextReader.h"
 #include "vtkCommand.h"
 #include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkStringToNumeric.h"
 #include "vtkTable.h"
+#include "vtkValueFromString.h"
 
 #include "vtkTextCodec.h"
 #include "vtkTextCodecFactory.h"
@@ -22,6 +27,8 @@
 #include <vtk_utf8.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <iostream>
 #include <iterator>
 #include <set>
@@ -289,6 +296,332 @@ private:
   vtkTypeUInt32 WithinString;
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// Parallel numeric parsing
+
+/// Classifies the ASCII characters of the input for the parallel numeric parser.
+class NumericTextSyntax
+{
+public:
+  enum CharacterClass : unsigned char
+  {
+    RecordDelimiter = 1,
+    FieldDelimiter = 2,
+    // Whitespace stripped at the beginning of records by DelimitedTextIterator.
+    RecordWhitespace = 4,
+    // Characters that need the regular parser: string delimiters, escape
+    // characters and non-ASCII bytes.
+    Special = 8,
+    // Whitespace skipped around numbers by vtkVariant.
+    NumberWhitespace = 16,
+    // Whitespace removed by TrimWhitespacePriorToNumericConversion.
+    TrimmedWhitespace = 32
+  };
+
+  NumericTextSyntax(const std::string& record_delimiters, const std::string& field_delimiters,
+    const std::string& string_delimiters, const std::string& whitespace, const std::string& escape,
+    bool merge_cons_delimiters, bool trim_whitespace)
+    : MergeConsecutiveDelimiters(merge_cons_delimiters)
+    , TrimWhitespace(trim_whitespace)
+  {
+    std::fill(std::begin(this->Classes), std::end(this->Classes), 0);
+    std::fill(std::begin(this->Classes) + 0x80, std::end(this->Classes), Special);
+    this->Add(string_delimiters, Special);
+    this->Add(escape, Special);
+    this->Add(record_delimiters, RecordDelimiter);
+    this->Add(field_delimiters, FieldDelimiter);
+    this->Add(whitespace, RecordWhitespace);
+    this->Add(" \t\n\v\f\r", NumberWhitespace);
+    this->Add(" \n\t\r", TrimmedWhitespace);
+  }
+
+  bool Is(char c, unsigned char characterClass) const
+  {
+    return (this->Classes[static_cast<unsigned char>(c)] & characterClass) != 0;
+  }
+
+  // Skip the record delimiters and whitespace before the next record.
+  const char* SkipToRecord(const char* it, const char* end) const
+  {
+    while (it != end && this->Is(*it, RecordDelimiter | RecordWhitespace))
+    {
+      ++it;
+    }
+    return it;
+  }
+
+  // Find the end of the record starting at `it`, noting whether it contains
+  // characters that need the regular parser.
+  const char* FindRecordEnd(const char* it, const char* end, bool& special) const
+  {
+    for (; it != end && !this->Is(*it, RecordDelimiter); ++it)
+    {
+      special |= this->Is(*it, Special);
+    }
+    return it;
+  }
+
+  // Call functor(fieldIndex, fieldBegin, fieldEnd) for each field of a record
+  // the same way DelimitedTextIterator splits it. An unterminated record, at
+  // the end of the input, loses a last field that is empty or ends with
+  // whitespace. Returns the number of fields or -1 if the functor returns false.
+  template <typename FieldFunctor>
+  vtkIdType ForEachField(
+    const char* it, const char* end, bool terminated, FieldFunctor&& functor) const
+  {
+    for (vtkIdType index = 0;; ++index)
+    {
+      if (this->MergeConsecutiveDelimiters)
+      {
+        while (it != end && this->Is(*it, FieldDelimiter))
+        {
+          ++it;
+        }
+      }
+      const char* fieldEnd = it;
+      while (fieldEnd != end && !this->Is(*fieldEnd, FieldDelimiter))
+      {
+        ++fieldEnd;
+      }
+      if (fieldEnd == end && !terminated && (it == end || this->Is(end[-1], RecordWhitespace)))
+      {
+        return index;
+      }
+      if (!functor(index, it, fieldEnd))
+      {
+        return -1;
+      }
+      if (fieldEnd == end)
+      {
+        return index + 1;
+      }
+      it = fieldEnd + 1;
+    }
+  }
+
+  enum FieldKind
+  {
+    Number,
+    Empty,
+    NotANumber
+  };
+
+  // Convert a field the same way vtkStringToNumeric does. `integer` is only
+  // checked when true and is reset if the field is not an integer.
+  FieldKind ParseField(const char* begin, const char* end, double& value, bool& integer) const
+  {
+    const char* it = begin;
+    while (it != end && this->Is(*it, NumberWhitespace))
+    {
+      ++it;
+    }
+    if (it == end)
+    {
+      const bool trimmed = this->TrimWhitespace &&
+        std::all_of(begin, end, [this](char c) { return this->Is(c, TrimmedWhitespace); });
+      return (begin == end || trimmed) ? Empty : NotANumber;
+    }
+    const std::size_t consumed = vtkValueFromString(it, end, value);
+    if (consumed == 0)
+    {
+      return NotANumber;
+    }
+    for (const char* last = it + consumed; last != end; ++last)
+    {
+      if (!this->Is(*last, NumberWhitespace))
+      {
+        return NotANumber;
+      }
+    }
+    if (integer)
+    {
+      int intValue;
+      integer = vtkValueFromString(it, end, intValue) == consumed;
+    }
+    return Number;
+  }
+
+private:
+  void Add(const std::string& characters, unsigned char characterClass)
+  {
+    for (char c : characters)
+    {
+      this->Classes[static_cast<unsigned char>(c)] |= characterClass;
+    }
+  }
+
+  unsigned char Classes[256];
+  bool MergeConsecutiveDelimiters;
+  bool TrimWhitespace;
+};
+
+/// Numeric columns filled block after block by the parallel numeric parser.
+struct NumericColumns
+{
+  std::vector<vtkSmartPointer<vtkDoubleArray>> Arrays;
+  std::vector<unsigned char> Integer;
+  std::vector<std::vector<vtkIdType>> EmptyRecords;
+  vtkIdType NumberOfRecords = 0;
+};
+
+/// A range of complete records parsed by a single thread.
+struct NumericChunk
+{
+  const char* Begin;
+  const char* End;
+  vtkIdType NumberOfRecords = 0;
+  vtkIdType FirstRecord = 0;
+  std::vector<unsigned char> Integer;
+  std::vector<std::vector<vtkIdType>> EmptyRecords;
+};
+
+// Size of the pieces of a block of records parsed concurrently.
+constexpr std::ptrdiff_t NumericChunkSize = 1 << 20;
+
+// Parse the complete records in [begin, end), appending at most `maxRecords`
+// of them (0 for no limit) to the columns. Returns false if any record needs
+// the regular parser.
+bool ParseNumericBlock(const NumericTextSyntax& syntax, const char* begin, const char* end,
+  vtkIdType maxRecords, double defaultDoubleValue, NumericColumns& columns)
+{
+  // Chunks start after a record delimiter so that no record is split.
+  std::vector<NumericChunk> chunks;
+  for (const char* it = begin; it != end;)
+  {
+    const char* chunkEnd = (end - it > NumericChunkSize) ? it + NumericChunkSize : end;
+    while (chunkEnd != end && !syntax.Is(chunkEnd[-1], NumericTextSyntax::RecordDelimiter))
+    {
+      ++chunkEnd;
+    }
+    chunks.emplace_back();
+    chunks.back().Begin = it;
+    chunks.back().End = chunkEnd;
+    it = chunkEnd;
+  }
+  const vtkIdType numberOfChunks = static_cast<vtkIdType>(chunks.size());
+
+  // Count the records of each chunk to know where they go in the columns.
+  std::atomic<bool> valid(true);
+  vtkSMPTools::For(0, numberOfChunks, 1, [&](vtkIdType first, vtkIdType last) {
+    for (vtkIdType chunkId = first; chunkId < last && valid; ++chunkId)
+    {
+      NumericChunk& chunk = chunks[chunkId];
+      bool special = false;
+      for (const char* it = syntax.SkipToRecord(chunk.Begin, chunk.End); it != chunk.End;
+           it = syntax.SkipToRecord(it, chunk.End))
+      {
+        it = syntax.FindRecordEnd(it, chunk.End, special);
+        ++chunk.NumberOfRecords;
+      }
+      if (special)
+      {
+        valid = false;
+      }
+    }
+  });
+  if (!valid)
+  {
+    return false;
+  }
+
+  vtkIdType numberOfRecords = 0;
+  for (NumericChunk& chunk : chunks)
+  {
+    chunk.FirstRecord = columns.NumberOfRecords + numberOfRecords;
+    if (maxRecords)
+    {
+      chunk.NumberOfRecords =
+        std::max<vtkIdType>(0, std::min(chunk.NumberOfRecords, maxRecords - numberOfRecords));
+    }
+    numberOfRecords += chunk.NumberOfRecords;
+  }
+
+  const vtkIdType numberOfColumns = static_cast<vtkIdType>(columns.Arrays.size());
+  const vtkIdType totalNumberOfRecords = columns.NumberOfRecords + numberOfRecords;
+  std::vector<double*> values(numberOfColumns);
+  for (vtkIdType column = 0; column < numberOfColumns; ++column)
+  {
+    vtkDoubleArray* array = columns.Arrays[column];
+    // Resize keeps the values and grows the memory geometrically.
+    array->Resize(totalNumberOfRecords);
+    array->SetNumberOfTuples(totalNumberOfRecords);
+    values[column] = array->GetPointer(0);
+  }
+
+  vtkSMPTools::For(0, numberOfChunks, 1, [&](vtkIdType first, vtkIdType last) {
+    for (vtkIdType chunkId = first; chunkId < last && valid; ++chunkId)
+    {
+      NumericChunk& chunk = chunks[chunkId];
+      chunk.Integer.assign(numberOfColumns, 1);
+      chunk.EmptyRecords.resize(numberOfColumns);
+      const char* it = chunk.Begin;
+      for (vtkIdType record = chunk.FirstRecord;
+           record < chunk.FirstRecord + chunk.NumberOfRecords; ++record)
+      {
+        bool special = false;
+        it = syntax.SkipToRecord(it, chunk.End);
+        const char* recordEnd = syntax.FindRecordEnd(it, chunk.End, special);
+        const vtkIdType numberOfFields = syntax.ForEachField(it, recordEnd, recordEnd != chunk.End,
+          [&](vtkIdType column, const char* fieldBegin, const char* fieldEnd) {
+            if (column >= numberOfColumns)
+            {
+              // Extra fields are ignored, as by DelimitedTextIterator.
+              return true;
+            }
+            bool integer = chunk.Integer[column] != 0;
+            double& value = values[column][record];
+            switch (syntax.ParseField(fieldBegin, fieldEnd, value, integer))
+            {
+              case NumericTextSyntax::Number:
+                chunk.Integer[column] = integer;
+                return true;
+              case NumericTextSyntax::Empty:
+                value = defaultDoubleValue;
+                chunk.EmptyRecords[column].push_back(record);
+                return true;
+              default:
+                return false;
+            }
+          });
+        if (numberOfFields < numberOfColumns)
+        {
+          // Not a number, or missing fields that make the regular parser
+          // produce columns of different lengths.
+          valid = false;
+          return;
+        }
+        it = recordEnd;
+      }
+    }
+  });
+  if (!valid)
+  {
+    return false;
+  }
+
+  for (const NumericChunk& chunk : chunks)
+  {
+    if (chunk.NumberOfRecords == 0)
+    {
+      continue;
+    }
+    for (vtkIdType column = 0; column < numberOfColumns; ++column)
+    {
+      columns.Integer[column] &= chunk.Integer[column];
+      columns.EmptyRecords[column].insert(columns.EmptyRecords[column].end(),
+        chunk.EmptyRecords[column].begin(), chunk.EmptyRecords[column].end());
+    }
+  }
+  columns.NumberOfRecords = totalNumberOfRecords;
+  return true;
+}
+
+bool IsASCII(const std::string& characters)
+{
+  return std::all_of(characters.begin(), characters.end(),
+    [](char c) { return static_cast<unsigned char>(c) < 0x80; });
+}
+
 } // End anonymous namespace
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -329,6 +662,7 @@ vtkDelimitedTextReader::vtkDelimitedTextReader()
   this->DefaultIntegerValue = 0;
   this->DefaultDoubleValue = 0.0;
   this->TrimWhitespacePriorToNumericConversion = false;
+  this->ParallelNumericParsing = false;
 }
 
 vtkDelimitedTextReader::~vtkDelimitedTextReader()
@@ -375,6 +709,8 @@ void vtkDelimitedTextReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "DefaultDoubleValue: " << this->DefaultDoubleValue << endl;
   os << indent << "TrimWhitespacePriorToNumericConversion: "
      << (this->TrimWhitespacePriorToNumericConversion ? "true" : "false") << endl;
+  os << indent << "ParallelNumericParsing: " << (this->ParallelNumericParsing ? "true" : "false")
+     << endl;
   os << indent << "GeneratePedigreeIds: " << this->GeneratePedigreeIds << endl;
   os << indent << "PedigreeIdArrayName: " << this->PedigreeIdArrayName << endl;
   os << indent << "OutputPedigreeIds: " << (this->OutputPedigreeIds ? "true" : "false") << endl;
@@ -543,17 +879,6 @@ int vtkDelimitedTextReader::ReadData(vtkTable* output_table)
       }
     }
 
-    vtkTextCodec* transCodec = nullptr;
-
-    if (this->UnicodeCharacterSet)
-    {
-      transCodec = vtkTextCodecFactory::CodecForName(this->UnicodeCharacterSet);
-    }
-    else
-    {
-      transCodec = vtkTextCodecFactory::CodecToHandle(*input_stream_pt);
-    }
-
     char tstring[2];
     tstring[1] = '\0';
     tstring[0] = this->StringDelimiter;
@@ -567,20 +892,54 @@ int vtkDelimitedTextReader::ReadData(vtkTable* output_table)
     this->UnicodeFieldDelimiters = fieldDelimiterCharacters;
     this->UnicodeStringDelimiters = tstring;
 
-    if (nullptr == transCodec)
+    // The parallel numeric parser handles ASCII, which is also valid UTF-8,
+    // and gives up on any other byte.
+    const char* characterSet = this->UnicodeCharacterSet;
+    bool numericDataRead = false;
+    if (this->DetectNumericColumns && this->ParallelNumericParsing &&
+      (!characterSet || strcmp(characterSet, "US-ASCII") == 0 ||
+        strcmp(characterSet, "ASCII") == 0 || strcmp(characterSet, "UTF-8") == 0) &&
+      ::IsASCII(this->UnicodeRecordDelimiters) && ::IsASCII(this->UnicodeFieldDelimiters) &&
+      ::IsASCII(this->UnicodeStringDelimiters) && ::IsASCII(this->UnicodeEscapeCharacter))
     {
-      // should this use the locale instead??
-      return 1;
+      const istream::pos_type start = input_stream_pt->tellg();
+      numericDataRead = this->ReadNumericData(*input_stream_pt, output_table);
+      if (!numericDataRead)
+      {
+        output_table->Initialize();
+        input_stream_pt->clear();
+        input_stream_pt->seekg(start);
+      }
     }
 
-    DelimitedTextIterator iterator(this->MaxRecords, this->UnicodeRecordDelimiters,
-      this->UnicodeFieldDelimiters, this->UnicodeStringDelimiters, this->UnicodeWhitespace,
-      this->UnicodeEscapeCharacter, this->HaveHeaders, this->MergeConsecutiveDelimiters,
-      this->UseStringDelimiter, output_table);
+    if (!numericDataRead)
+    {
+      vtkTextCodec* transCodec = nullptr;
+
+      if (this->UnicodeCharacterSet)
+      {
+        transCodec = vtkTextCodecFactory::CodecForName(this->UnicodeCharacterSet);
+      }
+      else
+      {
+        transCodec = vtkTextCodecFactory::CodecToHandle(*input_stream_pt);
+      }
+
+      if (nullptr == transCodec)
+      {
+        // should this use the locale instead??
+        return 1;
+      }
+
+      DelimitedTextIterator iterator(this->MaxRecords, this->UnicodeRecordDelimiters,
+        this->UnicodeFieldDelimiters, this->UnicodeStringDelimiters, this->UnicodeWhitespace,
+        this->UnicodeEscapeCharacter, this->HaveHeaders, this->MergeConsecutiveDelimiters,
+        this->UseStringDelimiter, output_table);
 
-    transCodec->ToUnicode(*input_stream_pt, iterator);
-    iterator.ReachedEndOfInput();
-    transCodec->Delete();
+      transCodec->ToUnicode(*input_stream_pt, iterator);
+      iterator.ReachedEndOfInput();
+      transCodec->Delete();
+    }
 
     if (this->OutputPedigreeIds)
     {
@@ -611,7 +970,7 @@ int vtkDelimitedTextReader::ReadData(vtkTable* output_table)
       }
     }
 
-    if (this->DetectNumericColumns)
+    if (this->DetectNumericColumns && !numericDataRead)
     {
       vtkStringToNumeric* converter = vtkStringToNumeric::New();
       converter->SetForceDouble(this->ForceDouble);
@@ -643,4 +1002,145 @@ int vtkDelimitedTextReader::ReadData(vtkTable* output_table)
 
   return 1;
 }
+
+bool vtkDelimitedTextReader::ReadNumericData(istream& input_stream, vtkTable* output_table)
+{
+  // Blocks of records are read one after the other and the records of each
+  // block are parsed concurrently.
+  const std::size_t blockSize = 1 << 26;
+
+  const istream::pos_type start = input_stream.tellg();
+  input_stream.seekg(0, ios::end);
+  const double totalBytes = static_cast<double>(input_stream.tellg() - start);
+  input_stream.seekg(start);
+
+  const NumericTextSyntax syntax(this->UnicodeRecordDelimiters, this->UnicodeFieldDelimiters,
+    this->UseStringDelimiter ? this->UnicodeStringDelimiters : std::string(),
+    this->UnicodeWhitespace, this->UnicodeEscapeCharacter, this->MergeConsecutiveDelimiters,
+    this->TrimWhitespacePriorToNumericConversion);
+
+  NumericColumns columns;
+  bool haveColumns = false;
+  std::vector<char> buffer;
+  std::size_t carry = 0;
+  double bytesRead = 0;
+  for (bool done = false; !done;)
+  {
+    buffer.resize(carry + blockSize);
+    input_stream.read(buffer.data() + carry, blockSize);
+    const std::size_t count = static_cast<std::size_t>(input_stream.gcount());
+    const bool atEnd = !input_stream;
+    bytesRead += count;
+    const char* begin = buffer.data();
+    const char* end = begin + carry + count;
+
+    // The last record of the block is carried over to the next one unless
+    // the input ends there.
+    const char* complete = end;
+    if (!atEnd)
+    {
+      while (complete != begin && !syntax.Is(complete[-1], NumericTextSyntax::RecordDelimiter))
+      {
+        --complete;
+      }
+    }
+
+    const char* it = begin;
+    if (!haveColumns)
+    {
+      // The first record gives the number of columns and their names.
+      it = syntax.SkipToRecord(it, complete);
+      if (it != complete)
+      {
+        bool special = false;
+        const char* recordEnd = syntax.FindRecordEnd(it, complete, special);
+        if (special)
+        {
+          return false;
+        }
+        std::vector<std::string> names;
+        syntax.ForEachField(it, recordEnd, recordEnd != end,
+          [&](vtkIdType index, const char* fieldBegin, const char* fieldEnd) {
+            if (this->HaveHeaders)
+            {
+              names.emplace_back(fieldBegin, fieldEnd);
+            }
+            else
+            {
+              names.push_back("Field " + std::to_string(index));
+            }
+            return true;
+          });
+        if (names.empty())
+        {
+          return false;
+        }
+        for (const std::string& name : names)
+        {
+          vtkNew<vtkDoubleArray> array;
+          array->SetName(name.c_str());
+          columns.Arrays.emplace_back(array);
+        }
+        columns.Integer.assign(names.size(), 1);
+        columns.EmptyRecords.resize(names.size());
+        haveColumns = true;
+        if (this->HaveHeaders)
+        {
+          it = recordEnd;
+        }
+      }
+    }
+
+    if (haveColumns && it != complete)
+    {
+      const vtkIdType maxRecords =
+        this->MaxRecords ? this->MaxRecords - columns.NumberOfRecords : 0;
+      if (!::ParseNumericBlock(
+            syntax, it, complete, maxRecords, this->DefaultDoubleValue, columns))
+      {
+        return false;
+      }
+      done = this->MaxRecords && columns.NumberOfRecords == this->MaxRecords;
+    }
+
+    carry = static_cast<std::size_t>(end - complete);
+    std::memmove(buffer.data(), complete, carry);
+    done |= atEnd;
+    if (totalBytes > 0)
+    {
+      this->UpdateProgress(bytesRead / totalBytes);
+    }
+  }
+
+  // Same column types as vtkStringToNumeric.
+  for (std::size_t column = 0; column < columns.Arrays.size(); ++column)
+  {
+    vtkDoubleArray* doubleArray = columns.Arrays[column];
+    if (!this->ForceDouble && columns.Integer[column] && columns.NumberOfRecords)
+    {
+      for (vtkIdType record : columns.EmptyRecords[column])
+      {
+        doubleArray->SetValue(record, this->DefaultIntegerValue);
+      }
+      vtkNew<vtkIntArray> intArray;
+      intArray->SetName(doubleArray->GetName());
+      intArray->SetNumberOfTuples(columns.NumberOfRecords);
+      const double* values = doubleArray->GetPointer(0);
+      int* intValues = intArray->GetPointer(0);
+      vtkSMPTools::For(0, columns.NumberOfRecords, [&](vtkIdType first, vtkIdType last) {
+        for (vtkIdType record = first; record < last; ++record)
+        {
+          intValues[record] = static_cast<int>(values[record]);
+        }
+      });
+      output_table->AddColumn(intArray);
+    }
+    else
+    {
+      doubleArray->Squeeze();
+      output_table->AddColumn(doubleArray);
+    }
+  }
+  return true;
+}
 VTK_ABI_NAMESPACE_END
@@ -251,6 +251,22 @@ public:
   vtkGetMacro(DefaultDoubleValue, double);
   ///@}
 
+  ///@{
+  /**
+   * When set to true and DetectNumericColumns is also true, files in which
+   * every field is a number are split at record boundaries and the records
+   * are parsed concurrently, straight into vtkIntArray or vtkDoubleArray
+   * columns, without building string columns first. This only applies to
+   * ASCII or UTF-8 input with ASCII delimiters. Input that contains string
+   * delimiters, escape sequences, non-numeric fields or records with missing
+   * fields is read again with the regular parser, so the output is the same
+   * either way. Default is off.
+   */
+  vtkSetMacro(ParallelNumericParsing, bool);
+  vtkGetMacro(ParallelNumericParsing, bool);
+  vtkBooleanMacro(ParallelNumericParsing, bool);
+  ///@}
+
   ///@{
   /**
    * The name of the array for generating or assigning pedigree ids
@@ -316,6 +332,10 @@ protected:
   // Read the content of the input file.
   int ReadData(vtkTable* output_table);
 
+  // Read the content of the input stream with the parallel numeric parser.
+  // Returns false if the input needs the regular parser.
+  bool ReadNumericData(istream& input_stream, vtkTable* output_table);
+
   char* FileName;
   vtkTypeBool ReadFromInputString;
   char* InputString;
@@ -332,6 +352,7 @@ protected:
   bool TrimWhitespacePriorToNumericConversion;
   int DefaultIntegerValue;
   double DefaultDoubleValue;
+  bool ParallelNumericParsing;
   char* FieldDelimiterCharacters;
   char StringDelimiter;
   bool UseStringDelimiter;
@@ -0,0 +1,270 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// .NAME Test of sub-extent and strided reads of vtkSegYReader
+// .SECTION Description
+// Write a small 3D SEG-Y file of IBM floats with a missing trace, read it
+// whole, by sub-extents and with strides, as structured grids and as images,
+// and check that the parts match the whole.
+
+#include "vtkSegYReader.h"
+
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkImageData.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkStructuredData.h"
+#include "vtkStructuredGrid.h"
+#include "vtkTestUtilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+const int FirstCrossline = 10;
+const int NumberOfCrosslines = 16;
+const int FirstInline = 100;
+const int NumberOfInlines = 12;
+const int NumberOfSamples = 40;
+const int MissingCrossline = 17;
+const int MissingInline = 105;
+
+float SampleValue(int inlineNumber, int crosslineNumber, int sample)
+{
+  return (inlineNumber - FirstInline) * 100.0f + (crosslineNumber - FirstCrossline) -
+    sample / 8.0f;
+}
+
+void WriteBigEndian(std::vector<char>& buffer, size_t position, uint32_t value, int size)
+{
+  for (int byte = 0; byte < size; ++byte)
+  {
+    buffer[position + byte] = static_cast<char>(value >> (8 * (size - 1 - byte)));
+  }
+}
+
+uint32_t ToIBMFloat(double value)
+{
+  if (value == 0.0)
+  {
+    return 0;
+  }
+  const uint32_t sign = value < 0 ? 0x80000000u : 0u;
+  value = std::fabs(value);
+  uint32_t exponent = 64;
+  while (value >= 1.0)
+  {
+    value /= 16.0;
+    ++exponent;
+  }
+  while (value < 1.0 / 16.0)
+  {
+    value *= 16.0;
+    --exponent;
+  }
+  return sign | (exponent << 24) | static_cast<uint32_t>(value * (1 << 24));
+}
+
+void WriteSegY(const std::string& fileName)
+{
+  std::vector<char> header(3600, ' ');
+  std::fill(header.begin() + 3200, header.end(), 0);
+  WriteBigEndian(header, 3216, 4000, 2); // sample interval
+  WriteBigEndian(header, 3220, NumberOfSamples, 2);
+  WriteBigEndian(header, 3224, 1, 2); // IBM floats
+  std::ofstream out(fileName, std::ios::binary);
+  out.write(header.data(), header.size());
+
+  std::vector<char> trace(240 + 4 * NumberOfSamples);
+  for (int inlineNumber = FirstInline; inlineNumber < FirstInline + NumberOfInlines;
+       ++inlineNumber)
+  {
+    for (int crossline = FirstCrossline; crossline < FirstCrossline + NumberOfCrosslines;
+         ++crossline)
+    {
+      if (inlineNumber == MissingInline && crossline == MissingCrossline)
+      {
+        continue;
+      }
+      std::fill(trace.begin(), trace.end(), 0);
+      WriteBigEndian(trace, 8, inlineNumber, 4);
+      WriteBigEndian(trace, 20, crossline, 4);
+      WriteBigEndian(trace, 70, static_cast<uint16_t>(-10), 2); // coordinates / 10
+      WriteBigEndian(trace, 72, crossline * 250 + inlineNumber * 30, 4);
+      WriteBigEndian(trace, 76, inlineNumber * 250 - crossline * 30, 4);
+      WriteBigEndian(trace, 114, NumberOfSamples, 2);
+      WriteBigEndian(trace, 116, 4000, 2);
+      for (int sample = 0; sample < NumberOfSamples; ++sample)
+      {
+        WriteBigEndian(trace, 240 + 4 * sample,
+          ToIBMFloat(::SampleValue(inlineNumber, crossline, sample)), 4);
+      }
+      out.write(trace.data(), trace.size());
+    }
+  }
+}
+
+vtkSmartPointer<vtkDataSet> Read(
+  const std::string& fileName, bool grid, const int* stride, const int* updateExtent)
+{
+  vtkNew<vtkSegYReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->SetStructuredGrid(grid);
+  if (stride)
+  {
+    reader->SetStride(const_cast<int*>(stride));
+  }
+  if (updateExtent)
+  {
+    reader->UpdateInformation();
+    reader->UpdateExtent(updateExtent);
+  }
+  else
+  {
+    reader->Update();
+  }
+  vtkSmartPointer<vtkDataSet> output = reader->GetOutput();
+  return output;
+}
+
+int* GetExtent(vtkDataSet* dataSet)
+{
+  if (auto image = vtkImageData::SafeDownCast(dataSet))
+  {
+    return image->GetExtent();
+  }
+  return vtkStructuredGrid::SafeDownCast(dataSet)->GetExtent();
+}
+
+// Check that the points of part match those of whole, point I of the part
+// being point e0 + (I - e0) * stride of the whole, e0 the start of its extent.
+bool SamePoints(vtkDataSet* whole, vtkDataSet* part, const int stride[3], const char* what)
+{
+  int* wholeExtent = ::GetExtent(whole);
+  int* partExtent = ::GetExtent(part);
+  vtkDataArray* wholeScalars = whole->GetPointData()->GetScalars();
+  vtkDataArray* partScalars = part->GetPointData()->GetScalars();
+  if (!wholeScalars || !partScalars ||
+    partScalars->GetNumberOfTuples() != part->GetNumberOfPoints())
+  {
+    std::cerr << "Error: missing scalars in " << what << "." << std::endl;
+    return false;
+  }
+  int ijk[3];
+  for (ijk[2] = partExtent[4]; ijk[2] <= partExtent[5]; ++ijk[2])
+  {
+    for (ijk[1] = partExtent[2]; ijk[1] <= partExtent[3]; ++ijk[1])
+    {
+      for (ijk[0] = partExtent[0]; ijk[0] <= partExtent[1]; ++ijk[0])
+      {
+        int wholeIJK[3];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+          wholeIJK[axis] =
+            wholeExtent[2 * axis] + (ijk[axis] - wholeExtent[2 * axis]) * stride[axis];
+        }
+        const vtkIdType partId = vtkStructuredData::ComputePointIdForExtent(partExtent, ijk);
+        const vtkIdType wholeId =
+          vtkStructuredData::ComputePointIdForExtent(wholeExtent, wholeIJK);
+        double partPoint[3], wholePoint[3];
+        part->GetPoint(partId, partPoint);
+        whole->GetPoint(wholeId, wholePoint);
+        if (partScalars->GetTuple1(partId) != wholeScalars->GetTuple1(wholeId) ||
+          std::sqrt(vtkMath::Distance2BetweenPoints(partPoint, wholePoint)) > 1e-6)
+        {
+          std::cerr << "Error: " << what << " differs at " << ijk[0] << ", " << ijk[1] << ", "
+                    << ijk[2] << "." << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool TestOutput(const std::string& fileName, bool grid)
+{
+  const int noStride[3] = { 1, 1, 1 };
+  auto whole = ::Read(fileName, grid, nullptr, nullptr);
+  int* extent = ::GetExtent(whole);
+  const int expectedExtent[6] = { FirstCrossline, FirstCrossline + NumberOfCrosslines - 1,
+    FirstInline, FirstInline + NumberOfInlines - 1, 0, NumberOfSamples - 1 };
+  if (!std::equal(expectedExtent, expectedExtent + 6, extent))
+  {
+    std::cerr << "Error: unexpected whole extent " << extent[0] << ", " << extent[1] << ", "
+              << extent[2] << ", " << extent[3] << ", " << extent[4] << ", " << extent[5]
+              << std::endl;
+    return false;
+  }
+
+  bool success = true;
+  if (grid)
+  {
+    // The samples of the structured grid are in the order of the file.
+    vtkDataArray* scalars = whole->GetPointData()->GetScalars();
+    int ijk[3] = { MissingCrossline, MissingInline, 7 };
+    if (scalars->GetTuple1(vtkStructuredData::ComputePointIdForExtent(extent, ijk)) != 0.0)
+    {
+      std::cerr << "Error: the missing trace is not filled with zeros." << std::endl;
+      success = false;
+    }
+    ijk[0] = 21;
+    ijk[1] = 103;
+    if (scalars->GetTuple1(vtkStructuredData::ComputePointIdForExtent(extent, ijk)) !=
+      ::SampleValue(ijk[1], ijk[0], ijk[2]))
+    {
+      std::cerr << "Error: unexpected sample value." << std::endl;
+      success = false;
+    }
+  }
+
+  const int subExtents[][6] = {
+    { 12, 20, 102, 107, 5, 30 },
+    { 17, 17, 100, 111, 0, 39 },
+    { 10, 25, 105, 105, 39, 39 },
+  };
+  for (const int* subExtent : subExtents)
+  {
+    auto part = ::Read(fileName, grid, nullptr, subExtent);
+    success &= ::SamePoints(whole, part, noStride, "sub-extent");
+  }
+
+  const int strides[][3] = { { 2, 3, 4 }, { 5, 1, 7 } };
+  for (const int* stride : strides)
+  {
+    auto decimated = ::Read(fileName, grid, stride, nullptr);
+    success &= ::SamePoints(whole, decimated, stride, "decimated output");
+    const int decimatedSubExtent[6] = { 11, 13, 101, 103, 2, 4 };
+    auto part = ::Read(fileName, grid, stride, decimatedSubExtent);
+    success &= ::SamePoints(whole, part, stride, "decimated sub-extent");
+  }
+  return success;
+}
+}
+
+int TestSegYReaderSubExtent(int argc, char* argv[])
+{
+  const char* tdir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string tempDir = tdir;
+  delete[] tdir;
+  if (tempDir.empty())
+  {
+    std::cout << "Could not determine temporary directory.\n";
+    return EXIT_FAILURE;
+  }
+
+  const std::string fileName = tempDir + "/TestSegYReaderSubExtent.sgy";
+  ::WriteSegY(fileName);
+
+  bool success = ::TestOutput(fileName, true);
+  success &= ::TestOutput(fileName, false);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
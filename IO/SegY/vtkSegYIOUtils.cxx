@@ -91,13 +91,36 @@ float vtkSegYIOUtils::readIBMFloat(std::istream& in)
 {
   char buffer[4];
   in.read(buffer, sizeof(buffer));
+  return vtkSegYIOUtils::decodeIBMFloat(buffer);
+}
 
-  if (!this->IsBigEndian)
-  {
-    swap(buffer, buffer + 3);
-    swap(buffer + 1, buffer + 2);
-  }
+//------------------------------------------------------------------------------
+short vtkSegYIOUtils::decodeShortInteger(const char* buffer)
+{
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(buffer);
+  return static_cast<short>((bytes[0] << 8) | bytes[1]);
+}
+
+//------------------------------------------------------------------------------
+int vtkSegYIOUtils::decodeLongInteger(const char* buffer)
+{
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(buffer);
+  return static_cast<int>((static_cast<uint32_t>(bytes[0]) << 24) |
+    (static_cast<uint32_t>(bytes[1]) << 16) | (static_cast<uint32_t>(bytes[2]) << 8) | bytes[3]);
+}
 
+//------------------------------------------------------------------------------
+float vtkSegYIOUtils::decodeFloat(const char* buffer)
+{
+  const int bits = vtkSegYIOUtils::decodeLongInteger(buffer);
+  float num;
+  memcpy(&num, &bits, 4);
+  return num;
+}
+
+//------------------------------------------------------------------------------
+float vtkSegYIOUtils::decodeIBMFloat(const char* buffer)
+{
   // The IBM Hex single precision floating point representation:
   //
   //  1      7                           24                    (width in bits)
@@ -116,17 +139,18 @@ float vtkSegYIOUtils::readIBMFloat(std::istream& in)
   // More details at
   // https://en.m.wikipedia.org/wiki/IBM_Floating_Point_Architecture
 
-  const uint32_t* longbuffer = reinterpret_cast<uint32_t*>(buffer);
-  int sign = longbuffer[0] >> 31 & 0x01;
-  int exponent = longbuffer[0] >> 24 & 0x7F;
-  float fraction = (longbuffer[0] & 0x00ffffff) / powf(2.0f, 24.0f);
-  if (fraction == 0.0f)
+  const uint32_t bits = static_cast<uint32_t>(vtkSegYIOUtils::decodeLongInteger(buffer));
+  int sign = bits >> 31 & 0x01;
+  int exponent = bits >> 24 & 0x7F;
+  const uint32_t fraction = bits & 0x00ffffff;
+  if (fraction == 0)
   {
     // Value is 0
     return 0.0f;
   }
-  float num = (1 - 2 * sign) * fraction * powf(16.0f, exponent - 64.0f);
-  return num;
+  // 0.F * 16^(E - 64) = F * 2^(4 * (E - 64) - 24), which ldexp computes exactly
+  // unless the result is out of the range of floats.
+  return (1 - 2 * sign) * std::ldexp(static_cast<float>(fraction), 4 * (exponent - 64) - 24);
 }
 
 //------------------------------------------------------------------------------
@@ -20,6 +20,10 @@ public:
   float readFloat(std::istream& in);
   float readIBMFloat(std::istream& in);
   unsigned char readUChar(std::istream& in);
+  static short decodeShortInteger(const char* buffer);
+  static int decodeLongInteger(const char* buffer);
+  static float decodeFloat(const char* buffer);
+  static float decodeIBMFloat(const char* buffer);
   void swap(char* a, char* b) noexcept;
   static vtkSegYIOUtils* Instance();
   std::streamoff getFileSize(std::istream& in);
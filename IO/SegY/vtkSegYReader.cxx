@@ -19,6 +19,44 @@
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkSegYReader);
 
+namespace
+{
+//------------------------------------------------------------------------------
+void ClampStride(const int* stride, int clampedStride[3])
+{
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    clampedStride[axis] = std::max(1, stride[axis]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Point P of the data extent becomes point e0 + (P - e0) / stride of the output.
+void DecimateExtent(const int* dataExtent, const int stride[3], int extent[6])
+{
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    extent[2 * axis] = dataExtent[2 * axis];
+    extent[2 * axis + 1] =
+      dataExtent[2 * axis] + (dataExtent[2 * axis + 1] - dataExtent[2 * axis]) / stride[axis];
+  }
+}
+
+//------------------------------------------------------------------------------
+// Origin and spacing of the vtkImageData output, such that decimated points
+// stay where they are in the data extent.
+void ComputeImageGeometry(const double dataOrigin[3], const double dataSpacing[3][3],
+  const int* dataExtent, const int stride[3], double origin[3], double spacing[3])
+{
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const double norm = vtkMath::Norm(dataSpacing[axis]);
+    spacing[axis] = norm * stride[axis];
+    origin[axis] = dataOrigin[axis] + dataExtent[2 * axis] * (1 - stride[axis]) * norm;
+  }
+}
+}
+
 //------------------------------------------------------------------------------
 vtkSegYReader::vtkSegYReader()
 {
@@ -40,6 +78,7 @@ vtkSegYReader::vtkSegYReader()
   this->YCoordByte = 77;
 
   this->VerticalCRS = VTK_SEGY_VERTICAL_HEIGHTS;
+  std::fill(this->Stride, this->Stride + 3, 1);
 }
 
 //------------------------------------------------------------------------------
@@ -71,6 +110,8 @@ void vtkSegYReader::SetXYCoordModeToCustom()
 void vtkSegYReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   Superclass::PrintSelf(os, indent);
+  os << indent << "Stride: " << this->Stride[0] << ", " << this->Stride[1] << ", "
+     << this->Stride[2] << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -113,18 +154,67 @@ int vtkSegYReader::RequestData(vtkInformation* vtkNotUsed(request),
       return 1;
     }
   }
-  this->Reader->LoadTraces(this->DataExtent);
+
+  int stride[3];
+  ::ClampStride(this->Stride, stride);
+  int wholeExtent[6];
+  ::DecimateExtent(this->DataExtent, stride, wholeExtent);
+  int updateExtent[6];
+  std::copy(wholeExtent, wholeExtent + 6, updateExtent);
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT()))
+  {
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), updateExtent);
+  }
+
+  // Only read the traces and the samples of the update extent. The vtkImageData
+  // output flips the axes along which the spacing of the data is negative.
+  const bool image = this->Is3D && !this->StructuredGrid;
+  int first[3], step[3], count[3];
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    updateExtent[2 * axis] = std::max(updateExtent[2 * axis], wholeExtent[2 * axis]);
+    updateExtent[2 * axis + 1] = std::min(updateExtent[2 * axis + 1], wholeExtent[2 * axis + 1]);
+    if (updateExtent[2 * axis] > updateExtent[2 * axis + 1])
+    {
+      return 1;
+    }
+    count[axis] = updateExtent[2 * axis + 1] - updateExtent[2 * axis] + 1;
+    const int point = (updateExtent[2 * axis] - wholeExtent[2 * axis]) * stride[axis];
+    if (image && this->DataSpacingSign[axis] < 0)
+    {
+      first[axis] = this->DataExtent[2 * axis + 1] - this->DataExtent[2 * axis] - point;
+      step[axis] = -stride[axis];
+    }
+    else
+    {
+      first[axis] = point;
+      step[axis] = stride[axis];
+    }
+  }
+
+  if (!this->Reader->In.is_open())
+  {
+    this->Reader->In.open(this->FileName, std::ios::binary);
+    if (!this->Reader->In)
+    {
+      vtkErrorMacro("File not found:" << this->FileName);
+      return 0;
+    }
+  }
+  this->Reader->LoadTraces(first, step, count);
   this->UpdateProgress(0.5);
-  if (this->Is3D && !this->StructuredGrid)
+  if (image)
   {
     vtkImageData* imageData = vtkImageData::SafeDownCast(output);
-    this->Reader->ExportData(
-      imageData, this->DataExtent, this->DataOrigin, this->DataSpacing, this->DataSpacingSign);
+    double origin[3], spacing[3];
+    ::ComputeImageGeometry(
+      this->DataOrigin, this->DataSpacing, this->DataExtent, stride, origin, spacing);
+    this->Reader->ExportData(imageData, updateExtent, origin, spacing);
   }
   else
   {
     vtkStructuredGrid* grid = vtkStructuredGrid::SafeDownCast(output);
-    this->Reader->ExportData(grid, this->DataExtent, this->DataOrigin, this->DataSpacing);
+    this->Reader->ExportData(grid, updateExtent, first, step, this->DataOrigin, this->DataSpacing);
     grid->Squeeze();
   }
   this->Reader->In.close();
@@ -142,12 +232,18 @@ int vtkSegYReader::RequestInformation(vtkInformation* vtkNotUsed(request),
     return 0;
   }
 
-  outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), this->DataExtent, 6);
+  int stride[3];
+  ::ClampStride(this->Stride, stride);
+  int wholeExtent[6];
+  ::DecimateExtent(this->DataExtent, stride, wholeExtent);
+  outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent, 6);
+  outInfo->Set(vtkAlgorithm::CAN_PRODUCE_SUB_EXTENT(), 1);
   if (this->Is3D && !this->StructuredGrid)
   {
-    double spacing[3] = { vtkMath::Norm(this->DataSpacing[0]), vtkMath::Norm(this->DataSpacing[1]),
-      vtkMath::Norm(this->DataSpacing[2]) };
-    outInfo->Set(vtkDataObject::ORIGIN(), this->DataOrigin, 3);
+    double origin[3], spacing[3];
+    ::ComputeImageGeometry(
+      this->DataOrigin, this->DataSpacing, this->DataExtent, stride, origin, spacing);
+    outInfo->Set(vtkDataObject::ORIGIN(), origin, 3);
     outInfo->Set(vtkDataObject::SPACING(), spacing, 3);
   }
   return 1;
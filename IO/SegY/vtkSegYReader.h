@@ -24,6 +24,10 @@ class vtkSegYReaderInternal;
  * data may not be correct. The axes for the data are: crossline,
  * inline, depth. For situations where traces are missing values of
  * zero are used to fill in the dataset.
+ *
+ * The reader produces sub-extents: only the traces and the samples of the
+ * requested update extent are read from the file, which allows browsing
+ * parts of large files. Stride decimates the output for previews.
  */
 class VTKIOSEGY_EXPORT vtkSegYReader : public vtkDataSetAlgorithm
 {
@@ -121,6 +125,16 @@ public:
   vtkBooleanMacro(Force2D, bool);
   ///@}
 
+  ///@{
+  /**
+   * Subsampling of the output along the crossline, inline and sample axes.
+   * Only every Stride[i]-th trace or sample is read, and the whole extent of
+   * the output shrinks accordingly. The default is 1, 1, 1 (no subsampling).
+   */
+  vtkSetVector3Macro(Stride, int);
+  vtkGetVector3Macro(Stride, int);
+  ///@}
+
 protected:
   int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
     vtkInformationVector* outputVector) override;
@@ -149,6 +163,8 @@ protected:
 
   bool Force2D;
 
+  int Stride[3];
+
 private:
   vtkSegYReader(const vtkSegYReader&) = delete;
   void operator=(const vtkSegYReader&) = delete;
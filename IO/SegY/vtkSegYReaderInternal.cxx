@@ -9,6 +9,7 @@
 #include "vtkMath.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSegYBinaryHeaderBytesPositions.h"
 #include "vtkSegYIOUtils.h"
 #include "vtkSegYTraceReader.h"
@@ -25,10 +26,32 @@ VTK_ABI_NAMESPACE_BEGIN
 namespace
 {
 const int FIRST_TRACE_START_POS = 3600; // this->Traces start after 3200 + 400 file header
+// Number of traces read before their samples are converted concurrently.
+const size_t TRACE_BATCH_SIZE = 1024;
 double decodeMultiplier(short multiplier)
 {
   return (multiplier < 0) ? (-1.0 / multiplier) : (multiplier > 0 ? multiplier : 1.0);
 }
+
+bool isSupportedFormat(int formatCode)
+{
+  return formatCode == 1 || formatCode == 3 || formatCode == 5 || formatCode == 8;
+}
+
+float decodeSample(int formatCode, const char* buffer)
+{
+  switch (formatCode)
+  {
+    case 1:
+      return vtkSegYIOUtils::decodeIBMFloat(buffer);
+    case 3:
+      return vtkSegYIOUtils::decodeShortInteger(buffer);
+    case 5:
+      return vtkSegYIOUtils::decodeFloat(buffer);
+    default:
+      return *buffer;
+  }
+}
 }
 
 //------------------------------------------------------------------------------
@@ -40,6 +63,7 @@ vtkSegYReaderInternal::vtkSegYReaderInternal()
   this->BinaryHeaderBytesPos = new vtkSegYBinaryHeaderBytesPositions();
   this->VerticalCRS = 0;
   this->TraceReader = new vtkSegYTraceReader();
+  this->TraceGridDimensions[0] = this->TraceGridDimensions[1] = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -47,10 +71,17 @@ vtkSegYReaderInternal::~vtkSegYReaderInternal()
 {
   delete this->BinaryHeaderBytesPos;
   delete this->TraceReader;
+  this->ClearTraces();
+}
+
+//------------------------------------------------------------------------------
+void vtkSegYReaderInternal::ClearTraces()
+{
   for (auto trace : this->Traces)
   {
     delete trace;
   }
+  this->Traces.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -66,28 +97,87 @@ void vtkSegYReaderInternal::SetVerticalCRS(int v)
 }
 
 //------------------------------------------------------------------------------
-void vtkSegYReaderInternal::LoadTraces(int* extent)
+void vtkSegYReaderInternal::LoadTraces(const int first[3], const int step[3], const int count[3])
 {
-  std::streamoff traceStartPos = FIRST_TRACE_START_POS;
-  std::streamoff fileSize = vtkSegYIOUtils::Instance()->getFileSize(this->In);
-
-  // allocate traces vector
-  int dims[3] = { extent[1] - extent[0] + 1, extent[3] - extent[2] + 1, extent[5] - extent[4] + 1 };
+  this->ClearTraces();
+  this->Traces.resize(static_cast<size_t>(count[0]) * count[1], nullptr);
 
-  bool is3d = extent[3] - extent[2] > 1;
-  this->Traces.resize(dims[0] * dims[1], nullptr);
-  size_t traceCount = 0;
-  while (traceStartPos + 240 < fileSize)
+  const bool supported = isSupportedFormat(this->FormatCode);
+  if (!supported)
+  {
+    std::cerr << "Data sample format code " << this->FormatCode << " not supported." << std::endl;
+  }
+  const int sampleSize = supported ? this->TraceReader->GetTraceSize(1, this->FormatCode) : 0;
+
+  // Range of samples read from each trace.
+  const int lastSample = first[2] + (count[2] - 1) * step[2];
+  const int minSample = std::min(first[2], lastSample);
+  const int maxSample = std::max(first[2], lastSample);
+  const size_t rangeSize = static_cast<size_t>(maxSample - minSample + 1) * sampleSize;
+
+  // The traces are read in batches, one after the other, and the samples of
+  // each batch are converted concurrently.
+  std::vector<char> samples;
+  std::vector<int> sampleCounts;
+  for (size_t batchStart = 0; batchStart < this->Traces.size(); batchStart += TRACE_BATCH_SIZE)
   {
-    vtkSegYTrace* pTrace = new vtkSegYTrace();
-    this->TraceReader->ReadTrace(traceStartPos, this->In, this->FormatCode, pTrace);
-    size_t loc = traceCount;
-    if (is3d)
+    const size_t batchEnd = std::min(batchStart + TRACE_BATCH_SIZE, this->Traces.size());
+    samples.resize((batchEnd - batchStart) * rangeSize);
+    sampleCounts.assign(batchEnd - batchStart, 0);
+    for (size_t index = batchStart; index < batchEnd; ++index)
     {
-      loc = pTrace->CrosslineNumber - extent[0] + (pTrace->InlineNumber - extent[2]) * dims[0];
+      const int traceI = first[0] + static_cast<int>(index % count[0]) * step[0];
+      const int traceJ = first[1] + static_cast<int>(index / count[0]) * step[1];
+      if (traceI < 0 || traceI >= this->TraceGridDimensions[0] || traceJ < 0 ||
+        traceJ >= this->TraceGridDimensions[1])
+      {
+        continue;
+      }
+      const std::streamoff position =
+        this->TracePositions[traceI + static_cast<size_t>(traceJ) * this->TraceGridDimensions[0]];
+      if (position < 0)
+      {
+        continue;
+      }
+
+      this->In.clear();
+      vtkSegYTrace* trace = new vtkSegYTrace();
+      this->Traces[index] = trace;
+      const int numSamples = this->TraceReader->ReadTraceHeader(position, this->In, trace);
+      sampleCounts[index - batchStart] = numSamples;
+      const int readEnd = std::min(maxSample + 1, numSamples);
+      if (readEnd > minSample && sampleSize > 0)
+      {
+        this->In.seekg(position + 240 + static_cast<std::streamoff>(minSample) * sampleSize,
+          std::istream::beg);
+        this->In.read(samples.data() + (index - batchStart) * rangeSize,
+          static_cast<std::streamsize>(readEnd - minSample) * sampleSize);
+      }
     }
-    this->Traces[loc] = pTrace;
-    traceCount++;
+
+    const vtkIdType batchSize = static_cast<vtkIdType>(batchEnd - batchStart);
+    vtkSMPTools::For(0, batchSize, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType batchIndex = begin; batchIndex < end; ++batchIndex)
+      {
+        vtkSegYTrace* trace = this->Traces[batchStart + batchIndex];
+        if (!trace)
+        {
+          continue;
+        }
+        trace->Data.assign(count[2], 0.0f);
+        const char* buffer = samples.data() + batchIndex * rangeSize;
+        const int numSamples = sampleCounts[batchIndex];
+        for (int k = 0; k < count[2]; ++k)
+        {
+          const int sample = first[2] + k * step[2];
+          if (supported && sample < numSamples)
+          {
+            trace->Data[k] =
+              decodeSample(this->FormatCode, buffer + (sample - minSample) * sampleSize);
+          }
+        }
+      }
+    });
   }
 }
 
@@ -110,11 +200,18 @@ bool vtkSegYReaderInternal::Is3DComputeParameters(
   this->ReadHeader();
   std::streamoff traceStartPos = FIRST_TRACE_START_POS;
   std::streamoff fileSize = vtkSegYIOUtils::Instance()->getFileSize(this->In);
-  int inlineNumber = 0, crosslineNumber;
-  int xCoord = 0, yCoord = 0;
-  short coordMultiplier = 0;
+  vtkSegYTrace header;
 
   size_t traceCount = 0;
+  std::vector<std::streamoff> positions;
+  std::vector<std::array<int, 2>> lineNumbers;
+  // Read the header of the next trace and move to the following one.
+  auto readNextTraceHeader = [&]() {
+    positions.push_back(traceStartPos);
+    const int numSamples = this->TraceReader->ReadTraceHeader(traceStartPos, this->In, &header);
+    traceStartPos += 240 + this->TraceReader->GetTraceSize(numSamples, this->FormatCode);
+    traceCount++;
+  };
 
   // for the forced 2D case we ignore lines/crosslines and just stitch together the
   // traces in order applying their x,y coordinates
@@ -122,10 +219,11 @@ bool vtkSegYReaderInternal::Is3DComputeParameters(
   {
     while (traceStartPos + 240 < fileSize)
     {
-      this->TraceReader->ReadInlineCrossline(traceStartPos, this->In, this->FormatCode,
-        &inlineNumber, &crosslineNumber, &xCoord, &yCoord, &coordMultiplier);
-      traceCount++;
+      readNextTraceHeader();
     }
+    this->TracePositions = std::move(positions);
+    this->TraceGridDimensions[0] = static_cast<int>(traceCount);
+    this->TraceGridDimensions[1] = 1;
     extent[0] = 0;
     extent[1] = static_cast<int>(traceCount - 1);
     extent[2] = 0;
@@ -149,10 +247,13 @@ bool vtkSegYReaderInternal::Is3DComputeParameters(
 
   while (traceStartPos + 240 < fileSize)
   {
-    this->TraceReader->ReadInlineCrossline(traceStartPos, this->In, this->FormatCode, &inlineNumber,
-      &crosslineNumber, &xCoord, &yCoord, &coordMultiplier);
-    traceCount++;
-    double coordinateMultiplier = decodeMultiplier(coordMultiplier);
+    readNextTraceHeader();
+    const int inlineNumber = header.InlineNumber;
+    const int crosslineNumber = header.CrosslineNumber;
+    const int xCoord = header.XCoordinate;
+    const int yCoord = header.YCoordinate;
+    lineNumbers.push_back({ crosslineNumber, inlineNumber });
+    double coordinateMultiplier = decodeMultiplier(header.CoordinateMultiplier);
 
     // store a third point, must have different basis from
     // first two
@@ -229,9 +330,24 @@ bool vtkSegYReaderInternal::Is3DComputeParameters(
       extent[0] = 0;
       extent[1] = static_cast<int>(traceCount) - 1;
     }
+    // the traces are placed in the order of the file
+    this->TracePositions = std::move(positions);
+    this->TraceGridDimensions[0] = static_cast<int>(traceCount);
+    this->TraceGridDimensions[1] = 1;
     return false;
   }
 
+  // place the traces by crossline and inline numbers
+  this->TraceGridDimensions[0] = crosslineCount;
+  this->TraceGridDimensions[1] = inlineCount;
+  this->TracePositions.assign(static_cast<size_t>(crosslineCount) * inlineCount, -1);
+  for (size_t trace = 0; trace < traceCount; ++trace)
+  {
+    this->TracePositions[(lineNumbers[trace][0] - startCross) +
+      static_cast<size_t>(lineNumbers[trace][1] - startInline) * crosslineCount] =
+      positions[trace];
+  }
+
   // compute the mapping of indices into coords if we have three
   if (basisPointCount == 3)
   {
@@ -285,40 +401,35 @@ bool vtkSegYReaderInternal::Is3DComputeParameters(
 
 //------------------------------------------------------------------------------
 void vtkSegYReaderInternal::ExportData(
-  vtkImageData* imageData, int* extent, double origin[3], double spacing[3][3], int* spacingSign)
+  vtkImageData* imageData, int* extent, double origin[3], double spacing[3])
 {
   imageData->SetExtent(extent);
   imageData->SetOrigin(origin);
-  imageData->SetSpacing(
-    vtkMath::Norm(spacing[0]), vtkMath::Norm(spacing[1]), vtkMath::Norm(spacing[2]));
+  imageData->SetSpacing(spacing);
   const int* dims = imageData->GetDimensions();
 
   vtkNew<vtkFloatArray> scalars;
   scalars->SetNumberOfComponents(1);
-  scalars->SetNumberOfTuples(dims[0] * dims[1] * dims[2]);
+  scalars->SetNumberOfTuples(static_cast<vtkIdType>(dims[0]) * dims[1] * dims[2]);
   scalars->SetName("trace");
   imageData->GetPointData()->SetScalars(scalars);
-  int id = 0;
-  int destK, destJ, destI;
-  for (int k = 0; k < dims[2]; ++k)
-  {
-    destK = (spacingSign[2] > 0 ? k : dims[2] - k - 1);
-    for (int j = 0; j < dims[1]; ++j)
+  float* values = scalars->GetPointer(0);
+  const vtkIdType sliceSize = static_cast<vtkIdType>(dims[0]) * dims[1];
+  vtkSMPTools::For(0, dims[2], [&](vtkIdType kBegin, vtkIdType kEnd) {
+    for (vtkIdType k = kBegin; k < kEnd; ++k)
     {
-      destJ = (spacingSign[1] > 0 ? j : dims[1] - j - 1);
-      for (int i = 0; i < dims[0]; ++i)
+      for (vtkIdType id = 0; id < sliceSize; ++id)
       {
-        destI = (spacingSign[0] > 0 ? i : dims[0] - i - 1);
-        vtkSegYTrace* trace = this->Traces[destJ * dims[0] + destI];
-        scalars->SetValue(id++, trace ? trace->Data[destK] : 0.0);
+        vtkSegYTrace* trace = this->Traces[id];
+        values[k * sliceSize + id] = trace ? trace->Data[k] : 0.0f;
       }
     }
-  }
+  });
 }
 
 //------------------------------------------------------------------------------
-void vtkSegYReaderInternal::ExportData(
-  vtkStructuredGrid* grid, int* extent, double origin[3], double spacing[3][3])
+void vtkSegYReaderInternal::ExportData(vtkStructuredGrid* grid, int* extent, const int first[3],
+  const int step[3], double origin[3], double spacing[3][3])
 {
   if (!grid)
   {
@@ -332,26 +443,29 @@ void vtkSegYReaderInternal::ExportData(
   vtkNew<vtkFloatArray> scalars;
   scalars->SetName("trace");
   scalars->SetNumberOfComponents(1);
-  scalars->Allocate(dims[0] * dims[1] * dims[2]);
+  scalars->Allocate(static_cast<vtkIdType>(dims[0]) * dims[1] * dims[2]);
 
   int sign = this->VerticalCRS == 0 ? -1 : 1;
   int id = 0;
   for (int k = 0; k < dims[2]; ++k)
   {
+    const int sample = first[2] + k * step[2];
     for (int j = 0; j < dims[1]; ++j)
     {
+      const int traceJ = first[1] + j * step[1];
       for (int i = 0; i < dims[0]; ++i)
       {
+        const int traceI = first[0] + i * step[0];
         auto trace = this->Traces[j * dims[0] + i];
-        double x = origin[0] + i * spacing[0][0] + j * spacing[1][0];
-        double y = origin[1] + i * spacing[0][1] + j * spacing[1][1];
-        double z = sign * k * spacing[2][2];
+        double x = origin[0] + traceI * spacing[0][0] + traceJ * spacing[1][0];
+        double y = origin[1] + traceI * spacing[0][1] + traceJ * spacing[1][1];
+        double z = sign * sample * spacing[2][2];
         if (trace)
         {
           double coordinateMultiplier = decodeMultiplier(trace->CoordinateMultiplier);
           x = coordinateMultiplier * trace->XCoordinate;
           y = coordinateMultiplier * trace->YCoordinate;
-          z = sign * k * (trace->SampleInterval / 1000.0);
+          z = sign * sample * (trace->SampleInterval / 1000.0);
 
           scalars->InsertValue(id++, trace->Data[k]);
         }
@@ -29,11 +29,16 @@ public:
 
   bool Is3DComputeParameters(
     int* extent, double origin[3], double spacing[3][3], int* spacingSign, bool force2D);
-  void LoadTraces(int* extent);
 
-  void ExportData(
-    vtkImageData*, int* extent, double origin[3], double spacing[3][3], int* spacingSign);
-  void ExportData(vtkStructuredGrid*, int* extent, double origin[3], double spacing[3][3]);
+  // Read the count[axis] traces, or samples, first[axis] + i * step[axis] along
+  // each axis, indices being counted from the start of the whole extent. Only
+  // the traces and the range of samples needed are read, and the samples are
+  // converted concurrently.
+  void LoadTraces(const int first[3], const int step[3], const int count[3]);
+
+  void ExportData(vtkImageData*, int* extent, double origin[3], double spacing[3]);
+  void ExportData(vtkStructuredGrid*, int* extent, const int first[3], const int step[3],
+    double origin[3], double spacing[3][3]);
 
   void SetXYCoordBytePositions(int x, int y);
   void SetVerticalCRS(int);
@@ -44,7 +49,14 @@ protected:
   bool ReadHeader();
 
 private:
+  void ClearTraces();
+
+  // Loaded traces of the sub-extent, nullptr where a trace is missing.
   std::vector<vtkSegYTrace*> Traces;
+  // Position in the file of the traces of the whole extent, -1 where a trace
+  // is missing, with TraceGridDimensions traces along the first two axes.
+  std::vector<std::streamoff> TracePositions;
+  int TraceGridDimensions[2];
   vtkSegYBinaryHeaderBytesPositions* BinaryHeaderBytesPos;
   vtkSegYTraceReader* TraceReader;
   int VerticalCRS;
@@ -69,23 +69,37 @@ void vtkSegYTraceReader::PrintTraceHeader(std::istream& in, int startPos)
 }
 
 //------------------------------------------------------------------------------
-void vtkSegYTraceReader::ReadTrace(
-  std::streamoff& startPos, std::istream& in, int formatCode, vtkSegYTrace* trace)
+int vtkSegYTraceReader::ReadTraceHeader(
+  std::streamoff startPos, std::istream& in, vtkSegYTrace* trace)
 {
+  // Read the whole header at once rather than seeking to each field.
+  char header[240];
+  in.seekg(startPos, std::istream::beg);
+  in.read(header, sizeof(header));
   trace->InlineNumber =
-    vtkSegYIOUtils::Instance()->readLongInteger(startPos + traceHeaderBytesPos.InlineNumber, in);
+    vtkSegYIOUtils::decodeLongInteger(header + traceHeaderBytesPos.InlineNumber);
   trace->CrosslineNumber =
-    vtkSegYIOUtils::Instance()->readLongInteger(startPos + traceHeaderBytesPos.CrosslineNumber, in);
-  int numSamples =
-    vtkSegYIOUtils::Instance()->readShortInteger(startPos + traceHeaderBytesPos.NumberSamples, in);
-  trace->CoordinateMultiplier = vtkSegYIOUtils::Instance()->readShortInteger(
-    startPos + traceHeaderBytesPos.CoordinateMultiplier, in);
-  trace->XCoordinate =
-    vtkSegYIOUtils::Instance()->readLongInteger(startPos + this->XCoordinate, in);
-  trace->YCoordinate =
-    vtkSegYIOUtils::Instance()->readLongInteger(startPos + this->YCoordinate, in);
+    vtkSegYIOUtils::decodeLongInteger(header + traceHeaderBytesPos.CrosslineNumber);
+  trace->CoordinateMultiplier =
+    vtkSegYIOUtils::decodeShortInteger(header + traceHeaderBytesPos.CoordinateMultiplier);
+  // Custom coordinate byte positions may lie outside of the header.
+  auto readCoordinate = [&](int position) {
+    return (position >= 0 && position + 4 <= static_cast<int>(sizeof(header)))
+      ? vtkSegYIOUtils::decodeLongInteger(header + position)
+      : vtkSegYIOUtils::Instance()->readLongInteger(startPos + position, in);
+  };
+  trace->XCoordinate = readCoordinate(this->XCoordinate);
+  trace->YCoordinate = readCoordinate(this->YCoordinate);
   trace->SampleInterval =
-    vtkSegYIOUtils::Instance()->readShortInteger(startPos + traceHeaderBytesPos.SampleInterval, in);
+    vtkSegYIOUtils::decodeShortInteger(header + traceHeaderBytesPos.SampleInterval);
+  return vtkSegYIOUtils::decodeShortInteger(header + traceHeaderBytesPos.NumberSamples);
+}
+
+//------------------------------------------------------------------------------
+void vtkSegYTraceReader::ReadTrace(
+  std::streamoff& startPos, std::istream& in, int formatCode, vtkSegYTrace* trace)
+{
+  int numSamples = this->ReadTraceHeader(startPos, in, trace);
 
   in.seekg(startPos + 240, std::istream::beg);
   float value;
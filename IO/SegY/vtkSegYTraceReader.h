@@ -44,6 +44,8 @@ public:
   void SetXYCoordBytePositions(int x, int y);
   void PrintTraceHeader(std::istream& in, int startPos);
   void ReadTrace(std::streamoff& startPos, std::istream& in, int formatCode, vtkSegYTrace* trace);
+  // Read the header of the trace starting at startPos, returns its number of samples.
+  int ReadTraceHeader(std::streamoff startPos, std::istream& in, vtkSegYTrace* trace);
   void ReadInlineCrossline(std::streamoff& startPos, std::istream& in, int formatCode,
     int* inlineNumber, int* crosslineNumber, int* xCoord, int* yCoord, short* coordMultiplier);
 